@@ -5,8 +5,13 @@ option(ENABLE_PROFILING, "Enables various options to make profiling easier" OFF)
 
 option(KEEP_FRAME_POINTER, "Add keep frame pointer for profiling" OFF)
 
+option(DATABOX_PROFILING
+  "Record the number, time and size of evaluations of DataBox compute items"
+  OFF)
+
 add_library(Profiling::KeepFramePointer IMPORTED INTERFACE)
 add_library(Profiling::EnableProfiling IMPORTED INTERFACE)
+add_library(Profiling::DataBoxProfiling IMPORTED INTERFACE)
 
 if (KEEP_FRAME_POINTER OR ENABLE_PROFILING)
   set_property(
@@ -27,9 +32,19 @@ if (ENABLE_PROFILING)
     )
 endif()
 
+if (DATABOX_PROFILING)
+  set_property(
+    TARGET Profiling::DataBoxProfiling
+    APPEND PROPERTY
+    INTERFACE_COMPILE_DEFINITIONS
+    $<$<COMPILE_LANGUAGE:CXX>:SPECTRE_DATABOX_PROFILING>
+    )
+endif()
+
 target_link_libraries(
   SpectreFlags
   INTERFACE
+  Profiling::DataBoxProfiling
   Profiling::EnableProfiling
   Profiling::KeepFramePointer
   )
@@ -0,0 +1,21 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/DataBox/ComputeItemPacking.hpp"
+
+namespace db {
+namespace {
+bool& mutable_pack_compute_item_values() noexcept {
+  thread_local bool pack_values = true;
+  return pack_values;
+}
+}  // namespace
+
+bool pack_compute_item_values() noexcept {
+  return mutable_pack_compute_item_values();
+}
+
+void set_pack_compute_item_values(const bool pack_values) noexcept {
+  mutable_pack_compute_item_values() = pack_values;
+}
+}  // namespace db
@@ -0,0 +1,25 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+namespace db {
+/// \ingroup DataBoxGroup
+/// \brief Whether serializing a DataBox on this PE writes the values of
+/// evaluated compute items.
+///
+/// \details Compute items can always be recomputed from the items they depend
+/// on, so their values need not be serialized. Skipping them makes the
+/// serialized DataBoxes smaller, e.g. when writing checkpoints, at the cost of
+/// reevaluating the compute items when they are first retrieved after
+/// deserialization. The setting applies to every `PUP::er`, i.e. to sizing
+/// and packing into memory or to disk alike, and is kept per thread, i.e. per
+/// PE. By default the values are written so that migrating elements and
+/// sending DataBoxes doesn't cause any recomputation.
+bool pack_compute_item_values() noexcept;
+
+/// \ingroup DataBoxGroup
+/// \brief Set whether serializing a DataBox on this PE writes the values of
+/// evaluated compute items. See `db::pack_compute_item_values`.
+void set_pack_compute_item_values(bool pack_values) noexcept;
+}  // namespace db
@@ -155,6 +155,36 @@ struct create_dependency_graph {
                       create_subitem_reverse_edge<tmpl::_1>>;
   using type = tmpl::append<compute_tag_argument_edges, subitem_reverse_edges>;
 };
+
+// The items that directly depend on any of the `SourceTagsList`
+template <typename EdgeList, typename SourceTagsList>
+using direct_dependents = tmpl::remove_duplicates<tmpl::transform<
+    tmpl::filter<EdgeList,
+                 tmpl::bind<tmpl::list_contains, tmpl::pin<SourceTagsList>,
+                            tmpl::get_source<tmpl::_1>>>,
+    tmpl::get_destination<tmpl::_1>>>;
+
+// The items that directly or indirectly depend on the `FrontierTagsList`,
+// computed by a breadth-first traversal of the dependency graph. Every item
+// appears exactly once, so resetting them is a single pass.
+template <typename EdgeList, typename FoundTagsList, typename FrontierTagsList>
+struct all_dependents_impl {
+  using found = tmpl::append<FoundTagsList, FrontierTagsList>;
+  using type = typename all_dependents_impl<
+      EdgeList, found,
+      tmpl::list_difference<direct_dependents<EdgeList, FrontierTagsList>,
+                            found>>::type;
+};
+
+template <typename EdgeList, typename FoundTagsList>
+struct all_dependents_impl<EdgeList, FoundTagsList, tmpl::list<>> {
+  using type = FoundTagsList;
+};
+
+template <typename EdgeList, typename MutatedTagsList>
+using all_dependents = typename all_dependents_impl<
+    EdgeList, tmpl::list<>,
+    direct_dependents<EdgeList, MutatedTagsList>>::type;
 }  // namespace detail
 
 /*!
@@ -340,9 +370,6 @@ class DataBox<tmpl::list<Tags...>> : private detail::Item<Tags>... {
   template <typename... TagsOfImmutableItemsToReset>
   SPECTRE_ALWAYS_INLINE constexpr void reset_compute_items_after_mutate(
       tmpl::list<TagsOfImmutableItemsToReset...> /*meta*/) noexcept;
-
-  SPECTRE_ALWAYS_INLINE constexpr void reset_compute_items_after_mutate(
-      tmpl::list<> /*meta*/) noexcept {}
   // End mutating items in the DataBox
 
   using edge_list =
@@ -557,31 +584,18 @@ DataBox<tmpl::list<Tags...>>::reset_compute_item() noexcept {
   }
 }
 
-// This function recursively calls itself to reset all compute items
-// that depended upon the mutated items.  It starts with
-// TagsOfImmutableItemsToReset as the tags of the immutable items that directly
-// depended upon the mutated items.  This function resets the compute items in
-// TagsOfImmutableItemsToReset and then constructs the list of immutable items
-// that directly depend on TagsOfImmutableItemsToReset which will become the
-// TagsOfImmutableItemsToReset on the next invocation of the function.  The
-// recursion terminates when TagsOfImmutableItemsToReset becomes an empty list
-// (using the function overload inlined above in the definition of DataBox).
+// Resets the compute items in TagsOfImmutableItemsToReset, which is the full
+// set of immutable items that directly or indirectly depend on the mutated
+// items (see detail::all_dependents). The set is computed at compile time so
+// every item is reset exactly once. Resetting only marks the item as not
+// evaluated; its value is kept so that its memory is reused when it is
+// recomputed.
 template <typename... Tags>
 template <typename... TagsOfImmutableItemsToReset>
 SPECTRE_ALWAYS_INLINE constexpr void
 db::DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate(
     tmpl::list<TagsOfImmutableItemsToReset...> /*meta*/) noexcept {
   EXPAND_PACK_LEFT_TO_RIGHT(reset_compute_item<TagsOfImmutableItemsToReset>());
-  using current_tags_to_reset = tmpl::list<TagsOfImmutableItemsToReset...>;
-  using next_compute_tags_to_reset = tmpl::list_difference<
-      tmpl::remove_duplicates<tmpl::transform<
-          tmpl::append<
-              tmpl::filter<typename DataBox<tmpl::list<Tags...>>::edge_list,
-                           std::is_same<tmpl::pin<TagsOfImmutableItemsToReset>,
-                                        tmpl::get_source<tmpl::_1>>>...>,
-          tmpl::get_destination<tmpl::_1>>>,
-      current_tags_to_reset>;
-  reset_compute_items_after_mutate(next_compute_tags_to_reset{});
 }
 
 template <typename... Tags>
@@ -665,17 +679,15 @@ void mutate(const gsl::not_null<DataBox<TagList>*> box, Invokable&& invokable,
       tmpl::append<detail::expand_subitems<mutate_tags_list>,
                    extra_mutated_tags>;
 
-  using first_compute_items_to_reset = tmpl::remove_duplicates<
-      tmpl::transform<tmpl::filter<typename DataBox<TagList>::edge_list,
-                                   tmpl::bind<tmpl::list_contains,
-                                              tmpl::pin<full_mutated_items>,
-                                              tmpl::get_source<tmpl::_1>>>,
-                      tmpl::get_destination<tmpl::_1>>>;
+  // All the items depending on any of the mutated items are reset in a
+  // single pass, no matter how many tags are mutated.
+  using compute_items_to_reset =
+      detail::all_dependents<typename DataBox<TagList>::edge_list,
+                             full_mutated_items>;
 
   EXPAND_PACK_LEFT_TO_RIGHT(box->template mutate_mutable_subitems<MutateTags>(
       typename Subitems<MutateTags>::type{}));
-  box->template reset_compute_items_after_mutate(
-      first_compute_items_to_reset{});
+  box->template reset_compute_items_after_mutate(compute_items_to_reset{});
 
   box->mutate_locked_box_ = false;
 }
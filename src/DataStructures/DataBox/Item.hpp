@@ -7,8 +7,12 @@
 #include <pup.h>
 #include <utility>
 
+#include "DataStructures/DataBox/ComputeItemPacking.hpp"
 #include "DataStructures/DataBox/TagTraits.hpp"
 #include "Utilities/Gsl.hpp"
+#ifdef SPECTRE_DATABOX_PROFILING
+#include "DataStructures/DataBox/Profiling.hpp"
+#endif  // SPECTRE_DATABOX_PROFILING
 #include "Utilities/Requires.hpp"
 
 /// \cond
@@ -85,6 +89,12 @@ class Item<Tag, ItemType::Mutable> {
 //
 // A compute item may not be directly mutated (its value only changes after one
 // of its dependencies changes and it is fetched again)
+//
+// When serialized, the value of an evaluated compute item is written only if
+// db::pack_compute_item_values() is true on the PE. Otherwise the item is
+// unpacked as not evaluated and is recomputed when it is first retrieved.
+// Skipping the values keeps e.g. checkpoints small by not writing cached data
+// such as Jacobians.
 template <typename Tag>
 class Item<Tag, ItemType::Compute> {
  public:
@@ -103,18 +113,39 @@ class Item<Tag, ItemType::Compute> {
 
   bool evaluated() const noexcept { return evaluated_; }
 
-  void reset() noexcept { evaluated_ = false; }
+  void reset() noexcept {
+#ifdef SPECTRE_DATABOX_PROFILING
+    if (evaluated_) {
+      db::profiling::detail::record_reset<Tag>();
+    }
+#endif  // SPECTRE_DATABOX_PROFILING
+    evaluated_ = false;
+  }
 
   template <typename... Args>
   void evaluate(const Args&... args) const noexcept {
+#ifdef SPECTRE_DATABOX_PROFILING
+    const auto start_time = std::chrono::steady_clock::now();
+#endif  // SPECTRE_DATABOX_PROFILING
     Tag::function(make_not_null(&value_), args...);
     evaluated_ = true;
+#ifdef SPECTRE_DATABOX_PROFILING
+    db::profiling::detail::record_evaluation<Tag>(start_time, value_);
+#endif  // SPECTRE_DATABOX_PROFILING
   }
 
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) noexcept {
-    p | evaluated_;
-    if (evaluated_) {
+    if (p.isUnpacking()) {
+      p | evaluated_;
+      if (evaluated_) {
+        p | value_;
+      }
+      return;
+    }
+    bool pup_value = evaluated_ and db::pack_compute_item_values();
+    p | pup_value;
+    if (pup_value) {
       p | value_;
     }
   }
@@ -0,0 +1,29 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/DataBox/Profiling.hpp"
+
+#include <map>
+#include <string>
+
+namespace db::profiling {
+const std::map<std::string, ComputeItemStatistics>&
+compute_item_statistics() noexcept {
+  return detail::mutable_compute_item_statistics();
+}
+
+void clear_compute_item_statistics() noexcept {
+  for (auto& name_and_statistics :
+       detail::mutable_compute_item_statistics()) {
+    name_and_statistics.second = ComputeItemStatistics{};
+  }
+}
+
+namespace detail {
+std::map<std::string, ComputeItemStatistics>&
+mutable_compute_item_statistics() noexcept {
+  thread_local std::map<std::string, ComputeItemStatistics> statistics{};
+  return statistics;
+}
+}  // namespace detail
+}  // namespace db::profiling
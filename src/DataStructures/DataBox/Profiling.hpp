@@ -0,0 +1,106 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/DataBox/TagName.hpp"
+#include "Utilities/TypeTraits/IsComplexOfFundamental.hpp"
+#include "Utilities/TypeTraits/IsIterable.hpp"
+
+/// \ingroup DataBoxGroup
+/// \brief Instrumentation of the evaluation of compute items.
+///
+/// \details The statistics are only recorded when SpECTRE is configured with
+/// `-D DATABOX_PROFILING=ON`, which defines `SPECTRE_DATABOX_PROFILING`.
+/// Otherwise the compute items are not instrumented and the statistics stay
+/// empty. The statistics are kept per thread, i.e. per PE, and are keyed on
+/// the name of the compute item.
+namespace db::profiling {
+/// Statistics of the evaluations of a compute item
+struct ComputeItemStatistics {
+  /// Number of times the item was computed
+  size_t number_of_evaluations{0};
+  /// Number of times the item was invalidated after it had been computed
+  size_t number_of_resets{0};
+  /// Cumulative wall time spent computing the item, in seconds
+  double evaluation_time{0.0};
+  /// Cumulative size of the computed values, in bytes. Only the values of
+  /// containers are counted, not their bookkeeping, e.g. a `DataVector`
+  /// counts its elements and a `Tensor` the elements of its components. Other
+  /// types count their `sizeof`.
+  size_t bytes_produced{0};
+};
+
+/// The statistics of all compute items evaluated on this PE, keyed on the
+/// name of the compute item
+const std::map<std::string, ComputeItemStatistics>&
+compute_item_statistics() noexcept;
+
+/// Set all statistics on this PE to zero
+void clear_compute_item_statistics() noexcept;
+
+namespace detail {
+std::map<std::string, ComputeItemStatistics>&
+mutable_compute_item_statistics() noexcept;
+
+template <typename Tag>
+ComputeItemStatistics& statistics() noexcept {
+  // References into a std::map remain valid when inserting, and clearing
+  // the statistics only zeroes them.
+  thread_local ComputeItemStatistics& statistics =
+      mutable_compute_item_statistics()[db::tag_name<Tag>()];
+  return statistics;
+}
+
+template <typename T, typename = std::void_t<>>
+struct has_contiguous_data : std::false_type {};
+
+template <typename T>
+struct has_contiguous_data<
+    T, std::void_t<decltype(std::declval<const T&>().data()),
+                   decltype(std::declval<const T&>().size()),
+                   typename T::value_type>>
+    : std::bool_constant<
+          tt::is_complex_or_fundamental_v<typename T::value_type>> {};
+
+template <typename T>
+size_t size_in_bytes(const T& value) noexcept {
+  if constexpr (has_contiguous_data<T>::value) {
+    return value.size() * sizeof(typename T::value_type);
+  } else if constexpr (tt::is_iterable_v<T>) {
+    size_t size = 0;
+    for (const auto& element : value) {
+      size += size_in_bytes(element);
+    }
+    return size;
+  } else {
+    (void)value;
+    return sizeof(T);
+  }
+}
+
+template <typename Tag, typename T>
+void record_evaluation(
+    const std::chrono::steady_clock::time_point& start_time,
+    const T& value) noexcept {
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start_time;
+  auto& item_statistics = statistics<Tag>();
+  ++item_statistics.number_of_evaluations;
+  item_statistics.evaluation_time += elapsed.count();
+  item_statistics.bytes_produced += size_in_bytes(value);
+}
+
+template <typename Tag>
+void record_reset() noexcept {
+  ++statistics<Tag>().number_of_resets;
+}
+}  // namespace detail
+}  // namespace db::profiling
@@ -0,0 +1,127 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <pybind11/complex.h>
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "PythonBindings/BoundChecks.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace py = pybind11;
+
+namespace py_bindings {
+void bind_complexdatavector(py::module& m) {  // NOLINT
+  // Wrapper for basic ComplexDataVector operations
+  py::class_<ComplexDataVector>(m, "ComplexDataVector", py::buffer_protocol())
+      .def(py::init<size_t>(), py::arg("size"))
+      .def(py::init<size_t, std::complex<double>>(), py::arg("size"),
+           py::arg("fill"))
+      .def(py::init([](const std::vector<std::complex<double>>& values) {
+             ComplexDataVector result{values.size()};
+             std::copy(values.begin(), values.end(), result.begin());
+             return result;
+           }),
+           py::arg("values"))
+      // This is a new-style constructor instead of a `py::init` factory so that
+      // the buffer is only kept alive when the ComplexDataVector references it
+      .def(
+          "__init__",
+          [](py::detail::value_and_holder& v_h, py::buffer buffer,
+             const bool copy) {
+            py::buffer_info info = buffer.request();
+            // Sanity-check the buffer
+            if (info.format !=
+                py::format_descriptor<std::complex<double>>::format()) {
+              throw std::runtime_error(
+                  "Incompatible format: expected a complex double array.");
+            }
+            if (info.ndim != 1) {
+              throw std::runtime_error("Incompatible dimension.");
+            }
+            const auto size = static_cast<size_t>(info.shape[0]);
+            const auto stride =
+                info.strides[0] /
+                static_cast<py::ssize_t>(sizeof(std::complex<double>));
+            auto data = static_cast<std::complex<double>*>(info.ptr);
+            if (copy) {
+              ComplexDataVector result{size};
+              for (size_t i = 0; i < size; ++i) {
+                const auto index = static_cast<py::ssize_t>(i) * stride;
+                result[i] = data[index];  // NOLINT
+              }
+              py::detail::initimpl::construct<py::class_<ComplexDataVector>>(
+                  v_h, std::move(result), false);
+            } else {
+              if (stride != 1 and size > 1) {
+                throw std::runtime_error(
+                    "Cannot reference a non-contiguous buffer, pass "
+                    "copy=True instead.");
+              }
+              // Create a non-owning ComplexDataVector from the buffer and keep
+              // the buffer alive while the ComplexDataVector exists
+              py::detail::initimpl::construct<py::class_<ComplexDataVector>>(
+                  v_h, ComplexDataVector{data, size}, false);
+              py::detail::keep_alive_impl(
+                  py::handle{reinterpret_cast<PyObject*>(v_h.inst)}, buffer);
+            }
+          },
+          py::detail::is_new_style_constructor(), py::arg("buffer"),
+          py::arg("copy") = true)
+      // Expose the data as a Python buffer so it can be cast into Numpy arrays
+      .def_buffer([](ComplexDataVector& data_vector) {
+        return py::buffer_info(
+            data_vector.data(),
+            // Size of one scalar
+            sizeof(std::complex<double>),
+            py::format_descriptor<std::complex<double>>::format(),
+            // Number of dimensions
+            1,
+            // Size of the buffer
+            {data_vector.size()},
+            // Stride for each index (in bytes)
+            {sizeof(std::complex<double>)});
+      })
+      .def(
+          "__iter__",
+          [](const ComplexDataVector& t) {
+            return py::make_iterator(t.begin(), t.end());
+          },
+          // Keep object alive while iterator exists
+          py::keep_alive<0, 1>())
+      .def("__len__", [](const ComplexDataVector& t) { return t.size(); })
+      .def("__getitem__",
+           +[](const ComplexDataVector& t, const size_t i) {
+             bounds_check(t, i);
+             return t[i];
+           })
+      .def("__setitem__",
+           +[](ComplexDataVector& t, const size_t i,
+               const std::complex<double> v) {
+             bounds_check(t, i);
+             t[i] = v;
+           })
+      .def("__str__",
+           +[](const ComplexDataVector& t) { return get_output(t); })
+      .def("__repr__",
+           +[](const ComplexDataVector& t) { return get_output(t); })
+      .def("real",
+           +[](const ComplexDataVector& t) { return DataVector{real(t)}; })
+      .def("imag",
+           +[](const ComplexDataVector& t) { return DataVector{imag(t)}; })
+      // NOLINTNEXTLINE(misc-redundant-expression)
+      .def(py::self == py::self)
+      // NOLINTNEXTLINE(misc-redundant-expression)
+      .def(py::self != py::self);
+}
+}  // namespace py_bindings
@@ -27,28 +27,49 @@ void bind_datavector(py::module& m) {  // NOLINT
              return result;
            }),
            py::arg("values"))
-      .def(py::init([](py::buffer buffer, const bool copy) {
-             py::buffer_info info = buffer.request();
-             // Sanity-check the buffer
-             if (info.format != py::format_descriptor<double>::format()) {
-               throw std::runtime_error(
-                   "Incompatible format: expected a double array.");
-             }
-             if (info.ndim != 1) {
-               throw std::runtime_error("Incompatible dimension.");
-             }
-             const auto size = static_cast<size_t>(info.shape[0]);
-             auto data = static_cast<double*>(info.ptr);
-             if (copy) {
-               DataVector result{size};
-               std::copy_n(data, result.size(), result.begin());
-               return result;
-             } else {
-               // Create a non-owning DataVector from the buffer
-               return DataVector{data, size};
-             }
-           }),
-           py::arg("buffer"), py::arg("copy") = true)
+      // This is a new-style constructor instead of a `py::init` factory so that
+      // the buffer is only kept alive when the DataVector references it
+      .def(
+          "__init__",
+          [](py::detail::value_and_holder& v_h, py::buffer buffer,
+             const bool copy) {
+            py::buffer_info info = buffer.request();
+            // Sanity-check the buffer
+            if (info.format != py::format_descriptor<double>::format()) {
+              throw std::runtime_error(
+                  "Incompatible format: expected a double array.");
+            }
+            if (info.ndim != 1) {
+              throw std::runtime_error("Incompatible dimension.");
+            }
+            const auto size = static_cast<size_t>(info.shape[0]);
+            const auto stride =
+                info.strides[0] / static_cast<py::ssize_t>(sizeof(double));
+            auto data = static_cast<double*>(info.ptr);
+            if (copy) {
+              DataVector result{size};
+              for (size_t i = 0; i < size; ++i) {
+                const auto index = static_cast<py::ssize_t>(i) * stride;
+                result[i] = data[index];  // NOLINT
+              }
+              py::detail::initimpl::construct<py::class_<DataVector>>(
+                  v_h, std::move(result), false);
+            } else {
+              if (stride != 1 and size > 1) {
+                throw std::runtime_error(
+                    "Cannot reference a non-contiguous buffer, pass "
+                    "copy=True instead.");
+              }
+              // Create a non-owning DataVector from the buffer and keep the
+              // buffer alive while the DataVector exists
+              py::detail::initimpl::construct<py::class_<DataVector>>(
+                  v_h, DataVector{data, size}, false);
+              py::detail::keep_alive_impl(
+                  py::handle{reinterpret_cast<PyObject*>(v_h.inst)}, buffer);
+            }
+          },
+          py::detail::is_new_style_constructor(), py::arg("buffer"),
+          py::arg("copy") = true)
       // Expose the data as a Python buffer so it can be cast into Numpy arrays
       .def_buffer([](DataVector& data_vector) {
         return py::buffer_info(data_vector.data(),
@@ -34,8 +34,28 @@ void bind_matrix(py::module& m) {  // NOLINT
              }
              const auto rows = static_cast<size_t>(info.shape[0]);
              const auto columns = static_cast<size_t>(info.shape[1]);
+             const auto row_stride =
+                 info.strides[0] / static_cast<py::ssize_t>(sizeof(double));
+             const auto column_stride =
+                 info.strides[1] / static_cast<py::ssize_t>(sizeof(double));
              auto data = static_cast<double*>(info.ptr);
-             return Matrix(rows, columns, data);
+             // Blaze owns the memory of the Matrix, so the data is always
+             // copied. Column-major buffers, such as the ones the Matrix
+             // exposes, are copied in one block.
+             if (row_stride == 1 and
+                 column_stride == static_cast<py::ssize_t>(rows)) {
+               return Matrix(rows, columns, data);
+             }
+             Matrix result(rows, columns);
+             for (size_t j = 0; j < columns; ++j) {
+               for (size_t i = 0; i < rows; ++i) {
+                 const auto index =
+                     static_cast<py::ssize_t>(i) * row_stride +
+                     static_cast<py::ssize_t>(j) * column_stride;
+                 result(i, j) = data[index];  // NOLINT
+               }
+             }
+             return result;
            }),
            py::arg("buffer"))
       // Expose the data as a Python buffer so it can be cast into Numpy arrays
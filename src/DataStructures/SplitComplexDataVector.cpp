@@ -0,0 +1,154 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/SplitComplexDataVector.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+SplitComplexDataVector::SplitComplexDataVector(const size_t size) noexcept
+    : data_{2 * size} {
+  set_views(size);
+}
+
+SplitComplexDataVector::SplitComplexDataVector(
+    const size_t size, const std::complex<double> value) noexcept
+    : SplitComplexDataVector(size) {
+  real_ = value.real();
+  imag_ = value.imag();
+}
+
+SplitComplexDataVector::SplitComplexDataVector(
+    const ComplexDataVector& vector) noexcept
+    : SplitComplexDataVector(vector.size()) {
+  real_ = real(vector);
+  imag_ = imag(vector);
+}
+
+SplitComplexDataVector::SplitComplexDataVector(
+    const SplitComplexDataVector& rhs) noexcept
+    : data_{rhs.data_} {
+  set_views(rhs.size());
+}
+
+SplitComplexDataVector& SplitComplexDataVector::operator=(
+    const SplitComplexDataVector& rhs) noexcept {
+  if (this != &rhs) {
+    data_ = rhs.data_;
+    set_views(rhs.size());
+  }
+  return *this;
+}
+
+SplitComplexDataVector::SplitComplexDataVector(
+    SplitComplexDataVector&& rhs) noexcept
+    : data_{std::move(rhs.data_)} {
+  set_views(data_.size() / 2);
+  rhs.set_views(0);
+}
+
+SplitComplexDataVector& SplitComplexDataVector::operator=(
+    SplitComplexDataVector&& rhs) noexcept {
+  if (this != &rhs) {
+    data_ = std::move(rhs.data_);
+    set_views(data_.size() / 2);
+    rhs.set_views(0);
+  }
+  return *this;
+}
+
+void SplitComplexDataVector::destructive_resize(
+    const size_t new_size) noexcept {
+  if (new_size != size()) {
+    data_.destructive_resize(2 * new_size);
+    set_views(new_size);
+  }
+}
+
+void SplitComplexDataVector::pup(PUP::er& p) noexcept {  // NOLINT
+  p | data_;
+  if (p.isUnpacking()) {
+    set_views(data_.size() / 2);
+  }
+}
+
+void SplitComplexDataVector::set_views(const size_t size) noexcept {
+  real_.set_data_ref(size == 0 ? nullptr : data_.data(), size);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  imag_.set_data_ref(size == 0 ? nullptr : data_.data() + size, size);
+}
+
+bool operator==(const SplitComplexDataVector& lhs,
+                const SplitComplexDataVector& rhs) noexcept {
+  return lhs.real() == rhs.real() and lhs.imag() == rhs.imag();
+}
+
+bool operator!=(const SplitComplexDataVector& lhs,
+                const SplitComplexDataVector& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+void split(const gsl::not_null<SplitComplexDataVector*> result,
+           const ComplexDataVector& source) noexcept {
+  result->destructive_resize(source.size());
+  result->real() = real(source);
+  result->imag() = imag(source);
+}
+
+void interleave(const gsl::not_null<ComplexDataVector*> result,
+                const SplitComplexDataVector& source) noexcept {
+  result->destructive_resize(source.size());
+  const DataVector& source_real = source.real();
+  const DataVector& source_imag = source.imag();
+  for (size_t i = 0; i < source.size(); ++i) {
+    (*result)[i] = std::complex<double>(source_real[i], source_imag[i]);
+  }
+}
+
+void multiply(const gsl::not_null<SplitComplexDataVector*> result,
+              const SplitComplexDataVector& lhs,
+              const SplitComplexDataVector& rhs) noexcept {
+  ASSERT(result.get() != &lhs and result.get() != &rhs,
+         "The result of the multiplication must not alias its arguments");
+  result->destructive_resize(lhs.size());
+  result->real() = lhs.real() * rhs.real() - lhs.imag() * rhs.imag();
+  result->imag() = lhs.real() * rhs.imag() + lhs.imag() * rhs.real();
+}
+
+void multiply_conjugate(const gsl::not_null<SplitComplexDataVector*> result,
+                        const SplitComplexDataVector& lhs,
+                        const SplitComplexDataVector& rhs) noexcept {
+  ASSERT(result.get() != &lhs and result.get() != &rhs,
+         "The result of the multiplication must not alias its arguments");
+  result->destructive_resize(lhs.size());
+  result->real() = lhs.real() * rhs.real() + lhs.imag() * rhs.imag();
+  result->imag() = lhs.imag() * rhs.real() - lhs.real() * rhs.imag();
+}
+
+void divide(const gsl::not_null<SplitComplexDataVector*> result,
+            const SplitComplexDataVector& lhs,
+            const SplitComplexDataVector& rhs) noexcept {
+  ASSERT(result.get() != &lhs and result.get() != &rhs,
+         "The result of the division must not alias its arguments");
+  result->destructive_resize(lhs.size());
+  // Use the imaginary part of the result as a buffer for 1 / |rhs|^2 so the
+  // division is done only once per point
+  result->imag() = 1.0 / (square(rhs.real()) + square(rhs.imag()));
+  result->real() = (lhs.real() * rhs.real() + lhs.imag() * rhs.imag()) *
+                   result->imag();
+  result->imag() *= lhs.imag() * rhs.real() - lhs.real() * rhs.imag();
+}
+
+void norm(const gsl::not_null<DataVector*> result,
+          const SplitComplexDataVector& vector) noexcept {
+  result->destructive_resize(vector.size());
+  *result = square(vector.real()) + square(vector.imag());
+}
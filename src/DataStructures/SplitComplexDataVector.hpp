@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Stores a collection of complex values with all real parts followed by
+ * all imaginary parts.
+ *
+ * \details `ComplexDataVector` stores interleaved `std::complex<double>`
+ * values, so Blaze cannot vectorize complex multiplications and divisions
+ * over it. The real and imaginary parts of a `SplitComplexDataVector` are each
+ * a `DataVector` (a view into the same allocation), so pointwise complex
+ * arithmetic written in terms of `real()` and `imag()` is a set of
+ * `DataVector` expressions that Blaze evaluates at full SIMD width, e.g.
+ *
+ * \code
+ * result.real() = a.real() * b.real() - a.imag() * b.imag();
+ * result.imag() = a.real() * b.imag() + a.imag() * b.real();
+ * \endcode
+ *
+ * Common operations are provided as free functions, e.g. `multiply` and
+ * `divide`. Use `split` and `interleave` to convert from and to
+ * `ComplexDataVector`.
+ *
+ * The memory layout is the one of
+ * `Spectral::Swsh::ComplexRepresentation::RealsThenImags`, so `data()` can be
+ * passed to libsharp or LAPACK routines that expect that layout without
+ * repacking.
+ */
+class SplitComplexDataVector {
+ public:
+  SplitComplexDataVector() = default;
+  explicit SplitComplexDataVector(size_t size) noexcept;
+  SplitComplexDataVector(size_t size, std::complex<double> value) noexcept;
+  explicit SplitComplexDataVector(const ComplexDataVector& vector) noexcept;
+  SplitComplexDataVector(const SplitComplexDataVector& rhs) noexcept;
+  SplitComplexDataVector(SplitComplexDataVector&& rhs) noexcept;
+  SplitComplexDataVector& operator=(const SplitComplexDataVector& rhs) noexcept;
+  SplitComplexDataVector& operator=(SplitComplexDataVector&& rhs) noexcept;
+  ~SplitComplexDataVector() = default;
+
+  size_t size() const noexcept { return real_.size(); }
+
+  /// The real parts, a view into the first half of `data()`
+  DataVector& real() noexcept { return real_; }
+  const DataVector& real() const noexcept { return real_; }
+
+  /// The imaginary parts, a view into the second half of `data()`
+  DataVector& imag() noexcept { return imag_; }
+  const DataVector& imag() const noexcept { return imag_; }
+
+  /// The `2 * size()` values, all real parts followed by all imaginary parts
+  double* data() noexcept { return data_.data(); }
+  const double* data() const noexcept { return data_.data(); }
+
+  /// Resize to `new_size` complex values, discarding the current values if
+  /// the size changes
+  void destructive_resize(size_t new_size) noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  void set_views(size_t size) noexcept;
+
+  DataVector data_{};
+  DataVector real_{};
+  DataVector imag_{};
+};
+
+bool operator==(const SplitComplexDataVector& lhs,
+                const SplitComplexDataVector& rhs) noexcept;
+bool operator!=(const SplitComplexDataVector& lhs,
+                const SplitComplexDataVector& rhs) noexcept;
+
+/// @{
+/// \ingroup DataStructuresGroup
+/// Copy the interleaved `source` into the split storage `result`, resizing
+/// `result` if necessary
+void split(gsl::not_null<SplitComplexDataVector*> result,
+           const ComplexDataVector& source) noexcept;
+
+template <int Spin>
+void split(gsl::not_null<SpinWeighted<SplitComplexDataVector, Spin>*> result,
+           const SpinWeighted<ComplexDataVector, Spin>& source) noexcept {
+  split(make_not_null(&result->data()), source.data());
+}
+/// @}
+
+/// @{
+/// \ingroup DataStructuresGroup
+/// Copy the split storage `source` into the interleaved `result`, resizing
+/// `result` if necessary
+void interleave(gsl::not_null<ComplexDataVector*> result,
+                const SplitComplexDataVector& source) noexcept;
+
+template <int Spin>
+void interleave(
+    gsl::not_null<SpinWeighted<ComplexDataVector, Spin>*> result,
+    const SpinWeighted<SplitComplexDataVector, Spin>& source) noexcept {
+  interleave(make_not_null(&result->data()), source.data());
+}
+/// @}
+
+/// \ingroup DataStructuresGroup
+/// Pointwise `lhs * rhs`. The `result` must not alias the arguments.
+void multiply(gsl::not_null<SplitComplexDataVector*> result,
+              const SplitComplexDataVector& lhs,
+              const SplitComplexDataVector& rhs) noexcept;
+
+/// \ingroup DataStructuresGroup
+/// Pointwise `lhs * conj(rhs)`. The `result` must not alias the arguments.
+void multiply_conjugate(gsl::not_null<SplitComplexDataVector*> result,
+                        const SplitComplexDataVector& lhs,
+                        const SplitComplexDataVector& rhs) noexcept;
+
+/// \ingroup DataStructuresGroup
+/// Pointwise `lhs / rhs`. The `result` must not alias the arguments.
+void divide(gsl::not_null<SplitComplexDataVector*> result,
+            const SplitComplexDataVector& lhs,
+            const SplitComplexDataVector& rhs) noexcept;
+
+/// \ingroup DataStructuresGroup
+/// Pointwise squared magnitude \f$|z|^2\f$, like `std::norm`
+void norm(gsl::not_null<DataVector*> result,
+          const SplitComplexDataVector& vector) noexcept;
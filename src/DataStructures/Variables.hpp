@@ -142,6 +142,21 @@ class Variables<tmpl::list<Tags...>> {
 
   Variables(size_t number_of_grid_points, value_type value) noexcept;
 
+  /// Construct a non-owning Variables that points to `start`. `size` is the
+  /// size of the allocation, which must be
+  /// `number_of_grid_points * number_of_independent_components`.
+  ///
+  /// A non-owning Variables cannot be resized, and assigning to it copies
+  /// into the referenced memory. This is used to view type-erased buffers,
+  /// e.g. boundary data received in a `std::vector<double>`, as a Variables
+  /// without copying them. Copy-constructing from a non-owning Variables or
+  /// unpacking one with PUP yields a Variables that owns its data.
+  ///
+  /// \note Serialization always copies the data into the PUP buffer. Data
+  /// sent between chares is not transferred by reference (zero-copy), and
+  /// views are not reconstructed on the receiving side.
+  Variables(pointer start, size_t size) noexcept;
+
   Variables(Variables&& rhs) noexcept = default;
   Variables& operator=(Variables&& rhs) noexcept;
 
@@ -187,6 +202,13 @@ class Variables<tmpl::list<Tags...>> {
   void initialize(size_t number_of_grid_points, value_type value) noexcept;
   // @}
 
+  /// Set the Variables to be a non-owning view of the memory starting at
+  /// `start` with `size` elements. Any owned allocation is released.
+  void set_data_ref(pointer start, size_t size) noexcept;
+
+  /// Whether or not the Variables owns its memory
+  bool is_owning() const noexcept { return owning_; }
+
   constexpr SPECTRE_ALWAYS_INLINE size_t
   number_of_grid_points() const noexcept {
     return number_of_grid_points_;
@@ -436,6 +458,7 @@ class Variables<tmpl::list<Tags...>> {
                                                                      &free};
   size_t size_ = 0;
   size_t number_of_grid_points_ = 0;
+  bool owning_{true};
 
   // variable_data_ is only used to plug into the Blaze expression templates
   pointer_type variable_data_;
@@ -505,10 +528,19 @@ Variables<tmpl::list<Tags...>>::Variables(const size_t number_of_grid_points,
   initialize(number_of_grid_points, value);
 }
 
+template <typename... Tags>
+Variables<tmpl::list<Tags...>>::Variables(const pointer start,
+                                          const size_t size) noexcept {
+  set_data_ref(start, size);
+}
+
 template <typename... Tags>
 void Variables<tmpl::list<Tags...>>::initialize(
     const size_t number_of_grid_points) noexcept {
   if (number_of_grid_points_ != number_of_grid_points) {
+    ASSERT(owning_, "Cannot resize a non-owning Variables from "
+                        << number_of_grid_points_ << " to "
+                        << number_of_grid_points << " grid points.");
     number_of_grid_points_ = number_of_grid_points;
     size_ = number_of_grid_points * number_of_independent_components;
     if (size_ > 0) {
@@ -528,8 +560,26 @@ template <typename... Tags>
 void Variables<tmpl::list<Tags...>>::initialize(
     const size_t number_of_grid_points, const value_type value) noexcept {
   initialize(number_of_grid_points);
-  std::fill(variable_data_impl_.get(), variable_data_impl_.get() + size_,
-            value);
+  std::fill(data(), data() + size_, value);
+}
+
+template <typename... Tags>
+void Variables<tmpl::list<Tags...>>::set_data_ref(const pointer start,
+                                                  const size_t size) noexcept {
+  ASSERT(size % number_of_independent_components == 0,
+         "The size " << size << " of the referenced memory is not a multiple "
+                     "of the number of independent components "
+                     << number_of_independent_components << ".");
+  variable_data_impl_.reset();
+  owning_ = false;
+  size_ = size;
+  number_of_grid_points_ = size_ / number_of_independent_components;
+  if (size_ == 0) {
+    variable_data_.reset();
+    return;
+  }
+  variable_data_.reset(start, size_);
+  add_reference_variable_data();
 }
 
 /// \cond HIDDEN_SYMBOLS
@@ -561,6 +611,19 @@ Variables<tmpl::list<Tags...>>& Variables<tmpl::list<Tags...>>::operator=(
   if (this == &rhs) {
     return *this;
   }
+  if (not owning_) {
+    ASSERT(size_ == rhs.size_, "Must move into a non-owning Variables of the "
+                               "same size, but have sizes "
+                                   << size_ << " and " << rhs.size_);
+    variable_data_ =
+        static_cast<const blaze::Vector<pointer_type, transpose_flag>&>(
+            rhs.variable_data_);
+    return *this;
+  }
+  owning_ = rhs.owning_;
+  if (not owning_ and rhs.size_ > 0) {
+    variable_data_.reset(rhs.variable_data_.data(), rhs.size_);
+  }
   variable_data_impl_ = std::move(rhs.variable_data_impl_);
   size_ = rhs.size_;
   number_of_grid_points_ = std::move(rhs.number_of_grid_points_);
@@ -611,6 +674,7 @@ Variables<tmpl::list<Tags...>>::Variables(
     : variable_data_impl_(std::move(rhs.variable_data_impl_)),
       size_(rhs.size()),
       number_of_grid_points_(rhs.number_of_grid_points()),
+      owning_(rhs.owning_),
       reference_variable_data_(std::move(rhs.reference_variable_data_)) {
   static_assert(
       (std::is_same_v<typename Tags::type, typename WrappedTags::type> and ...),
@@ -618,7 +682,7 @@ Variables<tmpl::list<Tags...>>::Variables(
   if (size_ == 0) {
     return;
   }
-  variable_data_.reset(variable_data_impl_.get(), size_);
+  variable_data_.reset(rhs.variable_data_.data(), size_);
 }
 
 template <typename... Tags>
@@ -631,6 +695,19 @@ Variables<tmpl::list<Tags...>>& Variables<tmpl::list<Tags...>>::operator=(
   static_assert(
       (std::is_same_v<typename Tags::type, typename WrappedTags::type> and ...),
       "Tensor types do not match!");
+  if (not owning_) {
+    ASSERT(size_ == rhs.size_, "Must move into a non-owning Variables of the "
+                               "same size, but have sizes "
+                                   << size_ << " and " << rhs.size_);
+    variable_data_ =
+        static_cast<const blaze::Vector<pointer_type, transpose_flag>&>(
+            rhs.variable_data_);
+    return *this;
+  }
+  owning_ = rhs.owning_;
+  if (not owning_ and rhs.size_ > 0) {
+    variable_data_.reset(rhs.variable_data_.data(), rhs.size_);
+  }
   variable_data_impl_ = std::move(rhs.variable_data_impl_);
   size_ = rhs.size_;
   number_of_grid_points_ = std::move(rhs.number_of_grid_points_);
@@ -643,9 +720,16 @@ void Variables<tmpl::list<Tags...>>::pup(PUP::er& p) noexcept {
   size_t number_of_grid_points = number_of_grid_points_;
   p | number_of_grid_points;
   if (p.isUnpacking()) {
+    // Unpacking never writes through a view
+    if (not owning_) {
+      owning_ = true;
+      variable_data_.reset();
+      size_ = 0;
+      number_of_grid_points_ = 0;
+    }
     initialize(number_of_grid_points);
   }
-  PUParray(p, variable_data_impl_.get(), size_);
+  PUParray(p, data(), size_);
 }
 /// \endcond
 
@@ -701,7 +785,9 @@ void Variables<tmpl::list<Tags...>>::add_reference_variable_data() noexcept {
   if (size_ == 0) {
     return;
   }
-  variable_data_.reset(variable_data_impl_.get(), size_);
+  if (owning_) {
+    variable_data_.reset(variable_data_impl_.get(), size_);
+  }
   size_t variable_offset = 0;
   tmpl::for_each<tags_list>([this, &variable_offset](auto tag_v) noexcept {
     using Tag = tmpl::type_from<decltype(tag_v)>;
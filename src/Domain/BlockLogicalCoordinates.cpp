@@ -3,9 +3,12 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <numeric>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -13,6 +16,8 @@
 #include "Domain/Structure/BlockId.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -21,6 +26,38 @@ using block_logical_coord_holder = std::optional<
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>;
 using functions_of_time_type = std::unordered_map<
     std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+// The points of `points` at the given `positions`
+template <size_t Dim, typename Frame>
+tnsr::I<DataVector, Dim, Frame> points_at(
+    const tnsr::I<DataVector, Dim, Frame>& points,
+    const std::vector<size_t>& positions) noexcept {
+  tnsr::I<DataVector, Dim, Frame> result(positions.size());
+  for (size_t d = 0; d < Dim; ++d) {
+    for (size_t s = 0; s < positions.size(); ++s) {
+      result.get(d)[s] = points.get(d)[positions[s]];
+    }
+  }
+  return result;
+}
+
+// Removes the points at which `is_valid` is false from `points`, and their
+// entries from `indices`
+template <size_t Dim, typename Frame>
+void keep_valid_points(
+    const gsl::not_null<tnsr::I<DataVector, Dim, Frame>*> points,
+    const gsl::not_null<std::vector<size_t>*> indices,
+    const std::vector<bool>& is_valid) noexcept {
+  std::vector<size_t> valid_positions{};
+  for (size_t s = 0; s < is_valid.size(); ++s) {
+    if (is_valid[s]) {
+      (*indices)[valid_positions.size()] = (*indices)[s];
+      valid_positions.push_back(s);
+    }
+  }
+  indices->resize(valid_positions.size());
+  *points = points_at(*points, valid_positions);
+}
 }  // namespace
 
 template <size_t Dim, typename Frame>
@@ -30,98 +67,98 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
     const functions_of_time_type& functions_of_time) noexcept {
   const size_t num_pts = get<0>(x).size();
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
-    tnsr::I<double, Dim, Frame> x_frame(0.0);
-    for (size_t d = 0; d < Dim; ++d) {
-      x_frame.get(d) = x.get(d)[s];
+  // The points that are not in any block checked so far
+  std::vector<size_t> unlocated_points(num_pts);
+  std::iota(unlocated_points.begin(), unlocated_points.end(), 0_st);
+  // Check which block each point is in. Each point will be in one
+  // and only one block, unless it is on a shared boundary.  In that
+  // case, choose the first matching block (and this block will have
+  // the smallest block_id). All points that are not yet located are
+  // inverted together, so maps with a batched inverse invert them at once.
+  for (const auto& block : domain.blocks()) {
+    if (unlocated_points.empty()) {
+      break;
     }
-    tnsr::I<double, Dim, typename ::Frame::Logical> x_logical{};
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
-      if (block.is_time_dependent()) {
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          // Point is in the inertial frame, so we need to map to the grid
-          // frame and then the logical frame.
-          const auto moving_inv =
-              block.moving_mesh_grid_to_inertial_map().inverse(
-                  x_frame, time, functions_of_time);
-          if (not moving_inv.has_value()) {
-            continue;
-          }
-          // logical to grid map is time-independent.
-          const auto inv = block.moving_mesh_logical_to_grid_map().inverse(
-              moving_inv.value());
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {  // frame is different than ::Frame::Inertial
-          // Currently 'time' is unused in this branch.
-          // To make the compiler happy, need to trick it to think that
-          // 'time' is used.
-          (void) time;
-          // Currently we only support Grid and Inertial frames in the
-          // block, so make sure Frame is ::Frame::Grid. (The
-          // Inertial case was handled above.)
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
+    // The positions in `x` of the points in the batch
+    std::vector<size_t> indices = unlocated_points;
+    const auto x_frame = points_at(x, indices);
+    tnsr::I<DataVector, Dim, typename ::Frame::Logical> x_logical{};
+    std::vector<bool> is_valid{};
+    if (block.is_time_dependent()) {
+      if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+        // Points are in the inertial frame, so we need to map to the grid
+        // frame and then the logical frame.
+        tnsr::I<DataVector, Dim, ::Frame::Grid> x_grid{};
+        block.moving_mesh_grid_to_inertial_map().inverse(
+            make_not_null(&x_grid), make_not_null(&is_valid), x_frame, time,
+            functions_of_time);
+        keep_valid_points(make_not_null(&x_grid), make_not_null(&indices),
+                          is_valid);
+        // logical to grid map is time-independent.
+        block.moving_mesh_logical_to_grid_map().inverse(
+            make_not_null(&x_logical), make_not_null(&is_valid), x_grid);
+      } else {  // frame is different than ::Frame::Inertial
+        // Currently 'time' is unused in this branch.
+        // To make the compiler happy, need to trick it to think that
+        // 'time' is used.
+        (void) time;
+        // Currently we only support Grid and Inertial frames in the
+        // block, so make sure Frame is ::Frame::Grid. (The
+        // Inertial case was handled above.)
+        static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                      "Cannot convert from given frame to Grid frame");
 
-          // Point is in the grid frame, just map to logical frame.
-          const auto inv =
-              block.moving_mesh_logical_to_grid_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        }
-      } else {  // not block.is_time_dependent()
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          const auto inv = block.stationary_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {
-          // If the map is time-independent, then the grid and
-          // inertial frames are the same.  So if we are in the grid frame,
-          // convert to the inertial frame.  Otherwise throw a static_assert.
-          // Once we support more frames (e.g. distorted) this logic will
-          // change.
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-          tnsr::I<double, Dim, ::Frame::Inertial> x_inertial(0.0);
-          for (size_t d = 0; d < Dim; ++d) {
-            x_inertial.get(d) = x_frame.get(d);
-          }
-          const auto inv = block.stationary_map().inverse(x_inertial);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
+        // Points are in the grid frame, just map to logical frame.
+        block.moving_mesh_logical_to_grid_map().inverse(
+            make_not_null(&x_logical), make_not_null(&is_valid), x_frame);
+      }
+    } else {  // not block.is_time_dependent()
+      if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+        block.stationary_map().inverse(make_not_null(&x_logical),
+                                       make_not_null(&is_valid), x_frame);
+      } else {
+        // If the map is time-independent, then the grid and
+        // inertial frames are the same.  So if we are in the grid frame,
+        // convert to the inertial frame.  Otherwise throw a static_assert.
+        // Once we support more frames (e.g. distorted) this logic will
+        // change.
+        static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                      "Cannot convert from given frame to Grid frame");
+        tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+        for (size_t d = 0; d < Dim; ++d) {
+          x_inertial.get(d) = x_frame.get(d);
         }
+        block.stationary_map().inverse(make_not_null(&x_logical),
+                                       make_not_null(&is_valid), x_inertial);
+      }
+    }
+
+    for (size_t s = 0; s < indices.size(); ++s) {
+      if (not is_valid[s]) {
+        continue;  // Not in this block
       }
       bool is_contained = true;
+      tnsr::I<double, Dim, typename ::Frame::Logical> x_logical_point{};
       for (size_t d = 0; d < Dim; ++d) {
+        x_logical_point.get(d) = x_logical.get(d)[s];
         // Assumes that logical coordinates go from -1 to +1 in each
         // dimension.
-        is_contained = is_contained and x_logical.get(d) >= -1.0 and
-                       x_logical.get(d) <= 1.0;
+        is_contained = is_contained and x_logical_point.get(d) >= -1.0 and
+                       x_logical_point.get(d) <= 1.0;
       }
       if (is_contained) {
         // Point is in this block.  Don't bother checking subsequent
         // blocks.
-        block_coord_holders[s] =
-            make_id_pair(domain::BlockId(block.id()), std::move(x_logical));
-        break;
+        block_coord_holders[indices[s]] = make_id_pair(
+            domain::BlockId(block.id()), std::move(x_logical_point));
       }
     }
+    unlocated_points.erase(
+        std::remove_if(unlocated_points.begin(), unlocated_points.end(),
+                       [&block_coord_holders](const size_t s) noexcept {
+                         return block_coord_holders[s].has_value();
+                       }),
+        unlocated_points.end());
   }
   return block_coord_holders;
 }
@@ -38,6 +38,11 @@ class IdPair;
 /// If a point is on a shared boundary of two or more `Block`s, it is
 /// returned only once, and is considered to belong to the `Block`
 /// with the smaller `BlockId`.
+///
+/// For each `Block`, all points that are not in a previous `Block` are
+/// inverted together with the batched `CoordinateMapBase::inverse`, so maps
+/// that provide a batched `DataVector` inverse (e.g. `Wedge3D`, `Frustum`,
+/// `BulgedCube` and `EquatorialCompression`) invert them at once.
 template <size_t Dim, typename Frame>
 auto block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
@@ -3,6 +3,7 @@
 
 #include "Domain/CoordinateMaps/BulgedCube.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <exception>
 #include <functional>  // for std::reference_wrapper
@@ -10,6 +11,7 @@
 #include <optional>
 #include <pup.h>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
@@ -56,7 +58,6 @@ class RootFunction {
                      1.0 / sqrt(2.0 + square(rho) * y_sq_over_r_sq) -
                      1.0 / sqrt(2.0 + square(rho) * z_sq_over_r_sq)));
   }
-  double get_r_sq() const noexcept { return physical_r_squared_; }
 
  private:
   const double radius_;
@@ -67,20 +68,85 @@ class RootFunction {
   const double z_sq_;
 };
 
-std::optional<double> scaling_factor(RootFunction&& rootfunction) noexcept {
-  const double physical_r_squared = rootfunction.get_r_sq();
+constexpr double root_tolerance =
+    10.0 * std::numeric_limits<double>::epsilon();
+// Use a small nonzero number since the inverse map is singular at r==0 and
+// that case is handled separately.
+constexpr double root_lower_bound = std::numeric_limits<double>::min();
+// root_upper_bound = sqrt(3) + root_tolerance
+constexpr double root_upper_bound = 1.7320508075688772 + root_tolerance;
+constexpr size_t max_newton_iterations = 20;
+
+// The Newton-Raphson correction f(rho) / f'(rho) for the function that
+// RootFunction evaluates, given the squared direction cosines x^2/r^2,
+// y^2/r^2 and z^2/r^2 of the target point
+double newton_correction(const double radius, const double sphericity,
+                         const double physical_r, const double x_sq_over_r_sq,
+                         const double y_sq_over_r_sq,
+                         const double z_sq_over_r_sq,
+                         const double rho) noexcept {
+  const double rho_sq = square(rho);
+  const double one_over_rho_xy =
+      1.0 / sqrt(1.0 + rho_sq * (x_sq_over_r_sq + y_sq_over_r_sq));
+  const double one_over_rho_xz =
+      1.0 / sqrt(1.0 + rho_sq * (x_sq_over_r_sq + z_sq_over_r_sq));
+  const double one_over_rho_yz =
+      1.0 / sqrt(1.0 + rho_sq * (y_sq_over_r_sq + z_sq_over_r_sq));
+  const double one_over_rho_x = 1.0 / sqrt(2.0 + rho_sq * x_sq_over_r_sq);
+  const double one_over_rho_y = 1.0 / sqrt(2.0 + rho_sq * y_sq_over_r_sq);
+  const double one_over_rho_z = 1.0 / sqrt(2.0 + rho_sq * z_sq_over_r_sq);
+  const double radial_factor =
+      1.0 / sqrt(3.0) +
+      sphericity * (one_over_rho_xy + one_over_rho_xz + one_over_rho_yz -
+                    one_over_rho_x - one_over_rho_y - one_over_rho_z);
+  // rho times the derivative of the radial_factor with respect to rho
+  const double rho_d_radial_factor =
+      sphericity * rho_sq *
+      (x_sq_over_r_sq * cube(one_over_rho_x) +
+       y_sq_over_r_sq * cube(one_over_rho_y) +
+       z_sq_over_r_sq * cube(one_over_rho_z) -
+       (x_sq_over_r_sq + y_sq_over_r_sq) * cube(one_over_rho_xy) -
+       (x_sq_over_r_sq + z_sq_over_r_sq) * cube(one_over_rho_xz) -
+       (y_sq_over_r_sq + z_sq_over_r_sq) * cube(one_over_rho_yz));
+  return (physical_r - radius * rho * radial_factor) /
+         (-radius * (radial_factor + rho_d_radial_factor));
+}
+
+// The initial guess for the Newton-Raphson iterations is the root for zero
+// sphericity
+double initial_rho(const double radius, const double physical_r) noexcept {
+  return std::min(sqrt(3.0) * physical_r / radius, root_upper_bound);
+}
+
+std::optional<double> scaling_factor(const double radius,
+                                     const double sphericity,
+                                     const double physical_r_squared,
+                                     const double x_sq, const double y_sq,
+                                     const double z_sq) noexcept {
+  const double physical_r = sqrt(physical_r_squared);
+  // Newton-Raphson iterations usually converge in a few steps. If they leave
+  // the allowed interval or do not converge we fall back to the bracketed
+  // root find.
+  double rho = initial_rho(radius, physical_r);
+  for (size_t i = 0; i < max_newton_iterations; ++i) {
+    const double correction = newton_correction(
+        radius, sphericity, physical_r, x_sq / physical_r_squared,
+        y_sq / physical_r_squared, z_sq / physical_r_squared, rho);
+    rho -= correction;
+    if (rho < root_lower_bound or rho > root_upper_bound) {
+      break;
+    }
+    if (std::abs(correction) <= root_tolerance * (1.0 + rho)) {
+      return rho / physical_r;
+    }
+  }
+
   try {
-    constexpr double tol = 10.0 * std::numeric_limits<double>::epsilon();
-    // Use a small nonzero number since the inverse map is singular at r==0 and
-    // that case is handled separately.
-    constexpr double lower_bound = std::numeric_limits<double>::min();
-    // upper_bound = sqrt(3) + tol
-    constexpr double upper_bound = 1.7320508075688772 + tol;
-    double rho =
+    rho = RootFinder::toms748(
         // NOLINTNEXTLINE(clang-analyzer-core)
-        RootFinder::toms748(rootfunction, lower_bound, upper_bound, tol, tol);
-    rho /= sqrt(physical_r_squared);
-    return rho;
+        RootFunction{radius, sphericity, physical_r_squared, x_sq, y_sq, z_sq},
+        root_lower_bound, root_upper_bound, root_tolerance, root_tolerance);
+    return rho / physical_r;
   } catch (std::exception& exception) {
     return std::nullopt;
   }
@@ -171,10 +237,8 @@ std::optional<std::array<double, 3>> BulgedCube::inverse(
   }
 
   // We are not at the origin, find the scaling factor (does a root-find)
-  const auto scaling_factor =
-      // NOLINTNEXTLINE(clang-analyzer-core)
-      ::scaling_factor(
-      RootFunction{radius_, sphericity_, physical_r_squared, x_sq, y_sq, z_sq});
+  const auto scaling_factor = ::scaling_factor(
+      radius_, sphericity_, physical_r_squared, x_sq, y_sq, z_sq);
   if (not scaling_factor.has_value()) {
     return std::nullopt;
   }
@@ -188,6 +252,82 @@ std::optional<std::array<double, 3>> BulgedCube::inverse(
             physical_z * scaling_factor.value()}}};
 }
 
+void BulgedCube::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> source_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const std::array<DataVector, 3>& target_coords) const noexcept {
+  const size_t num_points = target_coords[0].size();
+  is_valid->assign(num_points, true);
+  const DataVector x_sq = square(target_coords[0]);
+  const DataVector y_sq = square(target_coords[1]);
+  const DataVector z_sq = square(target_coords[2]);
+  const DataVector physical_r_squared = x_sq + y_sq + z_sq;
+  const DataVector physical_r = sqrt(physical_r_squared);
+
+  // Points at the origin map to the origin. Dividing by the smallest normal
+  // double instead of zero for them keeps the loops below free of branches,
+  // and their Newton-Raphson corrections vanish.
+  DataVector x_sq_over_r_sq{num_points};
+  DataVector y_sq_over_r_sq{num_points};
+  DataVector z_sq_over_r_sq{num_points};
+  DataVector rho{num_points};
+  for (size_t s = 0; s < num_points; ++s) {
+    const double one_over_r_sq =
+        1.0 / std::max(physical_r_squared[s], root_lower_bound);
+    x_sq_over_r_sq[s] = x_sq[s] * one_over_r_sq;
+    y_sq_over_r_sq[s] = y_sq[s] * one_over_r_sq;
+    z_sq_over_r_sq[s] = z_sq[s] * one_over_r_sq;
+    rho[s] = initial_rho(radius_, physical_r[s]);
+  }
+
+  // Iterate all points together until they have all converged. Points are
+  // kept in a bounded interval so that ones without a root in the allowed
+  // interval stay finite; they are handled individually below.
+  DataVector correction{num_points};
+  for (size_t i = 0; i < max_newton_iterations; ++i) {
+    double max_correction = 0.0;
+    for (size_t s = 0; s < num_points; ++s) {
+      correction[s] = newton_correction(
+          radius_, sphericity_, physical_r[s], x_sq_over_r_sq[s],
+          y_sq_over_r_sq[s], z_sq_over_r_sq[s], rho[s]);
+      rho[s] = std::clamp(rho[s] - correction[s], root_lower_bound,
+                          2.0 * root_upper_bound);
+      max_correction = std::max(max_correction, std::abs(correction[s]));
+    }
+    if (max_correction <= root_tolerance) {
+      break;
+    }
+  }
+
+  DataVector scaling_factor{num_points};
+  for (size_t s = 0; s < num_points; ++s) {
+    if (UNLIKELY(physical_r_squared[s] == 0.0)) {
+      scaling_factor[s] = 0.0;
+    } else if (std::abs(correction[s]) <= root_tolerance * (1.0 + rho[s]) and
+               rho[s] <= root_upper_bound) {
+      scaling_factor[s] = rho[s] / physical_r[s];
+    } else {
+      const auto point_scaling_factor =
+          ::scaling_factor(radius_, sphericity_, physical_r_squared[s],
+                           x_sq[s], y_sq[s], z_sq[s]);
+      if (point_scaling_factor.has_value()) {
+        scaling_factor[s] = point_scaling_factor.value();
+      } else {
+        (*is_valid)[s] = false;
+        scaling_factor[s] = 0.0;
+      }
+    }
+  }
+  for (size_t d = 0; d < 3; ++d) {
+    if (use_equiangular_map_) {
+      gsl::at(*source_coords, d) =
+          2.0 * M_2_PI * atan(gsl::at(target_coords, d) * scaling_factor);
+    } else {
+      gsl::at(*source_coords, d) = gsl::at(target_coords, d) * scaling_factor;
+    }
+  }
+}
+
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> BulgedCube::xi_derivative(
     const std::array<T, 3>& source_coords) const noexcept {
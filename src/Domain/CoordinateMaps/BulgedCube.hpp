@@ -9,10 +9,16 @@
 #include <cstddef>
 #include <limits>
 #include <optional>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
+/// \cond
+class DataVector;
+/// \endcond
+
 /// \cond
 namespace PUP {
 class er;
@@ -486,6 +492,9 @@ namespace CoordinateMaps {
  * one-dimensional formula is obtained by taking the magnitude of both sides
  * of the mapping, and changing variables from \f$\xi, \eta, \zeta\f$ to
  * \f$x, y, z\f$ and introducing \f$\rho^2 := \sqrt{\xi^2+\eta^2+\zeta^2}\f$.
+ * The root is found with Newton-Raphson iterations starting from the root for
+ * zero sphericity, falling back to a bracketed TOMS748 root find if they do
+ * not converge within the allowed interval.
  */
 class BulgedCube {
  public:
@@ -506,6 +515,16 @@ class BulgedCube {
   std::optional<std::array<double, 3>> inverse(
       const std::array<double, 3>& target_coords) const noexcept;
 
+  /// Batched inverse of all `target_coords` at once. The Newton-Raphson
+  /// iterations are done for all points together in branch-free loops that
+  /// the compiler can vectorize, and only points that do not converge fall
+  /// back to the root find for a single point. `is_valid` is set to whether
+  /// the inverse is valid at each point. The `source_coords` of invalid
+  /// points are unspecified.
+  void inverse(gsl::not_null<std::array<DataVector, 3>*> source_coords,
+               gsl::not_null<std::vector<bool>*> is_valid,
+               const std::array<DataVector, 3>& target_coords) const noexcept;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> jacobian(
       const std::array<T, 3>& source_coords) const noexcept;
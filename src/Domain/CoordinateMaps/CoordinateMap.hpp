@@ -22,6 +22,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -118,6 +119,23 @@ class CoordinateMapBase : public PUP::able {
       std::string,
       std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
       noexcept = 0;
+  /// Apply the inverse `Maps` to all points in `target_points` at once.
+  /// `is_valid` is set to whether the inverse is valid at each point, and the
+  /// `source_points` of invalid points are unspecified. Maps that provide a
+  /// batched `inverse` for `DataVector`s invert all points together, the
+  /// others one point at a time.
+  virtual void inverse(
+      gsl::not_null<tnsr::I<DataVector, Dim, SourceFrame>*> source_points,
+      gsl::not_null<std::vector<bool>*> is_valid,
+      const tnsr::I<DataVector, Dim, TargetFrame>& target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+      std::string,
+      std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+      functions_of_time = std::unordered_map<
+      std::string,
+      std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
+      noexcept = 0;
   // @}
 
   // @{
@@ -173,6 +191,11 @@ class CoordinateMapBase : public PUP::able {
   // @{
   /// Compute the mapped coordinates, frame velocity, Jacobian, and inverse
   /// Jacobian
+  ///
+  /// All quantities are computed in a single pass through the composed maps,
+  /// which is cheaper than calling `operator()`, `jacobian` and
+  /// `inv_jacobian` separately. The inverse Jacobian is computed by inverting
+  /// the Jacobian, so it agrees with `inv_jacobian` only up to roundoff.
   virtual std::tuple<tnsr::I<double, Dim, TargetFrame>,
                      InverseJacobian<double, Dim, SourceFrame, TargetFrame>,
                      Jacobian<double, Dim, SourceFrame, TargetFrame>,
@@ -325,6 +348,23 @@ class CoordinateMap
     return inverse_impl(std::move(target_point), time, functions_of_time,
                         std::make_index_sequence<sizeof...(Maps)>{});
   }
+  void inverse(
+      const gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*>
+          source_points,
+      const gsl::not_null<std::vector<bool>*> is_valid,
+      const tnsr::I<DataVector, dim, TargetFrame>& target_points,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
+      noexcept override {
+    batched_inverse_impl(source_points, is_valid, target_points, time,
+                         functions_of_time,
+                         std::make_index_sequence<sizeof...(Maps)>{});
+  }
   // @}
 
   // @{
@@ -499,6 +539,17 @@ class CoordinateMap
           functions_of_time,
       std::index_sequence<Is...> /*meta*/) const noexcept;
 
+  template <size_t... Is>
+  void batched_inverse_impl(
+      gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_points,
+      gsl::not_null<std::vector<bool>*> is_valid,
+      const tnsr::I<DataVector, dim, TargetFrame>& target_points, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time,
+      std::index_sequence<Is...> /*meta*/) const noexcept;
+
   template <typename T>
   InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jacobian_impl(
       tnsr::I<T, dim, SourceFrame>&& source_point, double time,
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -20,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/CoordinateMapHelpers.hpp"
@@ -27,7 +30,9 @@
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Parallel/CharmPupable.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/Tuple.hpp"
 
@@ -159,6 +164,44 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
              : std::optional<tnsr::I<T, dim, SourceFrame>>{};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+template <size_t... Is>
+void CoordinateMap<SourceFrame, TargetFrame, Maps...>::batched_inverse_impl(
+    const gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_points,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const tnsr::I<DataVector, dim, TargetFrame>& target_points,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    std::index_sequence<Is...> /*meta*/) const noexcept {
+  const size_t num_points = get<0>(target_points).size();
+  std::array<DataVector, dim> mapped_points{};
+  for (size_t d = 0; d < dim; ++d) {
+    gsl::at(mapped_points, d) = target_points.get(d);
+  }
+  // The points at which all inverses so far are valid, and their positions in
+  // `target_points`
+  std::vector<size_t> indices(num_points);
+  std::iota(indices.begin(), indices.end(), 0_st);
+
+  // this is the inverse function, so the iterator sequence below is reversed
+  EXPAND_PACK_LEFT_TO_RIGHT(CoordinateMap_detail::apply_batched_inverse_map(
+      make_not_null(&mapped_points), make_not_null(&indices),
+      std::get<sizeof...(Maps) - 1 - Is>(maps_), time, functions_of_time));
+
+  is_valid->assign(num_points, false);
+  for (size_t d = 0; d < dim; ++d) {
+    source_points->get(d).destructive_resize(num_points);
+  }
+  for (size_t s = 0; s < indices.size(); ++s) {
+    (*is_valid)[indices[s]] = true;
+    for (size_t d = 0; d < dim; ++d) {
+      source_points->get(d)[indices[s]] = gsl::at(mapped_points, d)[s];
+    }
+  }
+}
+
 namespace detail {
 template <typename T, typename Map, size_t Dim>
 void get_jacobian(
@@ -386,81 +429,43 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
                   InverseJacobian<T, dim, SourceFrame, TargetFrame>,
                   Jacobian<T, dim, SourceFrame, TargetFrame>,
                   tnsr::I<T, dim, TargetFrame>> {
+  // All quantities are computed in a single pass through the maps, so the
+  // intermediate coordinates are computed only once. Only the Jacobian of
+  // each map is evaluated, and the inverse Jacobian is computed by inverting
+  // the Jacobian of the composed map. This is cheaper than evaluating and
+  // multiplying the inverse Jacobians of all maps.
   std::array<T, dim> mapped_point = make_array<T, dim>(std::move(source_point));
-  InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jac{};
   Jacobian<T, dim, SourceFrame, TargetFrame> jac{};
   tnsr::I<T, dim, TargetFrame> frame_velocity{};
+  // The frame velocity is zero until the first time-dependent map, so we
+  // avoid multiplying it by the Jacobians of the time-independent maps before
+  bool frame_velocity_is_zero = true;
+  tnsr::Ij<T, dim, Frame::NoFrame> noframe_jac{};
 
   tuple_transform(
-      maps_,
-      [&frame_velocity, &inv_jac, &jac, &mapped_point, time,
-       &functions_of_time](const auto& map, auto index,
-                           const std::tuple<Maps...>& maps) noexcept {
+      maps_, [&frame_velocity, &frame_velocity_is_zero, &jac, &mapped_point,
+              &noframe_jac, time, &functions_of_time](
+                 const auto& map, auto index) noexcept {
         constexpr size_t count = decltype(index)::value;
         using Map = std::decay_t<decltype(map)>;
+        // WARNING: we have assumed that if the map is the identity the frame
+        // velocity is also zero. That is, we do not optimize for the map
+        // being instantaneously zero.
+        if (count != 0 and map.is_identity()) {
+          return;
+        }
 
-        tnsr::Ij<T, dim, Frame::NoFrame> noframe_jac{};
-        tnsr::Ij<T, dim, Frame::NoFrame> noframe_inv_jac{};
-
-        if (UNLIKELY(count == 0)) {
-          // Set Jacobian and inverse Jacobian
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
-          detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
-                               time, functions_of_time,
-                               domain::is_jacobian_time_dependent_t<Map, T>{});
-          for (size_t target = 0; target < dim; ++target) {
-            for (size_t source = 0; source < dim; ++source) {
-              jac.get(target, source) =
-                  std::move(noframe_jac.get(target, source));
-              inv_jac.get(source, target) =
-                  std::move(noframe_inv_jac.get(source, target));
-            }
-          }
-
-          // Set frame velocity
-          if (domain::is_map_time_dependent_v<
-                  std::tuple_element_t<0, std::decay_t<decltype(maps)>>>) {
-            std::array<T, dim> noframe_frame_velocity =
-                detail::get_frame_velocity(map, mapped_point, time,
-                                           functions_of_time);
-            for (size_t i = 0; i < dim; ++i) {
-              frame_velocity.get(i) =
-                  std::move(gsl::at(noframe_frame_velocity, i));
-            }
-          } else {
-            // If the first map is time-independent the velocity is initialized
-            // to zero
-            for (size_t i = 0; i < frame_velocity.size(); ++i) {
-              frame_velocity[i] = make_with_value<T>(get<0, 0>(jac), 0.0);
-            }
-          }
-        } else if (LIKELY(not map.is_identity())) {
-          // WARNING: we have assumed that if the map is the identity the frame
-          // velocity is also zero. That is, we do not optimize for the map
-          // being instantaneously zero.
-
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
-          detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
-                               time, functions_of_time,
-                               domain::is_jacobian_time_dependent_t<Map, T>{});
-
-          // Perform matrix multiplication for Jacobian and inverse Jacobian
-          detail::multiply_inv_jacobian(make_not_null(&inv_jac),
-                                        noframe_inv_jac);
-          detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
-
-          // Set frame velocity, only if map is time-dependent
-          std::array<T, dim> noframe_frame_velocity{};
-          if (domain::is_map_time_dependent_v<
-                  std::tuple_element_t<count, std::decay_t<decltype(maps)>>>) {
-            noframe_frame_velocity = detail::get_frame_velocity(
-                map, mapped_point, time, functions_of_time);
+        detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
+                             time, functions_of_time,
+                             domain::is_jacobian_time_dependent_t<Map, T>{});
+
+        // Transform the frame velocity of the previous maps and add the
+        // velocity of this map, if it is time-dependent
+        if constexpr (domain::is_map_time_dependent_v<Map>) {
+          std::array<T, dim> noframe_frame_velocity =
+              detail::get_frame_velocity(map, mapped_point, time,
+                                         functions_of_time);
+          if (not frame_velocity_is_zero) {
             for (size_t target_frame_index = 0; target_frame_index < dim;
                  ++target_frame_index) {
               for (size_t source_frame_index = 0; source_frame_index < dim;
@@ -470,35 +475,57 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
                     frame_velocity.get(source_frame_index);
               }
             }
-          } else {
-            for (size_t target_frame_index = 0; target_frame_index < dim;
-                 ++target_frame_index) {
-              size_t source_frame_index = 0;
-              gsl::at(noframe_frame_velocity, target_frame_index) =
+          }
+          for (size_t i = 0; i < dim; ++i) {
+            frame_velocity.get(i) =
+                std::move(gsl::at(noframe_frame_velocity, i));
+          }
+          frame_velocity_is_zero = false;
+        } else if (not frame_velocity_is_zero) {
+          std::array<T, dim> noframe_frame_velocity{};
+          for (size_t target_frame_index = 0; target_frame_index < dim;
+               ++target_frame_index) {
+            gsl::at(noframe_frame_velocity, target_frame_index) =
+                noframe_jac.get(target_frame_index, 0) * frame_velocity.get(0);
+            for (size_t source_frame_index = 1; source_frame_index < dim;
+                 ++source_frame_index) {
+              gsl::at(noframe_frame_velocity, target_frame_index) +=
                   noframe_jac.get(target_frame_index, source_frame_index) *
                   frame_velocity.get(source_frame_index);
-              for (source_frame_index = 1; source_frame_index < dim;
-                   ++source_frame_index) {
-                gsl::at(noframe_frame_velocity, target_frame_index) +=
-                    noframe_jac.get(target_frame_index, source_frame_index) *
-                    frame_velocity.get(source_frame_index);
-              }
             }
           }
-          for (size_t target_frame_index = 0; target_frame_index < dim;
-               ++target_frame_index) {
-            using std::swap;
-            swap(gsl::at(noframe_frame_velocity, target_frame_index),
-                 frame_velocity.get(target_frame_index));
+          for (size_t i = 0; i < dim; ++i) {
+            frame_velocity.get(i) =
+                std::move(gsl::at(noframe_frame_velocity, i));
+          }
+        }
+
+        if (count == 0) {
+          for (size_t target = 0; target < dim; ++target) {
+            for (size_t source = 0; source < dim; ++source) {
+              jac.get(target, source) =
+                  std::move(noframe_jac.get(target, source));
+            }
           }
+        } else {
+          detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
         }
 
         // Update to the next mapped point
         CoordinateMap_detail::apply_map(
             make_not_null(&mapped_point), map, time, functions_of_time,
-            domain::is_map_time_dependent_t<decltype(map)>{});
-      },
-      maps_);
+            domain::is_map_time_dependent_t<Map>{});
+      });
+
+  if (frame_velocity_is_zero) {
+    for (size_t i = 0; i < dim; ++i) {
+      frame_velocity.get(i) = make_with_value<T>(get<0, 0>(jac), 0.0);
+    }
+  }
+  Scalar<T> det_jac{};
+  InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jac{};
+  determinant_and_inverse(make_not_null(&det_jac), make_not_null(&inv_jac),
+                          jac);
   return std::tuple<tnsr::I<T, dim, TargetFrame>,
                     InverseJacobian<T, dim, SourceFrame, TargetFrame>,
                     Jacobian<T, dim, SourceFrame, TargetFrame>,
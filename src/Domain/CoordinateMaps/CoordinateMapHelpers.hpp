@@ -3,18 +3,24 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 namespace domain {
@@ -144,6 +150,88 @@ auto apply_inverse_map(
 }
 // @}
 
+CREATE_IS_CALLABLE(inverse)
+CREATE_IS_CALLABLE_V(inverse)
+
+/// Apply the inverse of `the_map` to all `points` at once. Points at which the
+/// inverse is invalid are removed from `points`, and their entries are removed
+/// from `indices`, which holds the position of each point in the original
+/// batch.
+///
+/// Time-independent maps that provide a batched `inverse` overload (taking a
+/// `gsl::not_null<std::array<DataVector, Dim>*>`, a
+/// `gsl::not_null<std::vector<bool>*>` and the target points) invert all
+/// points together. All other maps invert one point at a time.
+template <size_t Dim, typename Map>
+void apply_batched_inverse_map(
+    const gsl::not_null<std::array<DataVector, Dim>*> points,
+    const gsl::not_null<std::vector<size_t>*> indices, const Map& the_map,
+    const double t,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) noexcept {
+  using is_time_dependent = domain::is_map_time_dependent_t<Map>;
+  const size_t num_points = indices->size();
+  if (num_points == 0) {
+    return;
+  }
+  if constexpr (not is_time_dependent::value) {
+    if (the_map.is_identity()) {
+      return;
+    }
+  }
+  std::array<DataVector, Dim> source_points{};
+  std::vector<bool> is_valid{};
+  if constexpr (not is_time_dependent::value and
+                is_inverse_callable_v<
+                    const Map&, gsl::not_null<std::array<DataVector, Dim>*>,
+                    gsl::not_null<std::vector<bool>*>,
+                    const std::array<DataVector, Dim>&>) {
+    the_map.inverse(make_not_null(&source_points), make_not_null(&is_valid),
+                    *points);
+  } else {
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(source_points, d) = DataVector{num_points};
+    }
+    is_valid.assign(num_points, false);
+    std::array<double, Dim> point{};
+    for (size_t s = 0; s < num_points; ++s) {
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(point, d) = gsl::at(*points, d)[s];
+      }
+      const auto source_point = apply_inverse_map(
+          the_map, point, t, functions_of_time, is_time_dependent{});
+      if (source_point.has_value()) {
+        is_valid[s] = true;
+        for (size_t d = 0; d < Dim; ++d) {
+          gsl::at(source_points, d)[s] = gsl::at(source_point.value(), d);
+        }
+      }
+    }
+  }
+
+  const size_t num_valid_points = static_cast<size_t>(
+      std::count(is_valid.begin(), is_valid.end(), true));
+  if (num_valid_points == num_points) {
+    *points = std::move(source_points);
+    return;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(*points, d).destructive_resize(num_valid_points);
+  }
+  size_t valid_point = 0;
+  for (size_t s = 0; s < num_points; ++s) {
+    if (is_valid[s]) {
+      (*indices)[valid_point] = (*indices)[s];
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(*points, d)[valid_point] = gsl::at(source_points, d)[s];
+      }
+      ++valid_point;
+    }
+  }
+  indices->resize(num_valid_points);
+}
+
 // @{
 /// Compute the frame velocity
 template <typename T, size_t Dim, typename Map>
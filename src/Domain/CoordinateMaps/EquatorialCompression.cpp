@@ -6,6 +6,7 @@
 #include <cmath>  // IWYU pragma: keep
 #include <pup.h>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ContainerHelpers.hpp"
@@ -130,6 +131,14 @@ std::optional<std::array<double, 3>> EquatorialCompression::inverse(
   return angular_distortion(target_coords, aspect_ratio_);
 }
 
+void EquatorialCompression::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> source_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const std::array<DataVector, 3>& target_coords) const noexcept {
+  is_valid->assign(target_coords[0].size(), true);
+  *source_coords = angular_distortion(target_coords, aspect_ratio_);
+}
+
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame>
 EquatorialCompression::jacobian(const std::array<T, 3>& source_coords) const
@@ -7,11 +7,14 @@
 #include <cstddef>
 #include <limits>
 #include <optional>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace PUP {
 class er;
 }  // namespace PUP
@@ -71,6 +74,13 @@ class EquatorialCompression {
   std::optional<std::array<double, 3>> inverse(
       const std::array<double, 3>& target_coords) const noexcept;
 
+  /// Batched inverse of all `target_coords` at once. The inverse is the map
+  /// with the reciprocal aspect ratio, so it is evaluated in closed form and
+  /// every point is valid.
+  void inverse(gsl::not_null<std::array<DataVector, 3>*> source_coords,
+               gsl::not_null<std::vector<bool>*> is_valid,
+               const std::array<DataVector, 3>& target_coords) const noexcept;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> jacobian(
       const std::array<T, 3>& source_coords) const noexcept;
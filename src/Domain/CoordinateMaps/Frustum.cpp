@@ -7,6 +7,7 @@
 #include <cmath>
 #include <pup.h>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -163,6 +164,46 @@ std::optional<std::array<double, 3>> Frustum::inverse(
   return logical_coords;
 }
 
+void Frustum::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> source_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const std::array<DataVector, 3>& target_coords) const noexcept {
+  const std::array<DataVector, 3> physical_coords =
+      discrete_rotation(orientation_of_frustum_.inverse_map(), target_coords);
+  const size_t num_points = physical_coords[2].size();
+  is_valid->assign(num_points, true);
+
+  auto& logical_coords = *source_coords;
+  logical_coords[2] = (physical_coords[2] - sigma_z_) / delta_z_zeta_;
+  DataVector denom0 = delta_x_xi_ + delta_x_xi_zeta_ * logical_coords[2];
+  DataVector denom1 = delta_y_eta_ + delta_y_eta_zeta_ * logical_coords[2];
+  // Invalid points get a unit denominator so that the vectorized evaluation
+  // never divides by zero.
+  for (size_t s = 0; s < num_points; ++s) {
+    if (denom0[s] < 0.0 or equal_within_roundoff(denom0[s], 0.0) or
+        denom1[s] < 0.0 or equal_within_roundoff(denom1[s], 0.0)) {
+      (*is_valid)[s] = false;
+      denom0[s] = 1.0;
+      denom1[s] = 1.0;
+    }
+  }
+
+  logical_coords[0] =
+      (physical_coords[0] - sigma_x_ - delta_x_zeta_ * logical_coords[2]) /
+      denom0;
+  logical_coords[1] =
+      (physical_coords[1] - sigma_y_ - delta_y_zeta_ * logical_coords[2]) /
+      denom1;
+  if (with_equiangular_map_) {
+    logical_coords[0] = atan(logical_coords[0]) / M_PI_4;
+    logical_coords[1] = atan(logical_coords[1]) / M_PI_4;
+  }
+  if (with_projective_map_) {
+    logical_coords[2] = (-w_minus_ + w_plus_ * logical_coords[2]) /
+                        (w_plus_ - w_minus_ * logical_coords[2]);
+  }
+}
+
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Frustum::jacobian(
     const std::array<T, 3>& source_coords) const noexcept {
@@ -7,11 +7,17 @@
 #include <cstddef>
 #include <limits>
 #include <optional>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
+/// \cond
+class DataVector;
+/// \endcond
+
 /// \cond
 namespace PUP {
 class er;
@@ -188,6 +194,14 @@ class Frustum {
   std::optional<std::array<double, 3>> inverse(
       const std::array<double, 3>& target_coords) const noexcept;
 
+  /// Batched inverse of all `target_coords` at once, evaluated with
+  /// vectorized operations. `is_valid` is set to whether the inverse is valid
+  /// at each point, with the same conditions as for a single point. The
+  /// `source_coords` of invalid points are unspecified.
+  void inverse(gsl::not_null<std::array<DataVector, 3>*> source_coords,
+               gsl::not_null<std::vector<bool>*> is_valid,
+               const std::array<DataVector, 3>& target_coords) const noexcept;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> jacobian(
       const std::array<T, 3>& source_coords) const noexcept;
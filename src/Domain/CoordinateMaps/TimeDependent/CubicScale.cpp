@@ -16,6 +16,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/FunctionsOfTime/CachedEvaluation.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "NumericalAlgorithms/RootFinding/NewtonRaphson.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -61,7 +62,8 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::operator()(
              << f_of_t_b_ << "' in functions of time. Known functions are "
              << keys_of(functions_of_time));
 
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double a_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_a_, time)[0][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -72,7 +74,8 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::operator()(
     return result;
   }
 
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double b_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_b_, time)[0][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -112,7 +115,8 @@ CubicScale<Dim>::inverse(
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
     const double one_over_a_of_t =
-        1.0 / functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+        1.0 / domain::FunctionsOfTime::cached_func_and_derivs<0>(
+            functions_of_time, f_of_t_a_, time)[0][0];
 
     // Construct std::optional to have a default value of an empty array.
     // Doing just result{} would construct a std::optional that doesn't hold a
@@ -129,8 +133,10 @@ CubicScale<Dim>::inverse(
   // (b-a)/R^2*\rho^3 + a*\rho - r = 0,
   // where a and b are the FunctionsOfTime, R is the outer_boundary, and r is
   // the mapped/target coordinates radius.
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double a_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_a_, time)[0][0];
+  const double b_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_b_, time)[0][0];
 
   // these checks ensure that the function is monotonically increasing
   // and that there is one real root in the domain of \rho, [0,R]
@@ -223,7 +229,8 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::frame_velocity(
              << keys_of(functions_of_time));
 
   const double dt_a_of_t =
-      functions_of_time.at(f_of_t_a_)->func_and_deriv(time)[1][0];
+      domain::FunctionsOfTime::cached_func_and_derivs<1>(
+          functions_of_time, f_of_t_a_, time)[1][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -235,7 +242,8 @@ std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::frame_velocity(
   }
 
   const double dt_b_of_t =
-      functions_of_time.at(f_of_t_b_)->func_and_deriv(time)[1][0];
+      domain::FunctionsOfTime::cached_func_and_derivs<1>(
+          functions_of_time, f_of_t_b_, time)[1][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -272,7 +280,8 @@ CubicScale<Dim>::jacobian(
              << f_of_t_b_ << "' in functions of time. Known functions are "
              << keys_of(functions_of_time));
 
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double a_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_a_, time)[0][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -285,7 +294,8 @@ CubicScale<Dim>::jacobian(
     return jac;
   }
 
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double b_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_b_, time)[0][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -333,7 +343,8 @@ CubicScale<Dim>::inv_jacobian(
              << f_of_t_b_ << "' in functions of time. Known functions are "
              << keys_of(functions_of_time));
 
-  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double a_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_a_, time)[0][0];
 
   if (functions_of_time_equal_) {
     // optimization for linear radial scaling
@@ -347,7 +358,8 @@ CubicScale<Dim>::inv_jacobian(
     return inv_jac;
   }
 
-  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  const double b_of_t = domain::FunctionsOfTime::cached_func_and_derivs<0>(
+      functions_of_time, f_of_t_b_, time)[0][0];
 
   tt::remove_cvref_wrap_t<T> rho_squared =
       square(dereference_wrapper(source_coords[0]));
@@ -12,6 +12,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/FunctionsOfTime/CachedEvaluation.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -31,7 +32,8 @@ Matrix rotation_matrix(
                                      "time. The known functions of time are: "
                                   << keys_of(functions_of_time));
   const double rotation_angle =
-      functions_of_time.at(f_of_t_name)->func(time)[0][0];
+      domain::FunctionsOfTime::cached_func_and_derivs<0>(
+          functions_of_time, f_of_t_name, time)[0][0];
   return Matrix{{cos(rotation_angle), -sin(rotation_angle)},
                           {sin(rotation_angle), cos(rotation_angle)}};
 }
@@ -103,7 +105,8 @@ std::array<tt::remove_cvref_wrap_t<T>, 2> Rotation<2>::frame_velocity(
   const Matrix rot_matrix =
       rotation_matrix(f_of_t_name_, time, functions_of_time);
   const double rotation_angular_velocity =
-      functions_of_time.at(f_of_t_name_)->func_and_deriv(time)[1][0];
+      domain::FunctionsOfTime::cached_func_and_derivs<1>(
+          functions_of_time, f_of_t_name_, time)[1][0];
   return {{(source_coords[0] * rot_matrix(0, 1) -
             source_coords[1] * rot_matrix(0, 0)) *
                rotation_angular_velocity,
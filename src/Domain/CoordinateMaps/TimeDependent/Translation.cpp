@@ -10,6 +10,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
+#include "Domain/FunctionsOfTime/CachedEvaluation.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -34,7 +35,8 @@ std::array<tt::remove_cvref_wrap_t<T>, 1> Translation::operator()(
                                      "time. The known functions of time are: "
                                   << keys_of(functions_of_time));
   return {{source_coords[0] +
-           functions_of_time.at(f_of_t_name_)->func(time)[0][0]}};
+           domain::FunctionsOfTime::cached_func_and_derivs<0>(
+               functions_of_time, f_of_t_name_, time)[0][0]}};
 }
 
 std::optional<std::array<double, 1>> Translation::inverse(
@@ -48,7 +50,8 @@ std::optional<std::array<double, 1>> Translation::inverse(
                                      "time. The known functions of time are: "
                                   << keys_of(functions_of_time));
   return {{{target_coords[0] -
-            functions_of_time.at(f_of_t_name_)->func(time)[0][0]}}};
+            domain::FunctionsOfTime::cached_func_and_derivs<0>(
+                functions_of_time, f_of_t_name_, time)[0][0]}}};
 }
 
 template <typename T>
@@ -64,7 +67,8 @@ std::array<tt::remove_cvref_wrap_t<T>, 1> Translation::frame_velocity(
                                   << keys_of(functions_of_time));
   return {{make_with_value<tt::remove_cvref_wrap_t<T>>(
       dereference_wrapper(source_coords[0]),
-      functions_of_time.at(f_of_t_name_)->func_and_deriv(time)[1][0])}};
+      domain::FunctionsOfTime::cached_func_and_derivs<1>(
+          functions_of_time, f_of_t_name_, time)[1][0])}};
 }
 
 template <typename T>
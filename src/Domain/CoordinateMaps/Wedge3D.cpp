@@ -6,6 +6,7 @@
 #include <cmath>
 #include <pup.h>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -172,6 +173,67 @@ std::optional<std::array<double, 3>> Wedge3D::inverse(
   return std::array<double, 3>{{xi, eta, zeta}};
 }
 
+void Wedge3D::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> source_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const std::array<DataVector, 3>& target_coords) const noexcept {
+  std::array<DataVector, 3> physical_coords =
+      discrete_rotation(orientation_of_wedge_.inverse_map(), target_coords);
+  DataVector& physical_x = physical_coords[0];
+  DataVector& physical_y = physical_coords[1];
+  DataVector& physical_z = physical_coords[2];
+  const size_t num_points = physical_z.size();
+  is_valid->assign(num_points, true);
+
+  // The validity checks are the same as for a single point (see above).
+  // Invalid points are moved to the pole so that the vectorized evaluation
+  // never divides by zero.
+  for (size_t s = 0; s < num_points; ++s) {
+    if (physical_z[s] < 0.0 or equal_within_roundoff(physical_z[s], 0.0)) {
+      (*is_valid)[s] = false;
+      physical_x[s] = 0.0;
+      physical_y[s] = 0.0;
+      physical_z[s] = 1.0;
+    }
+  }
+  auto& logical_coords = *source_coords;
+  logical_coords[0] = physical_x / physical_z;
+  logical_coords[1] = physical_y / physical_z;
+  // These hold the capitalized coordinates until they are converted to the
+  // logical coordinates below
+  DataVector& cap_xi = logical_coords[0];
+  DataVector& cap_eta = logical_coords[1];
+  const DataVector rho = sqrt(1.0 + square(cap_xi) + square(cap_eta));
+  DataVector zeta_coefficient = scaled_frustum_rate_ + sphere_rate_ / rho;
+  for (size_t s = 0; s < num_points; ++s) {
+    if ((scaled_frustum_rate_ > 0.0 and scaled_frustum_rate_ < -sphere_rate_ and
+         zeta_coefficient[s] > 0.0) or
+        (scaled_frustum_rate_ < 0.0 and scaled_frustum_rate_ > -sphere_rate_ and
+         zeta_coefficient[s] < 0.0) or
+        equal_within_roundoff(zeta_coefficient[s], 0.0)) {
+      (*is_valid)[s] = false;
+      zeta_coefficient[s] = 1.0;
+    }
+  }
+
+  if (with_logarithmic_map_) {
+    logical_coords[2] = (log(physical_z * rho) - sphere_zero_) / sphere_rate_;
+  } else {
+    logical_coords[2] =
+        (physical_z - scaled_frustum_zero_ - sphere_zero_ / rho) /
+        zeta_coefficient;
+  }
+  if (with_equiangular_map_) {
+    cap_xi = atan(cap_xi) / M_PI_4;
+    cap_eta = atan(cap_eta) / M_PI_4;
+  }
+  if (halves_to_use_ == WedgeHalves::UpperOnly) {
+    cap_xi = 2.0 * cap_xi - 1.0;
+  } else if (halves_to_use_ == WedgeHalves::LowerOnly) {
+    cap_xi = 2.0 * cap_xi + 1.0;
+  }
+}
+
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Wedge3D::jacobian(
     const std::array<T, 3>& source_coords) const noexcept {
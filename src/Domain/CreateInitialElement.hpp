@@ -25,7 +25,8 @@ namespace Initialization {
  * \details This function creates an element at the refinement level and
  * position specified by the `element_id` within the `block`. It assumes
  * that all elements in a given block have the same refinement level,
- * given in `initial_refinement_levels`.
+ * given in `initial_refinement_levels`. The neighbors are on the same grid as
+ * the element, i.e. they have the same `ElementId::grid_index()`.
  */
 template <size_t VolumeDim>
 Element<VolumeDim> create_initial_element(
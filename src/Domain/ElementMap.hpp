@@ -7,9 +7,13 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -28,6 +32,12 @@ class er;
  * map corresponds to the coordinate map for the Element rather than the Block.
  * This allows DomainCreators to only specify the maps for the Blocks without
  * worrying about how the domain may be decomposed beyond that.
+ *
+ * If the block map is time-dependent, the `time` and `functions_of_time` are
+ * forwarded to it. `coords_frame_velocity_jacobians` evaluates everything
+ * needed on a moving mesh with a single (virtual) call to the block map, so
+ * the type-erased map is dispatched and the composed maps are traversed only
+ * once per element and time.
  */
 template <size_t Dim, typename TargetFrame>
 class ElementMap {
@@ -54,16 +64,28 @@ class ElementMap {
 
   template <typename T>
   tnsr::I<T, Dim, TargetFrame> operator()(
-      tnsr::I<T, Dim, Frame::Logical> source_point) const noexcept {
+      tnsr::I<T, Dim, Frame::Logical> source_point,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = {}) const noexcept {
     apply_affine_transformation_to_point(source_point);
-    return block_map_->operator()(std::move(source_point));
+    return block_map_->operator()(std::move(source_point), time,
+                                  functions_of_time);
   }
 
   template <typename T>
   tnsr::I<T, Dim, Frame::Logical> inverse(
-      tnsr::I<T, Dim, TargetFrame> target_point) const noexcept {
+      tnsr::I<T, Dim, TargetFrame> target_point,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = {}) const noexcept {
     auto source_point{
-        block_map_->inverse(std::move(target_point)).value()};
+        block_map_->inverse(std::move(target_point), time, functions_of_time)
+            .value()};
     // Apply the affine map to the points
     for (size_t d = 0; d < Dim; ++d) {
       source_point.get(d) =
@@ -75,30 +97,59 @@ class ElementMap {
 
   template <typename T>
   InverseJacobian<T, Dim, Frame::Logical, TargetFrame> inv_jacobian(
-      tnsr::I<T, Dim, Frame::Logical> source_point) const noexcept {
+      tnsr::I<T, Dim, Frame::Logical> source_point,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = {}) const noexcept {
     apply_affine_transformation_to_point(source_point);
-    auto inv_jac = block_map_->inv_jacobian(std::move(source_point));
-    for (size_t d = 0; d < Dim; ++d) {
-      for (size_t i = 0; i < Dim; ++i) {
-        inv_jac.get(d, i) *= gsl::at(inverse_jacobian_, d);
-      }
-    }
+    auto inv_jac = block_map_->inv_jacobian(std::move(source_point), time,
+                                            functions_of_time);
+    apply_affine_transformation_to_inv_jacobian(make_not_null(&inv_jac));
     return inv_jac;
   }
 
   template <typename T>
   Jacobian<T, Dim, Frame::Logical, TargetFrame> jacobian(
-      tnsr::I<T, Dim, Frame::Logical> source_point) const noexcept {
+      tnsr::I<T, Dim, Frame::Logical> source_point,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = {}) const noexcept {
     apply_affine_transformation_to_point(source_point);
-    auto jac = block_map_->jacobian(std::move(source_point));
-    for (size_t d = 0; d < Dim; ++d) {
-      for (size_t i = 0; i < Dim; ++i) {
-        jac.get(i, d) *= gsl::at(jacobian_, d);
-      }
-    }
+    auto jac =
+        block_map_->jacobian(std::move(source_point), time, functions_of_time);
+    apply_affine_transformation_to_jacobian(make_not_null(&jac));
     return jac;
   }
 
+  /// The target coordinates, the inverse Jacobian, the Jacobian and the frame
+  /// velocity, computed with a single call to
+  /// `CoordinateMapBase::coords_frame_velocity_jacobians` of the block map
+  template <typename T>
+  std::tuple<tnsr::I<T, Dim, TargetFrame>,
+             InverseJacobian<T, Dim, Frame::Logical, TargetFrame>,
+             Jacobian<T, Dim, Frame::Logical, TargetFrame>,
+             tnsr::I<T, Dim, TargetFrame>>
+  coords_frame_velocity_jacobians(
+      tnsr::I<T, Dim, Frame::Logical> source_point,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = {}) const noexcept {
+    apply_affine_transformation_to_point(source_point);
+    auto result = block_map_->coords_frame_velocity_jacobians(
+        std::move(source_point), time, functions_of_time);
+    apply_affine_transformation_to_inv_jacobian(
+        make_not_null(&std::get<1>(result)));
+    apply_affine_transformation_to_jacobian(
+        make_not_null(&std::get<2>(result)));
+    return result;
+  }
+
   // clang-tidy: do not use references
   void pup(PUP::er& p) noexcept;  // NOLINT
 
@@ -112,6 +163,28 @@ class ElementMap {
     }
   }
 
+  template <typename T>
+  void apply_affine_transformation_to_inv_jacobian(
+      const gsl::not_null<InverseJacobian<T, Dim, Frame::Logical, TargetFrame>*>
+          inv_jac) const noexcept {
+    for (size_t d = 0; d < Dim; ++d) {
+      for (size_t i = 0; i < Dim; ++i) {
+        inv_jac->get(d, i) *= gsl::at(inverse_jacobian_, d);
+      }
+    }
+  }
+
+  template <typename T>
+  void apply_affine_transformation_to_jacobian(
+      const gsl::not_null<Jacobian<T, Dim, Frame::Logical, TargetFrame>*> jac)
+      const noexcept {
+    for (size_t d = 0; d < Dim; ++d) {
+      for (size_t i = 0; i < Dim; ++i) {
+        jac->get(i, d) *= gsl::at(jacobian_, d);
+      }
+    }
+  }
+
   std::unique_ptr<domain::CoordinateMapBase<Frame::Logical, TargetFrame, Dim>>
       block_map_{nullptr};
   ElementId<Dim> element_id_{};
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/FunctionsOfTime/CachedEvaluation.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace domain::FunctionsOfTime {
+namespace {
+template <size_t MaxDerivReturned>
+struct CacheEntry {
+  size_t version{std::numeric_limits<size_t>::max()};
+  double time{std::numeric_limits<double>::signaling_NaN()};
+  std::array<DataVector, MaxDerivReturned + 1> values{};
+};
+}  // namespace
+
+template <size_t MaxDerivReturned>
+const std::array<DataVector, MaxDerivReturned + 1>& cached_func_and_derivs(
+    const std::unordered_map<std::string, std::unique_ptr<FunctionOfTime>>&
+        functions_of_time,
+    const std::string& name, const double t) noexcept {
+  static_assert(MaxDerivReturned < 3,
+                "Functions of time provide at most two derivatives.");
+  // Charm++ runs one PE per thread, so this cache is per-PE
+  thread_local std::unordered_map<std::string, CacheEntry<MaxDerivReturned>>
+      cache{};
+
+  const auto function_of_time_it = functions_of_time.find(name);
+  if (UNLIKELY(function_of_time_it == functions_of_time.end())) {
+    ERROR("The function of time '"
+          << name
+          << "' is not one of the known functions of time. The known "
+             "functions of time are: "
+          << keys_of(functions_of_time));
+  }
+  const FunctionOfTime& function_of_time = *function_of_time_it->second;
+
+  auto& entry = cache[name];
+  if (entry.version != function_of_time.version() or entry.time != t) {
+    if constexpr (MaxDerivReturned == 0) {
+      function_of_time.func(make_not_null(&entry.values), t);
+    } else if constexpr (MaxDerivReturned == 1) {
+      function_of_time.func_and_deriv(make_not_null(&entry.values), t);
+    } else {
+      function_of_time.func_and_2_derivs(make_not_null(&entry.values), t);
+    }
+    entry.version = function_of_time.version();
+    entry.time = t;
+  }
+  return entry.values;
+}
+
+/// \cond
+#define DERIV(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                                \
+  template const std::array<DataVector, DERIV(data) + 1>&                   \
+  cached_func_and_derivs<DERIV(data)>(                                      \
+      const std::unordered_map<std::string,                                 \
+                               std::unique_ptr<FunctionOfTime>>&,           \
+      const std::string&, double) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (0, 1, 2))
+
+#undef DERIV
+#undef INSTANTIATE
+/// \endcond
+}  // namespace domain::FunctionsOfTime
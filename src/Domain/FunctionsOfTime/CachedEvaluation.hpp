@@ -0,0 +1,43 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/// \cond
+class DataVector;
+namespace domain::FunctionsOfTime {
+class FunctionOfTime;
+}  // namespace domain::FunctionsOfTime
+/// \endcond
+
+namespace domain::FunctionsOfTime {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief The function of time `name` and its first `MaxDerivReturned`
+ * derivatives at time `t`, memoized on each PE.
+ *
+ * Time-dependent maps evaluate the same functions of time at the same time
+ * for every element on a PE. The evaluation is stored in a thread-local, and
+ * therefore per-PE, cache keyed on the name of the function of time, and
+ * repeated calls at the same time return a reference to the cached value
+ * without recomputing or allocating. Only the most recent time is kept for
+ * each name and number of derivatives.
+ *
+ * The cached value is recomputed if the `FunctionOfTime::version()` changed,
+ * so replacing or updating a function of time invalidates the cache.
+ *
+ * \warning The returned reference is only valid until the next call to this
+ * function with the same `name` and `MaxDerivReturned` on the same PE.
+ */
+template <size_t MaxDerivReturned>
+const std::array<DataVector, MaxDerivReturned + 1>& cached_func_and_derivs(
+    const std::unordered_map<std::string, std::unique_ptr<FunctionOfTime>>&
+        functions_of_time,
+    const std::string& name, double t) noexcept;
+}  // namespace domain::FunctionsOfTime
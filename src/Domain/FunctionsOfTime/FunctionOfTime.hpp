@@ -4,12 +4,15 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <pup.h>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace domain {
 /// \ingroup ComputationalDomainGroup
@@ -20,10 +23,17 @@ namespace FunctionsOfTime {
 class FunctionOfTime : public PUP::able {
  public:
   FunctionOfTime() = default;
-  FunctionOfTime(FunctionOfTime&&) noexcept = default;
-  FunctionOfTime& operator=(FunctionOfTime&&) noexcept = default;
-  FunctionOfTime(const FunctionOfTime&) = default;
-  FunctionOfTime& operator=(const FunctionOfTime&) = default;
+  // The special members give the new state a new version
+  FunctionOfTime(FunctionOfTime&& /*rhs*/) noexcept : PUP::able() {}
+  FunctionOfTime& operator=(FunctionOfTime&& /*rhs*/) noexcept {
+    update_version();
+    return *this;
+  }
+  FunctionOfTime(const FunctionOfTime& /*rhs*/) noexcept : PUP::able() {}
+  FunctionOfTime& operator=(const FunctionOfTime& /*rhs*/) noexcept {
+    update_version();
+    return *this;
+  }
   ~FunctionOfTime() override = default;
 
   virtual auto get_clone() const noexcept
@@ -40,7 +50,55 @@ class FunctionOfTime : public PUP::able {
   virtual std::array<DataVector, 3> func_and_2_derivs(double t) const
       noexcept = 0;
 
+  // @{
+  /// Write the function and its derivatives at time `t` into `result`.
+  ///
+  /// Derived classes override these to reuse the allocations in `result`.
+  /// The default implementations call the allocating overloads.
+  virtual void func(const gsl::not_null<std::array<DataVector, 1>*> result,
+                    const double t) const noexcept {
+    *result = func(t);
+  }
+  virtual void func_and_deriv(
+      const gsl::not_null<std::array<DataVector, 2>*> result,
+      const double t) const noexcept {
+    *result = func_and_deriv(t);
+  }
+  virtual void func_and_2_derivs(
+      const gsl::not_null<std::array<DataVector, 3>*> result,
+      const double t) const noexcept {
+    *result = func_and_2_derivs(t);
+  }
+  // @}
+
+  /// An identifier of this object and its current state on this process.
+  ///
+  /// The version changes whenever the function of time is constructed,
+  /// assigned, deserialized or updated, so it can be used to check whether
+  /// cached evaluations are still valid.
+  size_t version() const noexcept { return version_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    PUP::able::pup(p);
+    if (p.isUnpacking()) {
+      update_version();
+    }
+  }
+
   WRAPPED_PUPable_abstract(FunctionOfTime);  // NOLINT
+
+ protected:
+  /// Derived classes must call this when their state changes.
+  void update_version() noexcept { version_ = next_version(); }
+
+ private:
+  static size_t next_version() noexcept {
+    static std::atomic<size_t> counter{0};
+    return counter++;
+  }
+
+  size_t version_{next_version()};
 };
 }  // namespace FunctionsOfTime
 }  // namespace domain
@@ -17,7 +17,6 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
-#include "Utilities/MakeArray.hpp"
 
 namespace domain::FunctionsOfTime {
 template <size_t MaxDeriv>
@@ -37,6 +36,16 @@ template <size_t MaxDeriv>
 template <size_t MaxDerivReturned>
 std::array<DataVector, MaxDerivReturned + 1>
 PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const noexcept {
+  std::array<DataVector, MaxDerivReturned + 1> result{};
+  func_and_derivs(make_not_null(&result), t);
+  return result;
+}
+
+template <size_t MaxDeriv>
+template <size_t MaxDerivReturned>
+void PiecewisePolynomial<MaxDeriv>::func_and_derivs(
+    const gsl::not_null<std::array<DataVector, MaxDerivReturned + 1>*> result,
+    const double t) const noexcept {
   if (t > expiration_time_) {
     ERROR("Attempt to evaluate PiecewisePolynomial at a time "
           << t << " that is after the expiration time " << expiration_time_
@@ -47,27 +56,32 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const noexcept {
   const double dt = t - deriv_info_at_t.time;
   const value_type& coefs = deriv_info_at_t.derivs_coefs;
 
-  // initialize result for the number of derivs requested
-  std::array<DataVector, MaxDerivReturned + 1> result =
-      make_array<MaxDerivReturned + 1>(DataVector(coefs.back().size(), 0.0));
+  // only reallocate the result if the number of components changed
+  const size_t number_of_components = coefs.back().size();
+  for (auto& deriv : *result) {
+    if (deriv.size() != number_of_components) {
+      deriv.destructive_resize(number_of_components);
+    }
+  }
 
   // evaluate the polynomial using ddpoly (Numerical Recipes sec 5.1)
-  result[0] = coefs[MaxDeriv];
+  (*result)[0] = coefs[MaxDeriv];
+  for (size_t k = 1; k < MaxDerivReturned + 1; ++k) {
+    gsl::at(*result, k) = 0.0;
+  }
   for (size_t j = MaxDeriv; j-- > 0;) {
     const size_t min_deriv = std::min(MaxDerivReturned, MaxDeriv - j);
     for (size_t k = min_deriv; k > 0; k--) {
-      gsl::at(result, k) = gsl::at(result, k) * dt + gsl::at(result, k - 1);
+      gsl::at(*result, k) = gsl::at(*result, k) * dt + gsl::at(*result, k - 1);
     }
-    result[0] = result[0] * dt + gsl::at(coefs, j);
+    (*result)[0] = (*result)[0] * dt + gsl::at(coefs, j);
   }
   // after the first derivative, factorial constants come in
   double fact = 1.0;
   for (size_t j = 2; j < MaxDerivReturned + 1; j++) {
     fact *= j;
-    gsl::at(result, j) *= fact;
+    gsl::at(*result, j) *= fact;
   }
-
-  return result;
 }
 
 template <size_t MaxDeriv>
@@ -125,6 +139,7 @@ void PiecewisePolynomial<MaxDeriv>::update(
 
   func[MaxDeriv] = std::move(updated_max_deriv);
   deriv_info_at_update_times_.emplace_back(time_of_update, std::move(func));
+  update_version();
 }
 
 template <size_t MaxDeriv>
@@ -232,9 +247,13 @@ GENERATE_INSTANTIATIONS(INSTANTIATE, (2, 3, 4))
 
 #undef INSTANTIATE
 
-#define INSTANTIATE(_, data)                                          \
-  template std::array<DataVector, DIMRETURNED(data) + 1>              \
-  PiecewisePolynomial<DIM(data)>::func_and_derivs<DIMRETURNED(data)>( \
+#define INSTANTIATE(_, data)                                             \
+  template std::array<DataVector, DIMRETURNED(data) + 1>                 \
+  PiecewisePolynomial<DIM(data)>::func_and_derivs<DIMRETURNED(data)>(    \
+      const double) const noexcept;                                      \
+  template void                                                          \
+  PiecewisePolynomial<DIM(data)>::func_and_derivs<DIMRETURNED(data)>(    \
+      const gsl::not_null<std::array<DataVector, DIMRETURNED(data) + 1>*>, \
       const double) const noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (2), (0, 1, 2))
@@ -13,6 +13,7 @@
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace domain {
 namespace FunctionsOfTime {
@@ -55,6 +56,32 @@ class PiecewisePolynomial : public FunctionOfTime {
     return func_and_derivs<2>(t);
   }
 
+  // @{
+  /// Write the function and its derivatives at time `t` into `result`.
+  /// Does not allocate if the `DataVector`s in `result` already have the
+  /// number of components of the function.
+  void func(const gsl::not_null<std::array<DataVector, 1>*> result,
+            const double t) const noexcept override {
+    func_and_derivs<0>(result, t);
+  }
+  void func_and_deriv(const gsl::not_null<std::array<DataVector, 2>*> result,
+                      const double t) const noexcept override {
+    func_and_derivs<1>(result, t);
+  }
+  void func_and_2_derivs(
+      const gsl::not_null<std::array<DataVector, 3>*> result,
+      const double t) const noexcept override {
+    func_and_derivs<2>(result, t);
+  }
+  // @}
+
+  /// Write the function and `MaxDerivReturned` derivatives at time `t` into
+  /// `result`, reusing its allocations.
+  template <size_t MaxDerivReturned = MaxDeriv>
+  void func_and_derivs(
+      gsl::not_null<std::array<DataVector, MaxDerivReturned + 1>*> result,
+      double t) const noexcept;
+
   /// Updates the `MaxDeriv`th derivative of the function at the given time.
   /// `updated_max_deriv` is a vector of the `MaxDeriv`ths for each component.
   /// `next_expiration_time` is the next expiration time.
@@ -46,6 +46,10 @@ class SettleToConstant : public FunctionOfTime {
 
   auto get_clone() const noexcept -> std::unique_ptr<FunctionOfTime> override;
 
+  using FunctionOfTime::func;
+  using FunctionOfTime::func_and_2_derivs;
+  using FunctionOfTime::func_and_deriv;
+
   /// Returns the function at an arbitrary time `t`.
   std::array<DataVector, 1> func(const double t) const noexcept override {
     return func_and_derivs<0>(t);
@@ -22,11 +22,14 @@ void bind_element_id_impl(py::module& m) {  // NOLINT
   // These bindings don't cover the full public interface yet. More bindings
   // can be added as needed.
   py::class_<ElementId<Dim>>(m, ("ElementId" + get_output(Dim) + "D").c_str())
-      .def(py::init<size_t>(), py::arg("block_id"))
-      .def(py::init<size_t, std::array<SegmentId, Dim>>(), py::arg("block_id"),
-           py::arg("segment_ids"))
+      .def(py::init<size_t, size_t>(), py::arg("block_id"),
+           py::arg("grid_index") = 0)
+      .def(py::init<size_t, std::array<SegmentId, Dim>, size_t>(),
+           py::arg("block_id"), py::arg("segment_ids"),
+           py::arg("grid_index") = 0)
       .def_property("block_id", &ElementId<Dim>::block_id, nullptr)
       .def_property("segment_ids", &ElementId<Dim>::segment_ids, nullptr)
+      .def_property("grid_index", &ElementId<Dim>::grid_index, nullptr)
       .def_static("external_boundary_id", &ElementId<Dim>::external_boundary_id)
       .def("__repr__",
            [](const ElementId<Dim>& element_id) {
@@ -44,6 +44,12 @@ class er;
  * by densely packing bits together. `SegmentId` is responsible for handling the
  * low-level bit manipulations to create an index that satisfies the size
  * constraints.
+ *
+ * The `grid_index` labels the grid that the element belongs to in a hierarchy
+ * of grids, such as the one used by a multigrid solver. It is zero for the
+ * elements of the computational domain (the finest grid) and identifies
+ * elements on coarser grids that may cover the same region of a Block as
+ * elements on other grids.
  */
 template <size_t VolumeDim>
 class ElementId {
@@ -59,11 +65,11 @@ class ElementId {
   ~ElementId() noexcept = default;
 
   /// Create the ElementId of the root Element of a Block.
-  explicit ElementId(size_t block_id) noexcept;
+  explicit ElementId(size_t block_id, size_t grid_index = 0) noexcept;
 
   /// Create an arbitrary ElementId.
-  ElementId(size_t block_id,
-            std::array<SegmentId, VolumeDim> segment_ids) noexcept;
+  ElementId(size_t block_id, std::array<SegmentId, VolumeDim> segment_ids,
+            size_t grid_index = 0) noexcept;
 
   ElementId<VolumeDim> id_of_child(size_t dim, Side side) const noexcept;
 
@@ -84,6 +90,17 @@ class ElementId {
     return segment_ids_;
   }
 
+  size_t grid_index() const noexcept {
+    ASSERT(
+        alg::all_of(
+            segment_ids_,
+            [this](const SegmentId& current_id) noexcept {
+              return current_id.grid_index() == segment_ids_[0].grid_index();
+            }),
+        "Not all of the `SegmentId`s inside `ElementId` have same grid index.");
+    return segment_ids_[0].grid_index();
+  }
+
   /// Serialization for Charm++
   void pup(PUP::er& p) noexcept;  // NOLINT
 
@@ -129,7 +146,8 @@ template <size_t VolumeDim>
 inline bool operator==(const ElementId<VolumeDim>& lhs,
                        const ElementId<VolumeDim>& rhs) noexcept {
   return lhs.block_id() == rhs.block_id() and
-         lhs.segment_ids() == rhs.segment_ids();
+         lhs.segment_ids() == rhs.segment_ids() and
+         lhs.grid_index() == rhs.grid_index();
 }
 
 template <size_t VolumeDim>
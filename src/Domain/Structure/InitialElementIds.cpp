@@ -14,12 +14,13 @@
 template <>
 std::vector<ElementId<1>> initial_element_ids<1>(
     const size_t block_id,
-    const std::array<size_t, 1> initial_ref_levs) noexcept {
+    const std::array<size_t, 1> initial_ref_levs,
+    const size_t grid_index) noexcept {
   std::vector<ElementId<1>> ids;
   ids.reserve(two_to_the(initial_ref_levs[0]));
   for (size_t x_i = 0; x_i < two_to_the(initial_ref_levs[0]); ++x_i) {
     SegmentId x_segment_id(initial_ref_levs[0], x_i);
-    ids.emplace_back(block_id, make_array<1>(x_segment_id));
+    ids.emplace_back(block_id, make_array<1>(x_segment_id), grid_index);
   }
   return ids;
 }
@@ -27,7 +28,8 @@ std::vector<ElementId<1>> initial_element_ids<1>(
 template <>
 std::vector<ElementId<2>> initial_element_ids<2>(
     const size_t block_id,
-    const std::array<size_t, 2> initial_ref_levs) noexcept {
+    const std::array<size_t, 2> initial_ref_levs,
+    const size_t grid_index) noexcept {
   std::vector<ElementId<2>> ids;
   ids.reserve(two_to_the(initial_ref_levs[0]) *
               two_to_the(initial_ref_levs[1]));
@@ -35,7 +37,8 @@ std::vector<ElementId<2>> initial_element_ids<2>(
     SegmentId x_segment_id(initial_ref_levs[0], x_i);
     for (size_t y_i = 0; y_i < two_to_the(initial_ref_levs[1]); ++y_i) {
       SegmentId y_segment_id(initial_ref_levs[1], y_i);
-      ids.emplace_back(block_id, make_array(x_segment_id, y_segment_id));
+      ids.emplace_back(block_id, make_array(x_segment_id, y_segment_id),
+                       grid_index);
     }
   }
   return ids;
@@ -44,7 +47,8 @@ std::vector<ElementId<2>> initial_element_ids<2>(
 template <>
 std::vector<ElementId<3>> initial_element_ids<3>(
     const size_t block_id,
-    const std::array<size_t, 3> initial_ref_levs) noexcept {
+    const std::array<size_t, 3> initial_ref_levs,
+    const size_t grid_index) noexcept {
   std::vector<ElementId<3>> ids;
   ids.reserve(two_to_the(initial_ref_levs[0]) *
               two_to_the(initial_ref_levs[1]) *
@@ -56,7 +60,8 @@ std::vector<ElementId<3>> initial_element_ids<3>(
       for (size_t z_i = 0; z_i < two_to_the(initial_ref_levs[2]); ++z_i) {
         SegmentId z_segment_id(initial_ref_levs[2], z_i);
         ids.emplace_back(block_id,
-                         make_array(x_segment_id, y_segment_id, z_segment_id));
+                         make_array(x_segment_id, y_segment_id, z_segment_id),
+                         grid_index);
       }
     }
   }
@@ -65,13 +70,14 @@ std::vector<ElementId<3>> initial_element_ids<3>(
 
 template <size_t VolumeDim>
 std::vector<ElementId<VolumeDim>> initial_element_ids(
-    const std::vector<std::array<size_t, VolumeDim>>&
-        initial_refinement_levels) noexcept {
+    const std::vector<std::array<size_t, VolumeDim>>& initial_refinement_levels,
+    const size_t grid_index) noexcept {
   std::vector<ElementId<VolumeDim>> element_ids;
   for (size_t block_id = 0; block_id < initial_refinement_levels.size();
        ++block_id) {
     auto ids_for_block =
-        initial_element_ids(block_id, initial_refinement_levels[block_id]);
+        initial_element_ids(block_id, initial_refinement_levels[block_id],
+                            grid_index);
     element_ids.reserve(element_ids.size() + ids_for_block.size());
     std::move(ids_for_block.begin(), ids_for_block.end(),
               std::back_inserter(element_ids));
@@ -85,7 +91,8 @@ std::vector<ElementId<VolumeDim>> initial_element_ids(
   template std::vector<ElementId<GET_DIM(data)>>            \
   initial_element_ids<GET_DIM(data)>(                       \
       const std::vector<std::array<size_t, GET_DIM(data)>>& \
-          initial_refinement_levels) noexcept;
+          initial_refinement_levels,                        \
+      size_t grid_index) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -11,7 +11,10 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 
 SegmentId::SegmentId(const size_t refinement_level, const size_t index) noexcept
-    : block_id_(0), refinement_level_(refinement_level), index_(index) {
+    : block_id_(0),
+      refinement_level_(refinement_level),
+      grid_index_(0),
+      index_(index) {
   ASSERT(refinement_level <= max_refinement_level,
          "Refinement level out of bounds: " << refinement_level);
   ASSERT(index < two_to_the(refinement_level),
@@ -20,7 +23,10 @@ SegmentId::SegmentId(const size_t refinement_level, const size_t index) noexcept
 
 SegmentId::SegmentId(const size_t block_id, const size_t refinement_level,
                      const size_t index) noexcept
-    : block_id_(block_id), refinement_level_(refinement_level), index_(index) {
+    : block_id_(block_id),
+      refinement_level_(refinement_level),
+      grid_index_(0),
+      index_(index) {
   ASSERT(block_id < two_to_the(block_id_bits),
          "Block id out of bounds: " << block_id << "\nMaximum value is: "
                                     << two_to_the(block_id_bits) - 1);
@@ -57,14 +57,18 @@ class ElementId;
  * which means `SegmentId` must be the size of an `int` and satisfy
  * `std::is_pod`. In order to satisfy the size requirement, we use bitfields
  * internally in `SegmentId` with `ASSERT`s in the constructors to check for
- * potential overflows.
+ * potential overflows. The bitfields also hold the block id and the grid index
+ * of the `ElementId`, which are private to `SegmentId` and only set and
+ * retrieved by `ElementId`.
  */
 class SegmentId {
  public:
   static constexpr size_t block_id_bits = 7;
   static constexpr size_t refinement_bits = 5;
-  static constexpr size_t max_refinement_level = 20;
-  static_assert(block_id_bits + refinement_bits + max_refinement_level ==
+  static constexpr size_t grid_index_bits = 4;
+  static constexpr size_t max_refinement_level = 16;
+  static_assert(block_id_bits + refinement_bits + grid_index_bits +
+                        max_refinement_level ==
                     8 * sizeof(int),
                 "Bit representation requires padding or is too large");
   static_assert(two_to_the(refinement_bits) >= max_refinement_level,
@@ -125,9 +129,17 @@ class SegmentId {
                                       << two_to_the(block_id_bits) - 1);
     block_id_ = block_id;
   }
+  size_t grid_index() const noexcept { return grid_index_; }
+  void set_grid_index(const size_t grid_index) noexcept {
+    ASSERT(grid_index < two_to_the(grid_index_bits),
+           "Grid index out of bounds: " << grid_index << "\nMaximum value is: "
+                                        << two_to_the(grid_index_bits) - 1);
+    grid_index_ = grid_index;
+  }
 
   unsigned block_id_ : block_id_bits;
   unsigned refinement_level_ : refinement_bits;
+  unsigned grid_index_ : grid_index_bits;
   unsigned index_ : max_refinement_level;
 };
 
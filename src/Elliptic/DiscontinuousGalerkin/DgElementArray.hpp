@@ -21,6 +21,43 @@
 #include "Utilities/TaggedTuple.hpp"
 
 namespace elliptic {
+
+/*!
+ * \brief The default allocator of the `elliptic::DgElementArray`
+ *
+ * Creates the elements in all blocks of the domain at their initial refinement
+ * levels and distributes them round-robin over all processors.
+ */
+template <size_t Dim>
+struct DefaultElementsAllocator {
+  template <typename ParallelComponent, typename Metavariables,
+            typename... InitializationTags>
+  static void apply(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
+      const tuples::TaggedTuple<InitializationTags...>&
+          initialization_items) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    auto& element_array =
+        Parallel::get_parallel_component<ParallelComponent>(local_cache);
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(local_cache);
+    const auto& initial_refinement_levels =
+        get<domain::Tags::InitialRefinementLevels<Dim>>(initialization_items);
+    int which_proc = 0;
+    for (const auto& block : domain.blocks()) {
+      const auto initial_ref_levs = initial_refinement_levels[block.id()];
+      const std::vector<ElementId<Dim>> element_ids =
+          initial_element_ids(block.id(), initial_ref_levs);
+      const int number_of_procs = sys::number_of_procs();
+      for (size_t i = 0; i < element_ids.size(); ++i) {
+        element_array(ElementId<Dim>(element_ids[i]))
+            .insert(global_cache, initialization_items, which_proc);
+        which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+      }
+    }
+    element_array.doneInserting();
+  }
+};
+
 /*!
  * \brief The parallel component responsible for managing the DG elements that
  * compose the computational domain
@@ -28,12 +65,20 @@ namespace elliptic {
  * This parallel component will perform the actions specified by the
  * `PhaseDepActionList`.
  *
+ * The `ElementsAllocator` creates the elements of the array. It must provide a
+ * static `apply` function templated on the parallel component that takes the
+ * global cache and the initialization items, like
+ * `elliptic::DefaultElementsAllocator`. Use
+ * `LinearSolver::multigrid::ElementsAllocator` to create the elements of all
+ * grids in a multigrid hierarchy.
+ *
  * \note This parallel component is nearly identical to
  * `Evolution/DiscontinuousGalerkin/DgElementArray.hpp` right now, but will
- * likely diverge in the future, for instance to support a multigrid domain.
- *
+ * likely diverge in the future.
  */
-template <class Metavariables, class PhaseDepActionList>
+template <class Metavariables, class PhaseDepActionList,
+          class ElementsAllocator =
+              DefaultElementsAllocator<Metavariables::volume_dim>>
 struct DgElementArray {
   static constexpr size_t volume_dim = Metavariables::volume_dim;
 
@@ -54,7 +99,10 @@ struct DgElementArray {
   static void allocate_array(
       Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
       const tuples::tagged_tuple_from_typelist<initialization_tags>&
-          initialization_items) noexcept;
+          initialization_items) noexcept {
+    ElementsAllocator::template apply<DgElementArray>(global_cache,
+                                                      initialization_items);
+  }
 
   static void execute_next_phase(
       const typename Metavariables::Phase next_phase,
@@ -65,31 +113,4 @@ struct DgElementArray {
   }
 };
 
-template <class Metavariables, class PhaseDepActionList>
-void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
-    Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
-    const tuples::tagged_tuple_from_typelist<initialization_tags>&
-        initialization_items) noexcept {
-  auto& local_cache = *(global_cache.ckLocalBranch());
-  auto& dg_element_array =
-      Parallel::get_parallel_component<DgElementArray>(local_cache);
-  const auto& domain =
-      Parallel::get<domain::Tags::Domain<volume_dim>>(local_cache);
-  const auto& initial_refinement_levels =
-      get<domain::Tags::InitialRefinementLevels<volume_dim>>(
-          initialization_items);
-  int which_proc = 0;
-  for (const auto& block : domain.blocks()) {
-    const auto initial_ref_levs = initial_refinement_levels[block.id()];
-    const std::vector<ElementId<volume_dim>> element_ids =
-        initial_element_ids(block.id(), initial_ref_levs);
-    const int number_of_procs = sys::number_of_procs();
-    for (size_t i = 0; i < element_ids.size(); ++i) {
-      dg_element_array(ElementId<volume_dim>(element_ids[i]))
-          .insert(global_cache, initialization_items, which_proc);
-      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
-    }
-  }
-  dg_element_array.doneInserting();
-}
 }  // namespace elliptic
@@ -0,0 +1,229 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/StdArrayHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace elliptic::dg {
+
+/*!
+ * \brief The inverse Jacobian of an element packed into \f$D^2\f$ numbers, if
+ * it is constant over the element.
+ *
+ * The component \f$\partial\xi^j/\partial x^i\f$ is stored at index
+ * `j * Dim + i`. Returns `std::nullopt` if any component of the inverse
+ * Jacobian varies over the element, i.e. if the element map is not affine.
+ */
+template <size_t Dim>
+std::optional<std::array<double, Dim * Dim>> constant_inverse_jacobian(
+    const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
+        inv_jacobian) noexcept {
+  ASSERT(get<0, 0>(inv_jacobian).size() > 0,
+         "The inverse Jacobian has no grid points.");
+  std::array<double, Dim * Dim> result{};
+  for (size_t j = 0; j < Dim; ++j) {
+    for (size_t i = 0; i < Dim; ++i) {
+      const DataVector& component = inv_jacobian.get(j, i);
+      const double value = component[0];
+      for (const double component_value : component) {
+        // Only an exactly constant inverse Jacobian commutes with the
+        // logical derivatives, so don't tolerate roundoff differences
+        if (component_value != value) {
+          return std::nullopt;
+        }
+      }
+      gsl::at(result, j * Dim + i) = value;
+    }
+  }
+  return result;
+}
+
+/*!
+ * \brief Compute the divergence of the `fluxes` in the inertial frame
+ *
+ * This is a specialization of `divergence` for the elliptic DG operator, which
+ * applies the divergence on every linear solver iteration. When the inverse
+ * Jacobian of the element is constant (see
+ * `elliptic::dg::constant_inverse_jacobian`) it commutes with the logical
+ * derivatives, so the divergence can be written as
+ *
+ * \f{equation}
+ * \partial_i F^i = \sum_j \partial_{\xi^j} \left(\frac{\partial \xi^j}{\partial
+ * x^i} F^i\right) \text{.}
+ * \f}
+ *
+ * Contracting the fluxes with the packed inverse Jacobian first means that
+ * only one logical derivative of each of the contracted fluxes is needed. This
+ * reduces the number of (sum-factorized) derivative matrix multiplications by
+ * a factor of `Dim` compared to `divergence`, which takes all `Dim` logical
+ * derivatives of every flux component, and it avoids holding all logical
+ * derivatives in memory at once. For elements with a non-constant inverse
+ * Jacobian this function falls back to `divergence`.
+ *
+ * The contracted fluxes and the logical derivatives are stored in the
+ * `buffer`, which is resized only if it has the wrong size. Pass the same
+ * `buffer` to repeated calls on the same element to avoid allocating
+ * memory every time.
+ *
+ * \note This only replaces the volume divergence. The fluxes, the sources and
+ * the boundary lifting are still computed by separate DataBox items, because
+ * the face slices and the boundary scheme need the fluxes on their own.
+ */
+template <typename... DivTags, typename... FluxTags, size_t Dim>
+void div_fluxes(
+    const gsl::not_null<Variables<tmpl::list<DivTags...>>*> div_of_fluxes,
+    const gsl::not_null<DataVector*> buffer,
+    const Variables<tmpl::list<FluxTags...>>& fluxes, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
+        inv_jacobian,
+    const std::optional<std::array<double, Dim * Dim>>&
+        packed_inv_jacobian) noexcept {
+  if (not packed_inv_jacobian.has_value()) {
+    divergence(div_of_fluxes, fluxes, mesh, inv_jacobian);
+    return;
+  }
+  using div_vars_type = Variables<tmpl::list<DivTags...>>;
+  const size_t num_points = mesh.number_of_grid_points();
+  if (UNLIKELY(div_of_fluxes->number_of_grid_points() != num_points)) {
+    div_of_fluxes->initialize(num_points);
+  }
+  // In 1D the only logical derivative is written to `div_of_fluxes` directly
+  const size_t vars_size =
+      num_points * div_vars_type::number_of_independent_components;
+  buffer->destructive_resize((Dim > 1 ? 2 : 1) * vars_size);
+  div_vars_type contracted_fluxes{buffer->data(), vars_size};
+  div_vars_type logical_div{};
+  if constexpr (Dim > 1) {
+    logical_div.set_data_ref(buffer->data() + vars_size, vars_size);
+  }
+  const Matrix identity{};
+  auto matrices = make_array<Dim>(std::cref(identity));
+  for (size_t j = 0; j < Dim; ++j) {
+    const auto contract_fluxes = [&contracted_fluxes, &fluxes, &j,
+                                  &packed_inv_jacobian](
+                                     auto flux_tag_v,
+                                     auto div_tag_v) noexcept {
+      using FluxTag = std::decay_t<decltype(flux_tag_v)>;
+      using DivTag = std::decay_t<decltype(div_tag_v)>;
+      const auto& flux = get<FluxTag>(fluxes);
+      auto& contracted_flux = get<DivTag>(contracted_fluxes);
+      for (auto it = contracted_flux.begin(); it != contracted_flux.end();
+           ++it) {
+        const auto div_indices = contracted_flux.get_tensor_index(it);
+        *it = gsl::at(*packed_inv_jacobian, j * Dim) *
+              flux.get(prepend(div_indices, size_t{0}));
+        for (size_t i = 1; i < Dim; ++i) {
+          *it += gsl::at(*packed_inv_jacobian, j * Dim + i) *
+                 flux.get(prepend(div_indices, i));
+        }
+      }
+    };
+    EXPAND_PACK_LEFT_TO_RIGHT(contract_fluxes(FluxTags{}, DivTags{}));
+    gsl::at(matrices, j) =
+        std::cref(Spectral::differentiation_matrix(mesh.slice_through(j)));
+    if (j == 0) {
+      apply_matrices(div_of_fluxes, matrices, contracted_fluxes,
+                     mesh.extents());
+    } else {
+      apply_matrices(make_not_null(&logical_div), matrices, contracted_fluxes,
+                     mesh.extents());
+      *div_of_fluxes += logical_div;
+    }
+    gsl::at(matrices, j) = std::cref(identity);
+  }
+}
+
+/// Same as above, but allocates the memory for intermediate results
+template <typename... DivTags, typename... FluxTags, size_t Dim>
+void div_fluxes(
+    const gsl::not_null<Variables<tmpl::list<DivTags...>>*> div_of_fluxes,
+    const Variables<tmpl::list<FluxTags...>>& fluxes, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
+        inv_jacobian,
+    const std::optional<std::array<double, Dim * Dim>>&
+        packed_inv_jacobian) noexcept {
+  DataVector buffer{};
+  div_fluxes(div_of_fluxes, make_not_null(&buffer), fluxes, mesh, inv_jacobian,
+             packed_inv_jacobian);
+}
+
+namespace Tags {
+/*!
+ * \brief The inverse Jacobian of the element packed into \f$D^2\f$ numbers,
+ * or `std::nullopt` if it is not constant over the element
+ *
+ * \see elliptic::dg::constant_inverse_jacobian
+ */
+template <size_t Dim>
+struct ConstantInverseJacobian : db::SimpleTag {
+  using type = std::optional<std::array<double, Dim * Dim>>;
+};
+
+/// \see elliptic::dg::Tags::ConstantInverseJacobian
+template <size_t Dim>
+struct ConstantInverseJacobianCompute : ConstantInverseJacobian<Dim>,
+                                        db::ComputeTag {
+  using base = ConstantInverseJacobian<Dim>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<
+      domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>>;
+  static void function(
+      const gsl::not_null<return_type*> packed_inv_jacobian,
+      const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
+          inv_jacobian) noexcept {
+    *packed_inv_jacobian = constant_inverse_jacobian(inv_jacobian);
+  }
+};
+
+/*!
+ * \brief Compute the divergence of the `FluxesTag` with
+ * `elliptic::dg::div_fluxes`
+ *
+ * This tag inherits from `db::add_tag_prefix<::Tags::div, FluxesTag>`, so it
+ * can be used in place of `::Tags::DivVariablesCompute`.
+ */
+template <size_t Dim, typename FluxesTag>
+struct DivFluxesCompute : db::add_tag_prefix<::Tags::div, FluxesTag>,
+                          db::ComputeTag {
+  using base = db::add_tag_prefix<::Tags::div, FluxesTag>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<
+      FluxesTag, domain::Tags::Mesh<Dim>,
+      domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>,
+      ConstantInverseJacobian<Dim>>;
+  static void function(
+      const gsl::not_null<return_type*> div_of_fluxes,
+      const typename FluxesTag::type& fluxes, const Mesh<Dim>& mesh,
+      const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
+          inv_jacobian,
+      const std::optional<std::array<double, Dim * Dim>>&
+          packed_inv_jacobian) noexcept {
+    div_fluxes(div_of_fluxes, fluxes, mesh, inv_jacobian, packed_inv_jacobian);
+  }
+};
+}  // namespace Tags
+}  // namespace elliptic::dg
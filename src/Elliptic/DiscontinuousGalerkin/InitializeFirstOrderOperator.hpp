@@ -12,10 +12,10 @@
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Tags.hpp"
+#include "Elliptic/DiscontinuousGalerkin/DivFluxes.hpp"
 #include "Elliptic/FirstOrderComputeTags.hpp"
 #include "Elliptic/Tags.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
-#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/TMPL.hpp"
@@ -56,8 +56,6 @@ struct InitializeFirstOrderOperator {
       db::add_tag_prefix<::Tags::Flux, vars_tag, tmpl::size_t<volume_dim>,
                          Frame::Inertial>;
   using div_fluxes_tag = db::add_tag_prefix<::Tags::div, fluxes_tag>;
-  using inv_jacobian_tag =
-      domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>;
 
   template <typename Directions>
   using face_tags =
@@ -95,7 +93,10 @@ struct InitializeFirstOrderOperator {
   using simple_tags = tmpl::list<exterior_vars_tag>;
   using compute_tags = tmpl::flatten<tmpl::list<
       fluxes_compute_tag, sources_compute_tag,
-      ::Tags::DivVariablesCompute<fluxes_tag, inv_jacobian_tag>,
+      // The flux divergence is recomputed on every solver iteration, so it
+      // uses a specialized kernel that exploits constant inverse Jacobians
+      elliptic::dg::Tags::ConstantInverseJacobianCompute<volume_dim>,
+      elliptic::dg::Tags::DivFluxesCompute<volume_dim, fluxes_tag>,
       face_tags<domain::Tags::InternalDirections<volume_dim>>,
       face_tags<domain::Tags::BoundaryDirectionsInterior<volume_dim>>,
       exterior_tags>>;
@@ -39,7 +39,10 @@ struct FirstOrderFluxesCompute
                        const typename VariablesTag::type& vars,
                        const FluxesComputer& fluxes_computer,
                        const FluxesArgs&... fluxes_args) noexcept {
-    *fluxes = return_type{vars.number_of_grid_points()};
+    if (UNLIKELY(fluxes->number_of_grid_points() !=
+                 vars.number_of_grid_points())) {
+      fluxes->initialize(vars.number_of_grid_points());
+    }
     elliptic::first_order_fluxes<Dim, PrimalVariables, AuxiliaryVariables>(
         fluxes, vars, fluxes_computer, fluxes_args...);
   }
@@ -61,7 +64,10 @@ struct FirstOrderSourcesCompute
   static void function(const gsl::not_null<return_type*> sources,
                        const Vars& vars, const Fluxes& fluxes,
                        const SourcesArgs&... sources_args) noexcept {
-    *sources = return_type{vars.number_of_grid_points()};
+    if (UNLIKELY(sources->number_of_grid_points() !=
+                 vars.number_of_grid_points())) {
+      sources->initialize(vars.number_of_grid_points());
+    }
     elliptic::first_order_sources<Dim, PrimalVariables, AuxiliaryVariables,
                                   SourcesComputer>(sources, vars, fluxes,
                                                    sources_args...);
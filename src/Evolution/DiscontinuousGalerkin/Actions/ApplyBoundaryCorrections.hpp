@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <map>
 #include <optional>
@@ -12,6 +14,9 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/SliceIterator.hpp"
+#include "DataStructures/SliceVariables.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "Domain/FaceNormal.hpp"
 #include "Domain/Structure/Element.hpp"
@@ -33,6 +38,7 @@
 #include "Time/Tags.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -56,6 +62,71 @@ void boundary_correction(
       get<Tags>(local_boundary_data)..., get<Tags>(neighbor_boundary_data)...,
       dg_formulation);
 }
+
+// Copies `vars` into `batch`, which stacks the data of several mortars,
+// starting at grid point `offset`
+template <typename TagsList>
+void copy_to_batch(const gsl::not_null<Variables<TagsList>*> batch,
+                   const Variables<TagsList>& vars,
+                   const size_t offset) noexcept {
+  const size_t batch_points = batch->number_of_grid_points();
+  const size_t points = vars.number_of_grid_points();
+  ASSERT(offset + points <= batch_points,
+         "Cannot copy " << points << " grid points to offset " << offset
+                        << " of a batch of size " << batch_points);
+  for (size_t i = 0; i < Variables<TagsList>::number_of_independent_components;
+       ++i) {
+    std::copy_n(vars.data() + i * points, points,  // NOLINT
+                batch->data() + i * batch_points + offset);  // NOLINT
+  }
+}
+
+// Copies the grid points `[offset, offset + vars->number_of_grid_points())`
+// of `batch` into `vars`
+template <typename TagsList>
+void copy_from_batch(const gsl::not_null<Variables<TagsList>*> vars,
+                     const Variables<TagsList>& batch,
+                     const size_t offset) noexcept {
+  const size_t batch_points = batch.number_of_grid_points();
+  const size_t points = vars->number_of_grid_points();
+  ASSERT(offset + points <= batch_points,
+         "Cannot copy " << points << " grid points from offset " << offset
+                        << " of a batch of size " << batch_points);
+  for (size_t i = 0; i < Variables<TagsList>::number_of_independent_components;
+       ++i) {
+    std::copy_n(batch.data() + i * batch_points + offset, points,  // NOLINT
+                vars->data() + i * points);                        // NOLINT
+  }
+}
+
+// Same as `add_slice_to_data`, but the slice data is the section of `batch`
+// that starts at grid point `offset`
+template <size_t VolumeDim, typename TagsList>
+void add_batched_slice_to_data(
+    const gsl::not_null<Variables<TagsList>*> volume_vars,
+    const Variables<TagsList>& batch, const size_t offset,
+    const Index<VolumeDim>& extents, const size_t sliced_dim,
+    const size_t fixed_index) noexcept {
+  const size_t volume_grid_points = extents.product();
+  const size_t batch_points = batch.number_of_grid_points();
+  ASSERT(volume_vars->number_of_grid_points() == volume_grid_points,
+         "volume_vars has wrong number of grid points.  Expected "
+             << volume_grid_points << ", got "
+             << volume_vars->number_of_grid_points());
+  ASSERT(offset + extents.slice_away(sliced_dim).product() <= batch_points,
+         "The slice at offset " << offset << " does not fit in a batch of size "
+                                << batch_points);
+  double* const volume_data = volume_vars->data();
+  const double* const batch_data = batch.data() + offset;  // NOLINT
+  for (size_t i = 0; i < Variables<TagsList>::number_of_independent_components;
+       ++i) {
+    for (SliceIterator si(extents, sliced_dim, fixed_index); si; ++si) {
+      // clang-tidy: do not use pointer arithmetic
+      volume_data[si.volume_offset() + i * volume_grid_points] +=  // NOLINT
+          batch_data[si.slice_offset() + i * batch_points];        // NOLINT
+    }
+  }
+}
 }  // namespace detail
 
 /*!
@@ -121,6 +192,13 @@ void ApplyBoundaryCorrections<Metavariables>::apply_global_time_stepping(
     const gsl::not_null<tuples::TaggedTuple<InboxTags...>*> inboxes) noexcept {
   constexpr size_t volume_dim = Metavariables::system::volume_dim;
 
+  // Without neighbors there is no data in the inbox and nothing to lift (see
+  // `is_ready`)
+  if (UNLIKELY(db::get<domain::Tags::Element<volume_dim>>(*box)
+                   .number_of_neighbors() == 0)) {
+    return;
+  }
+
   // Move inbox contents into the DataBox
   using Key = std::pair<Direction<volume_dim>, ElementId<volume_dim>>;
   std::map<
@@ -137,8 +215,8 @@ void ApplyBoundaryCorrections<Metavariables>::apply_global_time_stepping(
   db::mutate<evolution::dg::Tags::MortarData<volume_dim>>(
       box,
       [&received_temporal_id_and_data](
-          const gsl::not_null<std::unordered_map<
-              Key, evolution::dg::MortarData<volume_dim>, boost::hash<Key>>*>
+          const gsl::not_null<MortarMap<
+              volume_dim, evolution::dg::MortarData<volume_dim>>*>
               mortar_data) noexcept {
         for (auto& received_mortar_data :
              received_temporal_id_and_data->second) {
@@ -192,90 +270,180 @@ void ApplyBoundaryCorrections<Metavariables>::apply_global_time_stepping(
         using mortar_tags_list = typename std::decay_t<decltype(
             boundary_correction)>::dg_package_field_tags;
 
-        Variables<db::wrap_tags_in<::Tags::dt, variables_tags>>
-            dt_boundary_correction_on_mortar{};
-        Variables<db::wrap_tags_in<::Tags::dt, variables_tags>>
-            dt_boundary_correction_projected_onto_face{};
-
-        // Iterate over all mortars
-        for (auto& [mortar_id, mortar_data] : *mortar_data_ptr) {
-          const auto& direction = mortar_id.first;
-          const size_t dimension = direction.dimension();
+        using dt_variables_type =
+            Variables<db::wrap_tags_in<::Tags::dt, variables_tags>>;
+
+        // All mortars are processed as one batch: the local and neighbor data
+        // on all mortars are stacked into contiguous buffers so that the
+        // boundary correction, which is pointwise, is evaluated in a single
+        // sweep over all faces. With Gauss-Lobatto points the mortars that
+        // coincide with their face are also lifted in a single pointwise
+        // multiplication of the batch.
+        struct MortarInBatch {
+          Key mortar_id;
+          size_t offset;
+          bool needs_projection;
+        };
+        std::vector<MortarInBatch> mortars_in_batch{};
+        mortars_in_batch.reserve(mortar_data_ptr->size());
+        size_t total_points = 0;
+        // Mortars that need a projection to the face, and all mortars when
+        // lifting at Gauss points, are lifted one at a time in a buffer that
+        // fits the largest of them
+        size_t max_unbatched_points = 0;
+        for (const auto& mortar_id_and_data : *mortar_data_ptr) {
+          const auto& mortar_id = mortar_id_and_data.first;
           if (UNLIKELY(mortar_id.second ==
                        ElementId<volume_dim>::external_boundary_id())) {
             ERROR(
                 "Cannot impose boundary conditions on external boundary in "
                 "direction "
-                << direction
+                << mortar_id.first
                 << " in the ApplyBoundaryCorrections action. Boundary "
                    "conditions are applied in the ComputeTimeDerivative action "
                    "instead. You may have unintentionally added external "
                    "mortars in one of the initialization actions.");
           }
-
           const Mesh<volume_dim - 1>& mortar_mesh = mortar_meshes.at(mortar_id);
+          const bool needs_projection = ::dg::needs_projection(
+              volume_mesh.slice_away(mortar_id.first.dimension()), mortar_mesh,
+              mortar_sizes.at(mortar_id));
+          mortars_in_batch.push_back(
+              {mortar_id, total_points, needs_projection});
+          total_points += mortar_mesh.number_of_grid_points();
+          if (needs_projection or not using_gauss_lobatto_points) {
+            max_unbatched_points = std::max(
+                max_unbatched_points, mortar_mesh.number_of_grid_points());
+          }
+        }
+        if (mortars_in_batch.empty()) {
+          return;
+        }
 
-          // Extract local and neighbor data, copy into Variables because we
-          // store them in a std::vector for type erasure.
-          const auto extracted_mortar_data = mortar_data.extract();
-          const auto& [local_mesh_and_data, neighbor_mesh_and_data] =
+        // Stack the local and neighbor data of all mortars
+        Variables<mortar_tags_list> local_data_on_mortars{total_points};
+        Variables<mortar_tags_list> neighbor_data_on_mortars{total_points};
+        for (const auto& mortar_in_batch : mortars_in_batch) {
+          const auto& mortar_id = mortar_in_batch.mortar_id;
+          const Mesh<volume_dim - 1>& mortar_mesh = mortar_meshes.at(mortar_id);
+          // Extract local and neighbor data and view them as Variables. We
+          // store them in a std::vector for type erasure, so the views avoid
+          // copying them into newly allocated Variables before stacking.
+          auto extracted_mortar_data = mortar_data_ptr->at(mortar_id).extract();
+          auto& [local_mesh_and_data, neighbor_mesh_and_data] =
               extracted_mortar_data;
-          Variables<mortar_tags_list> local_data_on_mortar{
-              mortar_mesh.number_of_grid_points()};
-          Variables<mortar_tags_list> neighbor_data_on_mortar{
-              mortar_mesh.number_of_grid_points()};
-          std::copy(local_mesh_and_data.second.begin(),
-                    local_mesh_and_data.second.end(),
-                    local_data_on_mortar.data());
-          std::copy(neighbor_mesh_and_data.second.begin(),
-                    neighbor_mesh_and_data.second.end(),
-                    neighbor_data_on_mortar.data());
-
-          // The boundary computations and lifting can be further optimized by
-          // in the h-refinement case having only one allocation for the face
-          // and having the projection from the mortar to the face be done in
-          // place. E.g. local_data_on_mortar and neighbor_data_on_mortar could
-          // be allocated fewer times, as well as `needs_projection` section
-          // below could do an in-place projection.
-          if (dt_boundary_correction_on_mortar.number_of_grid_points() !=
-              mortar_mesh.number_of_grid_points()) {
-            dt_boundary_correction_on_mortar.initialize(
-                mortar_mesh.number_of_grid_points());
+          ASSERT(local_mesh_and_data.second.size() ==
+                         neighbor_mesh_and_data.second.size() and
+                     local_mesh_and_data.second.size() ==
+                         mortar_mesh.number_of_grid_points() *
+                             Variables<mortar_tags_list>::
+                                 number_of_independent_components,
+                 "The local and neighbor mortar data must both match the "
+                 "size of the mortar mesh "
+                     << mortar_mesh << ", but have sizes "
+                     << local_mesh_and_data.second.size() << " and "
+                     << neighbor_mesh_and_data.second.size());
+          detail::copy_to_batch(make_not_null(&local_data_on_mortars),
+                                Variables<mortar_tags_list>{
+                                    local_mesh_and_data.second.data(),
+                                    local_mesh_and_data.second.size()},
+                                mortar_in_batch.offset);
+          detail::copy_to_batch(make_not_null(&neighbor_data_on_mortars),
+                                Variables<mortar_tags_list>{
+                                    neighbor_mesh_and_data.second.data(),
+                                    neighbor_mesh_and_data.second.size()},
+                                mortar_in_batch.offset);
+        }
+
+        dt_variables_type dt_boundary_correction_on_mortars{total_points};
+        detail::boundary_correction(
+            make_not_null(&dt_boundary_correction_on_mortars),
+            local_data_on_mortars, neighbor_data_on_mortars,
+            boundary_correction, dg_formulation);
+
+        const auto magnitude_of_face_normal_in_direction =
+            [&face_normal_covector_and_magnitude](
+                const Direction<volume_dim>& direction) noexcept
+            -> const Scalar<DataVector>& {
+          ASSERT(
+              face_normal_covector_and_magnitude.count(direction) == 1 and
+                  face_normal_covector_and_magnitude.at(direction).has_value(),
+              "Face normal covector and magnitude not set in direction: "
+                  << direction);
+          return get<evolution::dg::Tags::MagnitudeOfNormal>(
+              *face_normal_covector_and_magnitude.at(direction));
+        };
+
+        if (using_gauss_lobatto_points) {
+          // Lift all mortars that coincide with the face in one pass. See
+          // `::dg::lift_flux` for the lift factor. Mortars that need a
+          // projection are lifted after projecting to the face below.
+          DataVector lift_factor{total_points, 1.0};
+          for (const auto& mortar_in_batch : mortars_in_batch) {
+            if (mortar_in_batch.needs_projection) {
+              continue;
+            }
+            const auto& direction = mortar_in_batch.mortar_id.first;
+            const DataVector& magnitude_of_face_normal =
+                get(magnitude_of_face_normal_in_direction(direction));
+            const size_t extent = volume_mesh.extents(direction.dimension());
+            const double factor =
+                -0.5 * static_cast<double>(extent * (extent - 1));
+            for (size_t i = 0; i < magnitude_of_face_normal.size(); ++i) {
+              lift_factor[mortar_in_batch.offset + i] =
+                  factor * magnitude_of_face_normal[i];
+            }
           }
+          dt_boundary_correction_on_mortars *= lift_factor;
+        }
 
-          detail::boundary_correction(
+        DataVector unbatched_buffer{
+            max_unbatched_points *
+            dt_variables_type::number_of_independent_components};
+        dt_variables_type dt_boundary_correction_projected_onto_face{};
+        for (const auto& mortar_in_batch : mortars_in_batch) {
+          const auto& mortar_id = mortar_in_batch.mortar_id;
+          const auto& direction = mortar_id.first;
+          const size_t dimension = direction.dimension();
+
+          if (using_gauss_lobatto_points and
+              not mortar_in_batch.needs_projection) {
+            // Already lifted, so add directly from the batch to the volume
+            detail::add_batched_slice_to_data(
+                dt_variables_ptr, dt_boundary_correction_on_mortars,
+                mortar_in_batch.offset, volume_mesh.extents(), dimension,
+                index_to_slice_at(volume_mesh.extents(), direction));
+            continue;
+          }
+
+          const Mesh<volume_dim - 1>& mortar_mesh = mortar_meshes.at(mortar_id);
+          dt_variables_type dt_boundary_correction_on_mortar{
+              unbatched_buffer.data(),
+              mortar_mesh.number_of_grid_points() *
+                  dt_variables_type::number_of_independent_components};
+          detail::copy_from_batch(
               make_not_null(&dt_boundary_correction_on_mortar),
-              local_data_on_mortar, neighbor_data_on_mortar,
-              boundary_correction, dg_formulation);
+              dt_boundary_correction_on_mortars, mortar_in_batch.offset);
 
-          const std::array<Spectral::MortarSize, volume_dim - 1>& mortar_size =
-              mortar_sizes.at(mortar_id);
           const Mesh<volume_dim - 1> face_mesh =
               volume_mesh.slice_away(dimension);
-
           auto& dt_boundary_correction =
               [&dt_boundary_correction_on_mortar,
                &dt_boundary_correction_projected_onto_face, &face_mesh,
-               &mortar_mesh, &mortar_size]() noexcept
-              -> Variables<db::wrap_tags_in<::Tags::dt, variables_tags>>& {
-            if (::dg::needs_projection(face_mesh, mortar_mesh, mortar_size)) {
+               &mortar_in_batch, &mortar_mesh, &mortar_id,
+               &mortar_sizes]() noexcept -> dt_variables_type& {
+            if (mortar_in_batch.needs_projection) {
               dt_boundary_correction_projected_onto_face =
                   ::dg::project_from_mortar(dt_boundary_correction_on_mortar,
                                             face_mesh, mortar_mesh,
-                                            mortar_size);
+                                            mortar_sizes.at(mortar_id));
               return dt_boundary_correction_projected_onto_face;
             }
             return dt_boundary_correction_on_mortar;
           }();
 
-          ASSERT(
-              face_normal_covector_and_magnitude.count(direction) == 1 and
-                  face_normal_covector_and_magnitude.at(direction).has_value(),
-              "Face normal covector and magnitude not set in direction: "
-                  << direction);
           const auto& magnitude_of_face_normal =
-              get<evolution::dg::Tags::MagnitudeOfNormal>(
-                  *face_normal_covector_and_magnitude.at(direction));
+              magnitude_of_face_normal_in_direction(direction);
           if (using_gauss_lobatto_points) {
             // The lift_flux function lifts only on the slice, it does not add
             // the contribution to the volume.
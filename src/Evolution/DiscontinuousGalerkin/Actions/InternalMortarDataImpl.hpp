@@ -3,11 +3,9 @@
 
 #pragma once
 
-#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <optional>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -46,10 +44,7 @@ void internal_mortar_data_impl(
                               evolution::dg::Tags::MagnitudeOfNormal,
                               evolution::dg::Tags::NormalCovector<Dim>>>>>*>
         normal_covector_and_magnitude_ptr,
-    const gsl::not_null<std::unordered_map<
-        std::pair<Direction<Dim>, ElementId<Dim>>,
-        evolution::dg::MortarData<Dim>,
-        boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>*>
+    const gsl::not_null<MortarMap<Dim, evolution::dg::MortarData<Dim>>*>
         mortar_data_ptr,
     const BoundaryCorrection& boundary_correction,
     const Variables<typename System::variables_tag::tags_list>&
@@ -61,13 +56,9 @@ void internal_mortar_data_impl(
     const Variables<get_primitive_vars_tags_from_system<System>>* const
         volume_primitive_variables,
     const Element<Dim>& element, const Mesh<Dim>& volume_mesh,
-    const std::unordered_map<
-        std::pair<Direction<Dim>, ElementId<Dim>>, Mesh<Dim - 1>,
-        boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>& mortar_meshes,
-    const std::unordered_map<
-        std::pair<Direction<Dim>, ElementId<Dim>>,
-        std::array<Spectral::MortarSize, Dim - 1>,
-        boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>& mortar_sizes,
+    const MortarMap<Dim, Mesh<Dim - 1>>& mortar_meshes,
+    const MortarMap<Dim, std::array<Spectral::MortarSize, Dim - 1>>&
+        mortar_sizes,
     const TimeStepId& temporal_id,
     const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
         moving_mesh_map,
@@ -225,8 +216,14 @@ void internal_mortar_data_impl(
              "have been. Direction: "
                  << local_direction);
 
-      Variables<mortar_tags_list> packaged_data{
-          face_mesh.number_of_grid_points()};
+      // The packaged data is computed directly into a type-erased buffer
+      // through a non-owning Variables so it can be handed to the mortar
+      // data without a copy.
+      std::vector<double> packaged_data_buffer(
+          face_mesh.number_of_grid_points() *
+          Variables<mortar_tags_list>::number_of_independent_components);
+      Variables<mortar_tags_list> packaged_data{packaged_data_buffer.data(),
+                                                packaged_data_buffer.size()};
       // The DataBox is passed in for retrieving the `volume_tags`
       const double max_abs_char_speed_on_face = detail::dg_package_data<System>(
           make_not_null(&packaged_data), boundary_correction, fields_on_face,
@@ -244,30 +241,28 @@ void internal_mortar_data_impl(
         const auto& mortar_mesh = mortar_meshes.at(mortar_id);
         const auto& mortar_size = mortar_sizes.at(mortar_id);
 
-        // Project the data from the face to the mortar.
-        // Where no projection is necessary we `std::move` the data
+        // Project the data from the face to the mortar and store it in a
+        // way that is agnostic to the type of boundary correction used.
+        // Where no projection is necessary we `std::move` the buffer
         // directly to avoid a copy. We can't move the data or modify it
         // in-place when projecting, because in that case the face may
-        // touch two mortars so we need to keep the data around.
-        auto boundary_data_on_mortar =
-            ::dg::needs_projection(face_mesh, mortar_mesh, mortar_size)
-                // NOLINTNEXTLINE(bugprone-use-after-move)
-                ? ::dg::project_to_mortar(packaged_data, face_mesh, mortar_mesh,
-                                          mortar_size)
-                : std::move(packaged_data);
-
-        // Store the boundary data on this side of the mortar in a way
-        // that is agnostic to the type of boundary correction used. This
-        // currently requires an additional allocation that could be
-        // eliminated either by:
-        //
-        // 1. Having non-owning Variables
-        //
-        // 2. Allow stealing the allocation out of a Variables (and
-        //    inserting an allocation).
-        std::vector<double> type_erased_boundary_data_on_mortar{
-            boundary_data_on_mortar.data(),
-            boundary_data_on_mortar.data() + boundary_data_on_mortar.size()};
+        // touch two mortars so we need to keep the data around. The
+        // projection is done directly into the type-erased buffer.
+        std::vector<double> type_erased_boundary_data_on_mortar{};
+        if (::dg::needs_projection(face_mesh, mortar_mesh, mortar_size)) {
+          type_erased_boundary_data_on_mortar.resize(
+              mortar_mesh.number_of_grid_points() *
+              Variables<mortar_tags_list>::number_of_independent_components);
+          Variables<mortar_tags_list> boundary_data_on_mortar{
+              type_erased_boundary_data_on_mortar.data(),
+              type_erased_boundary_data_on_mortar.size()};
+          ::dg::project_to_mortar(make_not_null(&boundary_data_on_mortar),
+                                  packaged_data, face_mesh, mortar_mesh,
+                                  mortar_size);
+        } else {
+          // NOLINTNEXTLINE(bugprone-use-after-move)
+          type_erased_boundary_data_on_mortar = std::move(packaged_data_buffer);
+        }
         mortar_data_ptr->at(mortar_id).insert_local_mortar_data(
             temporal_id, face_mesh,
             std::move(type_erased_boundary_data_on_mortar));
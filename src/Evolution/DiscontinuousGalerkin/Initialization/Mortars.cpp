@@ -6,7 +6,6 @@
 #include <array>
 #include <cstddef>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
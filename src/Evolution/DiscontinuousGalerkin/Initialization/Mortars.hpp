@@ -4,11 +4,9 @@
 #pragma once
 
 #include <array>
-#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <optional>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -68,7 +66,7 @@ struct Mortars {
   using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
 
   template <typename MappedType>
-  using MortarMap = std::unordered_map<Key, MappedType, boost::hash<Key>>;
+  using MortarMap = evolution::dg::MortarMap<Dim, MappedType>;
 
  public:
   using initialization_tags = tmpl::list<::domain::Tags::InitialExtents<Dim>,
@@ -4,19 +4,58 @@
 #pragma once
 
 #include <array>
-#include <boost/functional/hash.hpp>
 #include <cstddef>
-#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/FixedHashMap.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"  // for MortarSize
 #include "Time/TimeStepId.hpp"
 
+namespace evolution::dg {
+/*!
+ * \brief Hash of a mortar id that places the mortars of each direction in
+ * their own row of a `MortarMap`
+ *
+ * The mortars in direction `d` hash to the first of the
+ * `maximum_number_of_neighbors_per_direction(Dim)` consecutive slots
+ * reserved for `d`, so the map is a flat table indexed by direction and
+ * neighbor. A neighbor's slot within the row is assigned when its mortar is
+ * inserted. The `ElementId` is not hashed.
+ */
+template <size_t Dim>
+struct MortarIdHash {
+  size_t operator()(
+      const std::pair<Direction<Dim>, ElementId<Dim>>& mortar_id) noexcept {
+    return DirectionHash<Dim>{}(mortar_id.first) *
+           maximum_number_of_neighbors_per_direction(Dim);
+  }
+};
+
+/*!
+ * \brief Map from a mortar, identified by a (Direction, ElementId) pair, to
+ * `MappedType`
+ *
+ * An element has at most `maximum_number_of_neighbors(Dim)` mortars, so the
+ * entries are stored inline in the element's DataBox rather than in
+ * individually allocated hash-table nodes. With `MortarIdHash` each
+ * direction owns a row of `maximum_number_of_neighbors_per_direction(Dim)`
+ * slots, so a lookup only compares against the mortars in the same
+ * direction. With 2:1 refinement an element has at most that many
+ * neighbors in any direction, so a row never overflows into the next one.
+ */
+template <size_t Dim, typename MappedType>
+using MortarMap =
+    FixedHashMap<maximum_number_of_neighbors(Dim),
+                 std::pair<Direction<Dim>, ElementId<Dim>>, MappedType,
+                 MortarIdHash<Dim>>;
+}  // namespace evolution::dg
+
 /// %Tags used for DG evolution scheme.
 namespace evolution::dg::Tags {
 /// Data on mortars, indexed by (Direction, ElementId) pairs
@@ -24,9 +63,7 @@ namespace evolution::dg::Tags {
 /// The `Dim` is the volume dimension, not the face dimension.
 template <size_t Dim>
 struct MortarData : db::SimpleTag {
-  using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type =
-      std::unordered_map<Key, evolution::dg::MortarData<Dim>, boost::hash<Key>>;
+  using type = MortarMap<Dim, evolution::dg::MortarData<Dim>>;
 };
 
 /// Mesh on the mortars, indexed by (Direction, ElementId) pairs
@@ -34,8 +71,7 @@ struct MortarData : db::SimpleTag {
 /// The `Dim` is the volume dimension, not the face dimension.
 template <size_t Dim>
 struct MortarMesh : db::SimpleTag {
-  using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type = std::unordered_map<Key, Mesh<Dim - 1>, boost::hash<Key>>;
+  using type = MortarMap<Dim, Mesh<Dim - 1>>;
 };
 
 /// Size of a mortar, relative to the element face.  That is, the part
@@ -44,10 +80,7 @@ struct MortarMesh : db::SimpleTag {
 /// The `Dim` is the volume dimension, not the face dimension.
 template <size_t Dim>
 struct MortarSize : db::SimpleTag {
-  using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type =
-      std::unordered_map<Key, std::array<Spectral::MortarSize, Dim - 1>,
-                         boost::hash<Key>>;
+  using type = MortarMap<Dim, std::array<Spectral::MortarSize, Dim - 1>>;
 };
 
 /// The next temporal id at which to receive data on the specified mortar.
@@ -55,7 +88,6 @@ struct MortarSize : db::SimpleTag {
 /// The `Dim` is the volume dimension, not the face dimension.
 template <size_t Dim>
 struct MortarNextTemporalId : db::SimpleTag {
-  using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type = std::unordered_map<Key, TimeStepId, boost::hash<Key>>;
+  using type = MortarMap<Dim, TimeStepId>;
 };
 }  // namespace evolution::dg::Tags
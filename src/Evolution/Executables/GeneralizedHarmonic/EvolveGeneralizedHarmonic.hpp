@@ -102,6 +102,7 @@
 #include "Time/Actions/ChangeSlabSize.hpp"
 #include "Time/Actions/ChangeStepSize.hpp"
 #include "Time/Actions/RecordTimeStepperData.hpp"
+#include "Time/Actions/RungeKuttaStartActions.hpp"
 #include "Time/Actions/SelfStartActions.hpp"
 #include "Time/Actions/UpdateU.hpp"
 #include "Time/StepChoosers/Cfl.hpp"
@@ -379,7 +380,11 @@ struct EvolutionMetavars {
                   initialize_initial_data_dependent_quantities_actions>,
               Parallel::PhaseActions<
                   Phase, Phase::InitializeTimeStepperHistory,
-                  SelfStart::self_start_procedure<step_actions, system>>,
+                  tmpl::conditional_t<
+                      local_time_stepping,
+                      SelfStart::self_start_procedure<step_actions, system>,
+                      RungeKuttaStart::start_procedure<step_actions,
+                                                       system>>>,
               Parallel::PhaseActions<
                   Phase, Phase::Register,
                   tmpl::list<intrp::Actions::RegisterElementWithInterpolator,
@@ -25,6 +25,7 @@
 #include "Evolution/Initialization/GrTagsForHydro.hpp"
 #include "Evolution/Initialization/Limiter.hpp"
 #include "Evolution/Initialization/SetVariables.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/ImplicitM1HydroCoupling.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Initialize.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/M1HydroCoupling.hpp"
@@ -71,6 +72,7 @@
 #include "Time/Actions/ChangeStepSize.hpp"
 #include "Time/Actions/RecordTimeStepperData.hpp"
 #include "Time/Actions/SelfStartActions.hpp"  // IWYU pragma: keep
+#include "Time/Actions/SolveImplicitSector.hpp"
 #include "Time/Actions/UpdateU.hpp"
 #include "Time/StepChoosers/Cfl.hpp"
 #include "Time/StepChoosers/Constant.hpp"
@@ -98,6 +100,7 @@ class CProxy_GlobalCache;
 }  // namespace Parallel
 /// \endcond
 
+template <bool ImplicitM1HydroCoupling>
 struct EvolutionMetavars {
   static constexpr size_t volume_dim = 3;
   static constexpr dg::Formulation dg_formulation =
@@ -118,6 +121,11 @@ struct EvolutionMetavars {
   using system = RadiationTransport::M1Grey::System<neutrino_species>;
   using temporal_id = Tags::TimeStepId;
   static constexpr bool local_time_stepping = false;
+  // Treat the stiff neutrino-matter coupling with an ImexTimeStepper
+  static constexpr bool implicit_m1_hydro_coupling = ImplicitM1HydroCoupling;
+  static_assert(not(local_time_stepping and implicit_m1_hydro_coupling),
+                "Local time stepping with an IMEX time stepper is not "
+                "supported.");
   using initial_data_tag =
       tmpl::conditional_t<evolution::is_analytic_solution_v<initial_data>,
                           Tags::AnalyticSolution<initial_data>,
@@ -147,8 +155,10 @@ struct EvolutionMetavars {
       tmpl::append<step_choosers_common, step_choosers_for_step_only,
                    step_choosers_for_slab_only>>;
 
-  using time_stepper_tag = Tags::TimeStepper<
-      tmpl::conditional_t<local_time_stepping, LtsTimeStepper, TimeStepper>>;
+  using time_stepper_tag = Tags::TimeStepper<tmpl::conditional_t<
+      local_time_stepping, LtsTimeStepper,
+      tmpl::conditional_t<implicit_m1_hydro_coupling, ImexTimeStepper,
+                          TimeStepper>>>;
   using boundary_scheme = tmpl::conditional_t<
       local_time_stepping,
       dg::FirstOrderScheme::FirstOrderSchemeLts<
@@ -179,6 +189,13 @@ struct EvolutionMetavars {
   using observed_reduction_data_tags = observers::collect_reduction_data_tags<
       typename Event<events>::creatable_classes>;
 
+  // When the coupling is treated implicitly, it is zeroed in the explicit
+  // time derivative and applied by the implicit sector of the system.
+  using m1_hydro_coupling = tmpl::conditional_t<
+      implicit_m1_hydro_coupling,
+      RadiationTransport::M1Grey::ZeroM1HydroCoupling<neutrino_species>,
+      RadiationTransport::M1Grey::ComputeM1HydroCoupling<neutrino_species>>;
+
   using step_actions = tmpl::flatten<tmpl::list<
       evolution::dg::Actions::ComputeTimeDerivative<EvolutionMetavars>,
       tmpl::conditional_t<
@@ -194,12 +211,14 @@ struct EvolutionMetavars {
                                      Actions::MutateApply<boundary_scheme>>,
                           tmpl::list<Actions::MutateApply<boundary_scheme>,
                                      Actions::RecordTimeStepperData<>>>,
-      Actions::UpdateU<>, Limiters::Actions::SendData<EvolutionMetavars>,
+      Actions::UpdateU<>,
+      tmpl::conditional_t<implicit_m1_hydro_coupling,
+                          Actions::SolveImplicitSector<>, tmpl::list<>>,
+      Limiters::Actions::SendData<EvolutionMetavars>,
       Limiters::Actions::Limit<EvolutionMetavars>,
       Actions::MutateApply<typename RadiationTransport::M1Grey::
                                ComputeM1Closure<neutrino_species>>,
-      Actions::MutateApply<typename RadiationTransport::M1Grey::
-                               ComputeM1HydroCoupling<neutrino_species>>>>;
+      Actions::MutateApply<m1_hydro_coupling>>>;
 
   enum class Phase {
     Initialization,
@@ -218,11 +237,14 @@ struct EvolutionMetavars {
       evolution::Initialization::Actions::SetVariables<
           domain::Tags::Coordinates<volume_dim, Frame::Logical>>,
       Initialization::Actions::TimeStepperHistory<EvolutionMetavars>,
+      tmpl::conditional_t<
+          implicit_m1_hydro_coupling,
+          Initialization::Actions::ImplicitHistory<EvolutionMetavars>,
+          tmpl::list<>>,
       RadiationTransport::M1Grey::Actions::InitializeM1Tags<system>,
       Actions::MutateApply<typename RadiationTransport::M1Grey::
                                ComputeM1Closure<neutrino_species>>,
-      Actions::MutateApply<typename RadiationTransport::M1Grey::
-                               ComputeM1HydroCoupling<neutrino_species>>,
+      Actions::MutateApply<m1_hydro_coupling>,
       dg::Actions::InitializeInterfaces<
           system,
           dg::Initialization::slice_tags_to_face<
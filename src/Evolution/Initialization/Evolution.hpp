@@ -272,5 +272,41 @@ struct TimeStepperHistory {
         "'Metavariables::system::variables_tag' in DataBox.");
   }
 };
+
+/// \ingroup InitializationGroup
+/// \brief Initialize the implicit sources used by
+/// `Actions::SolveImplicitSector` with an ::ImexTimeStepper
+///
+/// DataBox changes:
+/// - Adds:
+///   * `Tags::ImplicitHistory<variables_tag>`
+/// - Removes: nothing
+/// - Modifies: nothing
+///
+/// \note This action relies on the `SetupDataBox` aggregated initialization
+/// mechanism, so `Actions::SetupDataBox` must be present in the
+/// `Initialization` phase action list prior to this action.
+template <typename Metavariables>
+struct ImplicitHistory {
+  using initialization_tags = tmpl::list<>;
+
+  using variables_tag = typename Metavariables::system::variables_tag;
+
+  using simple_tags = tmpl::list<::Tags::ImplicitHistory<variables_tag>>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/, ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    Initialization::mutate_assign<simple_tags>(
+        make_not_null(&box),
+        typename ::Tags::ImplicitHistory<variables_tag>::type{});
+    return std::make_tuple(std::move(box));
+  }
+};
 }  // namespace Actions
 }  // namespace Initialization
@@ -8,6 +8,7 @@
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
+#include "DataStructures/SplitComplexDataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 
@@ -32,10 +33,16 @@ void ComputeBondiIntegrand<Tags::Integrand<Tags::BondiBeta>>::apply_impl(
     const SpinWeighted<ComplexDataVector, 2>& dy_j,
     const SpinWeighted<ComplexDataVector, 2>& j,
     const SpinWeighted<ComplexDataVector, 0>& one_minus_y) noexcept {
-  *integrand_for_beta =
-      0.125 * one_minus_y *
-      (dy_j * conj(dy_j) -
-       0.25 * square(j * conj(dy_j) + conj(j) * dy_j) / (1.0 + j * conj(j)));
+  // All factors but `one_minus_y` are real, so they are evaluated on the split
+  // real and imaginary parts, which vectorizes and avoids the complex division
+  const SplitComplexDataVector split_j{j.data()};
+  const SplitComplexDataVector split_dy_j{dy_j.data()};
+  const DataVector real_factor =
+      square(split_dy_j.real()) + square(split_dy_j.imag()) -
+      square(split_j.real() * split_dy_j.real() +
+             split_j.imag() * split_dy_j.imag()) /
+          (1.0 + square(split_j.real()) + square(split_j.imag()));
+  integrand_for_beta->data() = 0.125 * one_minus_y.data() * real_factor;
 }
 
 void ComputeBondiIntegrand<Tags::PoleOfIntegrand<Tags::BondiQ>>::apply_impl(
@@ -6,6 +6,8 @@
 #include <cstddef>
 
 #include "DataStructures/LeviCivitaIterator.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -1298,6 +1300,398 @@ void constraint_energy(
     }
   }
 }
+
+template <size_t SpatialDim, typename Frame, typename DataType>
+void all_constraints(
+    const gsl::not_null<tnsr::a<DataType, SpatialDim, Frame>*> gauge_constraint,
+    const gsl::not_null<tnsr::a<DataType, SpatialDim, Frame>*> f_constraint,
+    const gsl::not_null<tnsr::ia<DataType, SpatialDim, Frame>*>
+        two_index_constraint,
+    const gsl::not_null<tnsr::iaa<DataType, SpatialDim, Frame>*>
+        four_index_constraint,
+    const gsl::not_null<Scalar<DataType>*> energy,
+    const tnsr::a<DataType, SpatialDim, Frame>& gauge_function,
+    const tnsr::ia<DataType, SpatialDim, Frame>& d_gauge_function,
+    const tnsr::a<DataType, SpatialDim, Frame>& spacetime_normal_one_form,
+    const tnsr::A<DataType, SpatialDim, Frame>& spacetime_normal_vector,
+    const tnsr::II<DataType, SpatialDim, Frame>& inverse_spatial_metric,
+    const tnsr::AA<DataType, SpatialDim, Frame>& inverse_spacetime_metric,
+    const tnsr::aa<DataType, SpatialDim, Frame>& pi,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& phi,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& d_pi,
+    const tnsr::ijaa<DataType, SpatialDim, Frame>& d_phi,
+    const Scalar<DataType>& gamma2,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& three_index_constraint,
+    const Scalar<DataType>& spatial_metric_determinant) noexcept {
+  static_assert(
+      SpatialDim == 3,
+      "all_constraints() currently only supports 3 spatial dimensions");
+  const size_t num_points = get_size(get(gamma2));
+  destructive_resize_components(gauge_constraint, num_points);
+  destructive_resize_components(f_constraint, num_points);
+  destructive_resize_components(two_index_constraint, num_points);
+  destructive_resize_components(four_index_constraint, num_points);
+  destructive_resize_components(energy, num_points);
+
+  // Phi with the spatial part of its second index raised
+  using phi_spatial_index_up_type =
+      Tensor<DataType, Symmetry<3, 2, 1>,
+             index_list<SpatialIndex<SpatialDim, UpLo::Lo, Frame>,
+                        SpatialIndex<SpatialDim, UpLo::Up, Frame>,
+                        SpacetimeIndex<SpatialDim, UpLo::Lo, Frame>>>;
+  // Phi with both spatial indices raised
+  using phi_spatial_indices_up_type =
+      Tensor<DataType, Symmetry<3, 2, 1>,
+             index_list<SpatialIndex<SpatialDim, UpLo::Up, Frame>,
+                        SpatialIndex<SpatialDim, UpLo::Up, Frame>,
+                        SpacetimeIndex<SpatialDim, UpLo::Lo, Frame>>>;
+
+  // Use a TempBuffer to reduce total number of allocations. All contractions
+  // that appear in more than one term of the constraints are computed once.
+  TempBuffer<tmpl::list<
+      ::Tags::TempScalar<0, DataType>,
+      ::Tags::Tempi<1, SpatialDim, Frame, DataType>,
+      ::Tags::Tempa<2, SpatialDim, Frame, DataType>,
+      ::Tags::Tempia<3, SpatialDim, Frame, DataType>,
+      ::Tags::Tempi<4, SpatialDim, Frame, DataType>,
+      ::Tags::TempTensor<5, tnsr::iA<DataType, SpatialDim, Frame>>,
+      ::Tags::TempA<6, SpatialDim, Frame, DataType>,
+      ::Tags::TempAb<7, SpatialDim, Frame, DataType>,
+      ::Tags::TempTensor<8, tnsr::iAb<DataType, SpatialDim, Frame>>,
+      ::Tags::Tempa<9, SpatialDim, Frame, DataType>,
+      ::Tags::Tempi<10, SpatialDim, Frame, DataType>,
+      ::Tags::Tempij<11, SpatialDim, Frame, DataType>,
+      ::Tags::Tempi<12, SpatialDim, Frame, DataType>,
+      ::Tags::Tempii<13, SpatialDim, Frame, DataType>,
+      ::Tags::Tempi<14, SpatialDim, Frame, DataType>,
+      ::Tags::Tempi<15, SpatialDim, Frame, DataType>,
+      ::Tags::Tempi<16, SpatialDim, Frame, DataType>,
+      ::Tags::TempScalar<17, DataType>,
+      ::Tags::TempTensor<18, phi_spatial_index_up_type>,
+      ::Tags::TempTensor<19, phi_spatial_indices_up_type>>>
+      buffer(num_points);
+  // g^{ab} Pi_{ab}
+  auto& trace_pi = get<::Tags::TempScalar<0, DataType>>(buffer);
+  // g^{ab} Phi_{iab}
+  auto& trace_phi = get<::Tags::Tempi<1, SpatialDim, Frame, DataType>>(buffer);
+  // n^b Pi_{ba}
+  auto& pi_one_normal =
+      get<::Tags::Tempa<2, SpatialDim, Frame, DataType>>(buffer);
+  // n^b Phi_{iba}
+  auto& phi_one_normal =
+      get<::Tags::Tempia<3, SpatialDim, Frame, DataType>>(buffer);
+  // n^a n^b Phi_{iab}
+  auto& phi_two_normals =
+      get<::Tags::Tempi<4, SpatialDim, Frame, DataType>>(buffer);
+  // g^{ab} n^c Phi_{icb}
+  auto& phi_one_normal_up = get<
+      ::Tags::TempTensor<5, tnsr::iA<DataType, SpatialDim, Frame>>>(buffer);
+  // g^{ab} H_b
+  auto& gauge_function_up =
+      get<::Tags::TempA<6, SpatialDim, Frame, DataType>>(buffer);
+  // g^{ac} Pi_{cb}
+  auto& pi_first_index_up =
+      get<::Tags::TempAb<7, SpatialDim, Frame, DataType>>(buffer);
+  // g^{ac} Phi_{icb}
+  auto& phi_second_index_up = get<
+      ::Tags::TempTensor<8, tnsr::iAb<DataType, SpatialDim, Frame>>>(buffer);
+  // g^{ij} Phi_{ija}
+  auto& spatial_trace_phi =
+      get<::Tags::Tempa<9, SpatialDim, Frame, DataType>>(buffer);
+  // g^{ab} \partial_i Pi_{ab}
+  auto& trace_d_pi =
+      get<::Tags::Tempi<10, SpatialDim, Frame, DataType>>(buffer);
+  // g^{ab} \partial_i Phi_{jab}
+  auto& trace_d_phi =
+      get<::Tags::Tempij<11, SpatialDim, Frame, DataType>>(buffer);
+  // g^{ab} C_{iab}
+  auto& trace_three_index_constraint =
+      get<::Tags::Tempi<12, SpatialDim, Frame, DataType>>(buffer);
+  // Phi_{iab} Phi_j^{ab}
+  auto& phi_dot_phi =
+      get<::Tags::Tempii<13, SpatialDim, Frame, DataType>>(buffer);
+  // g^{jk} n^b Phi_{ijb} g^{ab} Phi_{kab}
+  auto& phi_one_normal_dot_trace_phi =
+      get<::Tags::Tempi<14, SpatialDim, Frame, DataType>>(buffer);
+  // Terms of C_{ia} proportional to n_a
+  auto& two_index_normal_terms =
+      get<::Tags::Tempi<15, SpatialDim, Frame, DataType>>(buffer);
+  // Spatial terms of F_a that are projected as
+  // X_a = \delta^i_a X_i + n_a n^i X_i
+  auto& f_projected_terms =
+      get<::Tags::Tempi<16, SpatialDim, Frame, DataType>>(buffer);
+  // Terms of F_a proportional to n_a
+  auto& f_normal_terms = get<::Tags::TempScalar<17, DataType>>(buffer);
+  // g^{jk} Phi_{ika}
+  auto& phi_spatial_index_up =
+      get<::Tags::TempTensor<18, phi_spatial_index_up_type>>(buffer);
+  // g^{ik} g^{jl} Phi_{kla}
+  auto& phi_spatial_indices_up =
+      get<::Tags::TempTensor<19, phi_spatial_indices_up_type>>(buffer);
+
+  // Contractions of Pi and the gauge function
+  for (size_t a = 0; a < SpatialDim + 1; ++a) {
+    gauge_function_up.get(a) = 0.0;
+    pi_one_normal.get(a) = 0.0;
+    for (size_t b = 0; b < SpatialDim + 1; ++b) {
+      gauge_function_up.get(a) +=
+          inverse_spacetime_metric.get(a, b) * gauge_function.get(b);
+      pi_one_normal.get(a) += spacetime_normal_vector.get(b) * pi.get(b, a);
+      pi_first_index_up.get(a, b) = 0.0;
+      for (size_t c = 0; c < SpatialDim + 1; ++c) {
+        pi_first_index_up.get(a, b) +=
+            inverse_spacetime_metric.get(a, c) * pi.get(c, b);
+      }
+    }
+  }
+  get(trace_pi) = 0.0;
+  for (size_t a = 0; a < SpatialDim + 1; ++a) {
+    get(trace_pi) += pi_first_index_up.get(a, a);
+  }
+
+  // Contractions of Phi, the derivatives of Pi and Phi, and C_{iab}
+  for (size_t a = 0; a < SpatialDim + 1; ++a) {
+    spatial_trace_phi.get(a) = 0.0;
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      for (size_t j = 0; j < SpatialDim; ++j) {
+        spatial_trace_phi.get(a) +=
+            inverse_spatial_metric.get(i, j) * phi.get(i, j + 1, a);
+      }
+    }
+  }
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    trace_phi.get(i) = 0.0;
+    phi_two_normals.get(i) = 0.0;
+    trace_d_pi.get(i) = 0.0;
+    trace_three_index_constraint.get(i) = 0.0;
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      trace_d_phi.get(i, j) = 0.0;
+    }
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      phi_one_normal.get(i, a) = 0.0;
+      for (size_t b = 0; b < SpatialDim + 1; ++b) {
+        phi_one_normal.get(i, a) +=
+            spacetime_normal_vector.get(b) * phi.get(i, b, a);
+        phi_second_index_up.get(i, a, b) = 0.0;
+        for (size_t c = 0; c < SpatialDim + 1; ++c) {
+          phi_second_index_up.get(i, a, b) +=
+              inverse_spacetime_metric.get(a, c) * phi.get(i, c, b);
+        }
+        trace_d_pi.get(i) +=
+            inverse_spacetime_metric.get(a, b) * d_pi.get(i, a, b);
+        trace_three_index_constraint.get(i) +=
+            inverse_spacetime_metric.get(a, b) *
+            three_index_constraint.get(i, a, b);
+        for (size_t j = 0; j < SpatialDim; ++j) {
+          trace_d_phi.get(i, j) +=
+              inverse_spacetime_metric.get(a, b) * d_phi.get(i, j, a, b);
+        }
+      }
+      trace_phi.get(i) += phi_second_index_up.get(i, a, a);
+      phi_two_normals.get(i) +=
+          spacetime_normal_vector.get(a) * phi_one_normal.get(i, a);
+    }
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      phi_one_normal_up.get(i, a) = 0.0;
+      for (size_t b = 0; b < SpatialDim + 1; ++b) {
+        phi_one_normal_up.get(i, a) +=
+            spacetime_normal_vector.get(b) * phi_second_index_up.get(i, a, b);
+      }
+    }
+  }
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      for (size_t a = 0; a < SpatialDim + 1; ++a) {
+        phi_spatial_index_up.get(i, j, a) = 0.0;
+        for (size_t k = 0; k < SpatialDim; ++k) {
+          phi_spatial_index_up.get(i, j, a) +=
+              inverse_spatial_metric.get(j, k) * phi.get(i, k + 1, a);
+        }
+      }
+    }
+  }
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      for (size_t a = 0; a < SpatialDim + 1; ++a) {
+        phi_spatial_indices_up.get(i, j, a) = 0.0;
+        for (size_t k = 0; k < SpatialDim; ++k) {
+          phi_spatial_indices_up.get(i, j, a) +=
+              inverse_spatial_metric.get(i, k) *
+              phi_spatial_index_up.get(k, j, a);
+        }
+      }
+    }
+  }
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    for (size_t j = i; j < SpatialDim; ++j) {
+      phi_dot_phi.get(i, j) = 0.0;
+      for (size_t a = 0; a < SpatialDim + 1; ++a) {
+        for (size_t b = 0; b < SpatialDim + 1; ++b) {
+          phi_dot_phi.get(i, j) += phi_second_index_up.get(i, a, b) *
+                                   phi_second_index_up.get(j, b, a);
+        }
+      }
+    }
+    phi_one_normal_dot_trace_phi.get(i) = 0.0;
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      for (size_t k = 0; k < SpatialDim; ++k) {
+        phi_one_normal_dot_trace_phi.get(i) +=
+            inverse_spatial_metric.get(j, k) * phi_one_normal.get(i, j + 1) *
+            trace_phi.get(k);
+      }
+    }
+  }
+
+  // Gauge constraint, Eq. (40) of https://arXiv.org/abs/gr-qc/0512093v3
+  for (size_t a = 0; a < SpatialDim + 1; ++a) {
+    gauge_constraint->get(a) = gauge_function.get(a) +
+                               spatial_trace_phi.get(a) +
+                               pi_one_normal.get(a) -
+                               0.5 * spacetime_normal_one_form.get(a) *
+                                   get(trace_pi);
+    if (a > 0) {
+      gauge_constraint->get(a) -= 0.5 * trace_phi.get(a - 1);
+    }
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      gauge_constraint->get(a) -= 0.5 * spacetime_normal_one_form.get(a) *
+                                  spacetime_normal_vector.get(i + 1) *
+                                  trace_phi.get(i);
+    }
+  }
+
+  // Two-index constraint, Eq. (44) of https://arXiv.org/abs/gr-qc/0512093v3
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    two_index_normal_terms.get(i) =
+        -0.5 * trace_d_pi.get(i) + 0.5 * phi_one_normal_dot_trace_phi.get(i) +
+        0.25 * phi_two_normals.get(i) * get(trace_pi) +
+        0.5 * get(gamma2) * trace_three_index_constraint.get(i);
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      for (size_t b = 0; b < SpatialDim + 1; ++b) {
+        two_index_normal_terms.get(i) += 0.5 *
+                                         phi_second_index_up.get(i, a, b) *
+                                         pi_first_index_up.get(b, a);
+      }
+    }
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      two_index_normal_terms.get(i) +=
+          0.5 * spacetime_normal_vector.get(j + 1) *
+          (phi_dot_phi.get(j, i) - trace_d_phi.get(j, i));
+    }
+
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      two_index_constraint->get(i, a) =
+          d_gauge_function.get(i, a) +
+          spacetime_normal_one_form.get(a) * two_index_normal_terms.get(i) -
+          0.5 * phi_two_normals.get(i) * pi_one_normal.get(a);
+      if (a > 0) {
+        two_index_constraint->get(i, a) +=
+            0.5 * (phi_dot_phi.get(a - 1, i) - trace_d_phi.get(a - 1, i));
+      }
+      for (size_t b = 0; b < SpatialDim + 1; ++b) {
+        two_index_constraint->get(i, a) +=
+            spacetime_normal_vector.get(b) *
+                (d_pi.get(i, b, a) -
+                 get(gamma2) * three_index_constraint.get(i, a, b)) -
+            phi_one_normal_up.get(i, b) * pi.get(b, a);
+      }
+      for (size_t j = 0; j < SpatialDim; ++j) {
+        for (size_t k = 0; k < SpatialDim; ++k) {
+          two_index_constraint->get(i, a) +=
+              inverse_spatial_metric.get(j, k) * d_phi.get(j, i, k + 1, a) -
+              phi_spatial_indices_up.get(j, k, a) * phi.get(i, j + 1, k + 1);
+        }
+      }
+    }
+  }
+
+  // F constraint, Eq. (43) of https://arXiv.org/abs/gr-qc/0512093v3
+  get(f_normal_terms) = 0.0;
+  for (size_t a = 0; a < SpatialDim + 1; ++a) {
+    get(f_normal_terms) +=
+        0.5 * get(trace_pi) * gauge_function.get(a) *
+            spacetime_normal_vector.get(a) -
+        spatial_trace_phi.get(a) * gauge_function_up.get(a);
+    for (size_t b = 0; b < SpatialDim + 1; ++b) {
+      get(f_normal_terms) +=
+          0.25 * pi_first_index_up.get(a, b) * pi_first_index_up.get(b, a) +
+          0.5 * inverse_spacetime_metric.get(a, b) * pi_one_normal.get(a) *
+              pi_one_normal.get(b);
+    }
+  }
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      get(f_normal_terms) +=
+          inverse_spatial_metric.get(i, j) *
+          (0.5 * trace_d_phi.get(i, j) + d_gauge_function.get(i, j + 1) -
+           0.25 * phi_dot_phi.get(i, j) +
+           0.5 * gauge_function.get(i + 1) * trace_phi.get(j));
+      for (size_t c = 0; c < SpatialDim + 1; ++c) {
+        get(f_normal_terms) -= 0.5 * phi_spatial_indices_up.get(i, j, c) *
+                               phi_second_index_up.get(j, c, i + 1);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    f_projected_terms.get(i) =
+        0.5 * trace_d_pi.get(i) - 0.5 * phi_one_normal_dot_trace_phi.get(i) -
+        0.25 * phi_two_normals.get(i) * get(trace_pi) -
+        0.5 * get(gamma2) * trace_three_index_constraint.get(i);
+    for (size_t b = 0; b < SpatialDim + 1; ++b) {
+      f_projected_terms.get(i) +=
+          phi_one_normal_up.get(i, b) * pi_one_normal.get(b) +
+          phi_one_normal.get(i, b) * gauge_function_up.get(b) -
+          spacetime_normal_vector.get(b) * d_gauge_function.get(i, b);
+      for (size_t j = 0; j < SpatialDim; ++j) {
+        f_projected_terms.get(i) +=
+            phi_spatial_index_up.get(i, j, b) * phi_one_normal_up.get(j, b);
+      }
+    }
+    get(f_normal_terms) +=
+        spacetime_normal_vector.get(i + 1) * f_projected_terms.get(i);
+  }
+
+  for (size_t a = 0; a < SpatialDim + 1; ++a) {
+    f_constraint->get(a) =
+        spacetime_normal_one_form.get(a) * get(f_normal_terms);
+    if (a > 0) {
+      f_constraint->get(a) += f_projected_terms.get(a - 1);
+    }
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      for (size_t d = 0; d < SpatialDim + 1; ++d) {
+        f_constraint->get(a) +=
+            get(gamma2) *
+            (inverse_spacetime_metric.get(i + 1, d) +
+             spacetime_normal_vector.get(i + 1) *
+                 spacetime_normal_vector.get(d)) *
+            three_index_constraint.get(i, d, a);
+      }
+      for (size_t j = 0; j < SpatialDim; ++j) {
+        f_constraint->get(a) -=
+            inverse_spatial_metric.get(i, j) *
+            ((gauge_function.get(i + 1) + pi_one_normal.get(i + 1) +
+              0.5 * phi_two_normals.get(i)) *
+                 pi.get(j + 1, a) +
+             phi_one_normal.get(i, a) *
+                 (gauge_function.get(j + 1) + pi_one_normal.get(j + 1)) +
+             d_pi.get(i, j + 1, a));
+        for (size_t b = 0; b < SpatialDim + 1; ++b) {
+          f_constraint->get(a) +=
+              inverse_spatial_metric.get(i, j) *
+              (phi_one_normal_up.get(i, b) * phi.get(j, b, a) -
+               spacetime_normal_vector.get(b) * d_phi.get(i, j, b, a));
+        }
+      }
+    }
+  }
+
+  GeneralizedHarmonic::four_index_constraint<SpatialDim, Frame, DataType>(
+      four_index_constraint, d_phi);
+  GeneralizedHarmonic::constraint_energy<SpatialDim, Frame, DataType>(
+      energy, *gauge_constraint, *f_constraint, *two_index_constraint,
+      three_index_constraint, *four_index_constraint, inverse_spatial_metric,
+      spatial_metric_determinant);
+}
 }  // namespace GeneralizedHarmonic
 
 // Explicit Instantiations
@@ -1462,7 +1856,35 @@ void constraint_energy(
   template void GeneralizedHarmonic::four_index_constraint(                   \
       const gsl::not_null<tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>*>    \
           constraint,                                                         \
-      const tnsr::ijaa<DTYPE(data), DIM(data), FRAME(data)>& d_phi) noexcept;
+      const tnsr::ijaa<DTYPE(data), DIM(data), FRAME(data)>& d_phi) noexcept; \
+  template void GeneralizedHarmonic::all_constraints(                         \
+      const gsl::not_null<tnsr::a<DTYPE(data), DIM(data), FRAME(data)>*>      \
+          gauge_constraint,                                                   \
+      const gsl::not_null<tnsr::a<DTYPE(data), DIM(data), FRAME(data)>*>      \
+          f_constraint,                                                       \
+      const gsl::not_null<tnsr::ia<DTYPE(data), DIM(data), FRAME(data)>*>     \
+          two_index_constraint,                                               \
+      const gsl::not_null<tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>*>    \
+          four_index_constraint,                                              \
+      const gsl::not_null<Scalar<DTYPE(data)>*> energy,                       \
+      const tnsr::a<DTYPE(data), DIM(data), FRAME(data)>& gauge_function,     \
+      const tnsr::ia<DTYPE(data), DIM(data), FRAME(data)>& d_gauge_function,  \
+      const tnsr::a<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          spacetime_normal_one_form,                                          \
+      const tnsr::A<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          spacetime_normal_vector,                                            \
+      const tnsr::II<DTYPE(data), DIM(data), FRAME(data)>&                    \
+          inverse_spatial_metric,                                             \
+      const tnsr::AA<DTYPE(data), DIM(data), FRAME(data)>&                    \
+          inverse_spacetime_metric,                                           \
+      const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>& pi,                \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>& phi,              \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>& d_pi,             \
+      const tnsr::ijaa<DTYPE(data), DIM(data), FRAME(data)>& d_phi,           \
+      const Scalar<DTYPE(data)>& gamma2,                                      \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>&                   \
+          three_index_constraint,                                             \
+      const Scalar<DTYPE(data)>& spatial_metric_determinant) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
                         (Frame::Grid, Frame::Inertial))
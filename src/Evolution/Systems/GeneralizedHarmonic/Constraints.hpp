@@ -12,19 +12,15 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "DataStructures/VariablesTag.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
-/// \cond
-namespace gsl {
-template <typename T>
-class not_null;
-}  // namespace gsl
-/// \endcond
-
 namespace GeneralizedHarmonic {
 // @{
 /*!
@@ -494,6 +490,42 @@ void constraint_energy(
     double four_index_constraint_multiplier = 1.0) noexcept;
 // @}
 
+/*!
+ * \brief Computes the gauge, F, two-index and four-index constraints and the
+ * constraint energy of the generalized harmonic system in a single pass.
+ *
+ * \details Gives the same results as calling `gauge_constraint()`,
+ * `f_constraint()`, `two_index_constraint()`, `four_index_constraint()` and
+ * `constraint_energy()` (with unit multipliers) one after another, but
+ * computes the contractions that these share, such as \f$g^{ab}\Pi_{ab}\f$,
+ * \f$g^{ab}\Phi_{iab}\f$, \f$n^b\Phi_{iba}\f$ and
+ * \f$g^{ab}\partial_i\Phi_{jab}\f$, only once and stores them in a single
+ * `TempBuffer`. Use this function when several of the constraints are needed
+ * at the same time, e.g. for observing them. The three-index constraint is an
+ * argument because it is already needed to compute the time derivative.
+ */
+template <size_t SpatialDim, typename Frame, typename DataType>
+void all_constraints(
+    gsl::not_null<tnsr::a<DataType, SpatialDim, Frame>*> gauge_constraint,
+    gsl::not_null<tnsr::a<DataType, SpatialDim, Frame>*> f_constraint,
+    gsl::not_null<tnsr::ia<DataType, SpatialDim, Frame>*> two_index_constraint,
+    gsl::not_null<tnsr::iaa<DataType, SpatialDim, Frame>*>
+        four_index_constraint,
+    gsl::not_null<Scalar<DataType>*> energy,
+    const tnsr::a<DataType, SpatialDim, Frame>& gauge_function,
+    const tnsr::ia<DataType, SpatialDim, Frame>& d_gauge_function,
+    const tnsr::a<DataType, SpatialDim, Frame>& spacetime_normal_one_form,
+    const tnsr::A<DataType, SpatialDim, Frame>& spacetime_normal_vector,
+    const tnsr::II<DataType, SpatialDim, Frame>& inverse_spatial_metric,
+    const tnsr::AA<DataType, SpatialDim, Frame>& inverse_spacetime_metric,
+    const tnsr::aa<DataType, SpatialDim, Frame>& pi,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& phi,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& d_pi,
+    const tnsr::ijaa<DataType, SpatialDim, Frame>& d_phi,
+    const Scalar<DataType>& gamma2,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& three_index_constraint,
+    const Scalar<DataType>& spatial_metric_determinant) noexcept;
+
 namespace Tags {
 /*!
  * \brief Compute item to get the gauge constraint for the
@@ -703,5 +735,83 @@ struct ConstraintEnergyCompute : ConstraintEnergy<SpatialDim, Frame>,
 
   using base = ConstraintEnergy<SpatialDim, Frame>;
 };
+
+/*!
+ * \brief Compute item to get the gauge, F, two-index and four-index
+ * constraints and the constraint energy for the generalized harmonic evolution
+ * system in a single pass.
+ *
+ * \details See `all_constraints()`. The individual constraints can be retrieved
+ * using `GeneralizedHarmonic::Tags::GaugeConstraint`,
+ * `GeneralizedHarmonic::Tags::FConstraint`,
+ * `GeneralizedHarmonic::Tags::TwoIndexConstraint`,
+ * `GeneralizedHarmonic::Tags::FourIndexConstraint` and
+ * `GeneralizedHarmonic::Tags::ConstraintEnergy`, so this tag replaces the
+ * corresponding individual compute items and must not be combined with them.
+ */
+template <size_t SpatialDim, typename Frame>
+struct AllConstraintsCompute
+    : ::Tags::Variables<tmpl::list<GaugeConstraint<SpatialDim, Frame>,
+                                   FConstraint<SpatialDim, Frame>,
+                                   TwoIndexConstraint<SpatialDim, Frame>,
+                                   FourIndexConstraint<SpatialDim, Frame>,
+                                   ConstraintEnergy<SpatialDim, Frame>>>,
+      db::ComputeTag {
+  using base =
+      ::Tags::Variables<tmpl::list<GaugeConstraint<SpatialDim, Frame>,
+                                   FConstraint<SpatialDim, Frame>,
+                                   TwoIndexConstraint<SpatialDim, Frame>,
+                                   FourIndexConstraint<SpatialDim, Frame>,
+                                   ConstraintEnergy<SpatialDim, Frame>>>;
+
+  using argument_tags = tmpl::list<
+      GaugeH<SpatialDim, Frame>,
+      ::Tags::deriv<GaugeH<SpatialDim, Frame>, tmpl::size_t<SpatialDim>, Frame>,
+      gr::Tags::SpacetimeNormalOneForm<SpatialDim, Frame, DataVector>,
+      gr::Tags::SpacetimeNormalVector<SpatialDim, Frame, DataVector>,
+      gr::Tags::InverseSpatialMetric<SpatialDim, Frame, DataVector>,
+      gr::Tags::InverseSpacetimeMetric<SpatialDim, Frame, DataVector>,
+      Pi<SpatialDim, Frame>, Phi<SpatialDim, Frame>,
+      ::Tags::deriv<Pi<SpatialDim, Frame>, tmpl::size_t<SpatialDim>, Frame>,
+      ::Tags::deriv<Phi<SpatialDim, Frame>, tmpl::size_t<SpatialDim>, Frame>,
+      ::GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma2,
+      ThreeIndexConstraint<SpatialDim, Frame>,
+      gr::Tags::DetSpatialMetric<DataVector>>;
+
+  using return_type = typename base::type;
+
+  static void function(
+      const gsl::not_null<return_type*> constraints,
+      const tnsr::a<DataVector, SpatialDim, Frame>& gauge_function,
+      const tnsr::ia<DataVector, SpatialDim, Frame>& d_gauge_function,
+      const tnsr::a<DataVector, SpatialDim, Frame>& spacetime_normal_one_form,
+      const tnsr::A<DataVector, SpatialDim, Frame>& spacetime_normal_vector,
+      const tnsr::II<DataVector, SpatialDim, Frame>& inverse_spatial_metric,
+      const tnsr::AA<DataVector, SpatialDim, Frame>& inverse_spacetime_metric,
+      const tnsr::aa<DataVector, SpatialDim, Frame>& pi,
+      const tnsr::iaa<DataVector, SpatialDim, Frame>& phi,
+      const tnsr::iaa<DataVector, SpatialDim, Frame>& d_pi,
+      const tnsr::ijaa<DataVector, SpatialDim, Frame>& d_phi,
+      const Scalar<DataVector>& gamma2,
+      const tnsr::iaa<DataVector, SpatialDim, Frame>& three_index_constraint,
+      const Scalar<DataVector>& spatial_metric_determinant) noexcept {
+    if (constraints->number_of_grid_points() != get(gamma2).size()) {
+      constraints->initialize(get(gamma2).size());
+    }
+    all_constraints<SpatialDim, Frame, DataVector>(
+        make_not_null(
+            &get<GaugeConstraint<SpatialDim, Frame>>(*constraints)),
+        make_not_null(&get<FConstraint<SpatialDim, Frame>>(*constraints)),
+        make_not_null(
+            &get<TwoIndexConstraint<SpatialDim, Frame>>(*constraints)),
+        make_not_null(
+            &get<FourIndexConstraint<SpatialDim, Frame>>(*constraints)),
+        make_not_null(&get<ConstraintEnergy<SpatialDim, Frame>>(*constraints)),
+        gauge_function, d_gauge_function, spacetime_normal_one_form,
+        spacetime_normal_vector, inverse_spatial_metric,
+        inverse_spacetime_metric, pi, phi, d_pi, d_phi, gamma2,
+        three_index_constraint, spatial_metric_determinant);
+  }
+};
 }  // namespace Tags
 }  // namespace GeneralizedHarmonic
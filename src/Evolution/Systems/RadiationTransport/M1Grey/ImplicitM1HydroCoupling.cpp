@@ -0,0 +1,145 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/RadiationTransport/M1Grey/ImplicitM1HydroCoupling.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1HydroCoupling.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+
+namespace {
+/// \cond
+struct ExplicitTildeE {
+  using type = Scalar<DataVector>;
+};
+struct ExplicitTildeS {
+  using type = tnsr::i<DataVector, 3>;
+};
+struct ClosureFactor {
+  using type = Scalar<DataVector>;
+};
+struct PressureTensor {
+  using type = tnsr::II<DataVector, 3>;
+};
+struct ComovingEnergyDensity {
+  using type = Scalar<DataVector>;
+};
+struct ComovingMomentumDensityNormal {
+  using type = Scalar<DataVector>;
+};
+struct ComovingMomentumDensitySpatial {
+  using type = tnsr::i<DataVector, 3>;
+};
+struct EnergyResidual {
+  using type = Scalar<DataVector>;
+};
+struct MomentumResidual {
+  using type = tnsr::i<DataVector, 3>;
+};
+struct EnergyJacobian {
+  using type = Scalar<DataVector>;
+};
+struct MomentumJacobian {
+  using type = Scalar<DataVector>;
+};
+/// \endcond
+}  // namespace
+
+namespace RadiationTransport::M1Grey::detail {
+
+void solve_implicit_m1_hydro_coupling_impl(
+    const gsl::not_null<Scalar<DataVector>*> tilde_e,
+    const gsl::not_null<tnsr::i<DataVector, 3>*> tilde_s,
+    const gsl::not_null<Scalar<DataVector>*> source_tilde_e,
+    const gsl::not_null<tnsr::i<DataVector, 3>*> source_tilde_s,
+    const double implicit_weight, const Scalar<DataVector>& emissivity,
+    const Scalar<DataVector>& absorption_opacity,
+    const Scalar<DataVector>& scattering_opacity,
+    const Scalar<DataVector>& closure_factor,
+    const tnsr::I<DataVector, 3>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const tnsr::II<DataVector, 3>& inv_spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
+  // Relative size of the residual at which the solution is accepted
+  constexpr double tolerance = 1.e-10;
+  constexpr size_t max_iterations = 100;
+  // Dimension of spatial tensors
+  constexpr size_t spatial_dim = 3;
+  Variables<tmpl::list<ExplicitTildeE, ExplicitTildeS, ClosureFactor,
+                       PressureTensor, ComovingEnergyDensity,
+                       ComovingMomentumDensityNormal,
+                       ComovingMomentumDensitySpatial, EnergyResidual,
+                       MomentumResidual, EnergyJacobian, MomentumJacobian>>
+      temp_tensors(get(lapse).size());
+
+  auto& explicit_tilde_e = get<ExplicitTildeE>(temp_tensors);
+  explicit_tilde_e = *tilde_e;
+  auto& explicit_tilde_s = get<ExplicitTildeS>(temp_tensors);
+  explicit_tilde_s = *tilde_s;
+  auto& local_closure_factor = get<ClosureFactor>(temp_tensors);
+  local_closure_factor = closure_factor;
+
+  // One minus the implicit weight times the Jacobian of the sources
+  // in the fluid rest frame
+  auto& energy_jacobian = get<EnergyJacobian>(temp_tensors);
+  get(energy_jacobian) =
+      1. + implicit_weight * get(lapse) * get(absorption_opacity);
+  auto& momentum_jacobian = get<MomentumJacobian>(temp_tensors);
+  get(momentum_jacobian) =
+      1. + implicit_weight * get(lapse) *
+               (get(absorption_opacity) + get(scattering_opacity));
+
+  auto& energy_residual = get<EnergyResidual>(temp_tensors);
+  auto& momentum_residual = get<MomentumResidual>(temp_tensors);
+  for (size_t iteration = 0;; ++iteration) {
+    compute_closure_impl(
+        make_not_null(&local_closure_factor),
+        make_not_null(&get<PressureTensor>(temp_tensors)),
+        make_not_null(&get<ComovingEnergyDensity>(temp_tensors)),
+        make_not_null(&get<ComovingMomentumDensityNormal>(temp_tensors)),
+        make_not_null(&get<ComovingMomentumDensitySpatial>(temp_tensors)),
+        *tilde_e, *tilde_s, fluid_velocity, fluid_lorentz_factor,
+        spatial_metric, inv_spatial_metric);
+    compute_m1_hydro_coupling_impl(
+        source_tilde_e, source_tilde_s, emissivity, absorption_opacity,
+        scattering_opacity, get<ComovingEnergyDensity>(temp_tensors),
+        get<ComovingMomentumDensityNormal>(temp_tensors),
+        get<ComovingMomentumDensitySpatial>(temp_tensors), fluid_velocity,
+        fluid_lorentz_factor, lapse, spatial_metric, sqrt_det_spatial_metric);
+
+    get(energy_residual) = get(*tilde_e) - get(explicit_tilde_e) -
+                           implicit_weight * get(*source_tilde_e);
+    double max_residual = max(abs(get(energy_residual)));
+    for (size_t i = 0; i < spatial_dim; i++) {
+      momentum_residual.get(i) = tilde_s->get(i) - explicit_tilde_s.get(i) -
+                                 implicit_weight * source_tilde_s->get(i);
+      max_residual = std::max(max_residual, max(abs(momentum_residual.get(i))));
+    }
+    if (max_residual <= tolerance * max(abs(get(*tilde_e)))) {
+      return;
+    }
+    if (iteration == max_iterations) {
+      ERROR("Implicit solve of the M1-hydro coupling did not converge after "
+            << max_iterations << " iterations. Residual: " << max_residual);
+    }
+
+    get(*tilde_e) -= get(energy_residual) / get(energy_jacobian);
+    for (size_t i = 0; i < spatial_dim; i++) {
+      tilde_s->get(i) -= momentum_residual.get(i) / get(momentum_jacobian);
+    }
+  }
+}
+
+}  // namespace RadiationTransport::M1Grey::detail
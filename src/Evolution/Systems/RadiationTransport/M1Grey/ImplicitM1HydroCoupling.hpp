@@ -0,0 +1,165 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+///\file
+/// Defines the implicit treatment of the M1-hydro coupling terms.
+
+#pragma once
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"  // IWYU pragma: keep
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"  // IWYU pragma: keep
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+
+/// \cond
+class DataVector;
+/// \endcond
+
+namespace RadiationTransport {
+namespace M1Grey {
+
+// Implementation of the implicit solve for
+// individual species
+namespace detail {
+void solve_implicit_m1_hydro_coupling_impl(
+    gsl::not_null<Scalar<DataVector>*> tilde_e,
+    gsl::not_null<tnsr::i<DataVector, 3>*> tilde_s,
+    gsl::not_null<Scalar<DataVector>*> source_tilde_e,
+    gsl::not_null<tnsr::i<DataVector, 3>*> source_tilde_s,
+    double implicit_weight, const Scalar<DataVector>& emissivity,
+    const Scalar<DataVector>& absorption_opacity,
+    const Scalar<DataVector>& scattering_opacity,
+    const Scalar<DataVector>& closure_factor,
+    const tnsr::I<DataVector, 3>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const tnsr::II<DataVector, 3>& inv_spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept;
+}  // namespace detail
+
+template <typename NeutrinoSpeciesList>
+struct ImplicitM1HydroCoupling;
+/*!
+ * Treat the neutrino-matter coupling terms computed by
+ * `ComputeM1HydroCoupling` implicitly, for use as the `implicit_sector` of
+ * the M1 system with `Actions::SolveImplicitSector`.
+ *
+ * The coupling terms are stiff in optically thick regions, where the
+ * timescale \f$1/(\alpha \kappa)\f$ is much shorter than the light-crossing
+ * time of a grid cell.  For each species this solves
+ *
+ * \f{align}{
+ * \tilde E = \tilde E^* + w S_E(\tilde E, \tilde S_i),\\
+ * \tilde S_i = \tilde S_i^* + w S_i(\tilde E, \tilde S_i),
+ * \f}
+ *
+ * at every grid point, with \f$S_E\f$ and \f$S_i\f$ the sources of
+ * `ComputeM1HydroCoupling` evaluated after applying the M1 closure to the
+ * unknowns.  The residual is evaluated exactly, and is reduced with the
+ * inverse of the Jacobian of the sources in the fluid rest frame,
+ *
+ * \f{align}{
+ * \frac{\partial S_E}{\partial \tilde E} = -\alpha \kappa_a, \qquad
+ * \frac{\partial S_i}{\partial \tilde S_j} =
+ * -\alpha (\kappa_a + \kappa_s) \delta_i^j,
+ * \f}
+ *
+ * which is exact for a fluid at rest and remains a contraction for moderate
+ * fluid velocities.  The closure factor of the previous step is the initial
+ * guess of the closure.
+ *
+ * When using this, the coupling terms must not also be added to the explicit
+ * time derivative, i.e., the tags they are stored in must be set to zero with
+ * `ZeroM1HydroCoupling` instead of computed with `ComputeM1HydroCoupling`.
+ */
+template <typename... NeutrinoSpecies>
+struct ImplicitM1HydroCoupling<tmpl::list<NeutrinoSpecies...>> {
+  using argument_tags =
+      tmpl::list<Tags::GreyEmissivity<NeutrinoSpecies>...,
+                 Tags::GreyAbsorptionOpacity<NeutrinoSpecies>...,
+                 Tags::GreyScatteringOpacity<NeutrinoSpecies>...,
+                 Tags::ClosureFactor<NeutrinoSpecies>...,
+                 hydro::Tags::SpatialVelocity<DataVector, 3>,
+                 hydro::Tags::LorentzFactor<DataVector>, gr::Tags::Lapse<>,
+                 gr::Tags::SpatialMetric<3>, gr::Tags::InverseSpatialMetric<3>,
+                 gr::Tags::SqrtDetSpatialMetric<>>;
+
+  using variables_type =
+      Variables<tmpl::list<Tags::TildeE<Frame::Inertial, NeutrinoSpecies>...,
+                           Tags::TildeS<Frame::Inertial, NeutrinoSpecies>...>>;
+  using sources_type = Variables<tmpl::list<
+      ::Tags::Source<Tags::TildeE<Frame::Inertial, NeutrinoSpecies>>...,
+      ::Tags::Source<Tags::TildeS<Frame::Inertial, NeutrinoSpecies>>...>>;
+
+  static void apply(
+      const gsl::not_null<variables_type*> vars,
+      const gsl::not_null<sources_type*> sources,
+      const double implicit_weight, const double /*time*/,
+      const typename Tags::GreyEmissivity<NeutrinoSpecies>::type&... emissivity,
+      const typename Tags::GreyAbsorptionOpacity<
+          NeutrinoSpecies>::type&... absorption_opacity,
+      const typename Tags::GreyScatteringOpacity<
+          NeutrinoSpecies>::type&... scattering_opacity,
+      const typename Tags::ClosureFactor<
+          NeutrinoSpecies>::type&... closure_factor,
+      const tnsr::I<DataVector, 3>& spatial_velocity,
+      const Scalar<DataVector>& lorentz_factor, const Scalar<DataVector>& lapse,
+      const tnsr::ii<DataVector, 3>& spatial_metric,
+      const tnsr::II<DataVector, 3>& inv_spatial_metric,
+      const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
+    EXPAND_PACK_LEFT_TO_RIGHT(detail::solve_implicit_m1_hydro_coupling_impl(
+        make_not_null(
+            &get<Tags::TildeE<Frame::Inertial, NeutrinoSpecies>>(*vars)),
+        make_not_null(
+            &get<Tags::TildeS<Frame::Inertial, NeutrinoSpecies>>(*vars)),
+        make_not_null(&get<::Tags::Source<
+                          Tags::TildeE<Frame::Inertial, NeutrinoSpecies>>>(
+            *sources)),
+        make_not_null(&get<::Tags::Source<
+                          Tags::TildeS<Frame::Inertial, NeutrinoSpecies>>>(
+            *sources)),
+        implicit_weight, emissivity, absorption_opacity, scattering_opacity,
+        closure_factor, spatial_velocity, lorentz_factor, lapse, spatial_metric,
+        inv_spatial_metric, sqrt_det_spatial_metric));
+  }
+};
+
+template <typename NeutrinoSpeciesList>
+struct ZeroM1HydroCoupling;
+/*!
+ * Set the M1-hydro coupling terms to zero, removing them from the explicit
+ * time derivative when they are treated implicitly by
+ * `ImplicitM1HydroCoupling`.
+ */
+template <typename... NeutrinoSpecies>
+struct ZeroM1HydroCoupling<tmpl::list<NeutrinoSpecies...>> {
+  using return_tags = tmpl::list<
+      Tags::M1HydroCouplingNormal<NeutrinoSpecies>...,
+      Tags::M1HydroCouplingSpatial<Frame::Inertial, NeutrinoSpecies>...>;
+
+  using argument_tags = tmpl::list<>;
+
+  static void apply(
+      const gsl::not_null<typename Tags::M1HydroCouplingNormal<
+          NeutrinoSpecies>::type*>... source_n,
+      const gsl::not_null<typename Tags::M1HydroCouplingSpatial<
+          Frame::Inertial, NeutrinoSpecies>::type*>... source_i) noexcept {
+    const auto zero_components = [](const auto tensor) noexcept {
+      for (auto& component : *tensor) {
+        component = 0.0;
+      }
+    };
+    EXPAND_PACK_LEFT_TO_RIGHT(zero_components(source_n));
+    EXPAND_PACK_LEFT_TO_RIGHT(zero_components(source_i));
+  }
+};
+
+}  // namespace M1Grey
+}  // namespace RadiationTransport
@@ -9,6 +9,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Characteristics.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Fluxes.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/ImplicitM1HydroCoupling.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Sources.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/TimeDerivativeTerms.hpp"
@@ -83,6 +84,10 @@ struct System<tmpl::list<NeutrinoSpecies...>> {
       TimeDerivativeTerms<NeutrinoSpecies...>;
   using volume_fluxes = ComputeFluxes<NeutrinoSpecies...>;
   using volume_sources = ComputeSources<NeutrinoSpecies...>;
+  // Only used with an ImexTimeStepper, in which case the M1-hydro coupling
+  // terms must be zeroed in the explicit time derivative
+  using implicit_sector =
+      ImplicitM1HydroCoupling<tmpl::list<NeutrinoSpecies...>>;
 
   using char_speeds_compute_tag = Tags::CharacteristicSpeedsCompute;
   using char_speeds_tag = Tags::CharacteristicSpeeds;
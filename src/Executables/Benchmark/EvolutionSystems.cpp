@@ -0,0 +1,893 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/SliceVariables.hpp"
+#include "DataStructures/Tensor/EagerMath/Determinant.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
+#include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.tpp"
+#include "Evolution/Systems/Burgers/BoundaryCorrections/Rusanov.hpp"
+#include "Evolution/Systems/Burgers/System.hpp"
+#include "Evolution/Systems/CurvedScalarWave/Equations.hpp"
+#include "Evolution/Systems/CurvedScalarWave/System.hpp"
+#include "Evolution/Systems/CurvedScalarWave/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/BoundaryCorrections/UpwindPenalty.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Rusanov.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
+#include "Evolution/Systems/NewtonianEuler/BoundaryCorrections/Rusanov.hpp"
+#include "Evolution/Systems/NewtonianEuler/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/NewtonianEuler/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/NewtonianEuler/System.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/System.hpp"
+#include "Evolution/Systems/RadiationTransport/Tags.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/System.hpp"
+#include "Evolution/Systems/ScalarWave/BoundaryCorrections/UpwindPenalty.hpp"
+#include "Evolution/Systems/ScalarWave/System.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "PointwiseFunctions/AnalyticSolutions/NewtonianEuler/SmoothFlow.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforthN.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+// Charm looks for this function but since we build without a main function or
+// main module we just have it be empty
+extern "C" void CkRegisterMainModule(void) {}
+
+// Benchmarks of the pieces of the right-hand side of every DG evolution
+// system on a single representative element. Each kernel is timed separately
+// and reports two counters:
+// - `points_per_second`: grid points processed per second. For the kernels
+//   that act on mortars this counts the mortar grid points.
+// - `bytes_per_point`: the size of the buffers the kernel reads and writes,
+//   per grid point.
+//
+// Benchmarks are named e.g. `bench_lift<BurgersTraits>/points:4/mortars:2`,
+// where the arguments are the number of grid points per dimension and either
+// whether the Jacobian is curved (volume kernels) or the number of mortars
+// (face kernels). Use `--benchmark_filter=<regex>` to select benchmarks, and
+// `--benchmark_format=json --benchmark_out=<file>.json` to write results
+// that can be compared across commits with Google Benchmark's
+// `tools/compare.py`.
+
+namespace {
+// The systems to benchmark. The `boundary_correction` is `void` for systems
+// that have none.
+struct ScalarWaveTraits {
+  using system = ScalarWave::System<3>;
+  using boundary_correction = ScalarWave::BoundaryCorrections::UpwindPenalty<3>;
+};
+
+struct GeneralizedHarmonicTraits {
+  using system = GeneralizedHarmonic::System<3>;
+  using boundary_correction =
+      GeneralizedHarmonic::BoundaryCorrections::UpwindPenalty<3>;
+};
+
+struct ValenciaDivCleanTraits {
+  using system =
+      grmhd::ValenciaDivClean::System<EquationsOfState::IdealFluid<true>>;
+  using boundary_correction =
+      grmhd::ValenciaDivClean::BoundaryCorrections::Rusanov;
+};
+
+struct ValenciaTraits {
+  using system =
+      RelativisticEuler::Valencia::System<3,
+                                          EquationsOfState::IdealFluid<true>>;
+  using boundary_correction = void;
+};
+
+struct NewtonianEulerTraits {
+  using system =
+      NewtonianEuler::System<3, EquationsOfState::IdealFluid<false>,
+                             NewtonianEuler::Solutions::SmoothFlow<3>>;
+  using boundary_correction = NewtonianEuler::BoundaryCorrections::Rusanov<3>;
+};
+
+struct BurgersTraits {
+  using system = Burgers::System;
+  using boundary_correction = Burgers::BoundaryCorrections::Rusanov;
+};
+
+struct M1GreyTraits {
+  using system = RadiationTransport::M1Grey::System<
+      tmpl::list<neutrinos::ElectronNeutrinos<1>>>;
+  using boundary_correction = void;
+};
+
+// CurvedScalarWave does not yet provide the interface the DG volume terms
+// need, so adapt `CurvedScalarWave::ComputeDuDt` to it. The system has no
+// fluxes and takes derivatives of all evolved variables.
+struct CurvedScalarWaveSystem : CurvedScalarWave::System<3> {
+  using flux_variables = tmpl::list<>;
+  using gradient_variables = gradients_tags;
+
+  struct compute_volume_time_derivative_terms {
+    using temporary_tags = tmpl::list<>;
+    using argument_tags = tmpl::list<
+        CurvedScalarWave::Pi, CurvedScalarWave::Phi<3>, gr::Tags::Lapse<>,
+        gr::Tags::Shift<3>,
+        ::Tags::deriv<gr::Tags::Lapse<>, tmpl::size_t<3>, Frame::Inertial>,
+        ::Tags::deriv<gr::Tags::Shift<3>, tmpl::size_t<3>, Frame::Inertial>,
+        gr::Tags::InverseSpatialMetric<3>,
+        gr::Tags::TraceSpatialChristoffelSecondKind<3>,
+        gr::Tags::TraceExtrinsicCurvature<>,
+        CurvedScalarWave::Tags::ConstraintGamma1,
+        CurvedScalarWave::Tags::ConstraintGamma2>;
+
+    static void apply(
+        const gsl::not_null<Scalar<DataVector>*> dt_pi,
+        const gsl::not_null<tnsr::i<DataVector, 3>*> dt_phi,
+        const gsl::not_null<Scalar<DataVector>*> dt_psi,
+        const tnsr::i<DataVector, 3>& d_pi,
+        const tnsr::ij<DataVector, 3>& d_phi,
+        const tnsr::i<DataVector, 3>& d_psi, const Scalar<DataVector>& pi,
+        const tnsr::i<DataVector, 3>& phi, const Scalar<DataVector>& lapse,
+        const tnsr::I<DataVector, 3>& shift,
+        const tnsr::i<DataVector, 3>& deriv_lapse,
+        const tnsr::iJ<DataVector, 3>& deriv_shift,
+        const tnsr::II<DataVector, 3>& upper_spatial_metric,
+        const tnsr::I<DataVector, 3>& trace_spatial_christoffel,
+        const Scalar<DataVector>& trace_extrinsic_curvature,
+        const Scalar<DataVector>& gamma1,
+        const Scalar<DataVector>& gamma2) noexcept {
+      CurvedScalarWave::ComputeDuDt<3>::apply(
+          dt_pi, dt_phi, dt_psi, pi, phi, d_psi, d_pi, d_phi, lapse, shift,
+          deriv_lapse, deriv_shift, upper_spatial_metric,
+          trace_spatial_christoffel, trace_extrinsic_curvature, gamma1,
+          gamma2);
+    }
+  };
+};
+
+struct CurvedScalarWaveTraits {
+  using system = CurvedScalarWaveSystem;
+  using boundary_correction = void;
+};
+
+void fill_with_random_values(const gsl::not_null<double*> value,
+                             const size_t /*num_points*/,
+                             const gsl::not_null<std::mt19937*> /*generator*/) {
+  // Only parameters such as damping constants are `double`s
+  *value = 1.0;
+}
+
+// Values in [1, 2] keep square roots and divisions in the kernels well
+// defined without the need for physically consistent data
+template <typename TensorType>
+void fill_with_random_values(const gsl::not_null<TensorType*> tensor,
+                             const size_t num_points,
+                             const gsl::not_null<std::mt19937*> generator) {
+  std::uniform_real_distribution<> distribution(1.0, 2.0);
+  for (auto& component : *tensor) {
+    component = DataVector{num_points};
+    for (double& value : component) {
+      value = distribution(*generator);
+    }
+  }
+}
+
+template <typename TagsList>
+void fill_with_random_values(const gsl::not_null<Variables<TagsList>*> vars,
+                             const size_t num_points,
+                             const gsl::not_null<std::mt19937*> generator) {
+  std::uniform_real_distribution<> distribution(1.0, 2.0);
+  vars->initialize(num_points);
+  for (size_t i = 0; i < vars->size(); ++i) {
+    vars->data()[i] = distribution(*generator);  // NOLINT
+  }
+}
+
+template <typename TagsList>
+size_t number_of_components() noexcept {
+  size_t result = 0;
+  tmpl::for_each<TagsList>([&result](auto tag_v) noexcept {
+    using type = typename tmpl::type_from<decltype(tag_v)>::type;
+    if constexpr (not std::is_same_v<type, double>) {
+      result += type::size();
+    }
+  });
+  return result;
+}
+
+template <typename... Tensors>
+size_t number_of_components(const Tensors&... tensors) noexcept {
+  return (tensors.size() + ...);
+}
+
+// clang-tidy: don't pass be non-const reference
+void set_counters(benchmark::State& state,  // NOLINT
+                  const size_t num_points,
+                  const size_t num_components) noexcept {
+  state.counters["points_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) *
+          static_cast<double>(num_points),
+      benchmark::Counter::kIsRate);
+  state.counters["bytes_per_point"] =
+      static_cast<double>(num_components * sizeof(double));
+}
+
+// A single element of the `Traits::system`, with randomized evolved
+// variables and time derivative arguments. A curved element has an inverse
+// Jacobian that varies over the element.
+template <typename Traits>
+struct Element {
+  using system = typename Traits::system;
+  static constexpr size_t dim = system::volume_dim;
+  using time_derivative = typename system::compute_volume_time_derivative_terms;
+  using variables_tags = typename system::variables_tag::tags_list;
+  using dt_variables_tags = db::wrap_tags_in<::Tags::dt, variables_tags>;
+  using flux_tags = db::wrap_tags_in<::Tags::Flux,
+                                     typename system::flux_variables,
+                                     tmpl::size_t<dim>, Frame::Inertial>;
+  using gradient_tags = typename system::gradient_variables;
+  using partial_derivative_tags =
+      db::wrap_tags_in<::Tags::deriv, gradient_tags, tmpl::size_t<dim>,
+                       Frame::Inertial>;
+  using temporary_tags = typename time_derivative::temporary_tags;
+  using argument_tags =
+      tmpl::list_difference<typename time_derivative::argument_tags,
+                            variables_tags>;
+
+  Element(const size_t points_per_dimension, const bool curved) noexcept
+      : mesh{points_per_dimension, Spectral::Basis::Legendre,
+             Spectral::Quadrature::GaussLobatto},
+        num_points(mesh.number_of_grid_points()),
+        inv_jacobian(num_points, 0.0),
+        inertial_coords(num_points),
+        dt_vars(num_points),
+        fluxes(num_points),
+        partial_derivs(num_points),
+        temporaries(num_points) {
+    const auto logical_coords = logical_coordinates(mesh);
+    for (size_t i = 0; i < dim; ++i) {
+      inertial_coords.get(i) = 0.5 * logical_coords.get(i);
+      inv_jacobian.get(i, i) = 2.0;
+      if (curved) {
+        for (size_t j = 0; j < dim; ++j) {
+          inv_jacobian.get(i, j) +=
+              0.1 * logical_coords.get(i) * logical_coords.get(j);
+        }
+      }
+    }
+    determinant(make_not_null(&det_inv_jacobian), inv_jacobian);
+
+    std::mt19937 generator{};
+    fill_with_random_values(make_not_null(&evolved_vars), num_points,
+                            make_not_null(&generator));
+    tmpl::for_each<argument_tags>(
+        [this, &generator](auto tag_v) noexcept {
+          using tag = tmpl::type_from<decltype(tag_v)>;
+          fill_with_random_values(make_not_null(&tuples::get<tag>(arguments)),
+                                  num_points, make_not_null(&generator));
+        });
+  }
+
+  // Time derivative arguments that are evolved variables are taken from the
+  // evolved variables, like they are from the DataBox in an evolution
+  template <typename Tag>
+  const auto& get_argument() const noexcept {
+    if constexpr (tmpl::list_contains_v<variables_tags, Tag>) {
+      return get<Tag>(evolved_vars);
+    } else {
+      return tuples::get<Tag>(arguments);
+    }
+  }
+
+  void compute_time_derivative_terms() noexcept {
+    compute_time_derivative_terms(
+        dt_variables_tags{}, flux_tags{}, temporary_tags{},
+        partial_derivative_tags{}, typename time_derivative::argument_tags{});
+  }
+
+  void compute_volume_terms() noexcept {
+    compute_volume_terms(typename time_derivative::argument_tags{});
+  }
+
+  Mesh<dim> mesh;
+  size_t num_points;
+  InverseJacobian<DataVector, dim, Frame::Logical, Frame::Inertial>
+      inv_jacobian;
+  tnsr::I<DataVector, dim, Frame::Inertial> inertial_coords;
+  Scalar<DataVector> det_inv_jacobian{};
+  Variables<variables_tags> evolved_vars{};
+  Variables<dt_variables_tags> dt_vars;
+  Variables<flux_tags> fluxes;
+  Variables<partial_derivative_tags> partial_derivs;
+  Variables<temporary_tags> temporaries;
+  tuples::tagged_tuple_from_typelist<argument_tags> arguments{};
+  std::optional<tnsr::I<DataVector, dim, Frame::Inertial>> mesh_velocity{};
+  std::optional<Scalar<DataVector>> div_mesh_velocity{};
+
+ private:
+  template <typename... DtTags, typename... FluxTags, typename... TemporaryTags,
+            typename... PartialDerivTags, typename... ArgumentTags>
+  void compute_time_derivative_terms(
+      tmpl::list<DtTags...> /*meta*/, tmpl::list<FluxTags...> /*meta*/,
+      tmpl::list<TemporaryTags...> /*meta*/,
+      tmpl::list<PartialDerivTags...> /*meta*/,
+      tmpl::list<ArgumentTags...> /*meta*/) noexcept {
+    time_derivative::apply(make_not_null(&get<DtTags>(dt_vars))...,
+                           make_not_null(&get<FluxTags>(fluxes))...,
+                           make_not_null(&get<TemporaryTags>(temporaries))...,
+                           get<PartialDerivTags>(partial_derivs)...,
+                           get_argument<ArgumentTags>()...);
+  }
+
+  template <typename... ArgumentTags>
+  void compute_volume_terms(tmpl::list<ArgumentTags...> /*meta*/) noexcept {
+    evolution::dg::Actions::detail::volume_terms<time_derivative>(
+        make_not_null(&dt_vars), make_not_null(&fluxes),
+        make_not_null(&partial_derivs), make_not_null(&temporaries),
+        evolved_vars, ::dg::Formulation::StrongInertial, mesh,
+        inertial_coords, inv_jacobian, &det_inv_jacobian, mesh_velocity,
+        div_mesh_velocity, get_argument<ArgumentTags>()...);
+  }
+};
+
+// Mortars are placed on the faces of the element in turn, so more than
+// `2 * Dim` mortars correspond to h-refined neighbors
+template <size_t Dim>
+size_t mortar_dimension(const size_t mortar) noexcept {
+  return (mortar / 2) % Dim;
+}
+
+size_t mortar_fixed_index(const size_t mortar,
+                          const size_t points_per_dimension) noexcept {
+  return mortar % 2 == 0 ? 0 : points_per_dimension - 1;
+}
+
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_partial_derivatives(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  element_type element{static_cast<size_t>(state.range(0)),
+                       state.range(1) != 0};
+  while (state.KeepRunning()) {
+    partial_derivatives<typename element_type::gradient_tags>(
+        make_not_null(&element.partial_derivs), element.evolved_vars,
+        element.mesh, element.inv_jacobian);
+    benchmark::DoNotOptimize(element.partial_derivs.data());
+  }
+  set_counters(
+      state, element.num_points,
+      number_of_components<typename element_type::gradient_tags>() +
+          number_of_components<
+              typename element_type::partial_derivative_tags>());
+}
+
+// The fluxes, sources and nonconservative products are computed together by
+// the system's `compute_volume_time_derivative_terms`
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_time_derivative_terms(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  element_type element{static_cast<size_t>(state.range(0)),
+                       state.range(1) != 0};
+  while (state.KeepRunning()) {
+    element.compute_time_derivative_terms();
+    benchmark::DoNotOptimize(element.dt_vars.data());
+  }
+  set_counters(
+      state, element.num_points,
+      number_of_components<typename element_type::dt_variables_tags>() +
+          number_of_components<typename element_type::flux_tags>() +
+          number_of_components<typename element_type::temporary_tags>() +
+          number_of_components<
+              typename element_type::partial_derivative_tags>() +
+          number_of_components<
+              typename element_type::time_derivative::argument_tags>());
+}
+
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_flux_divergence(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  using div_flux_tags =
+      db::wrap_tags_in<::Tags::div, typename element_type::flux_tags>;
+  element_type element{static_cast<size_t>(state.range(0)),
+                       state.range(1) != 0};
+  std::mt19937 generator{};
+  fill_with_random_values(make_not_null(&element.fluxes), element.num_points,
+                          make_not_null(&generator));
+  Variables<div_flux_tags> div_fluxes{element.num_points};
+  while (state.KeepRunning()) {
+    divergence(make_not_null(&div_fluxes), element.fluxes, element.mesh,
+               element.inv_jacobian);
+    benchmark::DoNotOptimize(div_fluxes.data());
+  }
+  set_counters(state, element.num_points,
+               number_of_components<typename element_type::flux_tags>() +
+                   number_of_components<div_flux_tags>());
+}
+
+// The complete volume contribution to the time derivative, as computed by
+// `evolution::dg::Actions::ComputeTimeDerivative`
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_volume_terms(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  element_type element{static_cast<size_t>(state.range(0)),
+                       state.range(1) != 0};
+  while (state.KeepRunning()) {
+    element.compute_volume_terms();
+    benchmark::DoNotOptimize(element.dt_vars.data());
+  }
+  set_counters(
+      state, element.num_points,
+      number_of_components<typename element_type::variables_tags>() +
+          number_of_components<typename element_type::dt_variables_tags>() +
+          number_of_components<typename element_type::flux_tags>() +
+          number_of_components<typename element_type::temporary_tags>() +
+          number_of_components<
+              typename element_type::partial_derivative_tags>() +
+          number_of_components<typename element_type::argument_tags>());
+}
+
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_boundary_correction(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  using BoundaryCorrection = typename Traits::boundary_correction;
+  using package_tags = typename BoundaryCorrection::dg_package_field_tags;
+  using dt_variables_tags = typename element_type::dt_variables_tags;
+  const auto points_per_dimension = static_cast<size_t>(state.range(0));
+  const auto number_of_mortars = static_cast<size_t>(state.range(1));
+  const size_t face_points =
+      Mesh<element_type::dim>{points_per_dimension, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto}
+          .slice_away(0)
+          .number_of_grid_points();
+
+  const BoundaryCorrection boundary_correction{};
+  std::mt19937 generator{};
+  std::vector<Variables<package_tags>> local_data(number_of_mortars);
+  std::vector<Variables<package_tags>> neighbor_data(number_of_mortars);
+  std::vector<Variables<dt_variables_tags>> corrections{};
+  for (size_t mortar = 0; mortar < number_of_mortars; ++mortar) {
+    fill_with_random_values(make_not_null(&local_data[mortar]), face_points,
+                            make_not_null(&generator));
+    fill_with_random_values(make_not_null(&neighbor_data[mortar]),
+                            face_points, make_not_null(&generator));
+    corrections.emplace_back(face_points);
+  }
+  while (state.KeepRunning()) {
+    for (size_t mortar = 0; mortar < number_of_mortars; ++mortar) {
+      evolution::dg::Actions::detail::boundary_correction(
+          make_not_null(&corrections[mortar]), local_data[mortar],
+          neighbor_data[mortar], boundary_correction,
+          ::dg::Formulation::StrongInertial);
+    }
+    benchmark::DoNotOptimize(corrections.data());
+  }
+  set_counters(state, number_of_mortars * face_points,
+               2 * number_of_components<package_tags>() +
+                   number_of_components<dt_variables_tags>());
+}
+
+// Lifts the boundary corrections on Gauss-Lobatto points and adds them to the
+// volume time derivative
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_lift(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  using dt_variables_tags = typename element_type::dt_variables_tags;
+  constexpr size_t dim = element_type::dim;
+  const auto points_per_dimension = static_cast<size_t>(state.range(0));
+  const auto number_of_mortars = static_cast<size_t>(state.range(1));
+  element_type element{points_per_dimension, false};
+  const size_t face_points =
+      element.mesh.slice_away(0).number_of_grid_points();
+
+  std::mt19937 generator{};
+  std::vector<Variables<dt_variables_tags>> corrections(number_of_mortars);
+  for (size_t mortar = 0; mortar < number_of_mortars; ++mortar) {
+    fill_with_random_values(make_not_null(&corrections[mortar]), face_points,
+                            make_not_null(&generator));
+  }
+  // Chosen so the lift factor is -1 and repeated lifting doesn't change the
+  // magnitude of the data
+  const Scalar<DataVector> magnitude_of_face_normal{DataVector{
+      face_points, 2.0 / static_cast<double>(points_per_dimension *
+                                             (points_per_dimension - 1))}};
+  while (state.KeepRunning()) {
+    for (size_t mortar = 0; mortar < number_of_mortars; ++mortar) {
+      ::dg::lift_flux(make_not_null(&corrections[mortar]),
+                      points_per_dimension, magnitude_of_face_normal);
+      add_slice_to_data(make_not_null(&element.dt_vars), corrections[mortar],
+                        element.mesh.extents(), mortar_dimension<dim>(mortar),
+                        mortar_fixed_index(mortar, points_per_dimension));
+    }
+    benchmark::DoNotOptimize(element.dt_vars.data());
+  }
+  set_counters(state, number_of_mortars * face_points,
+               2 * number_of_components<dt_variables_tags>() + 1);
+}
+
+// clang-tidy: don't pass be non-const reference
+template <typename Traits>
+void bench_time_stepper_update(benchmark::State& state) {  // NOLINT
+  using element_type = Element<Traits>;
+  using vars_type = Variables<typename element_type::variables_tags>;
+  using dt_vars_type = Variables<typename element_type::dt_variables_tags>;
+  element_type element{static_cast<size_t>(state.range(0)), false};
+
+  const TimeSteppers::AdamsBashforthN stepper{3};
+  const Slab slab{0.0, 1.0};
+  const TimeDelta time_step = slab.duration() / 1000;
+  TimeSteppers::History<vars_type, dt_vars_type> history{stepper.order()};
+  std::mt19937 generator{};
+  Time time = slab.start();
+  for (size_t i = 0; i < stepper.order(); ++i) {
+    fill_with_random_values(make_not_null(&element.dt_vars),
+                            element.num_points, make_not_null(&generator));
+    history.insert(TimeStepId{true, 0, time}, element.evolved_vars,
+                   element.dt_vars);
+    time += time_step;
+  }
+  while (state.KeepRunning()) {
+    stepper.update_u(make_not_null(&element.evolved_vars),
+                     make_not_null(&history), time_step);
+    benchmark::DoNotOptimize(element.evolved_vars.data());
+  }
+  set_counters(
+      state, element.num_points,
+      2 * number_of_components<typename element_type::variables_tags>() +
+          stepper.order() *
+              number_of_components<
+                  typename element_type::dt_variables_tags>());
+}
+
+// A fluid at rest in flat space with random density, internal energy and
+// magnetic field, as input to the conservative-to-primitive recovery
+struct FlatSpaceFluid {
+  FlatSpaceFluid(const size_t num_points, const double adiabatic_index,
+                 const gsl::not_null<std::mt19937*> generator) noexcept
+      : spatial_metric(num_points, 0.0),
+        inv_spatial_metric(num_points, 0.0),
+        sqrt_det_spatial_metric(num_points, 1.0),
+        divergence_cleaning_field(num_points, 0.0) {
+    fill_with_random_values(make_not_null(&rest_mass_density), num_points,
+                            generator);
+    fill_with_random_values(make_not_null(&specific_internal_energy),
+                            num_points, generator);
+    fill_with_random_values(make_not_null(&spatial_velocity), num_points,
+                            generator);
+    fill_with_random_values(make_not_null(&magnetic_field), num_points,
+                            generator);
+    DataVector velocity_squared{num_points, 0.0};
+    for (size_t i = 0; i < 3; ++i) {
+      spatial_metric.get(i, i) = 1.0;
+      inv_spatial_metric.get(i, i) = 1.0;
+      // Keep the speed well below the speed of light
+      spatial_velocity.get(i) *= 0.1;
+      magnetic_field.get(i) *= 0.1;
+      velocity_squared += square(spatial_velocity.get(i));
+    }
+    get(lorentz_factor) = 1.0 / sqrt(1.0 - velocity_squared);
+    get(pressure) = (adiabatic_index - 1.0) * get(rest_mass_density) *
+                    get(specific_internal_energy);
+    get(specific_enthalpy) = 1.0 + get(specific_internal_energy) +
+                             get(pressure) / get(rest_mass_density);
+  }
+
+  Scalar<DataVector> rest_mass_density{};
+  Scalar<DataVector> specific_internal_energy{};
+  tnsr::I<DataVector, 3> spatial_velocity{};
+  tnsr::I<DataVector, 3> magnetic_field{};
+  Scalar<DataVector> lorentz_factor{};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> specific_enthalpy{};
+  tnsr::ii<DataVector, 3> spatial_metric;
+  tnsr::II<DataVector, 3> inv_spatial_metric;
+  Scalar<DataVector> sqrt_det_spatial_metric;
+  Scalar<DataVector> divergence_cleaning_field;
+};
+
+// clang-tidy: don't pass be non-const reference
+void bench_primitive_recovery_newtonian_euler(  // NOLINT
+    benchmark::State& state) {
+  const auto points_per_dimension = static_cast<size_t>(state.range(0));
+  const size_t num_points = cube(points_per_dimension);
+  const EquationsOfState::IdealFluid<false> equation_of_state{5.0 / 3.0};
+  std::mt19937 generator{};
+  Scalar<DataVector> mass_density{};
+  tnsr::I<DataVector, 3> velocity{};
+  Scalar<DataVector> specific_internal_energy{};
+  fill_with_random_values(make_not_null(&mass_density), num_points,
+                          make_not_null(&generator));
+  fill_with_random_values(make_not_null(&velocity), num_points,
+                          make_not_null(&generator));
+  fill_with_random_values(make_not_null(&specific_internal_energy),
+                          num_points, make_not_null(&generator));
+  Scalar<DataVector> mass_density_cons{num_points};
+  tnsr::I<DataVector, 3> momentum_density{num_points};
+  Scalar<DataVector> energy_density{num_points};
+  Scalar<DataVector> pressure{num_points};
+  NewtonianEuler::ConservativeFromPrimitive<3>::apply(
+      make_not_null(&mass_density_cons), make_not_null(&momentum_density),
+      make_not_null(&energy_density), mass_density, velocity,
+      specific_internal_energy);
+
+  while (state.KeepRunning()) {
+    NewtonianEuler::PrimitiveFromConservative<3, 2>::apply(
+        make_not_null(&mass_density), make_not_null(&velocity),
+        make_not_null(&specific_internal_energy), make_not_null(&pressure),
+        mass_density_cons, momentum_density, energy_density,
+        equation_of_state);
+    benchmark::DoNotOptimize(get(pressure).data());
+  }
+  set_counters(state, num_points,
+               number_of_components(mass_density, velocity,
+                                    specific_internal_energy, pressure,
+                                    mass_density_cons, momentum_density,
+                                    energy_density));
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_primitive_recovery_valencia(benchmark::State& state) {  // NOLINT
+  const auto points_per_dimension = static_cast<size_t>(state.range(0));
+  const size_t num_points = cube(points_per_dimension);
+  const EquationsOfState::IdealFluid<true> equation_of_state{5.0 / 3.0};
+  std::mt19937 generator{};
+  FlatSpaceFluid fluid{num_points, 5.0 / 3.0, make_not_null(&generator)};
+  Scalar<DataVector> tilde_d{num_points};
+  Scalar<DataVector> tilde_tau{num_points};
+  tnsr::i<DataVector, 3> tilde_s{num_points};
+  RelativisticEuler::Valencia::ConservativeFromPrimitive<3>::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_tau),
+      make_not_null(&tilde_s), fluid.rest_mass_density,
+      fluid.specific_internal_energy, fluid.specific_enthalpy,
+      fluid.pressure, fluid.spatial_velocity, fluid.lorentz_factor,
+      fluid.sqrt_det_spatial_metric, fluid.spatial_metric);
+
+  while (state.KeepRunning()) {
+    RelativisticEuler::Valencia::PrimitiveFromConservative<2, 3>::apply(
+        make_not_null(&fluid.rest_mass_density),
+        make_not_null(&fluid.specific_internal_energy),
+        make_not_null(&fluid.lorentz_factor),
+        make_not_null(&fluid.specific_enthalpy),
+        make_not_null(&fluid.pressure),
+        make_not_null(&fluid.spatial_velocity), tilde_d, tilde_tau, tilde_s,
+        fluid.inv_spatial_metric, fluid.sqrt_det_spatial_metric,
+        equation_of_state);
+    benchmark::DoNotOptimize(get(fluid.pressure).data());
+  }
+  set_counters(
+      state, num_points,
+      number_of_components(
+          fluid.rest_mass_density, fluid.specific_internal_energy,
+          fluid.lorentz_factor, fluid.specific_enthalpy, fluid.pressure,
+          fluid.spatial_velocity, tilde_d, tilde_tau, tilde_s,
+          fluid.inv_spatial_metric, fluid.sqrt_det_spatial_metric));
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_primitive_recovery_valencia_div_clean(  // NOLINT
+    benchmark::State& state) {
+  const auto points_per_dimension = static_cast<size_t>(state.range(0));
+  const size_t num_points = cube(points_per_dimension);
+  const EquationsOfState::IdealFluid<true> equation_of_state{5.0 / 3.0};
+  std::mt19937 generator{};
+  FlatSpaceFluid fluid{num_points, 5.0 / 3.0, make_not_null(&generator)};
+  Scalar<DataVector> tilde_d{num_points};
+  Scalar<DataVector> tilde_tau{num_points};
+  tnsr::i<DataVector, 3> tilde_s{num_points};
+  tnsr::I<DataVector, 3> tilde_b{num_points};
+  Scalar<DataVector> tilde_phi{num_points};
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_tau),
+      make_not_null(&tilde_s), make_not_null(&tilde_b),
+      make_not_null(&tilde_phi), fluid.rest_mass_density,
+      fluid.specific_internal_energy, fluid.specific_enthalpy,
+      fluid.pressure, fluid.spatial_velocity, fluid.lorentz_factor,
+      fluid.magnetic_field, fluid.sqrt_det_spatial_metric,
+      fluid.spatial_metric, fluid.divergence_cleaning_field);
+
+  using primitive_from_conservative =
+      grmhd::ValenciaDivClean::PrimitiveFromConservative<
+          tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+                         NewmanHamlin>,
+          2>;
+  while (state.KeepRunning()) {
+    primitive_from_conservative::apply(
+        make_not_null(&fluid.rest_mass_density),
+        make_not_null(&fluid.specific_internal_energy),
+        make_not_null(&fluid.spatial_velocity),
+        make_not_null(&fluid.magnetic_field),
+        make_not_null(&fluid.divergence_cleaning_field),
+        make_not_null(&fluid.lorentz_factor), make_not_null(&fluid.pressure),
+        make_not_null(&fluid.specific_enthalpy), tilde_d, tilde_tau, tilde_s,
+        tilde_b, tilde_phi, fluid.spatial_metric, fluid.inv_spatial_metric,
+        fluid.sqrt_det_spatial_metric, equation_of_state);
+    benchmark::DoNotOptimize(get(fluid.pressure).data());
+  }
+  set_counters(
+      state, num_points,
+      number_of_components(
+          fluid.rest_mass_density, fluid.specific_internal_energy,
+          fluid.spatial_velocity, fluid.magnetic_field,
+          fluid.divergence_cleaning_field, fluid.lorentz_factor,
+          fluid.pressure, fluid.specific_enthalpy, tilde_d, tilde_tau,
+          tilde_s, tilde_b, tilde_phi, fluid.spatial_metric,
+          fluid.inv_spatial_metric, fluid.sqrt_det_spatial_metric));
+}
+
+void point_configurations(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"points"});
+  for (const int64_t points : {4, 6, 8}) {
+    benchmark->Arg(points);
+  }
+}
+
+void volume_configurations(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"points", "curved"});
+  for (const int64_t points : {4, 6, 8}) {
+    for (const int64_t curved : {0, 1}) {
+      benchmark->Args({points, curved});
+    }
+  }
+}
+
+// A single mortar, and one mortar on every face of the element
+template <typename Traits>
+void mortar_configurations(benchmark::internal::Benchmark* benchmark) {
+  constexpr auto number_of_faces =
+      static_cast<int64_t>(2 * Element<Traits>::dim);
+  benchmark->ArgNames({"points", "mortars"});
+  for (const int64_t points : {4, 6, 8}) {
+    for (const int64_t mortars : {int64_t{1}, number_of_faces}) {
+      benchmark->Args({points, mortars});
+    }
+  }
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(bench_partial_derivatives, ScalarWaveTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_partial_derivatives, GeneralizedHarmonicTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_partial_derivatives, CurvedScalarWaveTraits)
+    ->Apply(volume_configurations);  // NOLINT
+
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, ScalarWaveTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, GeneralizedHarmonicTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, ValenciaDivCleanTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, ValenciaTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, NewtonianEulerTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, BurgersTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, M1GreyTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_derivative_terms, CurvedScalarWaveTraits)
+    ->Apply(volume_configurations);  // NOLINT
+
+BENCHMARK_TEMPLATE(bench_flux_divergence, ValenciaDivCleanTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_flux_divergence, ValenciaTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_flux_divergence, NewtonianEulerTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_flux_divergence, BurgersTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_flux_divergence, M1GreyTraits)
+    ->Apply(volume_configurations);  // NOLINT
+
+BENCHMARK_TEMPLATE(bench_volume_terms, ScalarWaveTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, GeneralizedHarmonicTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, ValenciaDivCleanTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, ValenciaTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, NewtonianEulerTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, BurgersTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, M1GreyTraits)
+    ->Apply(volume_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_volume_terms, CurvedScalarWaveTraits)
+    ->Apply(volume_configurations);  // NOLINT
+
+BENCHMARK_TEMPLATE(bench_boundary_correction, ScalarWaveTraits)
+    ->Apply(mortar_configurations<ScalarWaveTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_boundary_correction, GeneralizedHarmonicTraits)
+    ->Apply(mortar_configurations<GeneralizedHarmonicTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_boundary_correction, ValenciaDivCleanTraits)
+    ->Apply(mortar_configurations<ValenciaDivCleanTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_boundary_correction, NewtonianEulerTraits)
+    ->Apply(mortar_configurations<NewtonianEulerTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_boundary_correction, BurgersTraits)
+    ->Apply(mortar_configurations<BurgersTraits>);  // NOLINT
+
+BENCHMARK_TEMPLATE(bench_lift, ScalarWaveTraits)
+    ->Apply(mortar_configurations<ScalarWaveTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, GeneralizedHarmonicTraits)
+    ->Apply(mortar_configurations<GeneralizedHarmonicTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, ValenciaDivCleanTraits)
+    ->Apply(mortar_configurations<ValenciaDivCleanTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, ValenciaTraits)
+    ->Apply(mortar_configurations<ValenciaTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, NewtonianEulerTraits)
+    ->Apply(mortar_configurations<NewtonianEulerTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, BurgersTraits)
+    ->Apply(mortar_configurations<BurgersTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, M1GreyTraits)
+    ->Apply(mortar_configurations<M1GreyTraits>);  // NOLINT
+BENCHMARK_TEMPLATE(bench_lift, CurvedScalarWaveTraits)
+    ->Apply(mortar_configurations<CurvedScalarWaveTraits>);  // NOLINT
+
+BENCHMARK_TEMPLATE(bench_time_stepper_update, ScalarWaveTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, GeneralizedHarmonicTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, ValenciaDivCleanTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, ValenciaTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, NewtonianEulerTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, BurgersTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, M1GreyTraits)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK_TEMPLATE(bench_time_stepper_update, CurvedScalarWaveTraits)
+    ->Apply(point_configurations);  // NOLINT
+
+BENCHMARK(bench_primitive_recovery_newtonian_euler)
+    ->Apply(point_configurations);  // NOLINT
+BENCHMARK(bench_primitive_recovery_valencia)->Apply(point_configurations);
+BENCHMARK(bench_primitive_recovery_valencia_div_clean)
+    ->Apply(point_configurations);  // NOLINT
+
+// Ignore the warning about an extra ';' because some versions of benchmark
+// require it
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
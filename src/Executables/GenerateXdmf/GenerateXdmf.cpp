@@ -0,0 +1,136 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IO/H5/VolumeDataIndex.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/FileSystem.hpp"
+
+// Charm looks for this function but since we build without a main function or
+// main module we just have it be empty
+extern "C" void CkRegisterMainModule(void) {}
+
+namespace {
+// All files `FILE_PREFIXN.h5` where `N` is a non-empty sequence of digits,
+// i.e. the files that `glob(file_prefix + "[0-9]*.h5")` finds in
+// `GenerateXdmf.py` (up to the digits-only restriction)
+std::vector<std::string> volume_file_names(const std::string& file_prefix) {
+  const auto separator = file_prefix.find_last_of('/');
+  const std::string directory =
+      separator == std::string::npos ? "./"
+                                     : file_prefix.substr(0, separator + 1);
+  const std::string name_prefix = separator == std::string::npos
+                                      ? file_prefix
+                                      : file_prefix.substr(separator + 1);
+  const std::string extension = ".h5";
+  std::vector<std::string> file_names{};
+  for (const auto& file_name : file_system::ls(directory)) {
+    if (file_name.size() <= name_prefix.size() + extension.size() or
+        file_name.compare(0, name_prefix.size(), name_prefix) != 0 or
+        file_name.compare(file_name.size() - extension.size(),
+                          extension.size(), extension) != 0) {
+      continue;
+    }
+    const auto digits_begin = file_name.begin() + name_prefix.size();
+    const auto digits_end = file_name.end() - extension.size();
+    if (std::all_of(digits_begin, digits_end,
+                    [](const char c) { return c >= '0' and c <= '9'; })) {
+      file_names.push_back(
+          (separator == std::string::npos ? "" : directory) + file_name);
+    }
+  }
+  std::sort(file_names.begin(), file_names.end());
+  return file_names;
+}
+}  // namespace
+
+/*
+ * This executable generates the XDMF file that ParaView and VisIt use to load
+ * volume data out of the H5 files written by a simulation. It produces the
+ * same output as `Visualization/Python/GenerateXdmf.py`, but reads the
+ * metadata of the files concurrently and can store it in an index file. When
+ * the same index file is passed again, e.g. while a simulation is still
+ * writing observations, only the observations that were added since the
+ * previous run are read from the H5 files.
+ */
+int main(int argc, char** argv) {
+  boost::program_options::options_description desc("Options");
+  desc.add_options()("help,h,", "show this help message")(
+      "file-prefix", boost::program_options::value<std::string>()->required(),
+      "The common prefix of the H5 volume files to load")(
+      "output,o", boost::program_options::value<std::string>()->required(),
+      "Output file name, an xmf extension will be added")(
+      "subfile-name,d",
+      boost::program_options::value<std::string>()->required(),
+      "Name of the volume data subfile in the H5 files, excluding the '.vol' "
+      "extension")(
+      "stride", boost::program_options::value<size_t>()->default_value(1),
+      "View only every stride'th time step")(
+      "start-time", boost::program_options::value<double>()->default_value(0.),
+      "The earliest time at which to start visualizing. The start-time value "
+      "is included.")(
+      "stop-time",
+      boost::program_options::value<double>()->default_value(1.e300),
+      "The time at which to stop visualizing. The stop-time value is "
+      "included.")(
+      "coordinates",
+      boost::program_options::value<std::string>()->default_value(
+          "InertialCoordinates"),
+      "The coordinates to use for visualization")(
+      "index-file", boost::program_options::value<std::string>(),
+      "File to store the metadata of the H5 files in. If it exists, only "
+      "observations that are not already in it are read from the H5 files.")(
+      "num-threads",
+      boost::program_options::value<size_t>()->default_value(
+          std::max(std::thread::hardware_concurrency(), 1u)),
+      "Number of threads that read the H5 files");
+
+  boost::program_options::variables_map vars;
+
+  boost::program_options::store(
+      boost::program_options::command_line_parser(argc, argv)
+          .options(desc)
+          .run(),
+      vars);
+
+  if (vars.count("help") != 0u or vars.count("file-prefix") == 0u or
+      vars.count("output") == 0u or vars.count("subfile-name") == 0u) {
+    Parallel::printf("%s\n", desc);
+    return 0;
+  }
+
+  const auto file_prefix = vars["file-prefix"].as<std::string>();
+  const auto subfile_name = vars["subfile-name"].as<std::string>();
+  const auto coordinates = vars["coordinates"].as<std::string>();
+  const auto file_names = volume_file_names(file_prefix);
+  if (file_names.empty()) {
+    ERROR("No H5 files with prefix '" << file_prefix << "' found.");
+  }
+
+  std::vector<h5::VolumeFileIndex> previous_index{};
+  if (vars.count("index-file") != 0u and
+      file_system::check_if_file_exists(
+          vars["index-file"].as<std::string>())) {
+    previous_index =
+        h5::read_volume_file_index(vars["index-file"].as<std::string>());
+  }
+  const auto index =
+      h5::index_volume_files(file_names, subfile_name, coordinates,
+                             vars["num-threads"].as<size_t>(), previous_index);
+  if (vars.count("index-file") != 0u) {
+    h5::write_volume_file_index(vars["index-file"].as<std::string>(), index);
+  }
+
+  std::ofstream xdmf_file(vars["output"].as<std::string>() + ".xmf");
+  xdmf_file << h5::volume_file_index_to_xdmf(
+      index, subfile_name, coordinates, vars["start-time"].as<double>(),
+      vars["stop-time"].as<double>(), vars["stride"].as<size_t>());
+}
@@ -1,9 +1,15 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <cstddef>
+#include <optional>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -13,13 +19,32 @@ namespace py = pybind11;
 
 namespace py_bindings {
 void bind_h5vol(py::module& m) {  // NOLINT
+  py::class_<h5::Compression> compression(m, "Compression");
+  py::enum_<h5::Compression::Method>(compression, "Method")
+      .value("Uncompressed", h5::Compression::Method::None)
+      .value("Float32", h5::Compression::Method::Float32)
+      .value("Quantized", h5::Compression::Method::Quantized);
+  compression
+      .def(py::init([](const h5::Compression::Method method,
+                       const double absolute_tolerance) {
+             return h5::Compression{method, absolute_tolerance};
+           }),
+           py::arg("method") = h5::Compression::Method::None,
+           py::arg("absolute_tolerance") = 0.0)
+      .def_readwrite("method", &h5::Compression::method)
+      .def_readwrite("absolute_tolerance",
+                     &h5::Compression::absolute_tolerance);
   // Wrapper for basic H5VolumeData operations
   py::class_<h5::VolumeData>(m, "H5Vol")
       .def_static("extension", &h5::VolumeData::extension)
       .def("get_header", &h5::VolumeData::get_header)
       .def("get_version", &h5::VolumeData::get_version)
       .def("get_dimension", &h5::VolumeData::get_dimension)
-      .def("write_volume_data", &h5::VolumeData::write_volume_data)
+      .def("write_volume_data", &h5::VolumeData::write_volume_data,
+           py::arg("observation_id"), py::arg("observation_value"),
+           py::arg("elements"),
+           py::arg("compression") =
+               std::unordered_map<std::string, h5::Compression>{})
       .def("list_observation_ids", &h5::VolumeData::list_observation_ids)
       .def("get_observation_value", &h5::VolumeData::get_observation_value,
            py::arg("observation_id"))
@@ -29,6 +54,37 @@ void bind_h5vol(py::module& m) {  // NOLINT
            py::arg("observation_id"))
       .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def(
+          "get_tensor_components",
+          [](const h5::VolumeData& volume_file, const size_t observation_id,
+             const std::optional<std::vector<std::string>>&
+                 tensor_components) {
+            const auto component_names =
+                tensor_components.has_value()
+                    ? *tensor_components
+                    : volume_file.list_tensor_components(observation_id);
+            auto data = volume_file.get_tensor_components(observation_id,
+                                                          component_names);
+            py::dict result{};
+            for (size_t i = 0; i < component_names.size(); ++i) {
+              // Hand the memory of the DataVector over to the NumPy array so
+              // the data read from the file is never copied
+              auto* const owned_data = new DataVector(std::move(data[i]));
+              const py::capsule free_data(owned_data, [](void* ptr) {
+                delete static_cast<DataVector*>(ptr);  // NOLINT
+              });
+              result[py::str(component_names[i])] = py::array_t<double>(
+                  {owned_data->size()}, {sizeof(double)}, owned_data->data(),
+                  free_data);
+            }
+            return result;
+          },
+          py::arg("observation_id"),
+          py::arg("tensor_components") = std::nullopt,
+          "Read the tensor components (all by default) at the observation id "
+          "into a dictionary of NumPy arrays without copying the data")
+      .def("get_compression", &h5::VolumeData::get_compression,
+           py::arg("observation_id"), py::arg("tensor_component"))
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
@@ -0,0 +1,111 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/SerializedData.hpp"
+
+#include <algorithm>
+#include <future>
+#include <hdf5.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/Type.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+/// \cond HIDDEN_SYMBOLS
+namespace h5 {
+SerializedData::SerializedData(const bool /*exists*/,
+                               detail::OpenGroup&& group,
+                               const hid_t /*location*/,
+                               const std::string& name) noexcept
+    : group_(std::move(group)),
+      name_(name.size() > extension().size()
+                ? (extension() == name.substr(name.size() - extension().size())
+                       ? name
+                       : name + extension())
+                : name + extension()),
+      serialized_data_group_(group_.id(), name_, h5::AccessType::ReadWrite) {}
+
+void SerializedData::write_buffer(const std::string& buffer_name,
+                                  const std::vector<char>& buffer,
+                                  const int compression_level) noexcept {
+  if (contains_dataset_or_group(serialized_data_group_.id(), "",
+                                buffer_name)) {
+    ERROR("Cannot write the buffer '" << buffer_name << "' to '" << name_
+                                      << "' because it already exists.");
+  }
+  if (compression_level < 0 or compression_level > 9) {
+    ERROR("The compression level must be between 0 and 9, but is "
+          << compression_level);
+  }
+  // Filters need a chunked dataset, and chunks cannot be empty
+  if (compression_level == 0 or buffer.empty() or
+      H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+    h5::write_data(serialized_data_group_.id(), buffer, {buffer.size()},
+                   buffer_name);
+    return;
+  }
+  const auto size = static_cast<hsize_t>(buffer.size());
+  const hid_t space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list");
+  // Chunks are limited to 4GB, and each chunk is compressed separately
+  const hsize_t chunk_size = std::min(size, hsize_t{1} << 20);
+  CHECK_H5(H5Pset_chunk(property_list, 1, &chunk_size),
+           "Failed to set chunk size");
+  CHECK_H5(H5Pset_deflate(property_list,
+                          static_cast<unsigned int>(compression_level)),
+           "Failed to set deflate filter");
+  const hid_t dataset_id = H5Dcreate2(
+      serialized_data_group_.id(), buffer_name.c_str(), h5_type<char>(),
+      space_id, h5::h5p_default(), property_list, h5::h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset");
+  CHECK_H5(H5Dwrite(dataset_id, h5_type<char>(), h5::h5s_all(), h5::h5s_all(),
+                    h5::h5p_default(), static_cast<const void*>(buffer.data())),
+           "Failed to write data to dataset");
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
+std::vector<char> SerializedData::get_buffer(
+    const std::string& buffer_name) const noexcept {
+  if (not contains_dataset_or_group(serialized_data_group_.id(), "",
+                                    buffer_name)) {
+    ERROR("The buffer '" << buffer_name << "' does not exist in '" << name_
+                         << "'.");
+  }
+  return read_data<1, std::vector<char>>(serialized_data_group_.id(),
+                                         buffer_name);
+}
+
+std::vector<std::string> SerializedData::list_buffers() const noexcept {
+  return get_group_names(serialized_data_group_.id(), "");
+}
+
+std::future<void> write_serialized_data_async(
+    std::string file_name, std::string subfile_name,
+    std::vector<std::pair<std::string, std::vector<char>>> buffers,
+    const int compression_level) noexcept {
+  return std::async(
+      std::launch::async,
+      [file_name = std::move(file_name), subfile_name = std::move(subfile_name),
+       buffers = std::move(buffers), compression_level]() noexcept {
+        h5::H5File<h5::AccessType::ReadWrite> h5_file(file_name, true);
+        auto& serialized_data =
+            h5_file.try_insert<h5::SerializedData>(subfile_name);
+        for (const auto& [buffer_name, buffer] : buffers) {
+          serialized_data.write_buffer(buffer_name, buffer,
+                                       compression_level);
+        }
+      });
+}
+}  // namespace h5
+/// \endcond
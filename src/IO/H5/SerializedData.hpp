@@ -0,0 +1,84 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <future>
+#include <hdf5.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/Object.hpp"
+#include "IO/H5/OpenGroup.hpp"
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief Serialized objects, e.g. the DataBoxes of elements for a checkpoint,
+ * written inside an H5 file.
+ *
+ * Each buffer, usually the result of `serialize`, is stored as a dataset named
+ * `buffer_name`. The buffers are compressed with the deflate filter of HDF5 if
+ * the library supports it. Serialized data of long simulations is dominated by
+ * repeated or slowly varying values, e.g. zero-initialized buffers and mesh
+ * and domain data, which compress well. Since the filter is part of the HDF5
+ * file format, `get_buffer` decompresses the buffers transparently.
+ *
+ * Writing with a `compression_level` of 0 stores the buffer uncompressed. A
+ * low level such as the default of 1 is much faster to write than the maximum
+ * of 9 and compresses serialized data nearly as well.
+ */
+class SerializedData : public h5::Object {
+ public:
+  static std::string extension() noexcept { return ".ser"; }
+
+  SerializedData(bool exists, detail::OpenGroup&& group, hid_t location,
+                 const std::string& name) noexcept;
+
+  SerializedData(const SerializedData& /*rhs*/) = delete;
+  SerializedData& operator=(const SerializedData& /*rhs*/) = delete;
+  SerializedData(SerializedData&& /*rhs*/) noexcept = delete;  // NOLINT
+  SerializedData& operator=(SerializedData&& /*rhs*/) noexcept =  // NOLINT
+      delete;
+
+  ~SerializedData() override = default;
+
+  /// Write `buffer` to the dataset `buffer_name`, which must not exist yet
+  void write_buffer(const std::string& buffer_name,
+                    const std::vector<char>& buffer,
+                    int compression_level = 1) noexcept;
+
+  /// Read the buffer in the dataset `buffer_name`
+  std::vector<char> get_buffer(const std::string& buffer_name) const noexcept;
+
+  /// List the names of all buffers in the subfile
+  std::vector<std::string> list_buffers() const noexcept;
+
+ private:
+  detail::OpenGroup group_{};
+  std::string name_{};
+  detail::OpenGroup serialized_data_group_{};
+};
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the `buffers` to the `h5::SerializedData` subfile
+ * `subfile_name` of the H5 file `file_name` on a background thread.
+ *
+ * The buffers are a snapshot of the serialized objects taken in memory, so the
+ * objects can change while the data is written. This lets e.g. an evolution
+ * continue while a checkpoint is compressed and written. The file and the
+ * subfile are created if they don't exist yet. Each pair holds the name and
+ * the contents of a buffer, see `h5::SerializedData::write_buffer`. Call
+ * `get()` on the returned future to wait for the data to be written.
+ *
+ * \warning Unless the HDF5 library is built thread-safe, nothing else may
+ * access HDF5 files until the returned future is ready. The file `file_name`
+ * must not be accessed in the meantime in any case.
+ */
+std::future<void> write_serialized_data_async(
+    std::string file_name, std::string subfile_name,
+    std::vector<std::pair<std::string, std::vector<char>>> buffers,
+    int compression_level = 1) noexcept;
+}  // namespace h5
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/iterator/transform_iterator.hpp>
+#include <cmath>
 #include <hdf5.h>
 #include <memory>
 #include <ostream>
@@ -16,9 +17,12 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/SpectralIo.hpp"
+#include "IO/H5/Type.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "IO/H5/Version.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -85,8 +89,122 @@ void append_element_name(const gsl::not_null<std::string*> grid_names,
   *grid_names += spatial_name + VolumeData::separator();
 }
 
+// Write the contiguous `data` of a tensor component to the dataset
+// `component_name`, compressed with the `compression` method
+void write_tensor_component(const hid_t observation_group_id,
+                            const std::vector<double>& data,
+                            const std::string& component_name,
+                            const Compression& compression) noexcept {
+  // Filters need a chunked dataset, and chunks cannot be empty
+  if (compression.method == Compression::Method::None or data.empty()) {
+    h5::write_data(observation_group_id, data, {data.size()}, component_name);
+    return;
+  }
+  const auto size = static_cast<hsize_t>(data.size());
+  const hid_t space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list");
+  // Chunks are limited to 4GB, and each chunk is compressed separately
+  const hsize_t chunk_size = std::min(size, hsize_t{1} << 20);
+  CHECK_H5(H5Pset_chunk(property_list, 1, &chunk_size),
+           "Failed to set chunk size");
+  const bool deflate_is_available = H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+  hid_t file_type = h5_type<double>();
+  if (compression.method == Compression::Method::Float32) {
+    file_type = H5T_NATIVE_FLOAT;
+    // Grouping the bytes of the floats by significance makes the exponents,
+    // which vary slowly for smooth data, compress well
+    if (deflate_is_available and H5Zfilter_avail(H5Z_FILTER_SHUFFLE) > 0) {
+      CHECK_H5(H5Pset_shuffle(property_list), "Failed to set shuffle filter");
+    }
+  } else {
+    if (not(compression.absolute_tolerance > 0.0)) {
+      ERROR("The absolute tolerance for compressing tensor component '"
+            << component_name << "' must be positive, but is "
+            << compression.absolute_tolerance);
+    }
+    if (H5Zfilter_avail(H5Z_FILTER_SCALEOFFSET) <= 0) {
+      ERROR("Cannot compress tensor component '"
+            << component_name
+            << "' because the HDF5 library does not support the scale-offset "
+               "filter.");
+    }
+    // Rounding to multiples of 10^(-decimal_digits) has an error of at most
+    // half of that
+    const int decimal_digits = std::max(
+        static_cast<int>(
+            std::ceil(-std::log10(2.0 * compression.absolute_tolerance))),
+        0);
+    CHECK_H5(H5Pset_scaleoffset(property_list, H5Z_SO_FLOAT_DSCALE,
+                                decimal_digits),
+             "Failed to set scale-offset filter");
+  }
+  if (deflate_is_available) {
+    CHECK_H5(H5Pset_deflate(property_list, 6), "Failed to set deflate filter");
+  }
+  const hid_t dataset_id =
+      H5Dcreate2(observation_group_id, component_name.c_str(), file_type,
+                 space_id, h5::h5p_default(), property_list, h5::h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset");
+  // HDF5 converts the doubles to the file type
+  CHECK_H5(H5Dwrite(dataset_id, h5_type<double>(), h5::h5s_all(),
+                    h5::h5s_all(), h5::h5p_default(),
+                    static_cast<const void*>(data.data())),
+           "Failed to write data to dataset");
+  h5::write_to_attribute(dataset_id, "compression",
+                         static_cast<int>(compression.method));
+  h5::write_to_attribute(dataset_id, "absolute_tolerance",
+                         compression.absolute_tolerance);
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
+// Read the tensor component dataset `tensor_component` of the observation
+// group `observation_group_id` directly into a DataVector. Compressed
+// datasets are decompressed by HDF5 when they are read as doubles.
+DataVector read_tensor_component(
+    const hid_t observation_group_id,
+    const std::string& tensor_component) noexcept {
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group_id, tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const auto rank =
+      static_cast<size_t>(H5Sget_simple_extent_ndims(dataspace_id));
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  switch (rank) {
+    case 1:
+      return h5::read_data<1, DataVector>(observation_group_id,
+                                          tensor_component);
+    case 2:
+      return h5::read_data<2, DataVector>(observation_group_id,
+                                          tensor_component);
+    case 3:
+      return h5::read_data<3, DataVector>(observation_group_id,
+                                          tensor_component);
+    default:
+      ERROR("Rank must be 1, 2, or 3. Received data with Rank = " << rank);
+  }
+}
+
 }  // namespace
 
+std::ostream& operator<<(std::ostream& os,
+                         const Compression::Method& method) noexcept {
+  switch (method) {
+    case Compression::Method::None:
+      return os << "None";
+    case Compression::Method::Float32:
+      return os << "Float32";
+    case Compression::Method::Quantized:
+      return os << "Quantized";
+    default:
+      ERROR("Invalid compression method");
+  }
+}
+
 VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
                        const hid_t /*location*/, const std::string& name,
                        const uint32_t version) noexcept
@@ -126,7 +244,8 @@ VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
 // an `observation_group` in a `VolumeData` file.
 void VolumeData::write_volume_data(
     const size_t observation_id, const double observation_value,
-    const std::vector<ElementVolumeData>& elements) noexcept {
+    const std::vector<ElementVolumeData>& elements,
+    const std::unordered_map<std::string, Compression>& compression) noexcept {
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
@@ -206,8 +325,12 @@ void VolumeData::write_volume_data(
                                     tensor_data_on_grid.end());
 
     }  // for each element
-    h5::write_data(observation_group.id(), contiguous_tensor_data,
-                   {contiguous_tensor_data.size()}, component_name);
+    const auto component_compression = compression.find(component_name);
+    write_tensor_component(observation_group.id(), contiguous_tensor_data,
+                           component_name,
+                           component_compression == compression.end()
+                               ? Compression{}
+                               : component_compression->second);
   }  // for each component
 
   // Write the grid extents contiguously, the first `dim` belong to the
@@ -304,27 +427,42 @@ DataVector VolumeData::get_tensor_component(
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadOnly);
+  return read_tensor_component(observation_group.id(), tensor_component);
+}
 
+std::vector<DataVector> VolumeData::get_tensor_components(
+    const size_t observation_id,
+    const std::vector<std::string>& tensor_components) const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  std::vector<DataVector> result{};
+  result.reserve(tensor_components.size());
+  for (const auto& tensor_component : tensor_components) {
+    result.push_back(
+        read_tensor_component(observation_group.id(), tensor_component));
+  }
+  return result;
+}
+
+Compression VolumeData::get_compression(
+    const size_t observation_id,
+    const std::string& tensor_component) const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
   const hid_t dataset_id =
       h5::open_dataset(observation_group.id(), tensor_component);
-  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
-  const auto rank =
-      static_cast<size_t>(H5Sget_simple_extent_ndims(dataspace_id));
-  h5::close_dataspace(dataspace_id);
-  h5::close_dataset(dataset_id);
-  switch (rank) {
-    case 1:
-      return h5::read_data<1, DataVector>(observation_group.id(),
-                                          tensor_component);
-    case 2:
-      return h5::read_data<2, DataVector>(observation_group.id(),
-                                          tensor_component);
-    case 3:
-      return h5::read_data<3, DataVector>(observation_group.id(),
-                                          tensor_component);
-    default:
-      ERROR("Rank must be 1, 2, or 3. Received data with Rank = " << rank);
+  Compression compression{};
+  // Uncompressed tensor components have no `compression` attribute
+  if (H5Aexists(dataset_id, "compression") > 0) {
+    compression.method = static_cast<Compression::Method>(
+        h5::read_value_attribute<int>(dataset_id, "compression"));
+    compression.absolute_tolerance =
+        h5::read_value_attribute<double>(dataset_id, "absolute_tolerance");
   }
+  h5::close_dataset(dataset_id);
+  return compression;
 }
 
 std::vector<std::vector<size_t>> VolumeData::get_extents(
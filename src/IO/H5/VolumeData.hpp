@@ -23,6 +23,38 @@ class ExtentsAndTensorVolumeData;
 /// \endcond
 
 namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief How `h5::VolumeData` stores a tensor component.
+ *
+ * By default tensor components are stored uncompressed as 64-bit floats. The
+ * lossy methods reduce the size of data that is only used for visualization or
+ * coarse analysis:
+ * - `Float32`: Store the values as 32-bit floats, i.e. with a relative error of
+ *   about \f$6\times 10^{-8}\f$.
+ * - `Quantized`: Store the values rounded to a multiple of a power of ten such
+ *   that the absolute error is at most `absolute_tolerance`. This uses the
+ *   scale-offset filter of HDF5, which stores only the bits needed for the
+ *   range of the rounded values in each chunk.
+ *
+ * Both lossy methods also apply the shuffle and deflate filters if the HDF5
+ * library supports them, so smooth data compresses well beyond the reduced
+ * precision. The method is recorded in the `compression` attribute of the
+ * dataset. Since the filters are part of the HDF5 file format, the data is
+ * decompressed transparently when it is read as 64-bit floats, by
+ * `h5::VolumeData::get_tensor_component` as well as by any other HDF5 reader,
+ * e.g. the XDMF files written by `GenerateXdmf` for ParaView and VisIt.
+ */
+struct Compression {
+  enum class Method { None, Float32, Quantized };
+  Method method{Method::None};
+  /// The maximum absolute error of `Method::Quantized`
+  double absolute_tolerance{0.0};
+};
+
+std::ostream& operator<<(std::ostream& os,
+                         const Compression::Method& method) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief A volume data subfile written inside an H5 file.
@@ -60,6 +92,9 @@ namespace h5 {
  * `h5::offset_and_length_for_grid` function to compute the offset into the
  * contiguous dataset that corresponds to a particular grid.
  *
+ * Tensor components can be written with lossy compression to reduce the size
+ * of the file, see `h5::Compression`.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -95,11 +130,16 @@ class VolumeData : public h5::Object {
   /// Insert tensor components at `observation_id` with floating point value
   /// `observation_value`
   ///
+  /// The tensor components named in `compression` (without the grid name,
+  /// e.g. `T_xx`) are stored compressed, all others are stored uncompressed.
+  ///
   /// \requires The names of the tensor components is of the form
   /// `GRID_NAME/TENSOR_NAME_COMPONENT`, e.g. `Element0/T_xx`
   void write_volume_data(
       size_t observation_id, double observation_value,
-      const std::vector<ElementVolumeData>& elements) noexcept;
+      const std::vector<ElementVolumeData>& elements,
+      const std::unordered_map<std::string, Compression>& compression =
+          {}) noexcept;
 
   /// List all the integral observation ids in the subfile
   std::vector<size_t> list_observation_ids() const noexcept;
@@ -127,11 +167,28 @@ class VolumeData : public h5::Object {
   std::vector<std::string> get_grid_names(size_t observation_id) const noexcept;
 
   /// Read a tensor component with name `tensor_component` at observation id
-  /// `observation_id` from all grids in the file
+  /// `observation_id` from all grids in the file. Compressed tensor components
+  /// are decompressed.
   DataVector get_tensor_component(
       size_t observation_id,
       const std::string& tensor_component) const noexcept;
 
+  /// Read the tensor components with names `tensor_components` at observation
+  /// id `observation_id` from all grids in the file, in the order they are
+  /// requested
+  ///
+  /// This opens the observation only once, so it is faster than calling
+  /// `get_tensor_component` for each of the components.
+  std::vector<DataVector> get_tensor_components(
+      size_t observation_id,
+      const std::vector<std::string>& tensor_components) const noexcept;
+
+  /// How the tensor component with name `tensor_component` at observation id
+  /// `observation_id` is stored in the file
+  Compression get_compression(
+      size_t observation_id,
+      const std::string& tensor_component) const noexcept;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(
@@ -0,0 +1,354 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/VolumeDataIndex.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <hdf5.h>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace h5 {
+namespace {
+VolumeFileIndex index_volume_file(
+    const std::string& file_name, const std::string& subfile_name,
+    const std::string& coordinates,
+    const VolumeFileIndex* const previous_index) {
+  const H5File<AccessType::ReadOnly> file{file_name};
+  const auto& volume_file = file.get<VolumeData>("/" + subfile_name);
+
+  std::unordered_map<size_t, const VolumeObservationMetadata*>
+      previous_observations{};
+  if (previous_index != nullptr) {
+    for (const auto& observation : previous_index->observations) {
+      previous_observations[observation.observation_id] = &observation;
+    }
+  }
+
+  VolumeFileIndex result{file_name, {}};
+  for (const size_t observation_id : volume_file.list_observation_ids()) {
+    const auto previous_observation =
+        previous_observations.find(observation_id);
+    if (previous_observation != previous_observations.end()) {
+      result.observations.push_back(*previous_observation->second);
+      continue;
+    }
+    VolumeObservationMetadata observation{};
+    observation.observation_id = observation_id;
+    observation.observation_value =
+        volume_file.get_observation_value(observation_id);
+    observation.tensor_components =
+        volume_file.list_tensor_components(observation_id);
+    if (not alg::found(observation.tensor_components, coordinates + "_x")) {
+      ERROR("No '" << coordinates << "_x' tensor component found in file '"
+                   << file_name << "' at observation id " << observation_id);
+    }
+    // If there are no z-coordinates then assume the data is 2d, like
+    // GenerateXdmf.py does
+    observation.dimension =
+        alg::found(observation.tensor_components, coordinates + "_z") ? 3 : 2;
+    for (const auto& extents : volume_file.get_extents(observation_id)) {
+      const bool is_3d = observation.dimension == 3 and extents.size() > 2;
+      observation.number_of_points +=
+          extents[0] * extents[1] * (is_3d ? extents[2] : 1);
+      // We can't have zero cells if rendering a 2d surface
+      observation.number_of_cells +=
+          (extents[0] - 1) * (extents[1] - 1) * (is_3d ? extents[2] - 1 : 1);
+    }
+    result.observations.push_back(std::move(observation));
+  }
+  alg::sort(result.observations,
+            [](const VolumeObservationMetadata& lhs,
+               const VolumeObservationMetadata& rhs) noexcept {
+              return lhs.observation_value < rhs.observation_value;
+            });
+  return result;
+}
+}  // namespace
+
+bool operator==(const VolumeObservationMetadata& lhs,
+                const VolumeObservationMetadata& rhs) noexcept {
+  return lhs.observation_id == rhs.observation_id and
+         lhs.observation_value == rhs.observation_value and
+         lhs.dimension == rhs.dimension and
+         lhs.number_of_points == rhs.number_of_points and
+         lhs.number_of_cells == rhs.number_of_cells and
+         lhs.tensor_components == rhs.tensor_components;
+}
+
+bool operator!=(const VolumeObservationMetadata& lhs,
+                const VolumeObservationMetadata& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+bool operator==(const VolumeFileIndex& lhs,
+                const VolumeFileIndex& rhs) noexcept {
+  return lhs.file_name == rhs.file_name and
+         lhs.observations == rhs.observations;
+}
+
+bool operator!=(const VolumeFileIndex& lhs,
+                const VolumeFileIndex& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+std::vector<VolumeFileIndex> index_volume_files(
+    const std::vector<std::string>& file_names,
+    const std::string& subfile_name, const std::string& coordinates,
+    const size_t number_of_threads,
+    const std::vector<VolumeFileIndex>& previous_index) {
+  if (file_names.empty()) {
+    return {};
+  }
+  std::unordered_map<std::string, const VolumeFileIndex*> previous_files{};
+  for (const auto& file_index : previous_index) {
+    previous_files[file_index.file_name] = &file_index;
+  }
+
+  hbool_t hdf5_is_threadsafe = false;
+  CHECK_H5(H5is_library_threadsafe(&hdf5_is_threadsafe),
+           "Failed to check if HDF5 is thread-safe");
+  const size_t threads_to_use =
+      hdf5_is_threadsafe
+          ? std::clamp(number_of_threads, size_t{1}, file_names.size())
+          : 1;
+
+  std::vector<VolumeFileIndex> result(file_names.size());
+  std::atomic<size_t> next_file{0};
+  const auto index_files = [&coordinates, &file_names, &next_file,
+                            &previous_files, &result, &subfile_name]() {
+    for (size_t i = next_file++; i < file_names.size(); i = next_file++) {
+      const auto previous_file = previous_files.find(file_names[i]);
+      result[i] = index_volume_file(
+          file_names[i], subfile_name, coordinates,
+          previous_file == previous_files.end() ? nullptr
+                                                : previous_file->second);
+    }
+  };
+  std::vector<std::thread> threads{};
+  threads.reserve(threads_to_use - 1);
+  for (size_t i = 1; i < threads_to_use; ++i) {
+    threads.emplace_back(index_files);
+  }
+  index_files();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return result;
+}
+
+void write_volume_file_index(const std::string& file_name,
+                             const std::vector<VolumeFileIndex>& index) {
+  std::ofstream index_file(file_name);
+  if (not index_file.is_open()) {
+    ERROR("Could not open the index file '" << file_name << "' for writing");
+  }
+  index_file << std::setprecision(17);
+  for (const auto& file_index : index) {
+    index_file << "file " << std::quoted(file_index.file_name) << " "
+               << file_index.observations.size() << "\n";
+    for (const auto& observation : file_index.observations) {
+      index_file << observation.observation_id << " "
+                 << observation.observation_value << " "
+                 << observation.dimension << " "
+                 << observation.number_of_points << " "
+                 << observation.number_of_cells << " "
+                 << observation.tensor_components.size();
+      for (const auto& component : observation.tensor_components) {
+        index_file << " " << std::quoted(component);
+      }
+      index_file << "\n";
+    }
+  }
+}
+
+std::vector<VolumeFileIndex> read_volume_file_index(
+    const std::string& file_name) {
+  std::ifstream index_file(file_name);
+  if (not index_file.is_open()) {
+    ERROR("Could not open the index file '" << file_name << "' for reading");
+  }
+  std::vector<VolumeFileIndex> index{};
+  std::string keyword{};
+  while (index_file >> keyword) {
+    if (keyword != "file") {
+      ERROR("Expected 'file' but found '" << keyword << "' in the index file '"
+                                          << file_name << "'");
+    }
+    VolumeFileIndex file_index{};
+    size_t number_of_observations = 0;
+    index_file >> std::quoted(file_index.file_name) >> number_of_observations;
+    file_index.observations.resize(number_of_observations);
+    for (auto& observation : file_index.observations) {
+      size_t number_of_components = 0;
+      index_file >> observation.observation_id >>
+          observation.observation_value >> observation.dimension >>
+          observation.number_of_points >> observation.number_of_cells >>
+          number_of_components;
+      observation.tensor_components.resize(number_of_components);
+      for (auto& component : observation.tensor_components) {
+        index_file >> std::quoted(component);
+      }
+    }
+    if (not index_file) {
+      ERROR("Failed to read the entry of file '"
+            << file_index.file_name << "' in the index file '" << file_name
+            << "'");
+    }
+    index.push_back(std::move(file_index));
+  }
+  return index;
+}
+
+std::string volume_file_index_to_xdmf(
+    const std::vector<VolumeFileIndex>& index, const std::string& subfile_name,
+    const std::string& coordinates, const double start_time,
+    const double stop_time, const size_t stride) {
+  if (index.empty()) {
+    ERROR("Cannot generate XDMF from an empty index");
+  }
+  if (stride == 0) {
+    ERROR("The stride must be at least 1");
+  }
+  std::vector<std::unordered_map<size_t, const VolumeObservationMetadata*>>
+      observations_by_id(index.size());
+  for (size_t i = 0; i < index.size(); ++i) {
+    for (const auto& observation : index[i].observations) {
+      observations_by_id[i][observation.observation_id] = &observation;
+    }
+  }
+
+  std::ostringstream xdmf{};
+  xdmf << "<?xml version=\"1.0\" ?>\n"
+          "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\">\n"
+          "<Xdmf Version=\"2.0\">\n"
+          "<Domain>\n"
+          "<Grid Name=\"Evolution\" GridType=\"Collection\" "
+          "CollectionType=\"Temporal\">\n";
+
+  // counter used to enforce the stride
+  size_t stride_counter = 0;
+  for (const auto& time_observation : index.front().observations) {
+    if (time_observation.observation_value < start_time) {
+      continue;
+    }
+    if (time_observation.observation_value > stop_time) {
+      break;
+    }
+    ++stride_counter;
+    if ((stride_counter - 1) % stride != 0) {
+      continue;
+    }
+
+    xdmf << "  <Grid Name=\"Grids\" GridType=\"Collection\">\n"
+         << "    <Time Value=\"" << std::scientific << std::setprecision(14)
+         << time_observation.observation_value << "\"/>\n";
+    for (size_t i = 0; i < index.size(); ++i) {
+      const auto& file_name = index[i].file_name;
+      const auto found_observation =
+          observations_by_id[i].find(time_observation.observation_id);
+      if (found_observation == observations_by_id[i].end()) {
+        ERROR("The observation id " << time_observation.observation_id
+                                    << " is missing in file '" << file_name
+                                    << "'");
+      }
+      const VolumeObservationMetadata& observation =
+          *found_observation->second;
+      const bool is_3d = observation.dimension == 3;
+
+      const std::string data_item =
+          "        <DataItem Dimensions=\" " +
+          std::to_string(observation.number_of_points) +
+          "\" NumberType=\"Double\" Precision=\"8\" Format=\"HDF5\">\n";
+      // In 2d we still need a 3d dataset to have a vector because ParaView
+      // only supports 3d vectors. We deal with this by making the z-component
+      // all zeros.
+      const std::string data_item_vec =
+          "        <DataItem Dimensions=\" " +
+          std::to_string(observation.number_of_points) +
+          " 3\" ItemType = \"Function\" Function = \"" +
+          (is_3d ? "JOIN($0,$1,$2)" : "JOIN($0,$1, 0 * $1)") + "\">\n";
+      const std::string grid_path =
+          "          " + file_name + ":/" + subfile_name +
+          ".vol/ObservationId" + std::to_string(observation.observation_id);
+
+      xdmf << "    <Grid Name=\"" << file_name << "\" GridType=\"Uniform\">\n"
+           << "      <Topology TopologyType=\""
+           << (is_3d ? "Hexahedron" : "quadrilateral")
+           << "\" NumberOfElements=\"" << observation.number_of_cells
+           << "\">\n"
+           << "        <DataItem Dimensions=\"" << observation.number_of_cells
+           << " " << (is_3d ? 8 : 4)
+           << "\" NumberType=\"Int\" Format=\"HDF5\">\n"
+           << grid_path << "/connectivity\n"
+           << "        </DataItem>\n      </Topology>\n";
+
+      xdmf << "      <Geometry Type=\"" << (is_3d ? "X_Y_Z" : "X_Y")
+           << "\">\n";
+      for (const std::string suffix : {"_x", "_y", "_z"}) {
+        if (suffix == "_z" and not is_3d) {
+          continue;
+        }
+        xdmf << data_item << grid_path << "/" << coordinates << suffix
+             << "\n        </DataItem>\n";
+      }
+      xdmf << "      </Geometry>\n";
+
+      // Everything that isn't a coordinate is a "component"
+      for (const auto& component : observation.tensor_components) {
+        if (component == coordinates + "_x" or
+            component == coordinates + "_y" or
+            (is_3d and component == coordinates + "_z")) {
+          continue;
+        }
+        const auto ends_with = [&component](const std::string& suffix) {
+          return component.size() >= suffix.size() and
+                 component.compare(component.size() - suffix.size(),
+                                   suffix.size(), suffix) == 0;
+        };
+        if (ends_with("_x")) {
+          // Write a vector using the three components that make up the vector
+          // (i.e. v_x, v_y, v_z)
+          const std::string vector = component.substr(0, component.size() - 2);
+          xdmf << "      <Attribute Name=\"" << vector
+               << "\" AttributeType=\"Vector\" Center=\"Node\">\n"
+               << data_item_vec;
+          for (const std::string suffix : {"_x", "_y", "_z"}) {
+            xdmf << data_item << grid_path << "/" << vector << suffix << "\n"
+                 << "        </DataItem>\n";
+          }
+          xdmf << "        </DataItem>\n"
+               << "      </Attribute>\n";
+        } else if (ends_with("_y") or ends_with("_z")) {
+          // The component is a y or z component of a vector, it is processed
+          // with the x component
+          continue;
+        } else {
+          // If the component is not part of a vector, write it as a scalar
+          xdmf << "      <Attribute Name=\"" << component
+               << "\" AttributeType=\"Scalar\" Center=\"Node\">\n"
+               << data_item << grid_path << "/" << component << "\n"
+               << "        </DataItem>\n"
+               << "      </Attribute>\n";
+        }
+      }
+      xdmf << "    </Grid>\n";
+    }
+    // close time grid
+    xdmf << "  </Grid>\n";
+  }
+  xdmf << "</Grid>\n</Domain>\n</Xdmf>";
+  return xdmf.str();
+}
+}  // namespace h5
@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief The metadata of one observation in an `h5::VolumeData` subfile that
+ * is needed to visualize it, e.g. with XDMF.
+ *
+ * The `dimension` is 3 if a `COORDINATES_z` tensor component exists and 2
+ * otherwise, where `COORDINATES` is the name of the coordinates that the index
+ * was built for. The `number_of_cells` counts the hexahedra (in 3D) or
+ * quadrilaterals (in 2D) between the grid points of all grids.
+ */
+struct VolumeObservationMetadata {
+  size_t observation_id{};
+  double observation_value{std::numeric_limits<double>::signaling_NaN()};
+  size_t dimension{};
+  size_t number_of_points{};
+  size_t number_of_cells{};
+  std::vector<std::string> tensor_components{};
+};
+
+bool operator==(const VolumeObservationMetadata& lhs,
+                const VolumeObservationMetadata& rhs) noexcept;
+bool operator!=(const VolumeObservationMetadata& lhs,
+                const VolumeObservationMetadata& rhs) noexcept;
+
+/// \ingroup HDF5Group
+/// \brief The metadata of all observations in the volume data subfile of one
+/// H5 file, sorted by observation value
+struct VolumeFileIndex {
+  std::string file_name{};
+  std::vector<VolumeObservationMetadata> observations{};
+};
+
+bool operator==(const VolumeFileIndex& lhs,
+                const VolumeFileIndex& rhs) noexcept;
+bool operator!=(const VolumeFileIndex& lhs,
+                const VolumeFileIndex& rhs) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Read the metadata of all observations in the `h5::VolumeData`
+ * subfile `subfile_name` of each of the `file_names`.
+ *
+ * The files are scanned concurrently by `number_of_threads` threads, each of
+ * which opens its own files. Since HDF5 is only safe to use from several
+ * threads if it was built thread-safe, a single thread is used otherwise.
+ *
+ * If a `previous_index` is given, e.g. one read with `read_volume_file_index`
+ * from an earlier run, only observations that are not already in it are read
+ * from the files, so appending observations to the files only requires
+ * reading the new observations. Observations in the `previous_index` that are
+ * no longer in the files are dropped. The `coordinates` must be the same as
+ * the ones the `previous_index` was built with.
+ *
+ * The result has one entry for each of the `file_names`, in the same order,
+ * so it is empty if no `file_names` are given.
+ */
+std::vector<VolumeFileIndex> index_volume_files(
+    const std::vector<std::string>& file_names,
+    const std::string& subfile_name, const std::string& coordinates,
+    size_t number_of_threads,
+    const std::vector<VolumeFileIndex>& previous_index = {});
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the `index` to the text file `file_name`, so that later
+ * visualization steps can read it with `read_volume_file_index` instead of
+ * scanning the H5 files again.
+ *
+ * The format is one line per file, `file "FILE_NAME" NUMBER_OF_OBSERVATIONS`,
+ * each followed by one line per observation with the observation id, the
+ * observation value, the dimension, the number of points, the number of cells,
+ * the number of tensor components and the names of the tensor components,
+ * separated by spaces. The file names and the tensor component names are
+ * written with `std::quoted`, so they may contain whitespace and quotes.
+ */
+void write_volume_file_index(const std::string& file_name,
+                             const std::vector<VolumeFileIndex>& index);
+
+/// \ingroup HDF5Group
+/// \brief Read an index written with `write_volume_file_index`
+std::vector<VolumeFileIndex> read_volume_file_index(
+    const std::string& file_name);
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Generate the XDMF that ParaView and VisIt use to load the data out of
+ * the H5 files in the `index`.
+ *
+ * Only observations with values in `[start_time, stop_time]` are included,
+ * and of those only every `stride`th. This produces the same XDMF as
+ * `Visualization/Python/GenerateXdmf.py`, but does not open any H5 file.
+ */
+std::string volume_file_index_to_xdmf(
+    const std::vector<VolumeFileIndex>& index, const std::string& subfile_name,
+    const std::string& coordinates, double start_time, double stop_time,
+    size_t stride);
+}  // namespace h5
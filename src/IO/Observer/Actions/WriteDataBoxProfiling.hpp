@@ -0,0 +1,72 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Profiling.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/WriteSimpleData.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+
+namespace observers::Actions {
+/*!
+ * \brief Write the statistics of the DataBox compute items evaluated on this
+ * PE to `h5::Dat` subfiles of the volume file of this node.
+ *
+ * \details Each compute item gets a subfile
+ * `/DataBoxProfiling/Pe<proc>/<item name>`, with one row of the cumulative
+ * statistics (see `db::profiling::ComputeItemStatistics`) per call. Since the
+ * statistics are kept per PE, this action must be invoked on the
+ * `observers::Observer` group, e.g. by broadcasting it, so that every PE
+ * writes its statistics.
+ *
+ * Nothing is recorded, and therefore nothing is written, unless SpECTRE is
+ * built with `DATABOX_PROFILING=ON`.
+ */
+struct WriteDataBoxProfiling {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const double time) noexcept {
+    const auto& statistics = db::profiling::compute_item_statistics();
+    if (statistics.empty()) {
+      return;
+    }
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const int my_proc = Parallel::my_proc(*my_proxy.ckLocalBranch());
+    const int my_node = Parallel::my_node(*my_proxy.ckLocalBranch());
+    auto writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(
+        cache)[static_cast<size_t>(my_node)];
+
+    const std::vector<std::string> legend{
+        "Time", "NumberOfEvaluations", "NumberOfResets", "EvaluationTime",
+        "BytesProduced"};
+    const std::string subfile_prefix =
+        "/DataBoxProfiling/Pe" + std::to_string(my_proc) + "/";
+    for (const auto& [name, item_statistics] : statistics) {
+      // Subfile names cannot contain slashes
+      std::string subfile_name = name;
+      std::replace(subfile_name.begin(), subfile_name.end(), '/', '_');
+      Parallel::threaded_action<ThreadedActions::WriteSimpleData>(
+          writer_proxy, legend,
+          std::vector<double>{
+              time, static_cast<double>(item_statistics.number_of_evaluations),
+              static_cast<double>(item_statistics.number_of_resets),
+              item_statistics.evaluation_time,
+              static_cast<double>(item_statistics.bytes_produced)},
+          subfile_prefix + subfile_name);
+    }
+  }
+};
+}  // namespace observers::Actions
@@ -79,13 +79,17 @@ bool needs_projection(const Mesh<Dim>& face_mesh, const Mesh<Dim>& mortar_mesh,
       });
 }
 
+// @{
 /// \ingroup DiscontinuousGalerkinGroup
 /// Project variables from a face to a mortar.
+///
+/// The `result` must already have the number of grid points of the
+/// `mortar_mesh`. It may be a non-owning `Variables`.
 template <typename Tags, size_t Dim>
-Variables<Tags> project_to_mortar(const Variables<Tags>& vars,
-                                  const Mesh<Dim>& face_mesh,
-                                  const Mesh<Dim>& mortar_mesh,
-                                  const MortarSize<Dim>& mortar_size) noexcept {
+void project_to_mortar(const gsl::not_null<Variables<Tags>*> result,
+                       const Variables<Tags>& vars, const Mesh<Dim>& face_mesh,
+                       const Mesh<Dim>& mortar_mesh,
+                       const MortarSize<Dim>& mortar_size) noexcept {
   const Matrix identity{};
   auto projection_matrices = make_array<Dim>(std::cref(identity));
 
@@ -101,8 +105,20 @@ Variables<Tags> project_to_mortar(const Variables<Tags>& vars,
           slice_size, mortar_slice_mesh, face_slice_mesh);
     }
   }
-  return apply_matrices(projection_matrices, vars, face_mesh.extents());
+  apply_matrices(result, projection_matrices, vars, face_mesh.extents());
+}
+
+template <typename Tags, size_t Dim>
+Variables<Tags> project_to_mortar(const Variables<Tags>& vars,
+                                  const Mesh<Dim>& face_mesh,
+                                  const Mesh<Dim>& mortar_mesh,
+                                  const MortarSize<Dim>& mortar_size) noexcept {
+  Variables<Tags> result{mortar_mesh.number_of_grid_points()};
+  project_to_mortar(make_not_null(&result), vars, face_mesh, mortar_mesh,
+                    mortar_size);
+  return result;
 }
+// @}
 
 /// \ingroup DiscontinuousGalerkinGroup
 /// Project variables from a mortar to a face.
@@ -48,7 +48,7 @@ struct SendPointsToInterpolator {
         make_not_null(&box), temporal_id, coords);
     auto& receiver_proxy =
         Parallel::get_parallel_component<Interpolator<Metavariables>>(cache);
-    Parallel::simple_action<Actions::ReceivePoints<InterpolationTargetTag>>(
+    Parallel::threaded_action<Actions::ReceivePoints<InterpolationTargetTag>>(
         receiver_proxy, temporal_id, std::move(coords));
   }
 };
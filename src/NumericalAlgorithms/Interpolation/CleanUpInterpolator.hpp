@@ -7,6 +7,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
@@ -38,7 +39,8 @@ namespace Actions {
 /// \ingroup ActionsGroup
 /// \brief Cleans up stored volume data that is no longer needed.
 ///
-/// Called by InterpolationTargetReceiveVars.
+/// Called by InterpolationTargetReceiveVars.  This is a threaded action
+/// that holds the node lock for its whole duration.
 ///
 /// Uses:
 /// - Databox:
@@ -63,7 +65,9 @@ struct CleanUpInterpolator {
       db::DataBox<DbTags>& box,  // HorizonManager's box
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> node_lock,
       const typename Metavariables::temporal_id::type& temporal_id) noexcept {
+    node_lock->lock();
     // Signal that this InterpolationTarget is done at this time.
     db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
         make_not_null(&box),
@@ -117,6 +121,7 @@ struct CleanUpInterpolator {
                 });
           });
     }
+    node_lock->unlock();
   }
 };
 }  // namespace Actions
@@ -106,11 +106,13 @@ class Interpolate<VolumeDim, InterpolationTargetTag, tmpl::list<Tensors...>,
     (void) copy_to_variables; // GCC warns unused variable if Tensors is empty.
     expand_pack(copy_to_variables(tmpl::type_<Tensors>{}, tensors)...);
 
-    // Send volume data to the Interpolator, to trigger interpolation.
+    // Send volume data to the Interpolator, to trigger interpolation. The
+    // interpolation runs on this core, concurrently with the other cores on
+    // this node.
     auto& interpolator =
         *::Parallel::get_parallel_component<Interpolator<Metavariables>>(cache)
              .ckLocalBranch();
-    Parallel::simple_action<Actions::InterpolatorReceiveVolumeData>(
+    Parallel::threaded_action<Actions::InterpolatorReceiveVolumeData>(
         interpolator, time_id, ElementId<VolumeDim>(array_index), mesh,
         interp_vars);
 
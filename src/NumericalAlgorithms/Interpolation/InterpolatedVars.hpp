@@ -38,8 +38,8 @@ struct Info {
   /// `Info` will change as more `Elements` send data to this
   /// `Interpolator`, and will be less than or equal to the size of
   /// `block_coord_holders` even after all `Element`s have sent their
-  /// data (this is because this `Info` lives only on a single core,
-  /// and this core will have access only to the local `Element`s).
+  /// data (this is because this `Info` lives only on a single node,
+  /// and this node will have access only to the local `Element`s).
   std::vector<std::optional<IdPair<
       domain::BlockId, tnsr::I<double, VolumeDim, typename ::Frame::Logical>>>>
       block_coord_holders;
@@ -54,9 +54,13 @@ struct Info {
   /// send data to this `Interpolator`.
   std::vector<std::vector<size_t>> global_offsets{};
   /// Holds the `ElementId`s of `Element`s for which interpolation has
-  /// already been done for this `Info`.
+  /// already been done (or has been started) for this `Info`.
   std::unordered_set<ElementId<VolumeDim>>
       interpolation_is_done_for_these_elements{};
+  /// The number of `Element`s in `interpolation_is_done_for_these_elements`
+  /// whose interpolation is still being done by another thread on this node,
+  /// and whose results are therefore not yet in `vars` and `global_offsets`.
+  size_t number_of_interpolations_in_progress{0};
 };
 
 template <size_t VolumeDim, typename TagList>
@@ -65,6 +69,7 @@ void pup(PUP::er& p, Info<VolumeDim, TagList>& t) noexcept {  // NOLINT
   p | t.vars;
   p | t.global_offsets;
   p | t.interpolation_is_done_for_these_elements;
+  p | t.number_of_interpolations_in_progress;
 }
 
 template <size_t VolumeDim, typename TagList>
@@ -96,7 +96,7 @@ struct InterpolationTargetReceiveVars {
         auto& interpolator_proxy =
             Parallel::get_parallel_component<Interpolator<Metavariables>>(
                 cache);
-        Parallel::simple_action<
+        Parallel::threaded_action<
             Actions::CleanUpInterpolator<InterpolationTargetTag>>(
             interpolator_proxy, temporal_id);
 
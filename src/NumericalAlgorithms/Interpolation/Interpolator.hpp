@@ -7,7 +7,7 @@
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolator.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
 #include "Parallel/Actions/TerminatePhase.hpp"
-#include "Parallel/Algorithms/AlgorithmGroup.hpp"
+#include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -18,10 +18,17 @@ namespace intrp {
 /// \brief ParallelComponent responsible for collecting data from
 /// `Element`s and interpolating it onto `InterpolationTarget`s.
 ///
+/// The `Interpolator` is a nodegroup, so the volume data of all `Element`s on
+/// a node is held once per node, and each `InterpolationTarget` receives a
+/// single message per node and temporal id with the points in all `Element`s
+/// on that node. The interpolation itself is done by the threaded action
+/// `Actions::InterpolatorReceiveVolumeData` on the cores that the `Element`s
+/// live on, so all cores of a node interpolate concurrently.
+///
 /// For requirements on Metavariables, see InterpolationTarget
 template <class Metavariables>
 struct Interpolator {
-  using chare_type = Parallel::Algorithms::Group;
+  using chare_type = Parallel::Algorithms::Nodegroup;
   using metavariables = Metavariables;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       typename metavariables::Phase, metavariables::Phase::Initialization,
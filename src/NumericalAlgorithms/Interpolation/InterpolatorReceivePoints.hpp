@@ -12,6 +12,7 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"
 #include "NumericalAlgorithms/Interpolation/TryToInterpolate.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -45,6 +46,10 @@ namespace Actions {
 /// After receiving the points, interpolates volume data onto them
 /// if it already has all the volume data.
 ///
+/// This is a threaded action that holds the node lock for its whole
+/// duration, since it mutates the same DataBox items as
+/// `InterpolatorReceiveVolumeData` running on other cores of the node.
+///
 /// Uses:
 /// - Databox:
 ///   - `Tags::NumberOfElements`
@@ -69,11 +74,13 @@ struct ReceivePoints {
       db::DataBox<DbTags>& box,
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> node_lock,
       const typename Metavariables::temporal_id::type& temporal_id,
       std::vector<std::optional<
           IdPair<domain::BlockId,
                  tnsr::I<double, VolumeDim, typename ::Frame::Logical>>>>&&
           block_logical_coords) noexcept {
+    node_lock->lock();
     db::mutate<intrp::Tags::InterpolatedVarsHolders<Metavariables>>(
         make_not_null(&box),
         [
@@ -96,6 +103,7 @@ struct ReceivePoints {
 
     try_to_interpolate<InterpolationTargetTag>(
         make_not_null(&box), make_not_null(&cache), temporal_id);
+    node_lock->unlock();
   }
 };
 
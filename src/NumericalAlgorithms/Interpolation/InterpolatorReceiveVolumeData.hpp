@@ -3,16 +3,23 @@
 
 #pragma once
 
+#include <optional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"
 #include "NumericalAlgorithms/Interpolation/Tags.hpp"
 #include "NumericalAlgorithms/Interpolation/TryToInterpolate.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -21,10 +28,17 @@ namespace intrp {
 namespace Actions {
 
 /// \ingroup ActionsGroup
-/// \brief Adds volume data from an `Element`.
+/// \brief Adds volume data from an `Element` and interpolates it onto the
+/// points of all InterpolationTargets that have already sent their points.
 ///
-/// Attempts to interpolate if it already has received target points from
-/// any InterpolationTargets.
+/// This is a threaded action on the `Interpolator` nodegroup. It is invoked
+/// directly on the local branch, so the interpolation for an `Element` runs
+/// on the core that the `Element` lives on, and the interpolations for
+/// different `Element`s on the same node run concurrently. The node lock is
+/// held only while the DataBox is accessed, i.e. while storing the volume data,
+/// while claiming the `Element` for an InterpolationTarget, and while storing
+/// the result. Once all `Element`s on the node are done, the combined result
+/// of the node is sent to the InterpolationTarget.
 ///
 /// Uses:
 /// - DataBox:
@@ -42,41 +56,122 @@ struct InterpolatorReceiveVolumeData {
       typename ArrayIndex, size_t VolumeDim,
       Requires<tmpl::list_contains_v<DbTags, Tags::NumberOfElements>> = nullptr>
   static void apply(
-      db::DataBox<DbTags>& box,
-      Parallel::GlobalCache<Metavariables>& cache,
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> node_lock,
       const typename Metavariables::temporal_id::type& temporal_id,
       const ElementId<VolumeDim>& element_id, const ::Mesh<VolumeDim>& mesh,
       Variables<typename Metavariables::interpolator_source_vars>&&
           vars) noexcept {
+    using VolumeInfo = typename Tags::VolumeVarsInfo<Metavariables>::Info;
+    // The stored volume data is pointer stable (it is held in node-based
+    // maps) and is not erased before all InterpolationTargets have received
+    // their data at this temporal_id, which cannot happen before this
+    // action has finished with it.
+    const VolumeInfo* volume_info = nullptr;
+    node_lock->lock();
     db::mutate<Tags::VolumeVarsInfo<Metavariables>>(
         make_not_null(&box),
-        [&temporal_id, &element_id, &mesh, &
-         vars ](const gsl::not_null<
+        [&temporal_id, &element_id, &mesh, &vars, &volume_info](
+            const gsl::not_null<
                 typename Tags::VolumeVarsInfo<Metavariables>::type*>
-                    container) noexcept {
-          if (container->find(temporal_id) == container->end()) {
-            container->emplace(
-                temporal_id,
-                std::unordered_map<
-                    ElementId<VolumeDim>,
-                    typename Tags::VolumeVarsInfo<Metavariables>::Info>{});
+                container) noexcept {
+          volume_info =
+              &((*container)[temporal_id]
+                    .emplace(element_id, VolumeInfo{mesh, std::move(vars)})
+                    .first->second);
+        });
+    node_lock->unlock();
+    ASSERT(volume_info != nullptr, "Failed to set volume_info in the mutate");
+
+    // Interpolate onto all InterpolationTargets.
+    tmpl::for_each<typename Metavariables::interpolation_target_tags>(
+        [&box, &cache, &element_id, &node_lock, &temporal_id,
+         &volume_info](auto tag_v) noexcept {
+          using tag = typename decltype(tag_v)::type;
+          interpolate_onto_target<tag>(make_not_null(&box),
+                                       make_not_null(&cache), node_lock,
+                                       temporal_id, element_id, *volume_info);
+        });
+  }
+
+ private:
+  template <typename InterpolationTargetTag, typename DbTags,
+            typename Metavariables, size_t VolumeDim>
+  static void interpolate_onto_target(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const gsl::not_null<Parallel::GlobalCache<Metavariables>*> cache,
+      const gsl::not_null<Parallel::NodeLock*> node_lock,
+      const typename Metavariables::temporal_id::type& temporal_id,
+      const ElementId<VolumeDim>& element_id,
+      const typename Tags::VolumeVarsInfo<Metavariables>::Info&
+          volume_info) noexcept {
+    using InterpInfo = Vars::Info<
+        VolumeDim,
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>;
+    // Claim this element for the InterpolationTarget, if the target points
+    // have already been received and no other thread has interpolated the
+    // element yet. The claimed `InterpInfo` is pointer stable and is not
+    // erased while `number_of_interpolations_in_progress` is nonzero.
+    InterpInfo* interp_info = nullptr;
+    node_lock->lock();
+    db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
+        box, [&element_id, &interp_info, &temporal_id](
+                 const gsl::not_null<typename Tags::InterpolatedVarsHolders<
+                     Metavariables>::type*>
+                     holders) noexcept {
+          auto& infos =
+              get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+                  *holders)
+                  .infos;
+          const auto info_it = infos.find(temporal_id);
+          if (info_it == infos.end() or
+              not info_it->second.interpolation_is_done_for_these_elements
+                      .insert(element_id)
+                      .second) {
+            return;
           }
-          container->at(temporal_id)
-              .emplace(std::make_pair(
-                  element_id,
-                  typename Tags::VolumeVarsInfo<Metavariables>::Info{
-                      mesh, std::move(vars)}));
+          interp_info = &info_it->second;
+          ++interp_info->number_of_interpolations_in_progress;
         });
+    node_lock->unlock();
+    if (interp_info == nullptr) {
+      return;
+    }
+
+    // Interpolate without holding the lock. The target points are not
+    // modified after they have been received.
+    const auto element_coord_holders = element_logical_coordinates(
+        std::vector<ElementId<VolumeDim>>{element_id},
+        interp_info->block_coord_holders);
+    std::optional<std::pair<
+        Variables<
+            typename InterpolationTargetTag::vars_to_interpolate_to_target>,
+        std::vector<size_t>>>
+        result{};
+    const auto coord_holder_it = element_coord_holders.find(element_id);
+    if (coord_holder_it != element_coord_holders.end()) {
+      result.emplace(interpolator_detail::interpolate_element<
+                         InterpolationTargetTag, Metavariables>(
+                         volume_info, coord_holder_it->second),
+                     coord_holder_it->second.offsets);
+    }
 
-    // Try to interpolate data for all InterpolationTargets.
-    tmpl::for_each<typename Metavariables::interpolation_target_tags>([
-      &box, &cache, &temporal_id
-    ](auto tag_v) noexcept {
-      using tag = typename decltype(tag_v)::type;
-      try_to_interpolate<tag>(make_not_null(&box), make_not_null(&cache),
-                              temporal_id);
-    });
+    node_lock->lock();
+    db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
+        box, [&interp_info, &result](
+                 const gsl::not_null<typename Tags::InterpolatedVarsHolders<
+                     Metavariables>::type*> /*holders*/) noexcept {
+          if (result.has_value()) {
+            interp_info->vars.emplace_back(std::move(result->first));
+            interp_info->global_offsets.emplace_back(
+                std::move(result->second));
+          }
+          --interp_info->number_of_interpolations_in_progress;
+        });
+    interpolator_detail::send_interpolated_data_if_done<InterpolationTargetTag>(
+        box, cache, temporal_id);
+    node_lock->unlock();
   }
 };
 
@@ -7,6 +7,7 @@
 #include "NumericalAlgorithms/Interpolation/Tags.hpp" // IWYU pragma: keep
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -29,7 +30,9 @@ namespace Actions {
 /// \brief Invoked on the `Interpolator` ParallelComponent to register an
 /// element with the `Interpolator`.
 ///
-/// This is called by `RegisterElementWithInterpolator` below.
+/// This is called by `RegisterElementWithInterpolator` below.  It is a
+/// threaded action that holds the node lock, because the elements on
+/// the different cores of a node register concurrently.
 ///
 /// Uses: nothing
 ///
@@ -45,14 +48,18 @@ struct RegisterElement {
       typename ParallelComponent, typename DbTags, typename Metavariables,
       typename ArrayIndex,
       Requires<tmpl::list_contains_v<DbTags, Tags::NumberOfElements>> = nullptr>
-  static void apply(db::DataBox<DbTags>& box,
-                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
-                    const ArrayIndex& /*array_index*/) noexcept {
+  static void apply(
+      db::DataBox<DbTags>& box,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> node_lock) noexcept {
+    node_lock->lock();
     db::mutate<Tags::NumberOfElements>(
         make_not_null(&box),
         [](const gsl::not_null<size_t*> num_elements) noexcept {
           ++(*num_elements);
         });
+    node_lock->unlock();
   }
 };
 
@@ -81,7 +88,7 @@ struct RegisterElementWithInterpolator {
         *Parallel::get_parallel_component<::intrp::Interpolator<Metavariables>>(
              cache)
              .ckLocalBranch();
-    Parallel::simple_action<RegisterElement>(interpolator);
+    Parallel::threaded_action<RegisterElement>(interpolator);
     return {std::move(box)};
   }
 };
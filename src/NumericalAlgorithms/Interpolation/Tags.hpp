@@ -81,6 +81,13 @@ struct InterpolatedVars : db::SimpleTag {
 };
 
 /// Volume variables at all `temporal_id`s for all local `Element`s.
+///
+/// The `Interpolator` is a nodegroup, so its actions for different
+/// `Element`s and InterpolationTargets run concurrently on the cores of a
+/// node.  `VolumeVarsInfo`, `InterpolatedVarsHolders`, and
+/// `NumberOfElements` must therefore only be read or mutated while the
+/// node lock is held, which is why every action of the `Interpolator` that
+/// touches them is a threaded action.
 template <typename Metavariables>
 struct VolumeVarsInfo : db::SimpleTag {
   struct Info {
@@ -109,6 +116,8 @@ using WrappedHolderTag = Vars::HolderTag<InterpolationTargetTag, Metavariables>;
 /// `TaggedTuple` via a `Vars::HolderTag`.  An `Interpolator` uses the
 /// object in `InterpolatedVarsHolders` to iterate over all of the
 /// `InterpolationTarget`s.
+///
+/// Must only be accessed while the node lock is held, see `VolumeVarsInfo`.
 template <typename Metavariables>
 struct InterpolatedVarsHolders : db::SimpleTag {
   using type = tuples::tagged_tuple_from_typelist<db::wrap_tags_in<
@@ -116,7 +125,9 @@ struct InterpolatedVarsHolders : db::SimpleTag {
       typename Metavariables::interpolation_target_tags, Metavariables>>;
 };
 
-/// Number of local `Element`s.
+/// Number of `Element`s on the local node.
+///
+/// Must only be accessed while the node lock is held, see `VolumeVarsInfo`.
 struct NumberOfElements : db::SimpleTag {
   using type = size_t;
 };
@@ -31,7 +31,43 @@ namespace intrp {
 
 namespace interpolator_detail {
 
+// Interpolates the volume data of a single element onto the points of
+// `element_coord_holder` (which lie inside that element).
+template <typename InterpolationTargetTag, typename Metavariables,
+          typename ElementCoordHolder>
+Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+interpolate_element(
+    const typename Tags::VolumeVarsInfo<Metavariables>::Info& volume_info,
+    const ElementCoordHolder& element_coord_holder) noexcept {
+  // Construct local_vars which is some set of variables
+  // derived from volume_info.vars plus an arbitrary set
+  // of compute items in
+  // InterpolationTargetTag::compute_items_on_source.
+  auto new_box = db::create<
+      db::AddSimpleTags<::Tags::Variables<
+          typename Metavariables::interpolator_source_vars>>,
+      db::AddComputeTags<
+          typename InterpolationTargetTag::compute_items_on_source>>(
+      volume_info.vars);
+
+  Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+      local_vars(volume_info.mesh.number_of_grid_points());
+
+  tmpl::for_each<
+      typename InterpolationTargetTag::vars_to_interpolate_to_target>(
+      [&new_box, &local_vars](auto x) noexcept {
+        using tag = typename decltype(x)::type;
+        get<tag>(local_vars) = db::get<tag>(new_box);
+      });
+
+  // Now interpolate.
+  intrp::Irregular<Metavariables::volume_dim> interpolator(
+      volume_info.mesh, element_coord_holder.element_logical_coords);
+  return interpolator.interpolate(local_vars);
+}
+
 // Interpolates data onto a set of points desired by an InterpolationTarget.
+// Must be called with the node lock held.
 template <typename InterpolationTargetTag, typename Metavariables,
           typename DbTags>
 void interpolate_data(
@@ -79,35 +115,10 @@ void interpolate_data(
           for (const auto& element_coord_pair : element_coord_holders) {
             const auto& element_id = element_coord_pair.first;
             const auto& element_coord_holder = element_coord_pair.second;
-            const auto& volume_info = volume_info_outer.second.at(element_id);
-
-            // Construct local_vars which is some set of variables
-            // derived from volume_info.vars plus an arbitrary set
-            // of compute items in
-            // InterpolationTargetTag::compute_items_on_source.
-
-            auto new_box = db::create<
-                db::AddSimpleTags<::Tags::Variables<
-                    typename Metavariables::interpolator_source_vars>>,
-                db::AddComputeTags<
-                    typename InterpolationTargetTag::compute_items_on_source>>(
-                volume_info.vars);
-
-            Variables<
-                typename InterpolationTargetTag::vars_to_interpolate_to_target>
-                local_vars(volume_info.mesh.number_of_grid_points());
-
-            tmpl::for_each<
-                typename InterpolationTargetTag::vars_to_interpolate_to_target>(
-                [&new_box, &local_vars](auto x) noexcept {
-                  using tag = typename decltype(x)::type;
-                  get<tag>(local_vars) = db::get<tag>(new_box);
-                });
-
-            // Now interpolate.
-            intrp::Irregular<Metavariables::volume_dim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
-            interp_info.vars.emplace_back(interpolator.interpolate(local_vars));
+            interp_info.vars.emplace_back(
+                interpolate_element<InterpolationTargetTag, Metavariables>(
+                    volume_info_outer.second.at(element_id),
+                    element_coord_holder));
             interp_info.global_offsets.emplace_back(
                 element_coord_holder.offsets);
           }
@@ -115,10 +126,62 @@ void interpolate_data(
       },
       box);
 }
+
+// Sends the interpolated data to the InterpolationTarget if interpolation has
+// been done on all of the local elements, and clears it from the
+// Interpolator.  Must be called with the node lock held.
+template <typename InterpolationTargetTag, typename Metavariables,
+          typename DbTags>
+void send_interpolated_data_if_done(
+    const gsl::not_null<db::DataBox<DbTags>*> box,
+    const gsl::not_null<Parallel::GlobalCache<Metavariables>*> cache,
+    const typename Metavariables::temporal_id::type& temporal_id) noexcept {
+  const auto& holders =
+      db::get<Tags::InterpolatedVarsHolders<Metavariables>>(*box);
+  const auto& vars_infos =
+      get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(holders)
+          .infos;
+  if (vars_infos.count(temporal_id) == 0) {
+    return;
+  }
+  const auto& info = vars_infos.at(temporal_id);
+
+  // Send interpolated data only if interpolation has been done on all
+  // of the local elements.
+  const auto& num_elements = db::get<Tags::NumberOfElements>(*box);
+  if (info.interpolation_is_done_for_these_elements.size() != num_elements or
+      info.number_of_interpolations_in_progress != 0) {
+    return;
+  }
+  // Send data to InterpolationTarget, but only if the list of points is
+  // non-empty.
+  if (not info.global_offsets.empty()) {
+    auto& receiver_proxy = Parallel::get_parallel_component<
+        InterpolationTarget<Metavariables, InterpolationTargetTag>>(*cache);
+    Parallel::simple_action<
+        Actions::InterpolationTargetReceiveVars<InterpolationTargetTag>>(
+        receiver_proxy, info.vars, info.global_offsets, temporal_id);
+  }
+
+  // Clear interpolated data, since we don't need it anymore.
+  db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
+      box, [&temporal_id](
+               const gsl::not_null<typename Tags::InterpolatedVarsHolders<
+                   Metavariables>::type*>
+                   holders_l) noexcept {
+        get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+            *holders_l)
+            .infos.erase(temporal_id);
+      });
+}
 }  // namespace interpolator_detail
 
 /// Check if we have enough information to interpolate.  If so, do the
 /// interpolation and send data to the InterpolationTarget.
+///
+/// Must be called with the node lock of the `Interpolator` held, since it
+/// reads and mutates `Tags::VolumeVarsInfo` and
+/// `Tags::InterpolatedVarsHolders`.
 template <typename InterpolationTargetTag, typename Metavariables,
           typename DbTags>
 void try_to_interpolate(
@@ -139,34 +202,8 @@ void try_to_interpolate(
 
   interpolator_detail::interpolate_data<InterpolationTargetTag, Metavariables>(
       box, temporal_id);
-
-  // Send interpolated data only if interpolation has been done on all
-  // of the local elements.
-  const auto& num_elements = db::get<Tags::NumberOfElements>(*box);
-  if (vars_infos.at(temporal_id)
-          .interpolation_is_done_for_these_elements.size() == num_elements) {
-    // Send data to InterpolationTarget, but only if the list of points is
-    // non-empty.
-    if (not vars_infos.at(temporal_id).global_offsets.empty()) {
-      const auto& info = vars_infos.at(temporal_id);
-      auto& receiver_proxy = Parallel::get_parallel_component<
-          InterpolationTarget<Metavariables, InterpolationTargetTag>>(*cache);
-      Parallel::simple_action<
-          Actions::InterpolationTargetReceiveVars<InterpolationTargetTag>>(
-          receiver_proxy, info.vars, info.global_offsets, temporal_id);
-    }
-
-    // Clear interpolated data, since we don't need it anymore.
-    db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
-        box, [&temporal_id](
-                 const gsl::not_null<typename Tags::InterpolatedVarsHolders<
-                     Metavariables>::type*>
-                     holders_l) noexcept {
-          get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-              *holders_l)
-              .infos.erase(temporal_id);
-        });
-  }
+  interpolator_detail::send_interpolated_data_if_done<InterpolationTargetTag>(
+      box, cache, temporal_id);
 }
 
 }  // namespace intrp
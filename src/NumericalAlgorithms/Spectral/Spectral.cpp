@@ -544,6 +544,31 @@ Matrix interpolation_matrix(const Mesh<1>& mesh,
       mesh);
 }
 
+Matrix modal_truncation_matrix(const Mesh<1>& source_mesh,
+                               const size_t target_num_points) noexcept {
+  const size_t source_num_points = source_mesh.extents(0);
+  ASSERT(source_mesh.basis(0) != Basis::FiniteDifference,
+         "Modal truncation requires a spectral basis, not "
+             << source_mesh.basis(0));
+  ASSERT(target_num_points <= source_num_points,
+         "Can only truncate to fewer points, but the source mesh has "
+             << source_num_points << " points and the target has "
+             << target_num_points);
+  const Mesh<1> target_mesh{target_num_points, source_mesh.basis(0),
+                            source_mesh.quadrature(0)};
+  const Matrix& modal_to_nodal = modal_to_nodal_matrix(target_mesh);
+  const Matrix& nodal_to_modal = nodal_to_modal_matrix(source_mesh);
+  // Multiply the target `modal_to_nodal_matrix` with the first
+  // `target_num_points` rows of the source `nodal_to_modal_matrix`, i.e. the
+  // rows that compute the modes that are kept.
+  Matrix truncation(target_num_points, source_num_points);
+  dgemm_('N', 'N', target_num_points, source_num_points, target_num_points,
+         1.0, modal_to_nodal.data(), modal_to_nodal.spacing(),
+         nodal_to_modal.data(), nodal_to_modal.spacing(), 0.0,
+         truncation.data(), truncation.spacing());
+  return truncation;
+}
+
 }  // namespace Spectral
 
 /// \cond HIDDEN_SYMBOLS
@@ -551,6 +551,25 @@ const Matrix& linear_filter_matrix(size_t num_points) noexcept;
  */
 const Matrix& linear_filter_matrix(const Mesh<1>& mesh) noexcept;
 
+/*!
+ * \brief %Matrix that projects nodal data on the `source_mesh` to
+ * `target_num_points` collocation points of the same basis and quadrature by
+ * truncating its modal expansion.
+ *
+ * \details The nodal coefficients are transformed to modal coefficients with
+ * `nodal_to_modal_matrix`, all but the lowest `target_num_points` modes are
+ * discarded, and the remaining modes are evaluated on the target collocation
+ * points with `modal_to_nodal_matrix`. This is the \f$L_2\f$ projection onto
+ * the lower-order polynomial space (up to the quadrature rule), so unlike
+ * interpolation to fewer points it does not alias the high modes into the
+ * result. For `target_num_points` equal to the number of points of the
+ * `source_mesh` the result is the identity.
+ *
+ * \warning This can only be called with a spectral basis.
+ */
+Matrix modal_truncation_matrix(const Mesh<1>& source_mesh,
+                               size_t target_num_points) noexcept;
+
 }  // namespace Spectral
 
 /// \cond
@@ -0,0 +1,307 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ReductionActions.hpp"   // IWYU pragma: keep
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "NumericalAlgorithms/LinearOperators/DefiniteIntegral.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Registration.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
+
+/// \cond
+namespace Frame {
+struct Inertial;
+struct Logical;
+}  // namespace Frame
+/// \endcond
+
+namespace dg {
+namespace Events {
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename ErrorNormTensors, typename VolumeIntegralTensors,
+          typename EventRegistrars>
+class ObserveErrorNormsAndVolumeIntegrals;
+
+namespace Registrars {
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename ErrorNormTensors, typename VolumeIntegralTensors>
+// Presence of size_t template argument requires to define this struct
+// instead of using Registration::Registrar alias.
+struct ObserveErrorNormsAndVolumeIntegrals {
+  template <typename RegistrarList>
+  using f = Events::ObserveErrorNormsAndVolumeIntegrals<
+      VolumeDim, ObservationValueTag, ErrorNormTensors, VolumeIntegralTensors,
+      RegistrarList>;
+};
+}  // namespace Registrars
+
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename ErrorNormTensors, typename VolumeIntegralTensors,
+          typename EventRegistrars =
+              tmpl::list<Registrars::ObserveErrorNormsAndVolumeIntegrals<
+                  VolumeDim, ObservationValueTag, ErrorNormTensors,
+                  VolumeIntegralTensors>>>
+class ObserveErrorNormsAndVolumeIntegrals;
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief %Observe the RMS errors of some tensors compared to their analytic
+ * solution and the volume integrals of other tensors in a single reduction.
+ *
+ * This event combines `dg::Events::ObserveErrorNorms` and
+ * `dg::Events::ObserveVolumeIntegrals`. All quantities are computed in one
+ * pass over the element's data and are packed into a single
+ * `Parallel::ReductionData`, so observing both kinds of quantities at an
+ * observation value costs one global reduction instead of two. This also
+ * sidesteps the restriction that only one reduction observation event may be
+ * triggered at a given observation value.
+ *
+ * Writes reduction quantities:
+ * - `ObservationValueTag`
+ * - `NumberOfPoints` = total number of points in the domain
+ * - `Volume` = volume of the domain
+ * - `Error(*)` = RMS errors in `ErrorNormTensors`, see
+ *   `dg::Events::ObserveErrorNorms`
+ * - `VolumeIntegral(*)` = volume integral of each component of the
+ *   `VolumeIntegralTensors`
+ *
+ * As for `dg::Events::ObserveErrorNorms`, nothing is observed if the analytic
+ * solutions are optional and not available.
+ */
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename... ErrorNormTensors, typename... VolumeIntegralTensors,
+          typename EventRegistrars>
+class ObserveErrorNormsAndVolumeIntegrals<
+    VolumeDim, ObservationValueTag, tmpl::list<ErrorNormTensors...>,
+    tmpl::list<VolumeIntegralTensors...>, EventRegistrars>
+    : public Event<EventRegistrars> {
+ private:
+  template <typename Tag>
+  struct LocalSquareError {
+    using type = double;
+  };
+
+  using L2ErrorDatum = Parallel::ReductionDatum<double, funcl::Plus<>,
+                                                funcl::Sqrt<funcl::Divides<>>,
+                                                std::index_sequence<1>>;
+  using VolumeIntegralDatum =
+      Parallel::ReductionDatum<std::vector<double>, funcl::VectorPlus>;
+  using ReductionData = tmpl::wrap<
+      tmpl::append<
+          tmpl::list<Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+                     Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+                     Parallel::ReductionDatum<double, funcl::Plus<>>>,
+          tmpl::filled_list<L2ErrorDatum, sizeof...(ErrorNormTensors)>,
+          tmpl::list<VolumeIntegralDatum>>,
+      Parallel::ReductionData>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveErrorNormsAndVolumeIntegrals(
+      CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveErrorNormsAndVolumeIntegrals);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe the RMS errors in some tensors compared to their analytic\n"
+      "solution and the volume integrals of other tensors, using a single\n"
+      "reduction.\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      " * ObservationValueTag\n"
+      " * NumberOfPoints = total number of points in the domain\n"
+      " * Volume = volume of the domain\n"
+      " * Error(*) = RMS errors in ErrorNormTensors (see online help details)\n"
+      " * VolumeIntegral(*) = volume integral of the VolumeIntegralTensors\n"
+      "\n"
+      "Prefer this event over separate ObserveErrorNorms and\n"
+      "ObserveVolumeIntegrals events triggered at the same observation value.";
+
+  ObserveErrorNormsAndVolumeIntegrals() = default;
+  explicit ObserveErrorNormsAndVolumeIntegrals(
+      const std::string& subfile_name) noexcept;
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using argument_tags =
+      tmpl::list<ObservationValueTag, domain::Tags::Mesh<VolumeDim>,
+                 domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>,
+                 ErrorNormTensors..., VolumeIntegralTensors...,
+                 ::Tags::AnalyticSolutionsBase>;
+
+  template <typename OptionalAnalyticSolutions, typename Metavariables,
+            typename ArrayIndex, typename ParallelComponent>
+  void operator()(
+      const typename ObservationValueTag::type& observation_value,
+      const Mesh<VolumeDim>& mesh, const Scalar<DataVector>& det_inv_jacobian,
+      const typename ErrorNormTensors::type&... error_norm_tensors,
+      const typename VolumeIntegralTensors::type&... volume_integral_tensors,
+      const OptionalAnalyticSolutions& optional_analytic_solutions,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index,
+      const ParallelComponent* const /*meta*/) const noexcept {
+    if constexpr (tt::is_a_v<std::optional, OptionalAnalyticSolutions>) {
+      if (not optional_analytic_solutions.has_value()) {
+        return;
+      }
+    }
+    const auto& analytic_solutions =
+        [&optional_analytic_solutions]() noexcept -> decltype(auto) {
+      if constexpr (tt::is_a_v<std::optional, OptionalAnalyticSolutions>) {
+        return *optional_analytic_solutions;
+      } else {
+        return optional_analytic_solutions;
+      }
+    }();
+    const size_t num_points = mesh.number_of_grid_points();
+
+    // Accumulate the square errors point by point so no temporary holding
+    // the pointwise errors is needed.
+    tuples::TaggedTuple<LocalSquareError<ErrorNormTensors>...>
+        local_square_errors;
+    const auto record_errors = [&local_square_errors, &analytic_solutions,
+                                &num_points](const auto tensor_tag_v,
+                                             const auto& tensor) noexcept {
+      using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
+      const auto& analytic_tensor =
+          get<::Tags::Analytic<tensor_tag>>(analytic_solutions);
+      double local_square_error = 0.0;
+      for (size_t i = 0; i < tensor.size(); ++i) {
+        for (size_t s = 0; s < num_points; ++s) {
+          local_square_error += square(tensor[i][s] - analytic_tensor[i][s]);
+        }
+      }
+      get<LocalSquareError<tensor_tag>>(local_square_errors) =
+          local_square_error;
+      return 0;
+    };
+    expand_pack(
+        record_errors(tmpl::type_<ErrorNormTensors>{}, error_norm_tensors)...);
+
+    // Determinant of Jacobian is needed because integral is performed in
+    // logical coords.
+    const DataVector det_jacobian = 1.0 / get(det_inv_jacobian);
+    const double local_volume = definite_integral(det_jacobian, mesh);
+
+    std::vector<std::string> reduction_names = {
+        db::tag_name<ObservationValueTag>(), "NumberOfPoints", "Volume",
+        ("Error(" + db::tag_name<ErrorNormTensors>() + ")")...};
+    std::vector<double> local_volume_integrals{};
+    local_volume_integrals.reserve(
+        (0 + ... + VolumeIntegralTensors::type::size()));
+    DataVector integrand(num_points);
+    const auto record_integrals =
+        [&local_volume_integrals, &reduction_names, &det_jacobian, &integrand,
+         &mesh](const auto tensor_tag_v, const auto& tensor) noexcept {
+          using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
+          for (size_t i = 0; i < tensor.size(); ++i) {
+            reduction_names.push_back("VolumeIntegral(" +
+                                      db::tag_name<tensor_tag>() +
+                                      tensor.component_suffix(i) + ")");
+            integrand = det_jacobian * tensor[i];
+            local_volume_integrals.push_back(
+                definite_integral(integrand, mesh));
+          }
+          return 0;
+        };
+    EXPAND_PACK_LEFT_TO_RIGHT(record_integrals(
+        tmpl::type_<VolumeIntegralTensors>{}, volume_integral_tensors));
+
+    // Send data to reduction observer
+    auto& local_observer =
+        *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+             cache)
+             .ckLocalBranch();
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(observation_value, subfile_path_ + ".dat"),
+        observers::ArrayComponentId{
+            std::add_pointer_t<ParallelComponent>{nullptr},
+            Parallel::ArrayIndex<ArrayIndex>(array_index)},
+        subfile_path_, reduction_names,
+        ReductionData{static_cast<double>(observation_value), num_points,
+                      local_volume,
+                      std::move(get<LocalSquareError<ErrorNormTensors>>(
+                          local_square_errors))...,
+                      std::move(local_volume_integrals)});
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const noexcept {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event<EventRegistrars>::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename... ErrorNormTensors, typename... VolumeIntegralTensors,
+          typename EventRegistrars>
+ObserveErrorNormsAndVolumeIntegrals<VolumeDim, ObservationValueTag,
+                                    tmpl::list<ErrorNormTensors...>,
+                                    tmpl::list<VolumeIntegralTensors...>,
+                                    EventRegistrars>::
+    ObserveErrorNormsAndVolumeIntegrals(
+        const std::string& subfile_name) noexcept
+    : subfile_path_("/" + subfile_name) {}
+
+/// \cond
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename... ErrorNormTensors, typename... VolumeIntegralTensors,
+          typename EventRegistrars>
+PUP::able::PUP_ID ObserveErrorNormsAndVolumeIntegrals<
+    VolumeDim, ObservationValueTag, tmpl::list<ErrorNormTensors...>,
+    tmpl::list<VolumeIntegralTensors...>, EventRegistrars>::my_PUP_ID =
+    0;  // NOLINT
+/// \endcond
+}  // namespace Events
+}  // namespace dg
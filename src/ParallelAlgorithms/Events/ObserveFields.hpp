@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
@@ -14,9 +16,11 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
@@ -25,6 +29,8 @@
 #include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
 #include "IO/Observer/VolumeActions.hpp"      // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -35,6 +41,7 @@
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
@@ -44,8 +51,6 @@
 #include "Utilities/TypeTraits/IsA.hpp"
 
 /// \cond
-template <size_t Dim>
-class Mesh;
 namespace Frame {
 struct Inertial;
 }  // namespace Frame
@@ -56,6 +61,37 @@ struct Time;
 
 namespace dg {
 namespace Events {
+namespace ObserveFields_detail {
+/// The mesh with at most `number_of_modes` points in each dimension with a
+/// spectral basis, and the matrices that project data onto it by truncating
+/// the modal expansion. Dimensions that are not truncated have an empty
+/// matrix, which `apply_matrices` treats as the identity.
+template <size_t Dim>
+std::pair<Mesh<Dim>, std::array<Matrix, Dim>> modal_truncation(
+    const Mesh<Dim>& mesh, const size_t number_of_modes) noexcept {
+  std::array<size_t, Dim> extents = mesh.extents().indices();
+  std::array<Matrix, Dim> matrices{};
+  for (size_t d = 0; d < Dim; ++d) {
+    if (gsl::at(mesh.basis(), d) == Spectral::Basis::FiniteDifference) {
+      continue;
+    }
+    // Gauss-Lobatto meshes need at least the two boundary points
+    const size_t truncated_extent = std::max(
+        number_of_modes,
+        gsl::at(mesh.quadrature(), d) == Spectral::Quadrature::GaussLobatto
+            ? 2_st
+            : 1_st);
+    if (truncated_extent < gsl::at(extents, d)) {
+      gsl::at(matrices, d) = Spectral::modal_truncation_matrix(
+          mesh.slice_through(d), truncated_extent);
+      gsl::at(extents, d) = truncated_extent;
+    }
+  }
+  return {Mesh<Dim>{extents, mesh.basis(), mesh.quadrature()},
+          std::move(matrices)};
+}
+}  // namespace ObserveFields_detail
+
 template <size_t VolumeDim, typename ObservationValueTag, typename Tensors,
           typename AnalyticSolutionTensors, typename EventRegistrars,
           typename NonSolutionTensors =
@@ -93,6 +129,17 @@ class ObserveFields;  // IWYU pragma: keep
  *
  * The user may specify an `interpolation_mesh` to which the
  * data is interpolated.
+ *
+ * Alternatively, the user may specify a number of modes to which the data is
+ * truncated for a reduced-resolution output, e.g. for monitoring. In every
+ * dimension with a spectral basis the data is transformed to its modal
+ * representation, all but the lowest modes are discarded, and the remaining
+ * modes are evaluated on the collocation points of a mesh with that many
+ * points and the same basis and quadrature (see
+ * `Spectral::modal_truncation_matrix`). The reduced mesh is written to the
+ * volume file, so the output can be read and visualized like any other volume
+ * data. Dimensions with a finite-difference basis or with no more points than
+ * requested are written at their full resolution.
  */
 template <size_t VolumeDim, typename ObservationValueTag, typename... Tensors,
           typename... AnalyticSolutionTensors, typename EventRegistrars,
@@ -143,8 +190,18 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         "on a new mesh.";
   };
 
-  using options =
-      tmpl::list<SubfileName, VariablesToObserve, InterpolateToMesh>;
+  struct TruncateToNumberOfModes {
+    using type = Options::Auto<size_t, Options::AutoLabel::None>;
+    static constexpr Options::String help =
+        "An optional number of modes to which the variables are truncated in "
+        "each dimension with a spectral basis. The observed quantities are "
+        "projected to this lower polynomial order and written on a mesh with "
+        "this many points, reducing the size of the output. Cannot be combined "
+        "with InterpolateToMesh.";
+  };
+
+  using options = tmpl::list<SubfileName, VariablesToObserve,
+                             InterpolateToMesh, TruncateToNumberOfModes>;
   static constexpr Options::String help =
       "Observe volume tensor fields.\n"
       "\n"
@@ -163,12 +220,22 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
   explicit ObserveFields(const std::string& subfile_name,
                          const std::vector<std::string>& variables_to_observe,
                          std::optional<Mesh<VolumeDim>> interpolation_mesh = {},
+                         std::optional<size_t> number_of_modes = {},
                          const Options::Context& context = {})
       : subfile_path_("/" + subfile_name),
         variables_to_observe_(variables_to_observe.begin(),
                               variables_to_observe.end()),
-        interpolation_mesh_(interpolation_mesh) {
+        interpolation_mesh_(interpolation_mesh),
+        number_of_modes_(number_of_modes) {
     using ::operator<<;
+    if (interpolation_mesh_.has_value() and number_of_modes_.has_value()) {
+      PARSE_ERROR(context,
+                  "Specify either InterpolateToMesh or "
+                  "TruncateToNumberOfModes, not both.");
+    }
+    if (number_of_modes_ == std::optional<size_t>{0}) {
+      PARSE_ERROR(context, "Cannot truncate to zero modes.");
+    }
     const std::unordered_set<std::string> valid_tensors{
         db::tag_name<Tensors>()...};
     for (const auto& name : variables_to_observe_) {
@@ -206,7 +273,8 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       const ElementId<VolumeDim>& array_index,
       const ParallelComponent* const component) const noexcept {
     call_operator_impl(subfile_path_, variables_to_observe_,
-                       interpolation_mesh_, observation_value, mesh,
+                       interpolation_mesh_, number_of_modes_,
+                       observation_value, mesh,
                        inertial_coordinates, analytic_solution_tensors...,
                        non_solution_tensors..., optional_analytic_solutions,
                        cache, array_index, component);
@@ -239,6 +307,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       const std::string& subfile_path,
       const std::unordered_set<std::string>& variables_to_observe,
       const std::optional<Mesh<VolumeDim>>& interpolation_mesh,
+      const std::optional<size_t>& number_of_modes,
       const typename ObservationValueTag::type& observation_value,
       const Mesh<VolumeDim>& mesh,
       const tnsr::I<DataVector, VolumeDim, Frame::Inertial>&
@@ -267,6 +336,21 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     // ignored by the RegularGridInterpolant except for a single copy.
     const intrp::RegularGrid interpolant(mesh,
                                          interpolation_mesh.value_or(mesh));
+    // If no number_of_modes is provided, the output mesh is the interpolation
+    // mesh (or the mesh itself) and no truncation matrices are needed.
+    const auto truncation =
+        number_of_modes.has_value()
+            ? ObserveFields_detail::modal_truncation(mesh, *number_of_modes)
+            : std::make_pair(interpolation_mesh.value_or(mesh),
+                             std::array<Matrix, VolumeDim>{});
+    const Mesh<VolumeDim>& output_mesh = truncation.first;
+    const auto to_output_mesh = [&interpolant, &mesh, &number_of_modes,
+                                 &truncation](
+                                    const DataVector& data) noexcept {
+      return number_of_modes.has_value()
+                 ? apply_matrices(truncation.second, data, mesh.extents())
+                 : interpolant.interpolate(data);
+    };
 
     // Remove tensor types, only storing individual components.
     std::vector<TensorComponent> components;
@@ -282,7 +366,8 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         0_st));
 
     const auto record_tensor_components = [&components, &element_name,
-                                           &interpolant, &variables_to_observe](
+                                           &to_output_mesh,
+                                           &variables_to_observe](
                                               const auto tensor_tag_v,
                                               const auto& tensor) noexcept {
       using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
@@ -290,7 +375,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         for (size_t i = 0; i < tensor.size(); ++i) {
           components.emplace_back(element_name + db::tag_name<tensor_tag>() +
                                       tensor.component_suffix(i),
-                                  interpolant.interpolate(tensor[i]));
+                                  to_output_mesh(tensor[i]));
         }
       }
     };
@@ -303,7 +388,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
 
     if (analytic_solutions.has_value()) {
       const auto record_errors = [&components, &element_name,
-                                  &analytic_solutions, &interpolant,
+                                  &analytic_solutions, &to_output_mesh,
                                   &variables_to_observe](
                                      const auto tensor_tag_v,
                                      const auto& tensor) noexcept {
@@ -315,7 +400,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
             components.emplace_back(element_name + "Error(" +
                                         db::tag_name<tensor_tag>() + ")" +
                                         tensor.component_suffix(i),
-                                    interpolant.interpolate(error));
+                                    to_output_mesh(error));
           }
         }
       };
@@ -337,9 +422,8 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         observers::ArrayComponentId(
             std::add_pointer_t<ParallelComponent>{nullptr},
             Parallel::ArrayIndex<ElementId<VolumeDim>>(array_index)),
-        std::move(components), interpolation_mesh.value_or(mesh).extents(),
-        interpolation_mesh.value_or(mesh).basis(),
-        interpolation_mesh.value_or(mesh).quadrature());
+        std::move(components), output_mesh.extents(), output_mesh.basis(),
+        output_mesh.quadrature());
   }
 
   using observation_registration_tags = tmpl::list<>;
@@ -355,12 +439,14 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     p | subfile_path_;
     p | variables_to_observe_;
     p | interpolation_mesh_;
+    p | number_of_modes_;
   }
 
  private:
   std::string subfile_path_;
   std::unordered_set<std::string> variables_to_observe_{};
   std::optional<Mesh<VolumeDim>> interpolation_mesh_{};
+  std::optional<size_t> number_of_modes_{};
 };
 
 /// \cond
@@ -7,11 +7,13 @@
 #include <limits>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
 #include "IO/Observer/Actions/RegisterWithObservers.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Helpers.hpp"
@@ -45,7 +47,7 @@ class TaggedTuple;
 }  // namespace tuples
 namespace LinearSolver::async_solvers {
 template <typename FieldsTag, typename OptionsGroup, typename SourceTag,
-          typename Label>
+          typename Label, typename ArraySectionIdTag = void>
 struct CompleteStep;
 }  // namespace LinearSolver::async_solvers
 /// \endcond
@@ -60,24 +62,47 @@ using reduction_data = Parallel::ReductionData<
     // Residual
     Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Sqrt<>>>;
 
+/*!
+ * \brief Identifies the section of the array that the element belongs to in
+ * observation keys and subfile names
+ *
+ * Elements that have the same value of the `ArraySectionIdTag` contribute to
+ * the same observations, e.g. all elements on one grid of a multigrid
+ * hierarchy. Returns an empty string if the `ArraySectionIdTag` is `void`, so
+ * all elements contribute to the same observations.
+ */
+template <typename ArraySectionIdTag, typename DbTagsList>
+std::string section_observation_key(
+    const db::DataBox<DbTagsList>& box) noexcept {
+  if constexpr (std::is_same_v<ArraySectionIdTag, void>) {
+    (void)box;
+    return "";
+  } else {
+    return db::tag_name<ArraySectionIdTag>() +
+           get_output(db::get<ArraySectionIdTag>(box));
+  }
+}
+
 template <typename OptionsGroup, typename ParallelComponent,
           typename Metavariables, typename ArrayIndex>
 void contribute_to_residual_observation(
     const size_t iteration_id, const double residual_magnitude_square,
-    Parallel::GlobalCache<Metavariables>& cache,
-    const ArrayIndex& array_index) noexcept {
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const std::string& section_observation_key = "") noexcept {
   auto& local_observer =
       *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
            cache)
            .ckLocalBranch();
   Parallel::simple_action<observers::Actions::ContributeReductionData>(
       local_observer,
-      observers::ObservationId(iteration_id,
-                               pretty_type::get_name<OptionsGroup>()),
+      observers::ObservationId(
+          iteration_id,
+          pretty_type::get_name<OptionsGroup>() + section_observation_key),
       observers::ArrayComponentId{
           std::add_pointer_t<ParallelComponent>{nullptr},
           Parallel::ArrayIndex<ArrayIndex>(array_index)},
-      std::string{"/" + Options::name<OptionsGroup>() + "Residuals"},
+      std::string{"/" + Options::name<OptionsGroup>() +
+                  section_observation_key + "Residuals"},
       std::vector<std::string>{"Iteration", "Residual"},
       reduction_data{iteration_id, residual_magnitude_square});
   if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
@@ -139,24 +164,27 @@ struct InitializeElement {
   }
 };
 
-template <typename OptionsGroup>
+template <typename OptionsGroup, typename ArraySectionIdTag = void>
 struct RegisterObservers {
   template <typename ParallelComponent, typename DbTagsList,
             typename ArrayIndex>
   static std::pair<observers::TypeOfObservation, observers::ObservationKey>
-  register_info(const db::DataBox<DbTagsList>& /*box*/,
+  register_info(const db::DataBox<DbTagsList>& box,
                 const ArrayIndex& /*array_index*/) noexcept {
     return {observers::TypeOfObservation::Reduction,
-            observers::ObservationKey{pretty_type::get_name<OptionsGroup>()}};
+            observers::ObservationKey{
+                pretty_type::get_name<OptionsGroup>() +
+                section_observation_key<ArraySectionIdTag>(box)}};
   }
 };
 
-template <typename FieldsTag, typename OptionsGroup, typename SourceTag>
-using RegisterElement =
-    observers::Actions::RegisterWithObservers<RegisterObservers<OptionsGroup>>;
+template <typename FieldsTag, typename OptionsGroup, typename SourceTag,
+          typename ArraySectionIdTag = void>
+using RegisterElement = observers::Actions::RegisterWithObservers<
+    RegisterObservers<OptionsGroup, ArraySectionIdTag>>;
 
 template <typename FieldsTag, typename OptionsGroup, typename SourceTag,
-          typename Label>
+          typename Label, typename ArraySectionIdTag = void>
 struct PrepareSolve {
  private:
   using fields_tag = FieldsTag;
@@ -194,12 +222,14 @@ struct PrepareSolve {
     const auto& residual = get<residual_tag>(box);
     const double residual_magnitude_square = inner_product(residual, residual);
     contribute_to_residual_observation<OptionsGroup, ParallelComponent>(
-        iteration_id, residual_magnitude_square, cache, array_index);
+        iteration_id, residual_magnitude_square, cache, array_index,
+        section_observation_key<ArraySectionIdTag>(box));
 
     // Skip steps entirely if the solve has already converged
     constexpr size_t step_end_index =
-        tmpl::index_of<ActionList, CompleteStep<FieldsTag, OptionsGroup,
-                                                SourceTag, Label>>::value;
+        tmpl::index_of<ActionList,
+                       CompleteStep<FieldsTag, OptionsGroup, SourceTag, Label,
+                                    ArraySectionIdTag>>::value;
     constexpr size_t this_action_index =
         tmpl::index_of<ActionList, PrepareSolve>::value;
     return {std::move(box), false,
@@ -210,7 +240,7 @@ struct PrepareSolve {
 };
 
 template <typename FieldsTag, typename OptionsGroup, typename SourceTag,
-          typename Label>
+          typename Label, typename ArraySectionIdTag>
 struct CompleteStep {
  private:
   using fields_tag = FieldsTag;
@@ -249,12 +279,14 @@ struct CompleteStep {
     const auto& residual = get<residual_tag>(box);
     const double residual_magnitude_square = inner_product(residual, residual);
     contribute_to_residual_observation<OptionsGroup, ParallelComponent>(
-        completed_iterations, residual_magnitude_square, cache, array_index);
+        completed_iterations, residual_magnitude_square, cache, array_index,
+        section_observation_key<ArraySectionIdTag>(box));
 
     // Repeat steps until the solve has converged
     constexpr size_t step_begin_index =
-        tmpl::index_of<ActionList, PrepareSolve<FieldsTag, OptionsGroup,
-                                                SourceTag, Label>>::value +
+        tmpl::index_of<ActionList,
+                       PrepareSolve<FieldsTag, OptionsGroup, SourceTag, Label,
+                                    ArraySectionIdTag>>::value +
         1;
     constexpr size_t this_action_index =
         tmpl::index_of<ActionList, CompleteStep>::value;
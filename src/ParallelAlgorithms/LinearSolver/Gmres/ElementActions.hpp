@@ -34,15 +34,30 @@ namespace LinearSolver::gmres::detail {
 template <typename Metavariables, typename FieldsTag, typename OptionsGroup>
 struct ResidualMonitor;
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label>
+          typename Label, typename ArraySectionIdTag>
 struct NormalizeOperandAndUpdateField;
 }  // namespace LinearSolver::gmres::detail
 /// \endcond
 
 namespace LinearSolver::gmres::detail {
 
+// Whether or not the element is part of the array section that the solver
+// operates on. Elements outside the section still run all actions, so they
+// take part in the reductions over the full array, but they contribute zero
+// and skip updating their operand and fields. Therefore, the reductions
+// effectively run over the section only.
+template <typename ArraySectionIdTag, typename DbTagsList>
+bool is_in_section(const db::DataBox<DbTagsList>& box) noexcept {
+  if constexpr (std::is_same_v<ArraySectionIdTag, void>) {
+    (void)box;
+    return true;
+  } else {
+    return db::get<ArraySectionIdTag>(box);
+  }
+}
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label, typename SourceTag>
+          typename Label, typename SourceTag, typename ArraySectionIdTag>
 struct PrepareSolve {
  private:
   using fields_tag = FieldsTag;
@@ -65,15 +80,21 @@ struct PrepareSolve {
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) noexcept {
+    const bool in_section = is_in_section<ArraySectionIdTag>(box);
     db::mutate<Convergence::Tags::IterationId<OptionsGroup>, operand_tag,
                initial_fields_tag, basis_history_tag>(
         make_not_null(&box),
-        [](const gsl::not_null<size_t*> iteration_id, const auto operand,
+        [in_section](const gsl::not_null<size_t*> iteration_id,
+                     const auto operand,
            const auto initial_fields, const auto basis_history,
            const auto& source, const auto& operator_applied_to_fields,
            const auto& fields) noexcept {
           *iteration_id = 0;
-          *operand = source - operator_applied_to_fields;
+          if (in_section) {
+            *operand = source - operator_applied_to_fields;
+          } else {
+            *operand = make_with_value<typename operand_tag::type>(source, 0.);
+          }
           *initial_fields = fields;
           *basis_history = typename basis_history_tag::type{};
         },
@@ -84,7 +105,9 @@ struct PrepareSolve {
         FieldsTag, OptionsGroup, ParallelComponent>>(
         Parallel::ReductionData<
             Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Sqrt<>>>{
-            inner_product(get<operand_tag>(box), get<operand_tag>(box))},
+            in_section
+                ? inner_product(get<operand_tag>(box), get<operand_tag>(box))
+                : 0.},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
@@ -108,7 +131,7 @@ struct PrepareSolve {
 };
 
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label>
+          typename Label, typename ArraySectionIdTag>
 struct NormalizeInitialOperand {
  private:
   using fields_tag = FieldsTag;
@@ -146,22 +169,27 @@ struct NormalizeInitialOperand {
             .mapped());
     const double residual_magnitude = get<0>(received_data);
     auto& has_converged = get<1>(received_data);
+    const bool in_section = is_in_section<ArraySectionIdTag>(box);
 
     db::mutate<operand_tag, basis_history_tag,
                Convergence::Tags::HasConverged<OptionsGroup>>(
-        make_not_null(&box), [residual_magnitude, &has_converged](
-                                 const auto operand, const auto basis_history,
-                                 const gsl::not_null<Convergence::HasConverged*>
-                                     local_has_converged) noexcept {
-          *operand /= residual_magnitude;
-          basis_history->push_back(*operand);
+        make_not_null(&box),
+        [residual_magnitude, &has_converged, in_section](
+            const auto operand, const auto basis_history,
+            const gsl::not_null<Convergence::HasConverged*>
+                local_has_converged) noexcept {
+          if (in_section) {
+            *operand /= residual_magnitude;
+            basis_history->push_back(*operand);
+          }
           *local_has_converged = std::move(has_converged);
         });
 
     // Skip steps entirely if the solve has already converged
-    constexpr size_t step_end_index = tmpl::index_of<
-        ActionList, NormalizeOperandAndUpdateField<
-                        FieldsTag, OptionsGroup, Preconditioned, Label>>::value;
+    constexpr size_t step_end_index =
+        tmpl::index_of<ActionList, NormalizeOperandAndUpdateField<
+                                       FieldsTag, OptionsGroup, Preconditioned,
+                                       Label, ArraySectionIdTag>>::value;
     constexpr size_t this_action_index =
         tmpl::index_of<ActionList, NormalizeInitialOperand>::value;
     return {std::move(box), false,
@@ -210,7 +238,7 @@ struct PrepareStep {
 };
 
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label>
+          typename Label, typename ArraySectionIdTag>
 struct PerformStep {
  private:
   using fields_tag = FieldsTag;
@@ -238,26 +266,32 @@ struct PerformStep {
             Convergence::Tags::IterationId<OptionsGroup>>;
     using basis_history_tag =
         LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+    const bool in_section = is_in_section<ArraySectionIdTag>(box);
 
     if constexpr (Preconditioned) {
       using preconditioned_basis_history_tag =
           LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
 
-      db::mutate<preconditioned_basis_history_tag>(
-          make_not_null(&box),
-          [](const auto preconditioned_basis_history,
-             const auto& preconditioned_operand) noexcept {
-            preconditioned_basis_history->push_back(preconditioned_operand);
-          },
-          get<preconditioned_operand_tag>(box));
+      if (in_section) {
+        db::mutate<preconditioned_basis_history_tag>(
+            make_not_null(&box),
+            [](const auto preconditioned_basis_history,
+               const auto& preconditioned_operand) noexcept {
+              preconditioned_basis_history->push_back(preconditioned_operand);
+            },
+            get<preconditioned_operand_tag>(box));
+      }
     }
 
     db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
         make_not_null(&box),
-        [](const auto operand,
-           const gsl::not_null<size_t*> orthogonalization_iteration_id,
-           const auto& operator_action) noexcept {
-          *operand = typename operand_tag::type(operator_action);
+        [in_section](
+            const auto operand,
+            const gsl::not_null<size_t*> orthogonalization_iteration_id,
+            const auto& operator_action) noexcept {
+          if (in_section) {
+            *operand = typename operand_tag::type(operator_action);
+          }
           *orthogonalization_iteration_id = 0;
         },
         get<operator_tag>(box));
@@ -270,8 +304,9 @@ struct PerformStep {
             Parallel::ReductionDatum<double, funcl::Plus<>>>{
             get<Convergence::Tags::IterationId<OptionsGroup>>(box),
             get<orthogonalization_iteration_id_tag>(box),
-            inner_product(get<basis_history_tag>(box)[0],
-                          get<operand_tag>(box))},
+            in_section ? inner_product(get<basis_history_tag>(box)[0],
+                                       get<operand_tag>(box))
+                       : 0.},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
@@ -281,7 +316,7 @@ struct PerformStep {
 };
 
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label>
+          typename Label, typename ArraySectionIdTag>
 struct OrthogonalizeOperand {
  private:
   using fields_tag = FieldsTag;
@@ -319,15 +354,18 @@ struct OrthogonalizeOperand {
         tuples::get<Tags::Orthogonalization<OptionsGroup>>(inboxes)
             .extract(db::get<Convergence::Tags::IterationId<OptionsGroup>>(box))
             .mapped());
+    const bool in_section = is_in_section<ArraySectionIdTag>(box);
 
     db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
         make_not_null(&box),
-        [orthogonalization](
+        [orthogonalization, in_section](
             const auto operand,
             const gsl::not_null<size_t*> orthogonalization_iteration_id,
             const auto& basis_history) noexcept {
-          *operand -= orthogonalization *
-                      gsl::at(basis_history, *orthogonalization_iteration_id);
+          if (in_section) {
+            *operand -= orthogonalization *
+                        gsl::at(basis_history, *orthogonalization_iteration_id);
+          }
           ++(*orthogonalization_iteration_id);
         },
         get<basis_history_tag>(box));
@@ -339,11 +377,13 @@ struct OrthogonalizeOperand {
     const bool orthogonalization_complete =
         next_orthogonalization_iteration_id == iteration_id + 1;
     const double local_orthogonalization =
-        inner_product(orthogonalization_complete
-                          ? get<operand_tag>(box)
-                          : gsl::at(get<basis_history_tag>(box),
-                                    next_orthogonalization_iteration_id),
-                      get<operand_tag>(box));
+        in_section
+            ? inner_product(orthogonalization_complete
+                                ? get<operand_tag>(box)
+                                : gsl::at(get<basis_history_tag>(box),
+                                          next_orthogonalization_iteration_id),
+                            get<operand_tag>(box))
+            : 0.;
 
     Parallel::contribute_to_reduction<
         StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
@@ -367,7 +407,7 @@ struct OrthogonalizeOperand {
 };
 
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label>
+          typename Label, typename ArraySectionIdTag>
 struct NormalizeOperandAndUpdateField {
  private:
   using fields_tag = FieldsTag;
@@ -413,12 +453,13 @@ struct NormalizeOperandAndUpdateField {
     const double normalization = get<0>(received_data);
     const auto& minres = get<1>(received_data);
     auto& has_converged = get<2>(received_data);
+    const bool in_section = is_in_section<ArraySectionIdTag>(box);
 
     db::mutate<operand_tag, basis_history_tag, fields_tag,
                Convergence::Tags::IterationId<OptionsGroup>,
                Convergence::Tags::HasConverged<OptionsGroup>>(
         make_not_null(&box),
-        [normalization, &minres, &has_converged](
+        [normalization, &minres, &has_converged, in_section](
             const auto operand, const auto basis_history, const auto field,
             const gsl::not_null<size_t*> iteration_id,
             const gsl::not_null<Convergence::HasConverged*> local_has_converged,
@@ -428,13 +469,15 @@ struct NormalizeOperandAndUpdateField {
           // the problem is solved and the algorithm will terminate (see
           // Proposition 9.3 in \cite Saad2003). Since there will be no next
           // iteration we don't need to normalize the operand.
-          if (LIKELY(normalization > 0.)) {
-            *operand /= normalization;
-          }
-          basis_history->push_back(*operand);
-          *field = initial_field;
-          for (size_t i = 0; i < minres.size(); i++) {
-            *field += minres[i] * gsl::at(preconditioned_basis_history, i);
+          if (in_section) {
+            if (LIKELY(normalization > 0.)) {
+              *operand /= normalization;
+            }
+            basis_history->push_back(*operand);
+            *field = initial_field;
+            for (size_t i = 0; i < minres.size(); i++) {
+              *field += minres[i] * gsl::at(preconditioned_basis_history, i);
+            }
           }
           ++(*iteration_id);
           *local_has_converged = std::move(has_converged);
@@ -77,13 +77,22 @@ namespace LinearSolver::gmres {
  * the new orthogonal vector and normalize. Use the residual vector and the set
  * of orthogonal vectors to determine the solution \f$x\f$.
  *
+ * \par Array sections:
+ * To solve on only a section of the array, e.g. the finest grid of a
+ * `LinearSolver::multigrid::Multigrid` preconditioner whose grids share the
+ * array, set the `ArraySectionIdTag` to a boolean tag that is `true` on the
+ * elements of the section. All elements of the array run the actions of the
+ * solver, but elements outside the section contribute zero to the reductions
+ * and don't update their fields, so the reductions run over the section only.
+ *
  * \see ConjugateGradient for a linear solver that is more efficient when the
  * linear operator \f$A\f$ is symmetric.
  */
 template <typename Metavariables, typename FieldsTag, typename OptionsGroup,
           bool Preconditioned,
           typename SourceTag =
-              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>,
+          typename ArraySectionIdTag = void>
 struct Gmres {
   using fields_tag = FieldsTag;
   using options_group = OptionsGroup;
@@ -120,16 +129,17 @@ struct Gmres {
   template <typename ApplyOperatorActions, typename Label = OptionsGroup>
   using solve = tmpl::list<
       detail::PrepareSolve<FieldsTag, OptionsGroup, Preconditioned, Label,
-                           SourceTag>,
+                           SourceTag, ArraySectionIdTag>,
       detail::NormalizeInitialOperand<FieldsTag, OptionsGroup, Preconditioned,
-                                      Label>,
+                                      Label, ArraySectionIdTag>,
       detail::PrepareStep<FieldsTag, OptionsGroup, Preconditioned, Label>,
       ApplyOperatorActions,
-      detail::PerformStep<FieldsTag, OptionsGroup, Preconditioned, Label>,
+      detail::PerformStep<FieldsTag, OptionsGroup, Preconditioned, Label,
+                          ArraySectionIdTag>,
       detail::OrthogonalizeOperand<FieldsTag, OptionsGroup, Preconditioned,
-                                   Label>,
-      detail::NormalizeOperandAndUpdateField<FieldsTag, OptionsGroup,
-                                             Preconditioned, Label>>;
+                                   Label, ArraySectionIdTag>,
+      detail::NormalizeOperandAndUpdateField<
+          FieldsTag, OptionsGroup, Preconditioned, Label, ArraySectionIdTag>>;
 };
 
 }  // namespace LinearSolver::gmres
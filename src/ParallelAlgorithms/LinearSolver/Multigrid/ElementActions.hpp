@@ -0,0 +1,392 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Informer/Tags.hpp"
+#include "Informer/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Printf.hpp"
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/TransferOperators.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace LinearSolver::multigrid::detail {
+
+template <size_t Dim, typename OptionsGroup>
+struct InitializeElement {
+  using initialization_tags =
+      tmpl::list<Tags::ChildrenRefinementLevels<Dim>,
+                 Tags::ParentRefinementLevels<Dim>>;
+  using const_global_cache_tags = tmpl::list<Tags::MaxLevels<OptionsGroup>>;
+  using simple_tags =
+      tmpl::list<Tags::MultigridLevel, Tags::IsFinestGrid, Tags::ParentId<Dim>,
+                 Tags::ChildIds<Dim>>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ElementId<Dim>& element_id,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    const auto& children_refinement_levels =
+        db::get<Tags::ChildrenRefinementLevels<Dim>>(box);
+    const auto& parent_refinement_levels =
+        db::get<Tags::ParentRefinementLevels<Dim>>(box);
+    std::optional<ElementId<Dim>> parent{};
+    if (not parent_refinement_levels.empty()) {
+      parent = multigrid::parent_id(
+          element_id, parent_refinement_levels[element_id.block_id()]);
+    }
+    std::unordered_set<ElementId<Dim>> children{};
+    if (not children_refinement_levels.empty()) {
+      children = multigrid::child_ids(
+          element_id, children_refinement_levels[element_id.block_id()]);
+    }
+    Initialization::mutate_assign<simple_tags>(
+        make_not_null(&box), element_id.grid_index(),
+        element_id.grid_index() == 0, std::move(parent), std::move(children));
+    return std::make_tuple(std::move(box));
+  }
+};
+
+template <size_t Dim, typename ReceiveTags, typename OptionsGroup>
+struct DataFromChildrenInboxTag
+    : public Parallel::InboxInserters::Map<
+          DataFromChildrenInboxTag<Dim, ReceiveTags, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<
+      temporal_id,
+      std::unordered_map<ElementId<Dim>,
+                         std::pair<Mesh<Dim>, Variables<ReceiveTags>>>>;
+};
+
+template <size_t Dim, typename ReceiveTags, typename OptionsGroup>
+struct DataFromParentInboxTag
+    : public Parallel::InboxInserters::Value<
+          DataFromParentInboxTag<Dim, ReceiveTags, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type =
+      std::map<temporal_id, std::pair<Mesh<Dim>, Variables<ReceiveTags>>>;
+};
+
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendCorrectionToFinerGrid;
+
+// Wait for the residuals of all children on the finer grid, restrict them to
+// this element and use them as the source of the coarse-grid correction. Does
+// nothing on the finest grid.
+//
+// The source of the first iteration must be in place before the
+// `async_solvers::PrepareSolve` action observes the initial residual, so the
+// `InitialIteration` instance of this action runs before it and receives the
+// residuals of iteration zero. The other instance runs at the beginning of
+// every iteration and receives the residuals of all later iterations.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          bool ResidualIsMassive, typename SourceTag, bool InitialIteration>
+struct ReceiveResidualFromFinerGrid {
+ private:
+  using fields_tag = FieldsTag;
+  using operator_applied_to_fields_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, fields_tag>;
+  using source_tag = SourceTag;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using residual_inbox_tag =
+      DataFromChildrenInboxTag<Dim, typename residual_tag::tags_list,
+                               OptionsGroup>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+  using inbox_tags = tmpl::list<residual_inbox_tag>;
+
+  template <typename DbTagsList>
+  static size_t iteration_id(const db::DataBox<DbTagsList>& box) noexcept {
+    if constexpr (InitialIteration) {
+      (void)box;
+      return 0;
+    } else {
+      return db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    }
+  }
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables>
+  static bool is_ready(const db::DataBox<DbTagsList>& box,
+                       const tuples::TaggedTuple<InboxTags...>& inboxes,
+                       const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                       const ElementId<Dim>& /*element_id*/) noexcept {
+    const auto& child_ids = db::get<Tags::ChildIds<Dim>>(box);
+    // The residuals of the first iteration were already received before
+    // preparing the solve
+    if (child_ids.empty() or
+        (not InitialIteration and iteration_id(box) == 0)) {
+      return true;
+    }
+    const auto& inbox = tuples::get<residual_inbox_tag>(inboxes);
+    const auto received_residuals = inbox.find(iteration_id(box));
+    return received_residuals != inbox.end() and
+           received_residuals->second.size() == child_ids.size();
+  }
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    // Nothing to receive on the finest grid. The residuals of the first
+    // iteration were already received before preparing the solve.
+    const size_t received_iteration_id = iteration_id(box);
+    if (db::get<Tags::ChildIds<Dim>>(box).empty() or
+        (not InitialIteration and received_iteration_id == 0)) {
+      return {std::move(box)};
+    }
+
+    // Do some logging
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s " + Options::name<OptionsGroup>() +
+                           "(%zu): Receive residual from finer grid\n",
+                       element_id, received_iteration_id);
+    }
+
+    // The coarse grid solves for a correction that is sourced by the restricted
+    // residuals of the finer grid, so start from a zero initial guess
+    auto received_residuals =
+        std::move(tuples::get<residual_inbox_tag>(inboxes)
+                      .extract(received_iteration_id)
+                      .mapped());
+    const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
+    const size_t num_points = mesh.number_of_grid_points();
+    db::mutate<fields_tag, operator_applied_to_fields_tag, source_tag>(
+        make_not_null(&box),
+        [&received_residuals, &mesh, &element_id, &num_points](
+            const auto fields, const auto operator_applied_to_fields,
+            const auto source) noexcept {
+          source->initialize(num_points, 0.);
+          for (const auto& [child_id, child_mesh_and_residual] :
+               received_residuals) {
+            const auto& [child_mesh, child_residual] = child_mesh_and_residual;
+            *source += restrict_to_parent(
+                child_residual, child_mesh, mesh,
+                child_size(child_id.segment_ids(), element_id.segment_ids()),
+                ResidualIsMassive);
+          }
+          fields->initialize(num_points, 0.);
+          operator_applied_to_fields->initialize(num_points, 0.);
+        });
+    return {std::move(box)};
+  }
+};
+
+// Send the residual that remains after pre-smoothing to the parent on the
+// coarser grid. On the coarsest grid there is no coarse-grid correction, so
+// skip ahead to sending the correction back to the finer grid.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendResidualToCoarserGrid {
+ private:
+  using fields_tag = FieldsTag;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using residual_inbox_tag =
+      DataFromChildrenInboxTag<Dim, typename residual_tag::tags_list,
+                               OptionsGroup>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool, size_t> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const auto& parent_id = db::get<Tags::ParentId<Dim>>(box);
+    if (not parent_id.has_value()) {
+      constexpr size_t send_correction_index = tmpl::index_of<
+          ActionList, SendCorrectionToFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                                SourceTag>>::value;
+      return {std::move(box), false, send_correction_index};
+    }
+
+    // Do some logging
+    const auto& iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s " + Options::name<OptionsGroup>() +
+                           "(%zu): Send residual to coarser grid\n",
+                       element_id, iteration_id);
+    }
+
+    // The parent restricts the residual to its mesh when it has received the
+    // data from all its children
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::receive_data<residual_inbox_tag>(
+        receiver_proxy[*parent_id], iteration_id,
+        std::make_pair(element_id,
+                       std::make_pair(db::get<domain::Tags::Mesh<Dim>>(box),
+                                      db::get<residual_tag>(box))));
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, SendResidualToCoarserGrid>::value;
+    return {std::move(box), false, this_action_index + 1};
+  }
+};
+
+// Wait for the correction from the parent on the coarser grid, prolongate it
+// to this element and add it to the fields
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct ReceiveCorrectionFromCoarserGrid {
+ private:
+  using fields_tag = FieldsTag;
+  using correction_inbox_tag =
+      DataFromParentInboxTag<Dim, typename fields_tag::tags_list,
+                             OptionsGroup>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+  using inbox_tags = tmpl::list<correction_inbox_tag>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables>
+  static bool is_ready(const db::DataBox<DbTagsList>& box,
+                       const tuples::TaggedTuple<InboxTags...>& inboxes,
+                       const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                       const ElementId<Dim>& /*element_id*/) noexcept {
+    if (not db::get<Tags::ParentId<Dim>>(box).has_value()) {
+      return true;
+    }
+    const auto& inbox = tuples::get<correction_inbox_tag>(inboxes);
+    return inbox.find(db::get<Convergence::Tags::IterationId<OptionsGroup>>(
+               box)) != inbox.end();
+  }
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const auto& parent_id = db::get<Tags::ParentId<Dim>>(box);
+    // Nothing to receive on the coarsest grid
+    if (not parent_id.has_value()) {
+      return {std::move(box)};
+    }
+
+    // Do some logging
+    const auto& iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s " + Options::name<OptionsGroup>() +
+                           "(%zu): Receive correction from coarser grid\n",
+                       element_id, iteration_id);
+    }
+
+    auto parent_mesh_and_correction =
+        std::move(tuples::get<correction_inbox_tag>(inboxes)
+                      .extract(iteration_id)
+                      .mapped());
+    const auto& [parent_mesh, parent_correction] = parent_mesh_and_correction;
+    const auto child_sizes =
+        child_size(element_id.segment_ids(), parent_id->segment_ids());
+    db::mutate<fields_tag>(
+        make_not_null(&box),
+        [&parent_mesh, &parent_correction, &child_sizes](
+            const auto fields, const Mesh<Dim>& mesh) noexcept {
+          *fields += prolongate(parent_correction, parent_mesh, mesh,
+                                child_sizes);
+        },
+        db::get<domain::Tags::Mesh<Dim>>(box));
+    return {std::move(box)};
+  }
+};
+
+// Send the fields, which are the correction on all grids but the finest, to
+// the children on the finer grid. Does nothing on the finest grid.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag>
+struct SendCorrectionToFinerGrid {
+ private:
+  using fields_tag = FieldsTag;
+  using correction_inbox_tag =
+      DataFromParentInboxTag<Dim, typename fields_tag::tags_list,
+                             OptionsGroup>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const auto& child_ids = db::get<Tags::ChildIds<Dim>>(box);
+    if (child_ids.empty()) {
+      return {std::move(box)};
+    }
+
+    // Do some logging
+    const auto& iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s " + Options::name<OptionsGroup>() +
+                           "(%zu): Send correction to finer grid\n",
+                       element_id, iteration_id);
+    }
+
+    // The children prolongate the correction to their mesh
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    for (const auto& child_id : child_ids) {
+      Parallel::receive_data<correction_inbox_tag>(
+          receiver_proxy[child_id], iteration_id,
+          std::make_pair(db::get<domain::Tags::Mesh<Dim>>(box),
+                         db::get<fields_tag>(box)));
+    }
+    return {std::move(box)};
+  }
+};
+
+}  // namespace LinearSolver::multigrid::detail
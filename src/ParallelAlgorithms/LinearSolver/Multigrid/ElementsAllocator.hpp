@@ -0,0 +1,100 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Tags.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace LinearSolver::multigrid {
+
+/*!
+ * \brief Create the elements of all grids in the multigrid hierarchy
+ *
+ * Use this allocator with the `elliptic::DgElementArray` to create the
+ * elements of all grids in the multigrid hierarchy in the same array. The
+ * finest grid has the initial refinement levels of the domain. Each coarser
+ * grid is h-coarsened with `LinearSolver::multigrid::coarsen` until the domain
+ * is fully coarsened or the `LinearSolver::multigrid::Tags::MaxLevels` are
+ * reached. The elements of each grid are distinguished by their
+ * `ElementId::grid_index()` and initialized with the refinement levels of
+ * their grid and of the neighboring grids, which the element actions of the
+ * `LinearSolver::multigrid::Multigrid` use to find their parent and children.
+ *
+ * The elements of all grids are distributed round-robin over all processors.
+ */
+template <size_t Dim, typename OptionsGroup>
+struct ElementsAllocator {
+  template <typename ParallelComponent, typename Metavariables,
+            typename... InitializationTags>
+  static void apply(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
+      const tuples::TaggedTuple<InitializationTags...>&
+          initialization_items) noexcept {
+    static_assert(
+        tmpl::list_contains_v<tmpl::list<InitializationTags...>,
+                              Tags::ChildrenRefinementLevels<Dim>> and
+            tmpl::list_contains_v<tmpl::list<InitializationTags...>,
+                                  Tags::ParentRefinementLevels<Dim>>,
+        "Add the 'initialize_element' actions of the multigrid solver to the "
+        "initialization phase to use the multigrid elements allocator.");
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    auto& element_array =
+        Parallel::get_parallel_component<ParallelComponent>(local_cache);
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(local_cache);
+    const size_t max_levels =
+        Parallel::get<Tags::MaxLevels<OptionsGroup>>(local_cache);
+
+    // Build the hierarchy of refinement levels from the finest to the coarsest
+    std::vector<std::vector<std::array<size_t, Dim>>> refinement_levels{
+        get<domain::Tags::InitialRefinementLevels<Dim>>(initialization_items)};
+    while (refinement_levels.size() < max_levels) {
+      auto coarser_levels = multigrid::coarsen(refinement_levels.back());
+      if (coarser_levels == refinement_levels.back()) {
+        break;
+      }
+      refinement_levels.push_back(std::move(coarser_levels));
+    }
+
+    const int number_of_procs = sys::number_of_procs();
+    int which_proc = 0;
+    for (size_t grid_index = 0; grid_index < refinement_levels.size();
+         ++grid_index) {
+      auto grid_initialization_items = initialization_items;
+      get<domain::Tags::InitialRefinementLevels<Dim>>(
+          grid_initialization_items) = refinement_levels[grid_index];
+      get<Tags::ChildrenRefinementLevels<Dim>>(grid_initialization_items) =
+          grid_index == 0 ? std::vector<std::array<size_t, Dim>>{}
+                          : refinement_levels[grid_index - 1];
+      get<Tags::ParentRefinementLevels<Dim>>(grid_initialization_items) =
+          grid_index + 1 == refinement_levels.size()
+              ? std::vector<std::array<size_t, Dim>>{}
+              : refinement_levels[grid_index + 1];
+      for (const auto& block : domain.blocks()) {
+        const std::vector<ElementId<Dim>> element_ids = initial_element_ids(
+            block.id(), refinement_levels[grid_index][block.id()], grid_index);
+        for (const auto& element_id : element_ids) {
+          element_array(element_id)
+              .insert(global_cache, grid_initialization_items, which_proc);
+          which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+        }
+      }
+    }
+    element_array.doneInserting();
+  }
+};
+
+}  // namespace LinearSolver::multigrid
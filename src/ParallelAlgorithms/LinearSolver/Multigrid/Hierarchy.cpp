@@ -0,0 +1,125 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+
+#include <array>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace LinearSolver::multigrid {
+
+template <size_t Dim>
+std::vector<std::array<size_t, Dim>> coarsen(
+    std::vector<std::array<size_t, Dim>> initial_refinement_levels) noexcept {
+  for (auto& refinement_levels_of_block : initial_refinement_levels) {
+    for (size_t d = 0; d < Dim; ++d) {
+      auto& refinement_level = gsl::at(refinement_levels_of_block, d);
+      if (refinement_level > 0) {
+        --refinement_level;
+      }
+    }
+  }
+  return initial_refinement_levels;
+}
+
+template <size_t Dim>
+ElementId<Dim> parent_id(
+    const ElementId<Dim>& child_id,
+    const std::array<size_t, Dim>& parent_refinement_levels) noexcept {
+  std::array<SegmentId, Dim> parent_segment_ids = child_id.segment_ids();
+  for (size_t d = 0; d < Dim; ++d) {
+    auto& segment_id = gsl::at(parent_segment_ids, d);
+    const size_t child_refinement_level = segment_id.refinement_level();
+    const size_t parent_refinement_level =
+        gsl::at(parent_refinement_levels, d);
+    ASSERT(parent_refinement_level == child_refinement_level or
+               parent_refinement_level + 1 == child_refinement_level,
+           "The refinement level of the parent ("
+               << parent_refinement_level
+               << ") must be equal to or one below the refinement level of "
+                  "the child ("
+               << child_refinement_level << ") in dimension " << d << ".");
+    if (parent_refinement_level < child_refinement_level) {
+      segment_id = segment_id.id_of_parent();
+    }
+  }
+  return {child_id.block_id(), std::move(parent_segment_ids),
+          child_id.grid_index() + 1};
+}
+
+template <size_t Dim>
+std::unordered_set<ElementId<Dim>> child_ids(
+    const ElementId<Dim>& parent_id,
+    const std::array<size_t, Dim>& children_refinement_levels) noexcept {
+  ASSERT(parent_id.grid_index() > 0,
+         "The element " << parent_id
+                        << " is on the finest grid, so it has no children.");
+  std::vector<std::array<SegmentId, Dim>> children_segment_ids{
+      parent_id.segment_ids()};
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t parent_refinement_level =
+        gsl::at(parent_id.segment_ids(), d).refinement_level();
+    const size_t child_refinement_level =
+        gsl::at(children_refinement_levels, d);
+    ASSERT(child_refinement_level == parent_refinement_level or
+               child_refinement_level == parent_refinement_level + 1,
+           "The refinement level of children ("
+               << child_refinement_level
+               << ") must be equal to or one above the refinement level of "
+                  "the parent ("
+               << parent_refinement_level << ") in dimension " << d << ".");
+    if (child_refinement_level == parent_refinement_level) {
+      continue;
+    }
+    // Split every child found so far in this dimension
+    const size_t num_children_so_far = children_segment_ids.size();
+    children_segment_ids.reserve(2 * num_children_so_far);
+    for (size_t i = 0; i < num_children_so_far; ++i) {
+      auto upper_child_segment_ids = children_segment_ids[i];
+      gsl::at(children_segment_ids[i], d) =
+          gsl::at(children_segment_ids[i], d).id_of_child(Side::Lower);
+      gsl::at(upper_child_segment_ids, d) =
+          gsl::at(upper_child_segment_ids, d).id_of_child(Side::Upper);
+      children_segment_ids.push_back(std::move(upper_child_segment_ids));
+    }
+  }
+  std::unordered_set<ElementId<Dim>> children_ids{};
+  for (auto& segment_ids : children_segment_ids) {
+    children_ids.emplace(parent_id.block_id(), std::move(segment_ids),
+                         parent_id.grid_index() - 1);
+  }
+  return children_ids;
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(r, data)                                             \
+  template std::vector<std::array<size_t, DIM(data)>> coarsen(         \
+      std::vector<std::array<size_t, DIM(data)>>                       \
+          initial_refinement_levels) noexcept;                         \
+  template ElementId<DIM(data)> parent_id(                             \
+      const ElementId<DIM(data)>& child_id,                            \
+      const std::array<size_t, DIM(data)>& parent_refinement_levels)   \
+      noexcept;                                                        \
+  template std::unordered_set<ElementId<DIM(data)>> child_ids(         \
+      const ElementId<DIM(data)>& parent_id,                           \
+      const std::array<size_t, DIM(data)>& children_refinement_levels) \
+      noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+/// \endcond
+
+}  // namespace LinearSolver::multigrid
@@ -0,0 +1,58 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+
+/// Functionality related to multigrid linear solvers
+namespace LinearSolver::multigrid {
+
+/*!
+ * \brief Coarsen the initial refinement levels of all blocks in the domain
+ *
+ * Simply decrease the refinement level uniformly over the entire domain.
+ * Doesn't do anything for blocks that are already fully coarsened, so if the
+ * return value equals the input argument the entire domain is fully coarsened.
+ * Will not coarsen beyond refinement level zero.
+ */
+template <size_t Dim>
+std::vector<std::array<size_t, Dim>> coarsen(
+    std::vector<std::array<size_t, Dim>> initial_refinement_levels) noexcept;
+
+/*!
+ * \brief The element covering the `child_id` on the coarser grid.
+ *
+ * The `parent_refinement_levels` are the refinement levels of the block on the
+ * coarser grid, which must each be equal to or one below the refinement level
+ * of the `child_id`. The parent is obtained by h-coarsening the element in
+ * every dimension where the coarser grid is less refined. Its grid index is
+ * one above the grid index of the `child_id`. If the block is not coarsened at
+ * all the parent covers the same region of the block as the child.
+ */
+template <size_t Dim>
+ElementId<Dim> parent_id(
+    const ElementId<Dim>& child_id,
+    const std::array<size_t, Dim>& parent_refinement_levels) noexcept;
+
+/*!
+ * \brief The elements covering the `parent_id` on the finer grid.
+ *
+ * The `children_refinement_levels` are the refinement levels of the block on
+ * the finer grid, which must each be equal to or one above the refinement
+ * level of the `parent_id`. The children have a grid index one below the grid
+ * index of the `parent_id`. If the block is not refined relative to the
+ * `parent_id` in any dimension the parent has a single child that covers the
+ * same region of the block.
+ */
+template <size_t Dim>
+std::unordered_set<ElementId<Dim>> child_ids(
+    const ElementId<Dim>& parent_id,
+    const std::array<size_t, Dim>& children_refinement_levels) noexcept;
+
+}  // namespace LinearSolver::multigrid
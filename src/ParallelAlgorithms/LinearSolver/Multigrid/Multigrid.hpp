@@ -0,0 +1,135 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/ElementsAllocator.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::multigrid {
+
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief A V-cycle geometric multigrid solver for linear systems of equations
+ * \f$Ax=b\f$
+ *
+ * Each iteration of this solver performs one V-cycle over a hierarchy of
+ * grids. The finest grid is the domain at its initial refinement levels and
+ * each coarser grid is h-coarsened by one refinement level in every block
+ * (see `LinearSolver::multigrid::coarsen`) until the domain is fully coarsened
+ * or the `LinearSolver::multigrid::Tags::MaxLevels` are reached. The elements
+ * of all grids live in the same array parallel component, so create the array
+ * with the `LinearSolver::multigrid::ElementsAllocator` (see
+ * `elliptic::DgElementArray`). The elements of each grid are distinguished by
+ * their `ElementId::grid_index()`, which is zero on the finest grid.
+ *
+ * A V-cycle proceeds as follows on every grid:
+ *
+ * 1. On all grids but the finest, receive the residuals of the children on the
+ *    finer grid and restrict them to this grid. They become the source of the
+ *    coarse-grid correction, which starts at zero. In the first iteration this
+ *    happens before the initial residual is observed, so the observed residual
+ *    of the coarse grids is the restricted residual.
+ * 2. Pre-smooth, i.e. run the `PreSmootherActions`.
+ * 3. Send the remaining residual to the parent on the coarser grid. On the
+ *    coarsest grid, skip to step 7 instead.
+ * 4. Receive the correction from the parent on the coarser grid, prolongate it
+ *    to this grid and add it to the fields.
+ * 5. Run the `ApplyOperatorActions` to update the operator applied to the
+ *    corrected fields.
+ * 6. Post-smooth, i.e. run the `PostSmootherActions`.
+ * 7. Send the fields to the children on the finer grid, where they are added
+ *    as a correction.
+ *
+ * Like the `LinearSolver::Schwarz::Schwarz` solver this solver expects that
+ * \f$A(x)\f$ is computed and stored in the DataBox as
+ * `db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>`
+ * when the solve begins, and it leaves it up to date when the solve completes.
+ * Since the coarse grids solve for a correction, the `ApplyOperatorActions`
+ * must apply the linear operator with homogeneous boundary conditions.
+ *
+ * \par Smoothers:
+ * Use an asynchronous solver, such as the `LinearSolver::Schwarz::Schwarz` or
+ * the `LinearSolver::Richardson::Richardson` solver, as smoother. Run it for a
+ * fixed small number of iterations and pass its `solve` action list, which
+ * includes the `ApplyOperatorActions`, as `PreSmootherActions` and
+ * `PostSmootherActions`. The pre- and post-smoother must use different
+ * `OptionsGroup`s because each contributes one residual observation per
+ * element and iteration. For the same reason pass
+ * `LinearSolver::multigrid::Tags::MultigridLevel` as the `ArraySectionIdTag`
+ * to the smoothers, so each grid observes its own residuals. Also add the
+ * smoothers' `initialize_element` and `register_element` actions to the
+ * array.
+ *
+ * \par Restriction of the residual:
+ * Set `ResidualIsMassive` to `true` if the linear operator includes the mass
+ * matrix, so that restricting the residual is the adjoint of prolongating the
+ * correction (see `LinearSolver::multigrid::restriction_matrix`).
+ *
+ * \par Preconditioning:
+ * Run a fixed number of V-cycles of this solver to precondition a
+ * `LinearSolver::gmres::Gmres` solver. Since the elements of all grids are in
+ * the same array, the GMRES solver must operate only on the section of the
+ * array that holds the finest grid. To do so, pass
+ * `LinearSolver::multigrid::Tags::IsFinestGrid` as the GMRES solver's
+ * `ArraySectionIdTag`. All elements run the actions of the GMRES solver and
+ * take part in its reductions, but the elements on the coarser grids
+ * contribute zero. This also keeps the grids in lockstep, so each application
+ * of the preconditioner completes on all grids before the next begins.
+ *
+ * \par Limitations:
+ * The grids are only h-coarsened, the number of grid points per element is
+ * kept.
+ */
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          bool ResidualIsMassive,
+          typename SourceTag =
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+struct Multigrid {
+  using operand_tag = FieldsTag;
+  using fields_tag = FieldsTag;
+  using source_tag = SourceTag;
+  using options_group = OptionsGroup;
+
+  using component_list = tmpl::list<>;
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<async_solvers::reduction_data>>;
+
+  using initialize_element = tmpl::list<
+      async_solvers::InitializeElement<FieldsTag, OptionsGroup, SourceTag>,
+      detail::InitializeElement<Dim, OptionsGroup>>;
+
+  using register_element =
+      async_solvers::RegisterElement<FieldsTag, OptionsGroup, SourceTag,
+                                     Tags::MultigridLevel>;
+
+  template <typename ApplyOperatorActions, typename PreSmootherActions,
+            typename PostSmootherActions, typename Label = OptionsGroup>
+  using solve = tmpl::list<
+      detail::ReceiveResidualFromFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                           ResidualIsMassive, SourceTag, true>,
+      async_solvers::PrepareSolve<FieldsTag, OptionsGroup, SourceTag, Label,
+                                  Tags::MultigridLevel>,
+      detail::ReceiveResidualFromFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                           ResidualIsMassive, SourceTag, false>,
+      PreSmootherActions,
+      detail::SendResidualToCoarserGrid<Dim, FieldsTag, OptionsGroup,
+                                        SourceTag>,
+      detail::ReceiveCorrectionFromCoarserGrid<Dim, FieldsTag, OptionsGroup,
+                                               SourceTag>,
+      ApplyOperatorActions, PostSmootherActions,
+      detail::SendCorrectionToFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                        SourceTag>,
+      async_solvers::CompleteStep<FieldsTag, OptionsGroup, SourceTag, Label,
+                                  Tags::MultigridLevel>>;
+};
+
+}  // namespace LinearSolver::multigrid
@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::multigrid {
+
+/// Option tags related to the multigrid solver
+namespace OptionTags {
+
+template <typename OptionsGroup>
+struct MaxLevels {
+  using type = size_t;
+  using group = OptionsGroup;
+  static constexpr Options::String help =
+      "Maximum number of levels in the multigrid hierarchy. Includes the "
+      "finest grid, i.e. set to '1' to disable coarse grids. Fewer levels are "
+      "used if the domain is fully coarsened.";
+  static type lower_bound() noexcept { return 1; }
+  static type upper_bound() noexcept {
+    return two_to_the(SegmentId::grid_index_bits);
+  }
+};
+
+}  // namespace OptionTags
+
+/// Tags related to the multigrid solver
+namespace Tags {
+
+/// Maximum number of levels in the multigrid hierarchy
+template <typename OptionsGroup>
+struct MaxLevels : db::SimpleTag {
+  static std::string name() noexcept {
+    return "MaxLevels(" + Options::name<OptionsGroup>() + ")";
+  }
+  using type = size_t;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::MaxLevels<OptionsGroup>>;
+  static type create_from_options(const type& value) noexcept { return value; }
+};
+
+/// The grid the element belongs to, where zero is the finest grid. This is the
+/// `ElementId::grid_index()` of the element.
+struct MultigridLevel : db::SimpleTag {
+  using type = size_t;
+};
+
+/// Whether or not the element belongs to the finest grid. Pass this tag as the
+/// `ArraySectionIdTag` to solvers that should only operate on the finest grid,
+/// such as a `LinearSolver::gmres::Gmres` that is preconditioned by the
+/// multigrid solver.
+struct IsFinestGrid : db::SimpleTag {
+  using type = bool;
+};
+
+/// The refinement levels of all blocks on the next-finer grid, or an empty
+/// vector on the finest grid. Set by
+/// `LinearSolver::multigrid::ElementsAllocator` for each grid.
+template <size_t Dim>
+struct ChildrenRefinementLevels : db::SimpleTag {
+  using type = std::vector<std::array<size_t, Dim>>;
+  using option_tags = tmpl::list<>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options() noexcept { return {}; }
+};
+
+/// The refinement levels of all blocks on the next-coarser grid, or an empty
+/// vector on the coarsest grid. Set by
+/// `LinearSolver::multigrid::ElementsAllocator` for each grid.
+template <size_t Dim>
+struct ParentRefinementLevels : db::SimpleTag {
+  using type = std::vector<std::array<size_t, Dim>>;
+  using option_tags = tmpl::list<>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options() noexcept { return {}; }
+};
+
+/// The element covering this element on the next-coarser grid, or
+/// `std::nullopt` on the coarsest grid
+template <size_t Dim>
+struct ParentId : db::SimpleTag {
+  using type = std::optional<ElementId<Dim>>;
+};
+
+/// The elements covering this element on the next-finer grid, or an empty set
+/// on the finest grid
+template <size_t Dim>
+struct ChildIds : db::SimpleTag {
+  using type = std::unordered_set<ElementId<Dim>>;
+};
+
+}  // namespace Tags
+}  // namespace LinearSolver::multigrid
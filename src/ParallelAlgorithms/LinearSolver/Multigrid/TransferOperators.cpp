@@ -0,0 +1,167 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/LinearSolver/Multigrid/TransferOperators.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/StaticCache.hpp"
+
+namespace LinearSolver::multigrid {
+
+namespace {
+const Matrix& identity_matrix() noexcept {
+  static const Matrix identity{};
+  return identity;
+}
+}  // namespace
+
+template <size_t Dim>
+std::array<Spectral::MortarSize, Dim> child_size(
+    const std::array<SegmentId, Dim>& child_segment_ids,
+    const std::array<SegmentId, Dim>& parent_segment_ids) noexcept {
+  std::array<Spectral::MortarSize, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const SegmentId& child_segment_id = gsl::at(child_segment_ids, d);
+    const SegmentId& parent_segment_id = gsl::at(parent_segment_ids, d);
+    if (child_segment_id == parent_segment_id) {
+      gsl::at(result, d) = Spectral::MortarSize::Full;
+    } else if (child_segment_id == parent_segment_id.id_of_child(Side::Lower)) {
+      gsl::at(result, d) = Spectral::MortarSize::LowerHalf;
+    } else {
+      ASSERT(child_segment_id == parent_segment_id.id_of_child(Side::Upper),
+             "Segment id '" << child_segment_id
+                            << "' is not the same as or a child of segment id '"
+                            << parent_segment_id << "' in dimension " << d
+                            << ".");
+      gsl::at(result, d) = Spectral::MortarSize::UpperHalf;
+    }
+  }
+  return result;
+}
+
+const Matrix& prolongation_matrix(
+    const Mesh<1>& child_mesh, const Mesh<1>& parent_mesh,
+    const Spectral::MortarSize child_size) noexcept {
+  if (child_size == Spectral::MortarSize::Full and child_mesh == parent_mesh) {
+    return identity_matrix();
+  }
+  return Spectral::projection_matrix_element_to_mortar(child_size, child_mesh,
+                                                       parent_mesh);
+}
+
+const Matrix& restriction_matrix(const Mesh<1>& parent_mesh,
+                                 const Mesh<1>& child_mesh,
+                                 const Spectral::MortarSize child_size,
+                                 const bool operand_is_massive) noexcept {
+  if (child_size == Spectral::MortarSize::Full and child_mesh == parent_mesh) {
+    return identity_matrix();
+  }
+  if (not operand_is_massive) {
+    return Spectral::projection_matrix_mortar_to_element(
+        child_size, parent_mesh, child_mesh);
+  }
+  ASSERT(parent_mesh.basis(0) == Spectral::Basis::Legendre and
+             child_mesh.basis(0) == Spectral::Basis::Legendre,
+         "Restriction only implemented on Legendre basis");
+  const static auto cache = make_static_cache<
+      CacheEnumeration<Spectral::MortarSize, Spectral::MortarSize::Full,
+                       Spectral::MortarSize::UpperHalf,
+                       Spectral::MortarSize::LowerHalf>,
+      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                       Spectral::Quadrature::GaussLobatto>,
+      CacheRange<2_st,
+                 Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
+                     1>,
+      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                       Spectral::Quadrature::GaussLobatto>,
+      CacheRange<2_st,
+                 Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
+                     1>>([](const Spectral::MortarSize local_child_size,
+                            const Spectral::Quadrature quadrature_child,
+                            const size_t extents_child,
+                            const Spectral::Quadrature quadrature_parent,
+                            const size_t extents_parent) noexcept {
+    if (extents_child < extents_parent) {
+      return Matrix{};
+    }
+    const Mesh<1> mesh_child(extents_child, Spectral::Basis::Legendre,
+                             quadrature_child);
+    const Mesh<1> mesh_parent(extents_parent, Spectral::Basis::Legendre,
+                              quadrature_parent);
+    // The restriction operator for massive quantities is the transpose of the
+    // prolongation operator
+    Matrix transposed_prolongation{
+        trans(Spectral::projection_matrix_element_to_mortar(
+            local_child_size, mesh_child, mesh_parent))};
+    return transposed_prolongation;
+  });
+  return cache(child_size, child_mesh.quadrature(0), child_mesh.extents(0),
+               parent_mesh.quadrature(0), parent_mesh.extents(0));
+}
+
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> prolongation_matrices(
+    const Mesh<Dim>& child_mesh, const Mesh<Dim>& parent_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes) noexcept {
+  auto matrices = make_array<Dim>(std::cref(identity_matrix()));
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(matrices, d) = prolongation_matrix(child_mesh.slice_through(d),
+                                               parent_mesh.slice_through(d),
+                                               gsl::at(child_sizes, d));
+  }
+  return matrices;
+}
+
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> restriction_matrices(
+    const Mesh<Dim>& parent_mesh, const Mesh<Dim>& child_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes,
+    const bool operand_is_massive) noexcept {
+  auto matrices = make_array<Dim>(std::cref(identity_matrix()));
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(matrices, d) = restriction_matrix(
+        parent_mesh.slice_through(d), child_mesh.slice_through(d),
+        gsl::at(child_sizes, d), operand_is_massive);
+  }
+  return matrices;
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(r, data)                                                  \
+  template std::array<Spectral::MortarSize, DIM(data)> child_size(            \
+      const std::array<SegmentId, DIM(data)>& child_segment_ids,              \
+      const std::array<SegmentId, DIM(data)>& parent_segment_ids) noexcept;   \
+  template std::array<std::reference_wrapper<const Matrix>, DIM(data)>        \
+  prolongation_matrices(                                                      \
+      const Mesh<DIM(data)>& child_mesh, const Mesh<DIM(data)>& parent_mesh,  \
+      const std::array<Spectral::MortarSize, DIM(data)>& child_sizes)         \
+      noexcept;                                                               \
+  template std::array<std::reference_wrapper<const Matrix>, DIM(data)>        \
+  restriction_matrices(                                                       \
+      const Mesh<DIM(data)>& parent_mesh, const Mesh<DIM(data)>& child_mesh,  \
+      const std::array<Spectral::MortarSize, DIM(data)>& child_sizes,         \
+      bool operand_is_massive) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+/// \endcond
+
+}  // namespace LinearSolver::multigrid
@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace LinearSolver::multigrid {
+
+/*!
+ * \brief The part of the parent element that the child element covers in
+ * every dimension
+ *
+ * The child segments must either be identical to the parent segments or one of
+ * their two children.
+ */
+template <size_t Dim>
+std::array<Spectral::MortarSize, Dim> child_size(
+    const std::array<SegmentId, Dim>& child_segment_ids,
+    const std::array<SegmentId, Dim>& parent_segment_ids) noexcept;
+
+/*!
+ * \brief The 1D matrix that prolongates data from a coarser parent element to
+ * a finer child element
+ *
+ * The prolongation is an interpolation from the parent to the child, so it is
+ * the same operation as the projection from an element to a mortar (see
+ * `Spectral::projection_matrix_element_to_mortar`). The `child_mesh` must have
+ * at least as many points as the `parent_mesh`. Returns an empty matrix to
+ * signal the identity operation if the child covers the full parent and their
+ * meshes are equal.
+ */
+const Matrix& prolongation_matrix(const Mesh<1>& child_mesh,
+                                  const Mesh<1>& parent_mesh,
+                                  Spectral::MortarSize child_size) noexcept;
+
+/*!
+ * \brief The 1D matrix that restricts data from a finer child element to a
+ * coarser parent element
+ *
+ * For data that does not include a mass matrix, such as the fields we solve
+ * for, the restriction is the \f$L_2\f$-projection from the child to the
+ * parent, which is the same operation as the projection from a mortar to an
+ * element (see `Spectral::projection_matrix_mortar_to_element`). For data that
+ * already includes a mass matrix, such as the residual of a "massive" DG
+ * operator, the restriction is the transpose of the prolongation so the
+ * coarse-grid operator is the Galerkin operator \f$R A P\f$ with
+ * \f$R = P^T\f$ (`operand_is_massive = true`).
+ *
+ * The restricted data from all children of a parent must be summed to obtain
+ * the data on the parent. Returns an empty matrix to signal the identity
+ * operation if the child covers the full parent and their meshes are equal.
+ */
+const Matrix& restriction_matrix(const Mesh<1>& parent_mesh,
+                                 const Mesh<1>& child_mesh,
+                                 Spectral::MortarSize child_size,
+                                 bool operand_is_massive) noexcept;
+
+// @{
+/// The `prolongation_matrix` or `restriction_matrix` in every dimension
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> prolongation_matrices(
+    const Mesh<Dim>& child_mesh, const Mesh<Dim>& parent_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes) noexcept;
+
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> restriction_matrices(
+    const Mesh<Dim>& parent_mesh, const Mesh<Dim>& child_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes,
+    bool operand_is_massive) noexcept;
+// @}
+
+// @{
+/// Prolongate data from the parent element to the child element
+template <typename TagsList, size_t Dim>
+void prolongate(const gsl::not_null<Variables<TagsList>*> child_data,
+                const Variables<TagsList>& parent_data,
+                const Mesh<Dim>& parent_mesh, const Mesh<Dim>& child_mesh,
+                const std::array<Spectral::MortarSize, Dim>&
+                    child_sizes) noexcept {
+  apply_matrices(child_data,
+                 prolongation_matrices(child_mesh, parent_mesh, child_sizes),
+                 parent_data, parent_mesh.extents());
+}
+
+template <typename TagsList, size_t Dim>
+Variables<TagsList> prolongate(
+    const Variables<TagsList>& parent_data, const Mesh<Dim>& parent_mesh,
+    const Mesh<Dim>& child_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes) noexcept {
+  Variables<TagsList> child_data{child_mesh.number_of_grid_points()};
+  prolongate(make_not_null(&child_data), parent_data, parent_mesh, child_mesh,
+             child_sizes);
+  return child_data;
+}
+// @}
+
+// @{
+/*!
+ * \brief Restrict data from the child element to the parent element
+ *
+ * The parent must sum the restricted data from all its children.
+ *
+ * \see `LinearSolver::multigrid::restriction_matrix`
+ */
+template <typename TagsList, size_t Dim>
+void restrict_to_parent(
+    const gsl::not_null<Variables<TagsList>*> parent_data,
+    const Variables<TagsList>& child_data, const Mesh<Dim>& child_mesh,
+    const Mesh<Dim>& parent_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes,
+    const bool operand_is_massive) noexcept {
+  apply_matrices(parent_data,
+                 restriction_matrices(parent_mesh, child_mesh, child_sizes,
+                                      operand_is_massive),
+                 child_data, child_mesh.extents());
+}
+
+template <typename TagsList, size_t Dim>
+Variables<TagsList> restrict_to_parent(
+    const Variables<TagsList>& child_data, const Mesh<Dim>& child_mesh,
+    const Mesh<Dim>& parent_mesh,
+    const std::array<Spectral::MortarSize, Dim>& child_sizes,
+    const bool operand_is_massive) noexcept {
+  Variables<TagsList> parent_data{parent_mesh.number_of_grid_points()};
+  restrict_to_parent(make_not_null(&parent_data), child_data, child_mesh,
+                     parent_mesh, child_sizes, operand_is_massive);
+  return parent_data;
+}
+// @}
+
+}  // namespace LinearSolver::multigrid
@@ -98,10 +98,17 @@ struct UpdateFields {
  * \f]
  *
  * for optimal convergence.
+ *
+ * Elements that have the same value of the `ArraySectionIdTag` contribute to
+ * the same residual observations (see
+ * `LinearSolver::async_solvers::section_observation_key`). This is useful when
+ * this solver smooths the grids of a `LinearSolver::multigrid::Multigrid`
+ * solver.
  */
 template <typename FieldsTag, typename OptionsGroup,
           typename SourceTag =
-              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>,
+          typename ArraySectionIdTag = void>
 struct Richardson {
   using fields_tag = FieldsTag;
   using options_group = OptionsGroup;
@@ -113,12 +120,15 @@ struct Richardson {
   using initialize_element =
       async_solvers::InitializeElement<FieldsTag, OptionsGroup, SourceTag>;
   using register_element =
-      async_solvers::RegisterElement<FieldsTag, OptionsGroup, SourceTag>;
+      async_solvers::RegisterElement<FieldsTag, OptionsGroup, SourceTag,
+                                     ArraySectionIdTag>;
   template <typename ApplyOperatorActions, typename Label = OptionsGroup>
   using solve = tmpl::list<
-      async_solvers::PrepareSolve<FieldsTag, OptionsGroup, SourceTag, Label>,
+      async_solvers::PrepareSolve<FieldsTag, OptionsGroup, SourceTag, Label,
+                                  ArraySectionIdTag>,
       detail::UpdateFields<FieldsTag, OptionsGroup, SourceTag>,
       ApplyOperatorActions,
-      async_solvers::CompleteStep<FieldsTag, OptionsGroup, SourceTag, Label>>;
+      async_solvers::CompleteStep<FieldsTag, OptionsGroup, SourceTag, Label,
+                                  ArraySectionIdTag>>;
 };
 }  // namespace LinearSolver::Richardson
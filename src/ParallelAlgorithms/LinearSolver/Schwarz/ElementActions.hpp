@@ -43,6 +43,7 @@
 #include "ParallelAlgorithms/DiscontinuousGalerkin/HasReceivedFromAllMortars.hpp"
 #include "ParallelAlgorithms/Initialization/MergeIntoDataBox.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/Actions/CommunicateOverlapFields.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ComputeTags.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
@@ -69,42 +70,47 @@ using reduction_data = Parallel::ReductionData<
     // Maximum number of subdomain solver iterations
     Parallel::ReductionDatum<size_t, funcl::Max<>>>;
 
-template <typename OptionsGroup>
+template <typename OptionsGroup, typename ArraySectionIdTag>
 struct RegisterObservers {
   template <typename ParallelComponent, typename DbTagsList,
             typename ArrayIndex>
   static std::pair<observers::TypeOfObservation, observers::ObservationKey>
-  register_info(const db::DataBox<DbTagsList>& /*box*/,
+  register_info(const db::DataBox<DbTagsList>& box,
                 const ArrayIndex& /*array_index*/) noexcept {
     return {observers::TypeOfObservation::Reduction,
-            observers::ObservationKey{pretty_type::get_name<OptionsGroup>() +
-                                      "SubdomainSolves"}};
+            observers::ObservationKey{
+                pretty_type::get_name<OptionsGroup>() +
+                async_solvers::section_observation_key<ArraySectionIdTag>(
+                    box) +
+                "SubdomainSolves"}};
   }
 };
 
-template <typename FieldsTag, typename OptionsGroup, typename SourceTag>
-using RegisterElement =
-    observers::Actions::RegisterWithObservers<RegisterObservers<OptionsGroup>>;
+template <typename FieldsTag, typename OptionsGroup, typename SourceTag,
+          typename ArraySectionIdTag>
+using RegisterElement = observers::Actions::RegisterWithObservers<
+    RegisterObservers<OptionsGroup, ArraySectionIdTag>>;
 
 template <typename OptionsGroup, typename ParallelComponent,
           typename Metavariables, typename ArrayIndex>
 void contribute_to_subdomain_stats_observation(
     const size_t iteration_id, const size_t subdomain_solve_num_iterations,
-    Parallel::GlobalCache<Metavariables>& cache,
-    const ArrayIndex& array_index) noexcept {
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const std::string& section_observation_key) noexcept {
   auto& local_observer =
       *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
            cache)
            .ckLocalBranch();
   Parallel::simple_action<observers::Actions::ContributeReductionData>(
       local_observer,
-      observers::ObservationId(
-          iteration_id,
-          pretty_type::get_name<OptionsGroup>() + "SubdomainSolves"),
+      observers::ObservationId(iteration_id,
+                               pretty_type::get_name<OptionsGroup>() +
+                                   section_observation_key + "SubdomainSolves"),
       observers::ArrayComponentId{
           std::add_pointer_t<ParallelComponent>{nullptr},
           Parallel::ArrayIndex<ArrayIndex>(array_index)},
-      std::string{"/" + Options::name<OptionsGroup>() + "SubdomainSolves"},
+      std::string{"/" + Options::name<OptionsGroup>() +
+                  section_observation_key + "SubdomainSolves"},
       std::vector<std::string>{"Iteration", "NumSubdomains", "AvgNumIterations",
                                "MinNumIterations", "MaxNumIterations"},
       reduction_data{iteration_id, 1, subdomain_solve_num_iterations,
@@ -212,7 +218,8 @@ struct OverlapSolutionInboxTag
 // problem for this element-centered subdomain. Apply the weighted solution on
 // this element directly and send the solution on overlap regions to the
 // neighbors that they overlap with.
-template <typename FieldsTag, typename OptionsGroup, typename SubdomainOperator>
+template <typename FieldsTag, typename OptionsGroup, typename SubdomainOperator,
+          typename ArraySectionIdTag>
 struct SolveSubdomain {
  private:
   using fields_tag = FieldsTag;
@@ -318,7 +325,8 @@ struct SolveSubdomain {
     }
     contribute_to_subdomain_stats_observation<OptionsGroup, ParallelComponent>(
         iteration_id + 1, subdomain_solve_has_converged.num_iterations(), cache,
-        element_id);
+        element_id,
+        async_solvers::section_observation_key<ArraySectionIdTag>(box));
 
     // Apply weighting
     if (LIKELY(max_overlap > 0)) {
@@ -135,6 +135,12 @@ namespace LinearSolver::Schwarz {
  * corner- and edge-neighbors when constructing the weights. See
  * `LinearSolver::Schwarz::intruding_weight` for a discussion.
  *
+ * \par Array sections:
+ * Pass a tag to the `ArraySectionIdTag` template parameter to observe the
+ * elements that have different values of this tag separately, e.g. the
+ * elements on the different grids of a multigrid hierarchy. See
+ * `LinearSolver::async_solvers::section_observation_key`.
+ *
  * \par Possible improvements:
  * - Specify the number of overlap points as a fraction of the element width
  * instead of a fixed number. This was shown in \cite Stiller2016b to achieve
@@ -143,7 +149,8 @@ namespace LinearSolver::Schwarz {
  */
 template <typename FieldsTag, typename OptionsGroup, typename SubdomainOperator,
           typename SourceTag =
-              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>,
+          typename ArraySectionIdTag = void>
 struct Schwarz {
   using operand_tag = FieldsTag;
   using fields_tag = FieldsTag;
@@ -161,19 +168,24 @@ struct Schwarz {
       detail::InitializeElement<FieldsTag, OptionsGroup, SubdomainOperator>>;
 
   using register_element = tmpl::list<
-      async_solvers::RegisterElement<FieldsTag, OptionsGroup, SourceTag>,
-      detail::RegisterElement<FieldsTag, OptionsGroup, SourceTag>>;
+      async_solvers::RegisterElement<FieldsTag, OptionsGroup, SourceTag,
+                                     ArraySectionIdTag>,
+      detail::RegisterElement<FieldsTag, OptionsGroup, SourceTag,
+                              ArraySectionIdTag>>;
 
   template <typename ApplyOperatorActions, typename Label = OptionsGroup>
   using solve = tmpl::list<
-      async_solvers::PrepareSolve<FieldsTag, OptionsGroup, SourceTag, Label>,
+      async_solvers::PrepareSolve<FieldsTag, OptionsGroup, SourceTag, Label,
+                                  ArraySectionIdTag>,
       detail::SendOverlapData<FieldsTag, OptionsGroup, SubdomainOperator>,
       detail::ReceiveOverlapData<FieldsTag, OptionsGroup, SubdomainOperator>,
-      detail::SolveSubdomain<FieldsTag, OptionsGroup, SubdomainOperator>,
+      detail::SolveSubdomain<FieldsTag, OptionsGroup, SubdomainOperator,
+                             ArraySectionIdTag>,
       detail::ReceiveOverlapSolution<FieldsTag, OptionsGroup,
                                      SubdomainOperator>,
       ApplyOperatorActions,
-      async_solvers::CompleteStep<FieldsTag, OptionsGroup, SourceTag, Label>>;
+      async_solvers::CompleteStep<FieldsTag, OptionsGroup, SourceTag, Label,
+                                  ArraySectionIdTag>>;
 };
 
 }  // namespace LinearSolver::Schwarz
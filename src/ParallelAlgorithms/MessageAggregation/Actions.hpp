@@ -0,0 +1,245 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace MessageAggregation {
+/// Actions related to message aggregation
+namespace Actions {
+
+/// \ingroup ActionsGroup
+/// \brief Initializes a `MessageAggregation::Aggregator`
+///
+/// DataBox changes:
+/// - Adds:
+///   - `BufferTag`
+/// - Removes: nothing
+/// - Modifies: nothing
+///
+/// \note This action relies on the `SetupDataBox` aggregated initialization
+/// mechanism, so `Actions::SetupDataBox` must be present in the
+/// `Initialization` phase action list prior to this action.
+template <typename BufferTag>
+struct InitializeAggregator {
+  using simple_tags = tmpl::list<BufferTag>;
+  using compute_tags = tmpl::list<>;
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    return {std::move(box)};
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Invoked on the local branch of a `MessageAggregation::Aggregator` to
+/// register an element that sends data through it.
+///
+/// This is called by `RegisterWithAggregator` below.
+struct RegisterSender {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename ElementIndex>
+  static void apply(db::DataBox<DbTags>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ElementIndex& sender) noexcept {
+    db::mutate<typename ParallelComponent::buffer_tag>(
+        make_not_null(&box), [&sender](const auto buffer) noexcept {
+          buffer->register_sender(sender);
+        });
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Invoked on the local branch of a `MessageAggregation::Aggregator` to
+/// buffer data that an element sends.
+///
+/// This is called by `MessageAggregation::receive_data`.
+struct BufferData {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename ReceiverIndex, typename TemporalId,
+            typename DataType>
+  static void apply(db::DataBox<DbTags>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const int destination_proc, TemporalId&& temporal_id,
+                    ReceiverIndex&& receiver, DataType&& data) noexcept {
+    db::mutate<typename ParallelComponent::buffer_tag>(
+        make_not_null(&box),
+        [&destination_proc, &temporal_id, &receiver,
+         &data](const auto buffer) noexcept {
+          buffer->insert(destination_proc, temporal_id, std::move(receiver),
+                         std::move(data));
+        });
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Invoked on a `MessageAggregation::Aggregator` to fan out the
+/// aggregated data to the inboxes of the receiving elements.
+struct ReceiveAggregatedData {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename TemporalId, typename Message>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const TemporalId& temporal_id, Message&& message) noexcept {
+    auto& element_proxy = Parallel::get_parallel_component<
+        typename ParallelComponent::element_component>(cache);
+    for (auto& [receiver, data] : message) {
+      Parallel::receive_data<typename ParallelComponent::receive_tag>(
+          element_proxy[receiver], temporal_id, std::move(data));
+    }
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Invoked on the local branch of a `MessageAggregation::Aggregator`
+/// when the `sender` has buffered all its data at the `temporal_id`. Sends the
+/// aggregated data at all temporal ids that all registered elements on this
+/// processing element are done with.
+///
+/// This is called by `SendAggregatedData` below. It is an error if the
+/// `sender` is not registered on this processing element, which happens if it
+/// migrated.
+struct SenderDone {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename ElementIndex, typename TemporalId>
+  static void apply(db::DataBox<DbTags>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ElementIndex& sender,
+                    const TemporalId& temporal_id) noexcept {
+    using buffer_tag = typename ParallelComponent::buffer_tag;
+    std::map<TemporalId,
+             std::unordered_map<int, typename buffer_tag::type::message_type>>
+        completed_messages{};
+    db::mutate<buffer_tag>(
+        make_not_null(&box),
+        [&completed_messages, &sender,
+         &temporal_id](const auto buffer) noexcept {
+          buffer->sender_done(sender, temporal_id);
+          completed_messages = buffer->extract_completed();
+        });
+    auto& aggregator_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    for (auto& [completed_temporal_id, messages] : completed_messages) {
+      for (auto& [destination_proc, message] : messages) {
+        Parallel::simple_action<ReceiveAggregatedData>(
+            aggregator_proxy[destination_proc], completed_temporal_id,
+            std::move(message));
+      }
+    }
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Invoked on the elements to register them with the local branch of
+/// the `AggregatorComponent`.
+///
+/// Place this action in the `Initialization` phase of the element component.
+template <typename AggregatorComponent>
+struct RegisterWithAggregator {
+  template <typename DbTagList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagList>&&> apply(
+      db::DataBox<DbTagList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    auto& aggregator =
+        *Parallel::get_parallel_component<AggregatorComponent>(cache)
+             .ckLocalBranch();
+    Parallel::simple_action<RegisterSender>(aggregator, array_index);
+    return {std::move(box)};
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Invoked on the elements to signal that they have buffered all data
+/// they send at the current temporal id, which is retrieved from the
+/// `TemporalIdTag`.
+///
+/// This action determines when aggregated data is flushed, so place it in the
+/// action list of the element component right after the action that sends the
+/// data with `MessageAggregation::receive_data`.
+template <typename AggregatorComponent, typename TemporalIdTag>
+struct SendAggregatedData {
+  template <typename DbTagList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagList>&&> apply(
+      db::DataBox<DbTagList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    auto& aggregator =
+        *Parallel::get_parallel_component<AggregatorComponent>(cache)
+             .ckLocalBranch();
+    Parallel::simple_action<SenderDone>(aggregator, array_index,
+                                        db::get<TemporalIdTag>(box));
+    return {std::move(box)};
+  }
+};
+
+}  // namespace Actions
+
+/*!
+ * \brief Send the `data` to the `ReceiveTag` inbox of the `receiver` through
+ * the `AggregatorComponent`
+ *
+ * This is a drop-in replacement for `Parallel::receive_data` that buffers the
+ * data on this processing element instead of sending it immediately. The data
+ * is sent once all elements on this processing element have invoked
+ * `MessageAggregation::Actions::SendAggregatedData` at the `temporal_id` or a
+ * later one.
+ *
+ * \see MessageAggregation::Aggregator
+ */
+template <typename AggregatorComponent, typename Metavariables,
+          typename ReceiverIndex, typename DataType>
+void receive_data(
+    Parallel::GlobalCache<Metavariables>& cache, ReceiverIndex receiver,
+    typename AggregatorComponent::receive_tag::temporal_id temporal_id,
+    DataType&& data) noexcept {
+  static_assert(
+      std::is_same_v<std::decay_t<DataType>,
+                     typename AggregatorComponent::receive_data_type>,
+      "The data type does not match the one the aggregator is set up for.");
+  auto& element_proxy = Parallel::get_parallel_component<
+      typename AggregatorComponent::element_component>(cache);
+  // Elements don't migrate while aggregation is in use (see
+  // `MessageAggregation::Aggregator`), so the last known location of the
+  // receiver is where it lives.
+  const int destination_proc = element_proxy.ckLocMgr()->lastKnown(
+      element_proxy[receiver].ckGetIndex());
+  auto& aggregator =
+      *Parallel::get_parallel_component<AggregatorComponent>(cache)
+           .ckLocalBranch();
+  Parallel::simple_action<Actions::BufferData>(
+      aggregator, destination_proc, std::move(temporal_id),
+      std::move(receiver), std::forward<DataType>(data));
+}
+
+}  // namespace MessageAggregation
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/Actions/TerminatePhase.hpp"
+#include "Parallel/Algorithms/AlgorithmGroup.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/MessageAggregation/Actions.hpp"
+#include "ParallelAlgorithms/MessageAggregation/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace MessageAggregation {
+
+/*!
+ * \brief ParallelComponent that aggregates the data that elements of the
+ * `ElementComponent` send to each other's `ReceiveTag` inbox
+ *
+ * Small elements send many small messages per step, and for them the overhead
+ * of each Charm++ message can outweigh the work of the element. With the
+ * aggregator, all data sent on a processing element (PE) within a step is
+ * shipped as one message per destination PE, and fanned out to the inboxes of
+ * the receiving elements on arrival.
+ *
+ * Aggregation is opt-in:
+ * - Add this component to the `component_list` of the metavariables.
+ * - Add `MessageAggregation::Actions::RegisterWithAggregator` to the
+ *   initialization phase of the `ElementComponent`.
+ * - Send data with `MessageAggregation::receive_data` instead of
+ *   `Parallel::receive_data`.
+ * - Place `MessageAggregation::Actions::SendAggregatedData` in the action list
+ *   of the `ElementComponent` after the action that sends the data. This is the
+ *   flush policy: once all elements on a PE have passed this action at a
+ *   temporal id or a later one, the aggregated data for that temporal id is
+ *   sent. Elements that skip a temporal id therefore delay the data at that
+ *   temporal id only until they pass this action again.
+ *
+ * \warning Elements must not migrate between PEs while aggregation is in use.
+ * The aggregator registers elements with the PE they start on and reports an
+ * error when an element signals it is done on a different PE. Aggregation is
+ * not suitable for local time stepping, since the elements that step more
+ * slowly would delay the data of the elements that step faster.
+ */
+template <typename Metavariables, typename ReceiveTag, typename ReceiveDataType,
+          typename ElementComponent>
+struct Aggregator {
+  using chare_type = Parallel::Algorithms::Group;
+  using metavariables = Metavariables;
+  using receive_tag = ReceiveTag;
+  using receive_data_type = ReceiveDataType;
+  using element_component = ElementComponent;
+  using buffer_tag =
+      Tags::Buffer<ReceiveTag, typename ElementComponent::array_index,
+                   ReceiveDataType>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      typename metavariables::Phase, metavariables::Phase::Initialization,
+      tmpl::list<::Actions::SetupDataBox,
+                 Actions::InitializeAggregator<buffer_tag>,
+                 Parallel::Actions::TerminatePhase>>>;
+  using initialization_tags = Parallel::get_initialization_tags<
+      Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+  static void execute_next_phase(
+      typename Metavariables::Phase next_phase,
+      const Parallel::CProxy_GlobalCache<Metavariables>&
+          global_cache) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    Parallel::get_parallel_component<Aggregator>(local_cache)
+        .start_phase(next_phase);
+  };
+};
+
+}  // namespace MessageAggregation
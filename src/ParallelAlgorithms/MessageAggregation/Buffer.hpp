@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Parallel/PupStlCpp17.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// Aggregation of many small messages into fewer, larger ones
+namespace MessageAggregation {
+
+/*!
+ * \brief Collects outgoing data on a processing element (PE), grouped by
+ * the temporal id and the PE it is destined for
+ *
+ * Every element that sends data through this PE must be registered with
+ * `register_sender()` and must call `sender_done()` once it has buffered all
+ * its data at a temporal id. The data at a temporal id is complete once every
+ * registered sender is done with that temporal id or a later one, so a sender
+ * that skips a temporal id doesn't hold back the data of the other senders
+ * beyond its next call to `sender_done()`. Complete data is shipped as one
+ * message per destination PE with `extract_completed()`.
+ *
+ * \warning A sender that stops calling `sender_done()` holds back all data
+ * buffered at later temporal ids.
+ */
+template <typename ElementIndex, typename TemporalId, typename DataType>
+class Buffer {
+ public:
+  using message_type = std::vector<std::pair<ElementIndex, DataType>>;
+
+  /// Register an element that sends data through this PE
+  void register_sender(const ElementIndex& sender) noexcept {
+    ASSERT(senders_.count(sender) == 0,
+           "The sender " << sender << " is already registered.");
+    senders_.emplace(sender, std::nullopt);
+  }
+
+  size_t number_of_senders() const noexcept { return senders_.size(); }
+
+  /// Buffer the `data` for the `receiver`, which lives on the
+  /// `destination_proc`.
+  void insert(const int destination_proc, const TemporalId& temporal_id,
+              ElementIndex receiver, DataType data) noexcept {
+    pending_[temporal_id][destination_proc].emplace_back(std::move(receiver),
+                                                         std::move(data));
+  }
+
+  /// Record that the `sender` has buffered all its data at the `temporal_id`
+  /// and at all earlier temporal ids.
+  void sender_done(const ElementIndex& sender,
+                   const TemporalId& temporal_id) noexcept {
+    const auto last_done = senders_.find(sender);
+    if (UNLIKELY(last_done == senders_.end())) {
+      ERROR("The sender " << sender
+                          << " is not registered on this processing element. "
+                             "Elements must not migrate while message "
+                             "aggregation is in use.");
+    }
+    ASSERT(not last_done->second.has_value() or
+               *last_done->second < temporal_id,
+           "The sender " << sender << " is done at temporal id " << temporal_id
+                         << ", but was already done at temporal id "
+                         << *last_done->second << ".");
+    last_done->second = temporal_id;
+  }
+
+  /// Remove and return the data at all temporal ids that every registered
+  /// sender is done with, keyed by the temporal id and the destination PE.
+  std::map<TemporalId, std::unordered_map<int, message_type>>
+  extract_completed() noexcept {
+    std::map<TemporalId, std::unordered_map<int, message_type>> completed{};
+    std::optional<TemporalId> all_done{};
+    for (const auto& sender_and_last_done : senders_) {
+      const std::optional<TemporalId>& last_done = sender_and_last_done.second;
+      if (not last_done.has_value()) {
+        return completed;
+      }
+      if (not all_done.has_value() or *last_done < *all_done) {
+        all_done = *last_done;
+      }
+    }
+    if (not all_done.has_value()) {
+      return completed;
+    }
+    auto it = pending_.begin();
+    while (it != pending_.end() and not(*all_done < it->first)) {
+      completed.emplace(it->first, std::move(it->second));
+      it = pending_.erase(it);
+    }
+    return completed;
+  }
+
+  /// Whether any data is buffered
+  bool empty() const noexcept { return pending_.empty(); }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept {
+    p | senders_;
+    p | pending_;
+  }
+
+ private:
+  // The last temporal id each registered sender is done with
+  std::unordered_map<ElementIndex, std::optional<TemporalId>> senders_{};
+  std::map<TemporalId, std::unordered_map<int, message_type>> pending_{};
+};
+
+}  // namespace MessageAggregation
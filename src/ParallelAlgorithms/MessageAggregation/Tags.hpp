@@ -0,0 +1,25 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "ParallelAlgorithms/MessageAggregation/Buffer.hpp"
+#include "Utilities/PrettyType.hpp"
+
+namespace MessageAggregation {
+/// Tags related to message aggregation
+namespace Tags {
+/// The outgoing data buffered on a processing element for the `ReceiveTag`
+template <typename ReceiveTag, typename ElementIndex, typename DataType>
+struct Buffer : db::SimpleTag {
+  static std::string name() noexcept {
+    return "Buffer(" + pretty_type::short_name<ReceiveTag>() + ")";
+  }
+  using type = MessageAggregation::Buffer<
+      ElementIndex, typename ReceiveTag::temporal_id, DataType>;
+};
+}  // namespace Tags
+}  // namespace MessageAggregation
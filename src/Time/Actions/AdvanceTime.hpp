@@ -39,6 +39,10 @@ namespace Actions {
 ///   - Tags::TimeStepId
 ///   - Tags::TimeStepper<>
 ///
+/// If `Tags::StepperErrorUpdated` is in the DataBox, the substeps are chosen
+/// so that the time stepper can produce an error estimate (see
+/// `TimeStepper::next_time_id_for_error`).
+///
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
@@ -56,6 +60,9 @@ struct AdvanceTime {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/, ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) noexcept {  // NOLINT const
+    constexpr bool using_error_control =
+        db::tag_is_retrievable_v<Tags::StepperErrorUpdated,
+                                 db::DataBox<DbTags>>;
     db::mutate<Tags::TimeStepId, Tags::Next<Tags::TimeStepId>, Tags::TimeStep,
                Tags::Time>(
         make_not_null(&box),
@@ -66,7 +73,13 @@ struct AdvanceTime {
            const TimeStepper& time_stepper) noexcept {
           *time_id = *next_time_id;
           *time_step = time_step->with_slab(time_id->step_time().slab());
-          *next_time_id = time_stepper.next_time_id(*next_time_id, *time_step);
+          if constexpr (using_error_control) {
+            *next_time_id =
+                time_stepper.next_time_id_for_error(*next_time_id, *time_step);
+          } else {
+            *next_time_id =
+                time_stepper.next_time_id(*next_time_id, *time_step);
+          }
           *time = time_id->substep_time().value();
         },
         db::get<Tags::TimeStepper<>>(box));
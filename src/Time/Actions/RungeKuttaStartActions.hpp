@@ -0,0 +1,486 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Parallel/Actions/Goto.hpp"     // IWYU pragma: keep
+#include "Parallel/Actions/TerminatePhase.hpp"     // IWYU pragma: keep
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "Time/Actions/AdvanceTime.hpp"  // IWYU pragma: keep
+#include "Time/Actions/RecordTimeStepperData.hpp"
+#include "Time/Actions/SelfStartActions.hpp"
+#include "Time/Actions/UpdateU.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/DormandPrince5.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+// IWYU pragma: no_forward_declare db::DataBox
+/// \endcond
+
+/// \ingroup TimeGroup
+/// Definition of a Runge-Kutta startup procedure for multistep
+/// integrators.
+///
+/// This is an alternative to the SelfStart procedure for evolutions
+/// using global time stepping.  It generates the same \f$N\f$ history
+/// values, where \f$N\f$ is the negative of the initial slab number, at
+/// the same times \f$t_0 + k \Delta t\f$, \f$k = 1, \ldots, N\f$, as the
+/// self-start procedure.
+///
+/// \details
+/// Instead of repeatedly integrating with increasing order, a single
+/// TimeSteppers::DormandPrince5 step of size \f$N \Delta t\f$ is taken
+/// from the initial time into a separate startup history.  The
+/// derivative at the end of that step is then evaluated, which both
+/// provides the history entry at \f$t_0 + N \Delta t\f$ and allows the
+/// stepper's dense output to interpolate the solution to fourth order
+/// over the step.  Finally, the derivative is evaluated at the
+/// interpolated values at the remaining times \f$t_0 + k \Delta t\f$,
+/// \f$k = 1, \ldots, N-1\f$, and recorded in the main history.  This
+/// requires \f$N + 6\f$ evaluations of the time derivative, compared to
+/// \f$N (N + 1) / 2\f$ for the self-start procedure.
+///
+/// The error of the dense output limits the accuracy of the generated
+/// history, so this procedure preserves the convergence order of
+/// Adams-Bashforth integrators up to fifth order.
+///
+/// As for the self-start procedure, the slab number is used to keep
+/// the evaluations ordered: the Runge-Kutta step and the evaluation at
+/// its end are performed in slab \f$-N\f$ and the interpolated
+/// evaluations in slab \f$-N+1\f$.  The history is again not monotonic
+/// in time at the end of the procedure.
+///
+/// The step actions must call `Actions::RecordTimeStepperData<>` and
+/// `Actions::UpdateU<>`, which are replaced by their startup versions.
+/// Local time stepping is not supported, because the boundary history
+/// cannot be generated by a substep integrator.
+namespace RungeKuttaStart {
+/// Runge-Kutta startup tags
+namespace Tags {
+/// \ingroup TimeGroup
+/// The history of the Runge-Kutta step used to generate the startup
+/// values.
+template <typename Tag>
+struct StartupHistory : db::PrefixTag, db::SimpleTag {
+  using tag = Tag;
+  using type = typename ::Tags::HistoryEvolvedVariables<Tag>::type;
+};
+}  // namespace Tags
+
+/// Runge-Kutta startup actions
+namespace Actions {
+namespace detail {
+// Stepper used to generate the startup values.
+using startup_stepper = TimeSteppers::DormandPrince5;
+
+// Start of the interval being filled with history values.
+inline Time startup_start(const TimeStepId& time_id) noexcept {
+  const Slab slab = time_id.step_time().slab();
+  return time_id.time_runs_forward() ? slab.start() : slab.end();
+}
+
+// Whether `time_id` is one of the substeps of the Runge-Kutta step.
+inline bool is_runge_kutta_substep(const TimeStepId& time_id,
+                                   const int64_t values_needed) noexcept {
+  return time_id.slab_number() == -values_needed and
+         time_id.step_time() == startup_start(time_id);
+}
+}  // namespace detail
+
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// Prepares the startup history.
+///
+/// This action must run after SelfStart::Actions::Initialize, which
+/// stores the initial values and chooses the startup step.
+///
+/// Uses:
+/// - GlobalCache: nothing
+/// - DataBox: nothing
+///
+/// DataBox changes:
+/// - Adds: RungeKuttaStart::Tags::StartupHistory<variables_tag>
+/// - Removes: nothing
+/// - Modifies: nothing
+template <typename System>
+struct Initialize {
+  using simple_tags =
+      tmpl::list<Tags::StartupHistory<typename System::variables_tag>>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    static_assert(not Metavariables::local_time_stepping,
+                  "The Runge-Kutta startup procedure does not support local "
+                  "time stepping.  Use the SelfStart procedure instead.");
+    using history_type = typename Tags::StartupHistory<
+        typename System::variables_tag>::type;
+    ::Initialization::mutate_assign<simple_tags>(
+        make_not_null(&box),
+        history_type{detail::startup_stepper{}.order()});
+    return std::make_tuple(std::move(box));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// Advances time through the startup evaluations.
+///
+/// The substeps of the Runge-Kutta step are followed by the evaluation
+/// at the end of the step and then by the evaluations at the
+/// intermediate history times.  After the last evaluation the next
+/// time is set to the start time in slab zero.
+///
+/// Uses:
+/// - GlobalCache: nothing
+/// - DataBox:
+///   - Tags::TimeStep
+///   - Tags::TimeStepId
+///   - Tags::TimeStepper<>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - Tags::Next<Tags::TimeStepId>
+///   - Tags::Time
+///   - Tags::TimeStepId
+struct AdvanceTime {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {  // NOLINT const
+    db::mutate<::Tags::TimeStepId, ::Tags::Next<::Tags::TimeStepId>,
+               ::Tags::Time>(
+        make_not_null(&box),
+        [](const gsl::not_null<TimeStepId*> time_id,
+           const gsl::not_null<TimeStepId*> next_time_id,
+           const gsl::not_null<double*> time, const TimeDelta& time_step,
+           const TimeStepper& time_stepper) noexcept {
+          *time_id = *next_time_id;
+          const auto values_needed =
+              static_cast<int64_t>(time_stepper.number_of_past_steps());
+          const bool time_runs_forward = time_id->time_runs_forward();
+          const Time start = detail::startup_start(*time_id);
+          const TimeDelta startup_step = values_needed * time_step;
+
+          if (detail::is_runge_kutta_substep(*time_id, values_needed)) {
+            // Runge-Kutta substeps.  The step is followed by the
+            // evaluation at its end.
+            *next_time_id = detail::startup_stepper{}.next_time_id(
+                *time_id, startup_step);
+          } else {
+            const Time next_time =
+                time_id->slab_number() == -values_needed
+                    ? start + time_step
+                    : time_id->step_time() + time_step;
+            *next_time_id =
+                next_time == start + startup_step
+                    ? TimeStepId(time_runs_forward, 0, start)
+                    : TimeStepId(time_runs_forward, 1 - values_needed,
+                                 next_time);
+          }
+          *time = time_id->substep_time().value();
+        },
+        db::get<::Tags::TimeStep>(box), db::get<::Tags::TimeStepper<>>(box));
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// Records the variables and their time derivatives in the startup or
+/// main history, and jumps to the start of the procedure once all
+/// values have been generated.
+///
+/// Evaluations in the initial slab are part of the Runge-Kutta step
+/// and are recorded in the startup history.  The others are recorded
+/// in the main history.  After the last evaluation, the value at the
+/// end of the Runge-Kutta step is moved to the main history and the
+/// variables are reset to their initial values.
+///
+/// Uses:
+/// - GlobalCache: nothing
+/// - DataBox:
+///   - variables_tag
+///   - dt_variables_tag
+///   - Tags::Next<Tags::TimeStepId>
+///   - Tags::TimeStepId
+///   - Tags::TimeStepper<>
+///   - SelfStart::Tags::InitialValue<variables_tag>
+///   - SelfStart::Tags::InitialValue<primitive_variables_tag> if the system
+///     has primitives
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - Tags::HistoryEvolvedVariables<variables_tag>
+///   - RungeKuttaStart::Tags::StartupHistory<variables_tag>
+///   - variables_tag if all values have been generated
+///   - primitive_variables_tag if all values have been generated and the
+///     system has primitives
+template <typename RestartTag>
+struct RecordTimeStepperData {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&, bool, size_t> apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    using system = typename Metavariables::system;
+    using variables_tag = typename system::variables_tag;
+    using dt_variables_tag = db::add_tag_prefix<::Tags::dt, variables_tag>;
+    using history_tag = ::Tags::HistoryEvolvedVariables<variables_tag>;
+    using startup_history_tag = Tags::StartupHistory<variables_tag>;
+
+    constexpr size_t restart_index =
+        tmpl::index_of<ActionList, ::Actions::Label<RestartTag>>::value + 1;
+    constexpr size_t continue_index =
+        tmpl::index_of<ActionList, RecordTimeStepperData>::value + 1;
+
+    const bool done =
+        db::get<::Tags::Next<::Tags::TimeStepId>>(box).slab_number() == 0;
+
+    db::mutate<history_tag, startup_history_tag>(
+        make_not_null(&box),
+        [&done](const gsl::not_null<typename history_tag::type*> history,
+                const gsl::not_null<typename history_tag::type*>
+                    startup_history,
+                const TimeStepId& time_step_id,
+                const typename variables_tag::type& vars,
+                const typename dt_variables_tag::type& dt_vars,
+                const TimeStepper& time_stepper) noexcept {
+          if (time_step_id.slab_number() ==
+              -static_cast<int64_t>(time_stepper.number_of_past_steps())) {
+            startup_history->insert(time_step_id, vars, dt_vars);
+          } else {
+            history->insert(time_step_id, vars, dt_vars);
+          }
+          if (done) {
+            ASSERT(startup_history->size() ==
+                       detail::startup_stepper{}.number_of_substeps() + 1,
+                   "The startup history has " << startup_history->size()
+                   << " entries after the last startup evaluation.");
+            const auto end_of_step = startup_history->end() - 1;
+            history->insert(end_of_step.time_step_id(), end_of_step.value(),
+                            end_of_step.derivative());
+            history->integration_order(history->size() + 1);
+          }
+        },
+        db::get<::Tags::TimeStepId>(box), db::get<variables_tag>(box),
+        db::get<dt_variables_tag>(box), db::get<::Tags::TimeStepper<>>(box));
+
+    if (done) {
+      tmpl::for_each<SelfStart::Actions::detail::vars_to_save<system>>(
+          [&box](auto tag) noexcept {
+            using Tag = tmpl::type_from<decltype(tag)>;
+            db::mutate<Tag>(
+                make_not_null(&box),
+                [](const gsl::not_null<typename Tag::type*> value,
+                   const std::tuple<typename Tag::type>&
+                       initial_value) noexcept {
+                  *value = get<0>(initial_value);
+                },
+                db::get<SelfStart::Tags::InitialValue<Tag>>(box));
+          });
+    }
+
+    return {std::move(box), false, done ? restart_index : continue_index};
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// Sets the variables for the next startup evaluation.
+///
+/// During the Runge-Kutta step this takes a substep.  The last substep
+/// is not completed with `update_u`, which would discard the substep
+/// data needed for the dense output.  Instead, the variables at the end
+/// of the step and at all later evaluations are set from the dense
+/// output of the step.
+///
+/// Uses:
+/// - GlobalCache: nothing
+/// - DataBox:
+///   - Tags::Next<Tags::TimeStepId>
+///   - Tags::TimeStepId
+///   - Tags::TimeStep
+///   - Tags::TimeStepper<>
+///   - RungeKuttaStart::Tags::StartupHistory<variables_tag>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - variables_tag
+///   - RungeKuttaStart::Tags::StartupHistory<variables_tag>
+struct UpdateU {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {  // NOLINT const
+    using variables_tag = typename Metavariables::system::variables_tag;
+    using startup_history_tag = Tags::StartupHistory<variables_tag>;
+
+    db::mutate<variables_tag, startup_history_tag>(
+        make_not_null(&box),
+        [](const gsl::not_null<typename variables_tag::type*> vars,
+           const gsl::not_null<typename startup_history_tag::type*>
+               startup_history,
+           const TimeStepId& time_id, const TimeStepId& next_time_id,
+           const TimeDelta& time_step,
+           const TimeStepper& time_stepper) noexcept {
+          const detail::startup_stepper stepper{};
+          const auto values_needed =
+              static_cast<int64_t>(time_stepper.number_of_past_steps());
+          const bool is_runge_kutta_substep =
+              detail::is_runge_kutta_substep(time_id, values_needed);
+          if (is_runge_kutta_substep and
+              time_id.substep() + 1 < stepper.number_of_substeps()) {
+            stepper.update_u(vars, startup_history,
+                             values_needed * time_step);
+          } else {
+            // The substeps, followed by the evaluation at the end of
+            // the step once it has been recorded.
+            ASSERT(startup_history->size() ==
+                       stepper.number_of_substeps() +
+                           (is_runge_kutta_substep ? 0 : 1),
+                   "The startup history has " << startup_history->size()
+                   << " entries at " << time_id);
+            stepper.dense_update_u(vars, *startup_history,
+                                   next_time_id.substep_time().value());
+          }
+        },
+        db::get<::Tags::TimeStepId>(box),
+        db::get<::Tags::Next<::Tags::TimeStepId>>(box),
+        db::get<::Tags::TimeStep>(box), db::get<::Tags::TimeStepper<>>(box));
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// Removes the startup history.
+///
+/// Uses:
+/// - GlobalCache: nothing
+/// - DataBox: nothing
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies: RungeKuttaStart::Tags::StartupHistory<variables_tag>
+struct Cleanup {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    using startup_history_tag =
+        Tags::StartupHistory<typename Metavariables::system::variables_tag>;
+    // Reset to a default-constructed value to release the memory, as in
+    // SelfStart::Actions::Cleanup.
+    db::mutate<startup_history_tag>(
+        make_not_null(&box),
+        [](const gsl::not_null<typename startup_history_tag::type*>
+               startup_history) noexcept {
+          *startup_history = typename startup_history_tag::type{};
+        });
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
+
+namespace detail {
+struct PhaseStart;
+struct PhaseEnd;
+
+template <typename StepActions, typename System>
+struct start_procedure_impl {
+  using flat_actions = tmpl::flatten<tmpl::list<StepActions>>;
+  static_assert(
+      tmpl::list_contains_v<flat_actions, ::Actions::RecordTimeStepperData<>>,
+      "Runge-Kutta start action loop must call "
+      "Actions::RecordTimeStepperData to update the history.");
+  static_assert(tmpl::list_contains_v<flat_actions, ::Actions::UpdateU<>>,
+                "Runge-Kutta start action loop must call Actions::UpdateU to "
+                "update the variables.");
+  // clang-format off
+  using type = tmpl::flatten<tmpl::list<
+      SelfStart::Actions::Initialize<System>,
+      RungeKuttaStart::Actions::Initialize<System>,
+      ::Actions::Label<detail::PhaseStart>,
+      SelfStart::Actions::CheckForCompletion<detail::PhaseEnd>,
+      RungeKuttaStart::Actions::AdvanceTime,
+      tmpl::replace<
+          tmpl::replace<flat_actions, ::Actions::RecordTimeStepperData<>,
+                        RungeKuttaStart::Actions::RecordTimeStepperData<
+                            detail::PhaseStart>>,
+          ::Actions::UpdateU<>, RungeKuttaStart::Actions::UpdateU>,
+      ::Actions::Goto<detail::PhaseStart>,
+      ::Actions::Label<detail::PhaseEnd>,
+      SelfStart::Actions::Cleanup,
+      RungeKuttaStart::Actions::Cleanup,
+      ::Actions::AdvanceTime,
+      Parallel::Actions::TerminatePhase>>;
+  // clang-format on
+};
+}  // namespace detail
+
+/// \ingroup TimeGroup
+/// The list of actions required to start a multistep integrator using
+/// a Runge-Kutta step.
+///
+/// \tparam StepActions List of actions computing and recording the
+/// system derivative and updating the evolved variables (but not the
+/// time).
+///
+/// \see RungeKuttaStart
+template <typename StepActions, typename System>
+using start_procedure =
+    typename detail::start_procedure_impl<StepActions, System>::type;
+}  // namespace RungeKuttaStart
@@ -0,0 +1,141 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines action SolveImplicitSector
+
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/Tags.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace Tags {
+template <typename Tag>
+struct Next;
+}  // namespace Tags
+// IWYU pragma: no_forward_declare db::DataBox
+/// \endcond
+
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// \brief Complete the implicit stage of an ::ImexTimeStepper substep
+///
+/// Must be placed after `Actions::UpdateU` (which applies the explicit part
+/// of the substep) and before `Actions::AdvanceTime`.  The stiff terms must
+/// not be included in the time derivative computed by the system.
+///
+/// The system must provide a struct `implicit_sector` with a list of
+/// `argument_tags` and a static function
+/// \code
+/// static void apply(gsl::not_null<Vars*> u, gsl::not_null<SourceVars*> source,
+///                   double implicit_weight, double time,
+///                   const Args&... args) noexcept;
+/// \endcode
+/// where `Vars` is the type of `variables_tag` and `SourceVars` that of
+/// `db::add_tag_prefix<Tags::Source, variables_tag>`.  On entry `u` holds
+/// \f$u^*\f$; on exit it must hold the solution of
+/// \f$u = u^* + w S(t, u)\f$, with \f$w\f$ = `implicit_weight` and \f$t\f$ =
+/// `time`, and `source` must hold \f$S(t, u)\f$.  The equation is local to
+/// each grid point, so the solve can be done pointwise on whole `DataVector`s.
+///
+/// Uses:
+/// - DataBox:
+///   - variables_tag (either the provided `VariablesTag` or the
+///   `system::variables_tag` if none is provided)
+///   - Tags::ImplicitHistory<variables_tag>
+///   - Tags::Next<Tags::TimeStepId>
+///   - Tags::TimeStep
+///   - Tags::TimeStepId
+///   - Tags::TimeStepper<>
+///   - `system::implicit_sector::argument_tags`
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - variables_tag
+///   - Tags::ImplicitHistory<variables_tag>
+template <typename VariablesTag = NoSuchType>
+struct SolveImplicitSector {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {  // NOLINT const
+    using variables_tag =
+        tmpl::conditional_t<std::is_same_v<VariablesTag, NoSuchType>,
+                            typename Metavariables::system::variables_tag,
+                            VariablesTag>;
+    using implicit_sector = typename Metavariables::system::implicit_sector;
+    using history_tag = Tags::ImplicitHistory<variables_tag>;
+    using source_type = typename db::add_tag_prefix<::Tags::Source,
+                                                    variables_tag>::type;
+
+    const ImexTimeStepper& time_stepper = db::get<Tags::TimeStepper<>>(box);
+    const uint64_t substep = db::get<Tags::TimeStepId>(box).substep();
+    const double dt = db::get<Tags::TimeStep>(box).value();
+    // The implicit stage is at the time of the next substep.
+    const double time =
+        db::get<Tags::Next<Tags::TimeStepId>>(box).substep_time().value();
+
+    auto source = make_with_value<source_type>(db::get<variables_tag>(box), 0.);
+    db::mutate_apply<
+        tmpl::list<variables_tag>,
+        tmpl::push_front<typename implicit_sector::argument_tags, history_tag>>(
+        [&dt, &source, &substep, &time, &time_stepper](
+            const gsl::not_null<typename variables_tag::type*> vars,
+            const typename history_tag::type& implicit_history,
+            const auto&... args) noexcept {
+          ASSERT(implicit_history.size() == substep,
+                 "Expected the implicit sources of " << substep
+                 << " previous stages, but have " << implicit_history.size());
+          for (uint64_t i = 0; i < substep; ++i) {
+            *vars += (time_stepper.implicit_coefficient(substep, i) * dt) *
+                     implicit_history[i];
+          }
+          implicit_sector::apply(vars, make_not_null(&source),
+                                 time_stepper.implicit_weight(substep) * dt,
+                                 time, args...);
+        },
+        make_not_null(&box));
+
+    db::mutate<history_tag>(
+        make_not_null(&box),
+        [&source, &substep, &time_stepper](
+            const gsl::not_null<typename history_tag::type*>
+                implicit_history) noexcept {
+          // The source of the final stage is not needed by later stages.
+          if (substep + 1 == time_stepper.number_of_substeps()) {
+            implicit_history->clear();
+          } else {
+            implicit_history->push_back(std::move(source));
+          }
+        });
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
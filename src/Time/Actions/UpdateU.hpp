@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <optional>
 #include <tuple>
 #include <utility>  // IWYU pragma: keep // for std::move
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/StepperErrorTolerances.hpp"
 #include "Time/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -39,12 +41,21 @@ namespace Actions {
 ///   - Tags::TimeStep
 ///   - Tags::TimeStepper<>
 ///
+/// If `Tags::StepperError<variables_tag>` is in the DataBox, the time stepper
+/// error estimate is also computed whenever it is available and is measured
+/// with the `Tags::StepperErrorTolerances<variables_tag>`, for use by
+/// `StepChoosers::ErrorControl`.
+///
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
 /// - Modifies:
 ///   - variables_tag
 ///   - Tags::HistoryEvolvedVariables<variables_tag>
+///   - Tags::StepperError<variables_tag> (if present)
+///   - Tags::StepperErrorMeasure<variables_tag> (if present)
+///   - Tags::PreviousStepperError<variables_tag> (if present)
+///   - Tags::StepperErrorUpdated (if present)
 template <typename VariablesTag = NoSuchType>
 struct UpdateU {
   template <typename DbTags, typename... InboxTags, typename Metavariables,
@@ -61,14 +72,43 @@ struct UpdateU {
                             VariablesTag>;
     using history_tag = Tags::HistoryEvolvedVariables<variables_tag>;
 
-    db::mutate<variables_tag, history_tag>(
-        make_not_null(&box),
-        [](const gsl::not_null<typename variables_tag::type*> vars,
-           const gsl::not_null<typename history_tag::type*> history,
-           const ::TimeDelta& time_step, const auto& time_stepper) noexcept {
-          time_stepper.update_u(vars, history, time_step);
-        },
-        db::get<Tags::TimeStep>(box), db::get<Tags::TimeStepper<>>(box));
+    using error_tag = Tags::StepperError<variables_tag>;
+    using error_measure_tag = Tags::StepperErrorMeasure<variables_tag>;
+    using previous_error_tag = Tags::PreviousStepperError<variables_tag>;
+
+    if constexpr (db::tag_is_retrievable_v<error_tag, db::DataBox<DbTags>>) {
+      db::mutate<variables_tag, history_tag, error_tag, error_measure_tag,
+                 previous_error_tag, Tags::StepperErrorUpdated>(
+          make_not_null(&box),
+          [](const gsl::not_null<typename variables_tag::type*> vars,
+             const gsl::not_null<typename history_tag::type*> history,
+             const gsl::not_null<typename error_tag::type*> error,
+             const gsl::not_null<std::optional<double>*> error_measure,
+             const gsl::not_null<std::optional<double>*> previous_error,
+             const gsl::not_null<bool*> error_updated,
+             const ::TimeDelta& time_step, const auto& time_stepper,
+             const StepperErrorTolerances& tolerances) noexcept {
+            *error_updated =
+                time_stepper.update_u(vars, error, history, time_step);
+            if (*error_updated) {
+              // Only the measure of the previous estimate is needed, so the
+              // estimate itself is overwritten
+              *previous_error = *error_measure;
+              *error_measure = tolerances.error_measure(*error, *vars);
+            }
+          },
+          db::get<Tags::TimeStep>(box), db::get<Tags::TimeStepper<>>(box),
+          db::get<Tags::StepperErrorTolerances<variables_tag>>(box));
+    } else {
+      db::mutate<variables_tag, history_tag>(
+          make_not_null(&box),
+          [](const gsl::not_null<typename variables_tag::type*> vars,
+             const gsl::not_null<typename history_tag::type*> history,
+             const ::TimeDelta& time_step, const auto& time_stepper) noexcept {
+            time_stepper.update_u(vars, history, time_step);
+          },
+          db::get<Tags::TimeStep>(box), db::get<Tags::TimeStepper<>>(box));
+    }
 
     return std::forward_as_tuple(std::move(box));
   }
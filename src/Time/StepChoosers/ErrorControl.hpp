@@ -0,0 +1,192 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <pup.h>
+#include <utility>
+
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Time/StepChoosers/StepChooser.hpp"  // IWYU pragma: keep
+#include "Time/Tags.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Registration.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace StepChoosers {
+template <typename EvolvedVariableTag, typename StepChooserRegistrars>
+class ErrorControl;
+
+namespace Registrars {
+template <typename EvolvedVariableTag>
+struct ErrorControl {
+  template <typename StepChooserRegistrars>
+  using f = StepChoosers::ErrorControl<EvolvedVariableTag,
+                                       StepChooserRegistrars>;
+};
+}  // namespace Registrars
+
+/*!
+ * \brief Suggests a step size based on the time stepper's embedded error
+ * estimate.
+ *
+ * The error estimate \f$e\f$ computed by `Actions::UpdateU` (from the
+ * embedded lower-order solution of `TimeSteppers::DormandPrince5`,
+ * `TimeSteppers::RungeKutta3`, or `TimeSteppers::RungeKutta4`, or from the
+ * lower-order step of `TimeSteppers::AdamsBashforthN`) is measured in the
+ * weighted maximum norm
+ *
+ * \f{align}{
+ * E = \max_i \frac{|e_i|}{\epsilon_{abs} + \epsilon_{rel} |u_i|},
+ * \f}
+ *
+ * with the tolerances in `Tags::StepperErrorTolerances<EvolvedVariableTag>`
+ * (see `StepperErrorTolerances::error_measure`).  Only the measures of the
+ * current and the previous estimate are kept.  The step is chosen with the
+ * standard proportional-integral (PI) controller (e.g. Sec. IV.2 of
+ * \cite Hairer1996)
+ *
+ * \f{align}{
+ * h_{new} = h \, s \, E_n^{-\alpha} E_{n-1}^{\beta},
+ * \qquad \alpha = \frac{0.7}{q + 1}, \qquad \beta = \frac{0.4}{q + 1},
+ * \f}
+ *
+ * where \f$q\f$ is `TimeStepper::error_estimate_order()` and \f$s\f$ is the
+ * safety factor.  Until a previous estimate \f$E_{n-1}\f$ is available the
+ * controller falls back to the elementary controller with \f$\alpha = 1 / (q
+ * + 1)\f$ and \f$\beta = 0\f$.  The change in step size is limited to the
+ * range [`MinFactor`, `MaxFactor`].  The returned step is a suggested upper
+ * bound and is quantized by the `StepController` (e.g.
+ * `StepControllers::BinaryFraction`) like all other step choosers.
+ *
+ * This step chooser never rejects a step, because neither
+ * `Actions::ChangeStepSize` nor `Actions::ChangeSlabSize` can retake one.  A
+ * step with \f$E > 1\f$ is kept and the controller shrinks the following
+ * step instead, so choose the tolerances with this in mind.
+ *
+ * This step chooser requires `Tags::StepperError<EvolvedVariableTag>`,
+ * `Tags::StepperErrorMeasure<EvolvedVariableTag>`,
+ * `Tags::PreviousStepperError<EvolvedVariableTag>`,
+ * `Tags::StepperErrorTolerances<EvolvedVariableTag>`, and
+ * `Tags::StepperErrorUpdated` to be in the DataBox (the latter initialized to
+ * `false`).  Their presence causes `Actions::UpdateU` to compute and measure
+ * the error estimate and `Actions::AdvanceTime` to take any extra substeps
+ * the stepper needs for it.  On substeps where no new estimate is available
+ * no restriction is imposed.
+ */
+template <typename EvolvedVariableTag,
+          typename StepChooserRegistrars =
+              tmpl::list<Registrars::ErrorControl<EvolvedVariableTag>>>
+class ErrorControl : public StepChooser<StepChooserRegistrars> {
+ public:
+  /// \cond
+  ErrorControl() = default;
+  explicit ErrorControl(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ErrorControl);  // NOLINT
+  /// \endcond
+
+  struct MaxFactor {
+    using type = double;
+    static constexpr Options::String help{
+        "Maximum factor to increase the step by"};
+    static type lower_bound() noexcept { return 1.0; }
+  };
+
+  struct MinFactor {
+    using type = double;
+    static constexpr Options::String help{
+        "Minimum factor to decrease the step by"};
+    static type lower_bound() noexcept { return 0.0; }
+    static type upper_bound() noexcept { return 1.0; }
+  };
+
+  struct SafetyFactor {
+    using type = double;
+    static constexpr Options::String help{
+        "Multiplier for the computed step, to keep the error below the "
+        "tolerance"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+
+  static constexpr Options::String help{
+      "Chooses a step based on the time stepper's embedded error estimate, "
+      "using PI control."};
+  using options = tmpl::list<MaxFactor, MinFactor, SafetyFactor>;
+
+  ErrorControl(const double max_factor, const double min_factor,
+               const double safety_factor) noexcept
+      : max_factor_(max_factor),
+        min_factor_(min_factor),
+        safety_factor_(safety_factor) {}
+
+  using argument_tags =
+      tmpl::list<Tags::StepperErrorMeasure<EvolvedVariableTag>,
+                 Tags::PreviousStepperError<EvolvedVariableTag>,
+                 Tags::StepperErrorUpdated, Tags::TimeStepper<>>;
+
+  template <typename Metavariables>
+  std::pair<double, bool> operator()(
+      const std::optional<double>& error_measure,
+      const std::optional<double>& previous_error_measure,
+      const bool error_updated, const TimeStepper& time_stepper,
+      const double last_step_magnitude,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/) const noexcept {
+    if (not error_updated) {
+      return std::make_pair(std::numeric_limits<double>::infinity(), true);
+    }
+    ASSERT(error_measure.has_value(),
+           "The error estimate was updated but has not been measured.");
+
+    // Guard against a vanishing error, which would request an infinite step.
+    const double error =
+        std::max(*error_measure, std::numeric_limits<double>::min());
+    const double order_plus_one =
+        static_cast<double>(time_stepper.error_estimate_order() + 1);
+
+    double factor = 0.0;
+    if (previous_error_measure.has_value()) {
+      const double previous_error = std::max(
+          *previous_error_measure, std::numeric_limits<double>::min());
+      factor = safety_factor_ * std::pow(error, -0.7 / order_plus_one) *
+               std::pow(previous_error, 0.4 / order_plus_one);
+    } else {
+      factor = safety_factor_ * std::pow(error, -1.0 / order_plus_one);
+    }
+    factor = std::clamp(factor, min_factor_, max_factor_);
+    return std::make_pair(factor * last_step_magnitude, true);
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept override {
+    p | max_factor_;
+    p | min_factor_;
+    p | safety_factor_;
+  }
+
+ private:
+  double max_factor_ = std::numeric_limits<double>::signaling_NaN();
+  double min_factor_ = std::numeric_limits<double>::signaling_NaN();
+  double safety_factor_ = std::numeric_limits<double>::signaling_NaN();
+};
+
+/// \cond
+template <typename EvolvedVariableTag, typename StepChooserRegistrars>
+PUP::able::PUP_ID
+    ErrorControl<EvolvedVariableTag, StepChooserRegistrars>::my_PUP_ID =
+        0;  // NOLINT
+/// \endcond
+}  // namespace StepChoosers
@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/StepperErrorTolerances.hpp"
+
+#include <pup.h>
+
+StepperErrorTolerances::StepperErrorTolerances(
+    const double absolute_tolerance, const double relative_tolerance,
+    const Options::Context& context)
+    : absolute_tolerance_(absolute_tolerance),
+      relative_tolerance_(relative_tolerance) {
+  if (absolute_tolerance_ == 0.0 and relative_tolerance_ == 0.0) {
+    PARSE_ERROR(context, "At least one of the tolerances must be positive.");
+  }
+}
+
+void StepperErrorTolerances::pup(PUP::er& p) noexcept {
+  p | absolute_tolerance_;
+  p | relative_tolerance_;
+}
+
+bool operator==(const StepperErrorTolerances& lhs,
+                const StepperErrorTolerances& rhs) noexcept {
+  return lhs.absolute_tolerance() == rhs.absolute_tolerance() and
+         lhs.relative_tolerance() == rhs.relative_tolerance();
+}
+
+bool operator!=(const StepperErrorTolerances& lhs,
+                const StepperErrorTolerances& rhs) noexcept {
+  return not(lhs == rhs);
+}
@@ -0,0 +1,91 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "Options/Options.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+/// \ingroup TimeGroup
+/// \brief Tolerances used to measure the time stepper's embedded error
+/// estimate.
+///
+/// \see Tags::StepperErrorTolerances
+class StepperErrorTolerances {
+ public:
+  struct AbsoluteTolerance {
+    using type = double;
+    static constexpr Options::String help{"Target absolute tolerance"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+
+  struct RelativeTolerance {
+    using type = double;
+    static constexpr Options::String help{"Target relative tolerance"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+
+  using options = tmpl::list<AbsoluteTolerance, RelativeTolerance>;
+  static constexpr Options::String help{
+      "Tolerances for the time stepper's embedded error estimate"};
+
+  StepperErrorTolerances() = default;
+  StepperErrorTolerances(double absolute_tolerance, double relative_tolerance,
+                         const Options::Context& context = {});
+
+  double absolute_tolerance() const noexcept { return absolute_tolerance_; }
+  double relative_tolerance() const noexcept { return relative_tolerance_; }
+
+  /// The weighted maximum norm
+  /// \f$\max_i |e_i| / (\epsilon_{abs} + \epsilon_{rel} |u_i|)\f$ of the
+  /// error estimate `error` of the `values`, for any contiguous container of
+  /// doubles (e.g. `DataVector` or `Variables`). The step meets the tolerances
+  /// if the result is at most 1.
+  template <typename T>
+  double error_measure(const T& error, const T& values) const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  double absolute_tolerance_ = std::numeric_limits<double>::signaling_NaN();
+  double relative_tolerance_ = std::numeric_limits<double>::signaling_NaN();
+};
+
+bool operator==(const StepperErrorTolerances& lhs,
+                const StepperErrorTolerances& rhs) noexcept;
+bool operator!=(const StepperErrorTolerances& lhs,
+                const StepperErrorTolerances& rhs) noexcept;
+
+template <typename T>
+double StepperErrorTolerances::error_measure(const T& error,
+                                             const T& values) const noexcept {
+  ASSERT(error.size() == values.size(),
+         "The error estimate has " << error.size()
+                                   << " entries, but the variables have "
+                                   << values.size());
+  double result = 0.0;
+  const double* const error_data = error.data();
+  const double* const value_data = values.data();
+  for (size_t i = 0; i < error.size(); ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const double scale = absolute_tolerance_ +
+                         // NOLINTNEXTLINE
+                         relative_tolerance_ * std::abs(value_data[i]);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    result = std::max(result, std::abs(error_data[i]) / scale);
+  }
+  return result;
+}
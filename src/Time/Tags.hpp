@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "Time/History.hpp"
 #include "Time/StepChoosers/StepChooser.hpp"        // IWYU pragma: keep
 #include "Time/StepControllers/StepController.hpp"  // IWYU pragma: keep
+#include "Time/StepperErrorTolerances.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/TMPL.hpp"
@@ -103,6 +105,70 @@ struct HistoryEvolvedVariables : HistoryEvolvedVariables<>, db::SimpleTag {
 };
 /// \endcond
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief Tag for the implicit sources of the completed implicit stages of
+/// the current step of an ::ImexTimeStepper
+///
+/// \see Actions::SolveImplicitSector
+template <typename Tag>
+struct ImplicitHistory : db::PrefixTag, db::SimpleTag {
+  using type =
+      std::vector<typename db::add_tag_prefix<::Tags::Source, Tag>::type>;
+  using tag = Tag;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief Tag for the embedded error estimate of the most recent step
+///
+/// When this tag is present in the DataBox, `Actions::UpdateU` computes the
+/// time stepper error estimate alongside the update whenever the stepper can
+/// provide one.  The estimate is the difference between the solution and the
+/// lower-order embedded solution.  `Actions::UpdateU` also measures the
+/// estimate with the `Tags::StepperErrorTolerances<Tag>`, see
+/// `Tags::StepperErrorMeasure<Tag>`.
+///
+/// \see StepperErrorUpdated
+template <typename Tag>
+struct StepperError : db::PrefixTag, db::SimpleTag {
+  using type = typename Tag::type;
+  using tag = Tag;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief Tag for the measure `StepperErrorTolerances::error_measure` of the
+/// error estimate in `Tags::StepperError<Tag>`
+///
+/// Holds no value until the first error estimate has been computed.
+template <typename Tag>
+struct StepperErrorMeasure : db::PrefixTag, db::SimpleTag {
+  using type = std::optional<double>;
+  using tag = Tag;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief Tag for the measure of the error estimate preceding the one in
+/// `Tags::StepperError<Tag>`, used for PI step size control.
+///
+/// Only the measure of the previous estimate is kept, not the estimate
+/// itself.  Holds no value until two error estimates have been computed.
+template <typename Tag>
+struct PreviousStepperError : db::PrefixTag, db::SimpleTag {
+  using type = std::optional<double>;
+  using tag = Tag;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief Tag indicating whether the stepper error was updated during the
+/// most recent substep
+struct StepperErrorUpdated : db::SimpleTag {
+  using type = bool;
+};
+
 /// \ingroup DataBoxTagsGroup
 /// \ingroup TimeGroup
 /// Tag for TimeStepper boundary history
@@ -144,6 +210,16 @@ struct StepController {
   using group = evolution::OptionTags::Group;
 };
 
+/// \ingroup OptionTagsGroup
+/// \ingroup TimeGroup
+/// \brief The tolerances for the time stepper's embedded error estimate
+struct StepperErrorTolerances {
+  static constexpr Options::String help{
+      "Tolerances for the time stepper's embedded error estimate"};
+  using type = ::StepperErrorTolerances;
+  using group = evolution::OptionTags::Group;
+};
+
 /// \ingroup OptionTagsGroup
 /// \ingroup TimeGroup
 /// \brief The time at which to start the simulation
@@ -230,4 +306,21 @@ struct StepController : db::SimpleTag {
     return deserialize<type>(serialize<type>(step_controller).data());
   }
 };
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief Tag for the tolerances used to measure the error estimate in
+/// `Tags::StepperError<Tag>`
+template <typename Tag>
+struct StepperErrorTolerances : db::PrefixTag, db::SimpleTag {
+  using type = ::StepperErrorTolerances;
+  using tag = Tag;
+  using option_tags = tmpl::list<::OptionTags::StepperErrorTolerances>;
+
+  static constexpr bool pass_metavariables = false;
+  static ::StepperErrorTolerances create_from_options(
+      const ::StepperErrorTolerances& tolerances) noexcept {
+    return tolerances;
+  }
+};
 }  // namespace Tags
@@ -0,0 +1,85 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/Ars222.hpp"
+
+#include "Time/TimeStepId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace TimeSteppers {
+namespace {
+// Best rational approximation to gamma = 1 - 1/sqrt(2) with a small
+// denominator, used for the time of the intermediate substep.
+const Time::rational_t substep_fraction{5741, 19601};
+}  // namespace
+
+size_t Ars222::order() const noexcept { return 2; }
+
+size_t Ars222::error_estimate_order() const noexcept {
+  ERROR("Ars222 does not provide an error estimate, so it cannot be used "
+        "with step size error control.");
+}
+
+uint64_t Ars222::number_of_substeps() const noexcept { return 2; }
+
+uint64_t Ars222::number_of_substeps_for_error() const noexcept { return 2; }
+
+size_t Ars222::number_of_past_steps() const noexcept { return 0; }
+
+// The explicit part has the stability polynomial 1 + z + z^2 / 2 of all
+// two-stage second-order Runge-Kutta methods, which has the same extent on
+// the negative real axis as forward Euler.
+double Ars222::stable_step() const noexcept { return 1.0; }
+
+TimeStepId Ars222::next_time_id(const TimeStepId& current_id,
+                                const TimeDelta& time_step) const noexcept {
+  switch (current_id.substep()) {
+    case 0:
+      ASSERT(current_id.substep_time() == current_id.step_time(),
+             "In Ars222 substep 0, the substep time ("
+                 << current_id.substep_time() << ") should equal t0 ("
+                 << current_id.step_time() << ")");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 1,
+              current_id.step_time() + substep_fraction * time_step};
+    case 1:
+      ASSERT(current_id.substep_time() ==
+                 current_id.step_time() + substep_fraction * time_step,
+             "In Ars222 substep 1, the substep time ("
+                 << current_id.substep_time() << ") should equal t0+gamma*dt ("
+                 << current_id.step_time() + substep_fraction * time_step
+                 << ")");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time() + time_step};
+    default:
+      ERROR("In Ars222 substep should be one of 0,1, not "
+            << current_id.substep());
+  }
+}
+
+TimeStepId Ars222::next_time_id_for_error(
+    const TimeStepId& current_id, const TimeDelta& time_step) const noexcept {
+  return next_time_id(current_id, time_step);
+}
+
+double Ars222::implicit_weight(const uint64_t substep) const noexcept {
+  ASSERT(substep < 2,
+         "In Ars222 substep should be one of 0,1, not " << substep);
+  return gamma_;
+}
+
+double Ars222::implicit_coefficient(
+    const uint64_t substep, const uint64_t source_substep) const noexcept {
+  ASSERT(substep == 1 and source_substep == 0,
+         "Ars222 only couples the implicit stage of substep 1 to that of "
+         "substep 0, not substep "
+             << substep << " to substep " << source_substep);
+  return 1.0 - gamma_;
+}
+}  // namespace TimeSteppers
+
+/// \cond
+PUP::able::PUP_ID TimeSteppers::Ars222::my_PUP_ID =  // NOLINT
+    0;
+/// \endcond
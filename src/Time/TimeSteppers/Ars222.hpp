@@ -0,0 +1,183 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class Ars222.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <pup.h>
+
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"  // IWYU pragma: keep
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+struct TimeStepId;
+namespace TimeSteppers {
+template <typename Vars, typename DerivVars>
+class History;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+
+/*!
+ * \ingroup TimeSteppersGroup
+ *
+ * The second-order implicit-explicit Runge-Kutta method ARS(2,2,2) of
+ * \cite Ascher1997.
+ *
+ * For \f$du/dt = E(t, u) + S(t, u)\f$ with stiff \f$S\f$, a step is
+ *
+ * \f{align}{
+ * U_1 &= u^n, \\
+ * U_2 &= u^n + \gamma \Delta t E(U_1) + \gamma \Delta t S(U_2), \\
+ * u^{n+1} = U_3 &= u^n + \Delta t \left[\delta E(U_1) + (1 - \delta) E(U_2)
+ *   \right] + \Delta t \left[(1 - \gamma) S(U_2) + \gamma S(U_3)\right],
+ * \f}
+ *
+ * with \f$\gamma = 1 - 1/\sqrt{2}\f$ and \f$\delta = 1 - 1/(2\gamma)\f$.
+ * The implicit part is L-stable and the method is stiffly accurate, so stiff
+ * relaxation terms are damped at any step size.  With \f$S = 0\f$ it reduces
+ * to a second-order explicit Runge-Kutta method.
+ *
+ * The explicit part is applied through `update_u`; the implicit terms are
+ * applied by `Actions::SolveImplicitSector` using the coefficients provided
+ * through the ImexTimeStepper interface.
+ *
+ * \note The substep time of \f$U_2\f$ is represented by the rational
+ * approximation \f$5741/19601\f$ to \f$\gamma\f$ (relative error
+ * \f$\sim 10^{-9}\f$), because substep times must be exact fractions of the
+ * slab.  This only affects the time passed to time-dependent terms.
+ */
+class Ars222 : public ImexTimeStepper {
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "The second-order implicit-explicit Runge-Kutta method ARS(2,2,2)."};
+
+  Ars222() = default;
+  Ars222(const Ars222&) noexcept = default;
+  Ars222& operator=(const Ars222&) noexcept = default;
+  Ars222(Ars222&&) noexcept = default;
+  Ars222& operator=(Ars222&&) noexcept = default;
+  ~Ars222() noexcept override = default;
+
+  template <typename Vars, typename DerivVars>
+  void update_u(gsl::not_null<Vars*> u,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept;
+
+  /// No error estimate is available, so this always returns `false`.
+  template <typename Vars, typename ErrVars, typename DerivVars>
+  bool update_u(gsl::not_null<Vars*> u, gsl::not_null<ErrVars*> /*u_error*/,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept {
+    update_u(u, history, time_step);
+    return false;
+  }
+
+  template <typename Vars, typename DerivVars>
+  void dense_update_u(gsl::not_null<Vars*> /*u*/,
+                      const History<Vars, DerivVars>& /*history*/,
+                      double /*time*/) const noexcept {
+    ERROR(
+        "Dense output is not supported by Ars222 because the final value "
+        "requires an implicit solve.");
+  }
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(
+      const TimeStepId& time_id,
+      const TimeSteppers::History<Vars, DerivVars>& /*history*/) const
+      noexcept {
+    return time_id.substep() == 0;
+  }
+
+  size_t order() const noexcept override;
+
+  /// No embedded error estimate is available, so this is an error.
+  size_t error_estimate_order() const noexcept override;
+
+  uint64_t number_of_substeps() const noexcept override;
+
+  uint64_t number_of_substeps_for_error() const noexcept override;
+
+  size_t number_of_past_steps() const noexcept override;
+
+  double stable_step() const noexcept override;
+
+  TimeStepId next_time_id(const TimeStepId& current_id,
+                          const TimeDelta& time_step) const noexcept override;
+
+  TimeStepId next_time_id_for_error(
+      const TimeStepId& current_id,
+      const TimeDelta& time_step) const noexcept override;
+
+  double implicit_weight(uint64_t substep) const noexcept override;
+
+  double implicit_coefficient(uint64_t substep,
+                              uint64_t source_substep) const noexcept override;
+
+  WRAPPED_PUPable_decl_template(Ars222);  // NOLINT
+
+  explicit Ars222(CkMigrateMessage* /*unused*/) noexcept {}
+
+  // clang-tidy: do not pass by non-const reference
+  void pup(PUP::er& p) noexcept override {  // NOLINT
+    ImexTimeStepper::pup(p);
+  }
+
+ private:
+  // gamma = 1 - 1/sqrt(2) and delta = 1 - 1/(2 gamma) = -1/sqrt(2)
+  static constexpr double gamma_ = 0.29289321881345247560;
+  static constexpr double delta_ = -0.70710678118654752440;
+};
+
+inline bool constexpr operator==(const Ars222& /*lhs*/,
+                                 const Ars222& /*rhs*/) noexcept {
+  return true;
+}
+
+inline bool constexpr operator!=(const Ars222& /*lhs*/,
+                                 const Ars222& /*rhs*/) noexcept {
+  return false;
+}
+
+template <typename Vars, typename DerivVars>
+void Ars222::update_u(const gsl::not_null<Vars*> u,
+                      const gsl::not_null<History<Vars, DerivVars>*> history,
+                      const TimeDelta& time_step) const noexcept {
+  ASSERT(history->integration_order() == 2,
+         "Fixed-order stepper cannot run at order "
+             << history->integration_order());
+  const size_t substep = history->size() - 1;
+  const auto& u0 = history->begin().value();
+  const double dt = time_step.value();
+
+  switch (substep) {
+    case 0:
+      *u = u0 + (gamma_ * dt) * history->begin().derivative();
+      break;
+    case 1:
+      *u = u0 + (delta_ * dt) * history->begin().derivative() +
+           ((1.0 - delta_) * dt) * (history->begin() + 1).derivative();
+      break;
+    default:
+      ERROR("Substep in Ars222 should be one of 0,1, not " << substep);
+  }
+
+  // Clean up old history
+  if (history->size() == number_of_substeps()) {
+    history->mark_unneeded(history->end());
+  }
+}
+}  // namespace TimeSteppers
@@ -54,6 +54,11 @@ namespace TimeSteppers {
  * Here the coefficients \f$a_{ij}\f$, \f$b_i\f$, and \f$c_i\f$ are given
  * in e.g. Sec. 7.2 of \cite NumericalRecipes. Note that \f$c_1 = 0\f$.
  *
+ * Dense output requires \f$\mathcal{L}(t^{n+1}, u^{n+1})\f$.  If the
+ * history contains an entry at the end of the step following the six
+ * substeps, its derivative is used.  Otherwise the derivative is
+ * approximated by that at the last substep, which lowers the accuracy of
+ * the interpolation.
  */
 class DormandPrince5 : public TimeStepper::Inherit {
  public:
@@ -261,12 +266,13 @@ template <typename Vars, typename DerivVars>
 void DormandPrince5::dense_update_u(const gsl::not_null<Vars*> u,
                                     const History<Vars, DerivVars>& history,
                                     const double time) const noexcept {
-  ASSERT(history.size() == number_of_substeps(),
+  ASSERT(history.size() == number_of_substeps() or
+             history.size() == number_of_substeps() + 1,
          "DP5 can only dense output on last substep ("
              << number_of_substeps() - 1 << "), not substep "
              << history.size() - 1);
   const double t0 = history[0].value();
-  const double t_end = history[history.size() - 1].value();
+  const double t_end = history[number_of_substeps() - 1].value();
   // The history does not contain the final step; specifically,
   // step_end = t0 + c[4] * dt, so dt = (t_end - t0) / c[4]. But since
   // c[4] = 1.0 for DP5, we don't need to divide by c[4] here.
@@ -294,6 +300,13 @@ void DormandPrince5::dense_update_u(const gsl::not_null<Vars*> u,
   const auto& l4 = (history.begin() + 3).derivative();
   const auto& l5 = (history.begin() + 4).derivative();
   const auto& l6 = (history.begin() + 5).derivative();
+  // If the derivative at the end of the step, L(t+dt, u1), has been
+  // recorded, it is the extra entry in the history.  Otherwise,
+  // approximate it by l6, which reduces the accuracy of the
+  // interpolation.
+  const auto& l7 = history.size() > number_of_substeps()
+                       ? (history.begin() + 6).derivative()
+                       : l6;
 
   // Compute the updating coefficents, called rcontN in Numerical recipes,
   // that will be reused, so I don't have to compute them more than once.
@@ -301,15 +314,14 @@ void DormandPrince5::dense_update_u(const gsl::not_null<Vars*> u,
   const Vars rcont3 = dt * l1 - rcont2;
 
   // The formula for dense output is given in Numerical Recipes Sec. 17.2.3.
-  // Note: L(t+dt, u1) after the step is unavailable in the history; so here,
-  // approximate L(t+dt, u1) by l6.
   *u = u0 + output_fraction *
                 (rcont2 +
                  (1.0 - output_fraction) *
                      (rcont3 + output_fraction *
-                                   ((rcont2 - dt * l6 - rcont3) +
+                                   ((rcont2 - dt * l7 - rcont3) +
                                     ((1.0 - output_fraction) * dt) *
                                         (d_[0] * l1 + d_[1] * l3 + d_[2] * l4 +
-                                         d_[3] * l5 + (d_[4] + d_[5]) * l6))));
+                                         d_[3] * l5 + d_[4] * l6 +
+                                         d_[5] * l7))));
 }
 }  // namespace TimeSteppers
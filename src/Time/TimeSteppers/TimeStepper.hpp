@@ -30,6 +30,7 @@ class History;
 /// Holds classes that take time steps.
 namespace TimeSteppers {
 class AdamsBashforthN;  // IWYU pragma: keep
+class Ars222;  // IWYU pragma: keep
 class DormandPrince5;
 class RungeKutta3;  // IWYU pragma: keep
 class RungeKutta4;
@@ -50,8 +51,9 @@ class TimeStepper : public PUP::able {
       TimeStepper_detail::FakeVirtualInherit_dense_update_u<
           TimeStepper_detail::FakeVirtualInherit_update_u<TimeStepper>>>;
   using creatable_classes =
-      tmpl::list<TimeSteppers::AdamsBashforthN, TimeSteppers::DormandPrince5,
-                 TimeSteppers::RungeKutta3, TimeSteppers::RungeKutta4>;
+      tmpl::list<TimeSteppers::AdamsBashforthN, TimeSteppers::Ars222,
+                 TimeSteppers::DormandPrince5, TimeSteppers::RungeKutta3,
+                 TimeSteppers::RungeKutta4>;
 
   WRAPPED_PUPable_abstract(TimeStepper);  // NOLINT
 
@@ -243,7 +245,91 @@ class LtsTimeStepper : public TimeStepper::Inherit {
 };
 
 
+// ImexTimeStepper cannot be split out into its own file for the same
+// reason as LtsTimeStepper.
+
+/// \ingroup TimeSteppersGroup
+///
+/// Base class for implicit-explicit (IMEX) TimeSteppers, derived from
+/// TimeStepper.
+///
+/// The evolution equations are split as \f$du/dt = E(t, u) + S(t, u)\f$,
+/// where the stiff part \f$S\f$ is treated implicitly.  The explicit part
+/// is integrated through the usual TimeStepper interface, with the history
+/// holding only \f$E\f$.  After the explicit update of substep \f$k\f$,
+/// the implicit stage is completed by adding
+///
+/// \f{align}{
+/// \Delta t \sum_{j < k} \tilde{a}_{kj} S_j
+/// \f}
+///
+/// to the variables, where \f$\tilde{a}_{kj}\f$ is
+/// `implicit_coefficient(k, j)` and \f$S_j\f$ is the implicit source of the
+/// stage following substep \f$j\f$, and then solving
+///
+/// \f{align}{
+/// u = u^{*} + w S(u)
+/// \f}
+///
+/// with \f$w = \Delta t\f$ `implicit_weight(k)`.  The implicit stage
+/// following substep \f$k\f$ is always at the time of the next substep.  See
+/// `Actions::SolveImplicitSector`.
+class ImexTimeStepper : public TimeStepper::Inherit {
+ public:
+  // When you add a class here, remember to add it to TimeStepper as well.
+  using creatable_classes = tmpl::list<TimeSteppers::Ars222>;
+
+  WRAPPED_PUPable_abstract(ImexTimeStepper);  // NOLINT
+
+  /// The diagonal coefficient of the implicit stage following substep
+  /// `substep`, i.e., the weight of the unknown source in the implicit
+  /// equation in units of the step size.
+  virtual double implicit_weight(uint64_t substep) const noexcept = 0;
+
+  /// The coefficient of the source from the implicit stage following
+  /// substep `source_substep` in the implicit stage following substep
+  /// `substep`, in units of the step size.  Only called with
+  /// `source_substep < substep`.
+  virtual double implicit_coefficient(uint64_t substep,
+                                      uint64_t source_substep) const
+      noexcept = 0;
+
+  /// \cond
+  // See the comment in LtsTimeStepper.
+  template <typename Vars, typename DerivVars>
+  void update_u(
+      const gsl::not_null<Vars*> u,
+      const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*> history,
+      const TimeDelta& time_step) const noexcept {
+    return TimeStepper::update_u(u, history, time_step);
+  }
+
+  template <typename Vars, typename ErrVars, typename DerivVars>
+  bool update_u(
+      const gsl::not_null<Vars*> u, const gsl::not_null<ErrVars*> u_error,
+      const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*> history,
+      const TimeDelta& time_step) const noexcept {
+    return TimeStepper::update_u(u, u_error, history, time_step);
+  }
+
+  template <typename Vars, typename DerivVars>
+  void dense_update_u(const gsl::not_null<Vars*> u,
+                      const TimeSteppers::History<Vars, DerivVars>& history,
+                      const double time) const noexcept {
+    return TimeStepper::dense_update_u(u, history, time);
+  }
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(
+      const TimeStepId& time_id,
+      const TimeSteppers::History<Vars, DerivVars>& history) const noexcept {
+    return TimeStepper::can_change_step_size(time_id, history);
+  }
+  /// \endcond
+};
+
 #include "Time/TimeSteppers/AdamsBashforthN.hpp"  // IWYU pragma: keep
+#include "Time/TimeSteppers/Ars222.hpp"  // IWYU pragma: keep
 #include "Time/TimeSteppers/DormandPrince5.hpp"
 #include "Time/TimeSteppers/RungeKutta3.hpp"  // IWYU pragma: keep
 #include "Time/TimeSteppers/RungeKutta4.hpp"  // IWYU pragma: keep
@@ -182,7 +182,7 @@ struct mock_interpolation_target {
 template <typename Metavariables>
 struct mock_interpolator {
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockGroupChare;
+  using chare_type = ActionTesting::MockNodeGroupChare;
   using array_index = size_t;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       typename Metavariables::Phase, Metavariables::Phase::Initialization,
@@ -265,11 +265,11 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
 
   ActionTesting::set_phase(make_not_null(&runner),
                            metavars::Phase::Initialization);
-  ActionTesting::emplace_group_component<interp_component>(&runner);
+  ActionTesting::emplace_nodegroup_component<interp_component>(&runner);
   for (size_t i = 0; i < 2; ++i) {
-    for (size_t indx = 0; indx < 5; ++indx) {
+    for (size_t node = 0; node < 2; ++node) {
       ActionTesting::next_action<interp_component>(make_not_null(&runner),
-                                                   indx);
+                                                   node);
     }
   }
   ActionTesting::emplace_singleton_component<target_component>(
@@ -302,19 +302,19 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
   // each one.  Normally intrp::Actions::RegisterElement is called by
   // RegisterElementWithInterpolator, and invoked on the ckLocalBranch
   // of the interpolator that is associated with each element
-  // (i.e. the local core on each element).
-  // Here we assign elements round-robin to the mock cores.
-  // And for group components, the array_index is the global core index.
-  const size_t num_cores = runner.num_global_cores();
-  std::unordered_map<ElementId<3>, size_t> mock_core_for_each_element;
-  size_t core = 0;
+  // (i.e. the local node of each element).
+  // Here we assign elements round-robin to the mock nodes.
+  // And for nodegroup components, the array_index is the node index.
+  const size_t num_nodes = runner.num_nodes();
+  std::unordered_map<ElementId<3>, size_t> mock_node_for_each_element;
+  size_t node = 0;
   for (const auto& element_id : element_ids) {
-    mock_core_for_each_element.insert({element_id, core});
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::RegisterElement>(
-        make_not_null(&runner), core);
-    if (++core >= num_cores) {
-      core = 0;
+    mock_node_for_each_element.insert({element_id, node});
+    ActionTesting::threaded_action<interp_component,
+                                   intrp::Actions::RegisterElement>(
+        make_not_null(&runner), node);
+    if (++node >= num_nodes) {
+      node = 0;
     }
   }
   ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
@@ -378,13 +378,13 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
                 output_vars));
 
     // Call the InterpolatorReceiveVolumeData action on each element_id.
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::InterpolatorReceiveVolumeData>(
-        make_not_null(&runner), mock_core_for_each_element.at(element_id),
+    ActionTesting::threaded_action<
+        interp_component, intrp::Actions::InterpolatorReceiveVolumeData>(
+        make_not_null(&runner), mock_node_for_each_element.at(element_id),
         first_temporal_id, element_id, mesh, output_vars);
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::InterpolatorReceiveVolumeData>(
-        make_not_null(&runner), mock_core_for_each_element.at(element_id),
+    ActionTesting::threaded_action<
+        interp_component, intrp::Actions::InterpolatorReceiveVolumeData>(
+        make_not_null(&runner), mock_node_for_each_element.at(element_id),
         second_temporal_id, element_id, mesh, std::move(output_vars));
   }
 
@@ -5,15 +5,18 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdio>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <pup.h>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataBox/ComputeItemPacking.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/DataOnSlice.hpp"
@@ -29,6 +32,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Parallel/Serialize.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
@@ -1233,6 +1237,96 @@ void test_variables_extra_reset() noexcept {
   CHECK(db::get<ExtraResetTags::CheckReset>(box) == 0);
 }
 
+namespace DependentsTags {
+struct A;
+struct B;
+struct C;
+struct D;
+struct E;
+// A diamond A -> {B, C} -> D followed by D -> E
+using edges = tmpl::list<tmpl::edge<A, B>, tmpl::edge<A, C>, tmpl::edge<B, D>,
+                         tmpl::edge<C, D>, tmpl::edge<D, E>>;
+static_assert(std::is_same_v<db::detail::all_dependents<edges, tmpl::list<A>>,
+                             tmpl::list<B, C, D, E>>);
+static_assert(
+    std::is_same_v<db::detail::all_dependents<edges, tmpl::list<B, C>>,
+                   tmpl::list<D, E>>);
+static_assert(
+    std::is_same_v<db::detail::all_dependents<edges, tmpl::list<A, D>>,
+                   tmpl::list<B, C, E, D>>);
+static_assert(std::is_same_v<db::detail::all_dependents<edges, tmpl::list<E>>,
+                             tmpl::list<>>);
+
+struct Input0 : db::SimpleTag {
+  using type = double;
+};
+struct Input1 : db::SimpleTag {
+  using type = double;
+};
+template <size_t Id>
+struct Sum : db::SimpleTag {
+  using type = double;
+};
+template <size_t Id, typename... ArgumentTags>
+struct SumCompute : Sum<Id>, db::ComputeTag {
+  using base = Sum<Id>;
+  using return_type = double;
+  static void function(const gsl::not_null<double*> result,
+                       const typename ArgumentTags::type&... args) noexcept {
+    ++count;
+    *result = (0.0 + ... + args);
+  }
+  using argument_tags = tmpl::list<ArgumentTags...>;
+  static size_t count;
+};
+template <size_t Id, typename... ArgumentTags>
+size_t SumCompute<Id, ArgumentTags...>::count = 0;
+}  // namespace DependentsTags
+
+void test_mutate_resets_all_dependents() noexcept {
+  INFO("test mutate resets all dependents");
+  using DependentsTags::Input0;
+  using DependentsTags::Input1;
+  using DependentsTags::Sum;
+  using Sum0Compute = DependentsTags::SumCompute<0, Input0>;
+  using Sum1Compute = DependentsTags::SumCompute<1, Input0, Input1>;
+  using Sum2Compute = DependentsTags::SumCompute<2, Sum<0>, Sum<1>>;
+  using Sum3Compute = DependentsTags::SumCompute<3, Sum<2>, Input1>;
+  auto box = db::create<
+      db::AddSimpleTags<Input0, Input1>,
+      db::AddComputeTags<Sum0Compute, Sum1Compute, Sum2Compute, Sum3Compute>>(
+      1.0, 2.0);
+  CHECK(db::get<Sum<3>>(box) == 6.0);
+  CHECK(Sum0Compute::count == 1);
+  CHECK(Sum1Compute::count == 1);
+  CHECK(Sum2Compute::count == 1);
+  CHECK(Sum3Compute::count == 1);
+
+  db::mutate<Input1>(make_not_null(&box),
+                     [](const gsl::not_null<double*> input1) noexcept {
+                       *input1 = 3.0;
+                     });
+  CHECK(db::get<Sum<3>>(box) == 8.0);
+  CHECK(Sum0Compute::count == 1);
+  CHECK(Sum1Compute::count == 2);
+  CHECK(Sum2Compute::count == 2);
+  CHECK(Sum3Compute::count == 2);
+
+  db::mutate<Input0, Input1>(
+      make_not_null(&box),
+      [](const gsl::not_null<double*> input0,
+         const gsl::not_null<double*> input1) noexcept {
+        *input0 = 2.0;
+        *input1 = 1.0;
+      });
+  CHECK(db::get<Sum<2>>(box) == 5.0);
+  CHECK(db::get<Sum<3>>(box) == 6.0);
+  CHECK(Sum0Compute::count == 2);
+  CHECK(Sum1Compute::count == 3);
+  CHECK(Sum2Compute::count == 3);
+  CHECK(Sum3Compute::count == 3);
+}
+
 /// [mutate_apply_struct_definition_example]
 struct TestDataboxMutateApply {
   // delete copy semantics just to make sure it works. Not necessary in general.
@@ -2587,6 +2681,67 @@ void serialization_subitem_compute_items() noexcept {  // NOLINT
   ParentCompute<3>::count = 0;
 }
 
+void serialization_compute_items_without_values() noexcept {
+  INFO("serialization without the values of compute items");
+  CountingFunc<0>::count = 0;
+  auto box = db::create<
+      db::AddSimpleTags<test_databox_tags::Tag0>,
+      db::AddComputeTags<CountingTagCompute<0>,
+                         test_databox_tags::Tag4Compute>>(3.14);
+  CHECK(db::get<CountingTag<0>>(box) == 8.2);
+  CHECK(db::get<test_databox_tags::Tag4>(box) == 6.28);
+  CHECK(CountingFunc<0>::count == 1);
+
+  const auto write_and_read_from_disk = [&box]() noexcept {
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    {
+      PUP::toDisk writer(file);
+      writer | box;
+    }
+    std::rewind(file);
+    decltype(box) restarted_box{};
+    {
+      PUP::fromDisk reader(file);
+      reader | restarted_box;
+    }
+    std::fclose(file);
+    return restarted_box;
+  };
+
+  // By default the evaluated compute items are serialized
+  CHECK(db::pack_compute_item_values());
+  const auto copied_box = serialize_and_deserialize(box);
+  CHECK(db::get<CountingTag<0>>(copied_box) == 8.2);
+  const auto box_from_disk = write_and_read_from_disk();
+  CHECK(db::get<CountingTag<0>>(box_from_disk) == 8.2);
+  CHECK(CountingFunc<0>::count == 1);
+
+  // Without the values the compute items are recomputed lazily, whichever
+  // PUP::er serializes the box
+  db::set_pack_compute_item_values(false);
+  CHECK_FALSE(db::pack_compute_item_values());
+  const auto copied_box_without_values = serialize_and_deserialize(box);
+  const auto box_from_disk_without_values = write_and_read_from_disk();
+  db::set_pack_compute_item_values(true);
+  CHECK(serialize(box).size() >
+        serialize(copied_box_without_values).size());
+  for (const auto* const restarted_box :
+       {&copied_box_without_values, &box_from_disk_without_values}) {
+    const int count_before = CountingFunc<0>::count;
+    CHECK(db::get<test_databox_tags::Tag0>(*restarted_box) == 3.14);
+    CHECK(CountingFunc<0>::count == count_before);
+    CHECK(db::get<CountingTag<0>>(*restarted_box) == 8.2);
+    CHECK(CountingFunc<0>::count == count_before + 1);
+    CHECK(db::get<test_databox_tags::Tag4>(*restarted_box) == 6.28);
+  }
+  CHECK(CountingFunc<0>::count == 3);
+  // The original box is unchanged
+  CHECK(db::get<CountingTag<0>>(box) == 8.2);
+  CHECK(CountingFunc<0>::count == 3);
+  CountingFunc<0>::count = 0;
+}
+
 void serialization_compute_items_of_base_tags() noexcept {
   INFO("serialization of a DataBox with compute items depending on base tags");
   auto original_box =
@@ -2670,6 +2825,7 @@ void test_serialization() noexcept {
   serialization_non_subitem_simple_items();
   serialization_subitems_simple_items();
   serialization_subitem_compute_items();
+  serialization_compute_items_without_values();
   serialization_compute_items_of_base_tags();
   serialization_of_pointers();
 }
@@ -2684,6 +2840,7 @@ SPECTRE_TEST_CASE("Unit.DataStructures.DataBox", "[Unit][DataStructures]") {
   test_variables2();
   test_reset_compute_items();
   test_variables_extra_reset();
+  test_mutate_resets_all_dependents();
   test_mutate_apply();
   test_mutating_compute_item();
   test_data_on_slice_single();
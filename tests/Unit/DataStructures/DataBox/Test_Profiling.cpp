@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Profiling.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Input : db::SimpleTag {
+  using type = double;
+};
+
+struct Output : db::SimpleTag {
+  using type = std::vector<double>;
+};
+
+struct OutputCompute : Output, db::ComputeTag {
+  using base = Output;
+  using return_type = std::vector<double>;
+  static void function(const gsl::not_null<std::vector<double>*> result,
+                       const double input) noexcept {
+    *result = std::vector<double>(3, input);
+  }
+  using argument_tags = tmpl::list<Input>;
+};
+
+struct RecordedItem : db::SimpleTag {
+  using type = std::vector<double>;
+};
+
+void test_size_in_bytes() noexcept {
+  using db::profiling::detail::size_in_bytes;
+  CHECK(size_in_bytes(1.0) == sizeof(double));
+  CHECK(size_in_bytes(std::vector<double>(4, 1.0)) == 4 * sizeof(double));
+  CHECK(size_in_bytes(DataVector(5, 1.0)) == 5 * sizeof(double));
+  CHECK(size_in_bytes(tnsr::i<DataVector, 3>{size_t{5}, 1.0}) ==
+        15 * sizeof(double));
+  CHECK(size_in_bytes(std::vector<std::vector<double>>{{1.0, 2.0}, {3.0}}) ==
+        3 * sizeof(double));
+  // Types that are neither containers nor contiguous fall back to `sizeof`
+  CHECK(size_in_bytes(std::pair<int, double>{1, 2.0}) ==
+        sizeof(std::pair<int, double>));
+}
+
+void test_record() noexcept {
+  db::profiling::clear_compute_item_statistics();
+  const std::vector<double> value(4, 1.0);
+  db::profiling::detail::record_evaluation<RecordedItem>(
+      std::chrono::steady_clock::now(), value);
+  db::profiling::detail::record_evaluation<RecordedItem>(
+      std::chrono::steady_clock::now(), value);
+  db::profiling::detail::record_reset<RecordedItem>();
+  const auto& statistics = db::profiling::compute_item_statistics().at(
+      db::tag_name<RecordedItem>());
+  CHECK(statistics.number_of_evaluations == 2);
+  CHECK(statistics.number_of_resets == 1);
+  CHECK(statistics.evaluation_time >= 0.0);
+  CHECK(statistics.bytes_produced == 2 * 4 * sizeof(double));
+
+  db::profiling::clear_compute_item_statistics();
+  CHECK(statistics.number_of_evaluations == 0);
+  CHECK(statistics.number_of_resets == 0);
+  CHECK(statistics.evaluation_time == 0.0);
+  CHECK(statistics.bytes_produced == 0);
+}
+
+void test_databox() noexcept {
+#ifdef SPECTRE_DATABOX_PROFILING
+  db::profiling::clear_compute_item_statistics();
+  auto box = db::create<db::AddSimpleTags<Input>,
+                        db::AddComputeTags<OutputCompute>>(2.0);
+  // The statistics of an item are recorded once it is first evaluated
+  CHECK(db::profiling::compute_item_statistics().count(
+            db::tag_name<Output>()) == 0);
+  CHECK(db::get<Output>(box) == std::vector<double>(3, 2.0));
+  CHECK(db::get<Output>(box) == std::vector<double>(3, 2.0));
+  const auto& statistics =
+      db::profiling::compute_item_statistics().at(db::tag_name<Output>());
+  CHECK(statistics.number_of_evaluations == 1);
+  CHECK(statistics.number_of_resets == 0);
+  CHECK(statistics.bytes_produced == 3 * sizeof(double));
+  db::mutate<Input>(make_not_null(&box),
+                    [](const gsl::not_null<double*> input) noexcept {
+                      *input = 3.0;
+                    });
+  CHECK(statistics.number_of_resets == 1);
+  // Resetting an item that was not evaluated is not counted
+  db::mutate<Input>(make_not_null(&box),
+                    [](const gsl::not_null<double*> input) noexcept {
+                      *input = 4.0;
+                    });
+  CHECK(statistics.number_of_resets == 1);
+  CHECK(db::get<Output>(box) == std::vector<double>(3, 4.0));
+  CHECK(statistics.number_of_evaluations == 2);
+#endif  // SPECTRE_DATABOX_PROFILING
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.DataBox.Profiling",
+                  "[Unit][DataStructures]") {
+  test_size_in_bytes();
+  test_record();
+}
+
+SPECTRE_TEST_CASE("Unit.DataStructures.DataBox.Profiling.DataBox",
+                  "[Unit][DataStructures]") {
+  test_databox();
+}
@@ -0,0 +1,59 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+from spectre.DataStructures import ComplexDataVector, DataVector
+import unittest
+import weakref
+import numpy as np
+import numpy.testing as npt
+
+
+class TestComplexDataVector(unittest.TestCase):
+    def test_len(self):
+        a = ComplexDataVector(5, 1.0 + 2.0j)
+        self.assertEqual(len(a), 5)
+        self.assertEqual(a[3], 1.0 + 2.0j)
+
+    def test_real_imag(self):
+        a = ComplexDataVector([1.0 + 2.0j, -3.0 + 0.5j])
+        self.assertEqual(a.real(), DataVector([1.0, -3.0]))
+        self.assertEqual(a.imag(), DataVector([2.0, 0.5]))
+
+    def test_numpy_compatibility(self):
+        b = np.array([1.0 + 1.0j, 2.0 - 1.0j, 3.0j])
+        c = ComplexDataVector([1.0 + 1.0j, 2.0 - 1.0j, 3.0j])
+        # Convert a ComplexDataVector to a Numpy array
+        c_array_copy = np.array(c)
+        npt.assert_equal(c_array_copy, b)
+        c_array_copy[2] = 4.0
+        npt.assert_equal(c, b)
+        c_array_reference = np.array(c, copy=False)
+        c_array_reference[2] = 4.0
+        self.assertEqual(c[2], 4.0)
+        # Convert a Numpy array to a ComplexDataVector
+        b_dv_copy = ComplexDataVector(b)
+        b_dv_copy[2] = 4.0
+        self.assertEqual(b[2], 3.0j)
+        b_dv_reference = ComplexDataVector(b, copy=False)
+        b_dv_reference[2] = 4.0
+        self.assertEqual(b[2], 4.0)
+        # Only a reference keeps the array alive
+        c = np.array([1.0j, 2.0])
+        c_ref = weakref.ref(c)
+        c_dv_reference = ComplexDataVector(c, copy=False)
+        del c
+        self.assertIsNotNone(c_ref())
+        c = np.array([1.0j, 2.0])
+        c_ref = weakref.ref(c)
+        c_dv_copy = ComplexDataVector(c)
+        del c
+        self.assertIsNone(c_ref())
+        # Non-contiguous arrays can only be copied
+        self.assertEqual(ComplexDataVector(b[::2]),
+                         ComplexDataVector([1.0 + 1.0j, 4.0]))
+        self.assertRaises(RuntimeError,
+                          lambda: ComplexDataVector(b[::2], copy=False))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
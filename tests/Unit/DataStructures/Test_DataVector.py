@@ -4,6 +4,7 @@
 from spectre.DataStructures import DataVector
 import unittest
 import math
+import weakref
 import numpy as np
 import numpy.testing as npt
 
@@ -337,6 +338,25 @@ class TestDataVector(unittest.TestCase):
         b_dv_reference = DataVector(b, copy=False)
         b_dv_reference[2] = 4.0
         self.assertEqual(b[2], 4.0)
+        # The referenced array is kept alive by the DataVector
+        c_dv_reference = DataVector(np.array([1.0, 2.0, 3.0]), copy=False)
+        self.assertEqual(c_dv_reference, DataVector([1.0, 2.0, 3.0]))
+        e = np.array([1.0, 2.0, 3.0])
+        e_ref = weakref.ref(e)
+        e_dv_reference = DataVector(e, copy=False)
+        del e
+        self.assertIsNotNone(e_ref())
+        # A copy doesn't keep the array alive
+        e = np.array([1.0, 2.0, 3.0])
+        e_ref = weakref.ref(e)
+        e_dv_copy = DataVector(e)
+        del e
+        self.assertIsNone(e_ref())
+        self.assertEqual(e_dv_copy, DataVector([1.0, 2.0, 3.0]))
+        # Non-contiguous arrays can only be copied
+        d = np.array([1.0, 2.0, 3.0, 4.0])
+        self.assertEqual(DataVector(d[::2]), DataVector([1.0, 3.0]))
+        self.assertRaises(RuntimeError, lambda: DataVector(d[::2], copy=False))
 
     def test_iterator(self):
         a = DataVector([1.0, 2.0, 3.0, 4.0, 5.0])
@@ -5,6 +5,7 @@ from spectre.DataStructures import Matrix
 import unittest
 import math
 import numpy as np
+import numpy.testing as npt
 
 
 class TestMatrix(unittest.TestCase):
@@ -59,6 +60,11 @@ class TestMatrix(unittest.TestCase):
         self.assertEquals(M_from_array[1, 0], 2.7)
         self.assertEquals(M_from_array[0, 1], 5.42)
         self.assertEquals(M_from_array[1, 1], -2.3)
+        # Row-major arrays are converted element by element
+        B = np.array([[1.0, 5.42, 0.5], [2.7, -2.3, 1.5]], order='C')
+        M_from_row_major = Matrix(B)
+        self.assertEqual(M_from_row_major.shape, (2, 3))
+        npt.assert_equal(np.array(M_from_row_major), B)
 
 
 if __name__ == '__main__':
@@ -0,0 +1,113 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <utility>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "DataStructures/SplitComplexDataVector.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+void test_storage(const ComplexDataVector& values) noexcept {
+  const size_t size = values.size();
+  const SplitComplexDataVector split_values{values};
+  CHECK(split_values.size() == size);
+  CHECK(split_values.real() == real(values));
+  CHECK(split_values.imag() == imag(values));
+  // The reals are followed by the imaginary parts in one allocation
+  for (size_t i = 0; i < size; ++i) {
+    CHECK(split_values.data()[i] == values[i].real());         // NOLINT
+    CHECK(split_values.data()[size + i] == values[i].imag());  // NOLINT
+  }
+
+  ComplexDataVector interleaved{};
+  interleave(make_not_null(&interleaved), split_values);
+  CHECK(interleaved == values);
+  SplitComplexDataVector resplit{};
+  split(make_not_null(&resplit), interleaved);
+  CHECK(resplit == split_values);
+
+  // Copies and moves own their data
+  SplitComplexDataVector copied{split_values};
+  CHECK(copied == split_values);
+  CHECK(copied.data() != split_values.data());
+  copied.real()[0] += 1.0;
+  CHECK(copied != split_values);
+  const double* const copied_data = copied.data();
+  SplitComplexDataVector moved{std::move(copied)};
+  CHECK(moved.data() == copied_data);
+  CHECK(moved.real().data() == copied_data);
+  CHECK(moved.imag().data() == copied_data + size);  // NOLINT
+  SplitComplexDataVector assigned{size, std::complex<double>{1.0, 2.0}};
+  CHECK(assigned.real() == DataVector(size, 1.0));
+  CHECK(assigned.imag() == DataVector(size, 2.0));
+  assigned = split_values;
+  CHECK(assigned == split_values);
+  assigned = std::move(moved);
+  CHECK(assigned.data() == copied_data);
+
+  SplitComplexDataVector resized{split_values};
+  resized.destructive_resize(size + 1);
+  CHECK(resized.size() == size + 1);
+  CHECK(resized.imag().data() == resized.data() + size + 1);  // NOLINT
+  resized.destructive_resize(0);
+  CHECK(resized.size() == 0);
+
+  test_serialization(split_values);
+  const SpinWeighted<ComplexDataVector, 2> spin_weighted_values{values};
+  SpinWeighted<SplitComplexDataVector, 2> spin_weighted_split{};
+  split(make_not_null(&spin_weighted_split), spin_weighted_values);
+  CHECK(spin_weighted_split.data() == split_values);
+  SpinWeighted<ComplexDataVector, 2> spin_weighted_interleaved{};
+  interleave(make_not_null(&spin_weighted_interleaved), spin_weighted_split);
+  CHECK(spin_weighted_interleaved == spin_weighted_values);
+}
+
+void test_arithmetic(const ComplexDataVector& lhs,
+                     const ComplexDataVector& rhs) noexcept {
+  const SplitComplexDataVector split_lhs{lhs};
+  const SplitComplexDataVector split_rhs{rhs};
+  SplitComplexDataVector result{};
+  ComplexDataVector interleaved_result{};
+
+  multiply(make_not_null(&result), split_lhs, split_rhs);
+  interleave(make_not_null(&interleaved_result), result);
+  CHECK_ITERABLE_APPROX(interleaved_result, ComplexDataVector{lhs * rhs});
+
+  multiply_conjugate(make_not_null(&result), split_lhs, split_rhs);
+  interleave(make_not_null(&interleaved_result), result);
+  CHECK_ITERABLE_APPROX(interleaved_result,
+                        ComplexDataVector{lhs * conj(rhs)});
+
+  divide(make_not_null(&result), split_lhs, split_rhs);
+  interleave(make_not_null(&interleaved_result), result);
+  CHECK_ITERABLE_APPROX(interleaved_result, ComplexDataVector{lhs / rhs});
+
+  DataVector norm_of_lhs{};
+  norm(make_not_null(&norm_of_lhs), split_lhs);
+  CHECK_ITERABLE_APPROX(norm_of_lhs, DataVector{real(lhs * conj(lhs))});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.SplitComplexDataVector",
+                  "[DataStructures][Unit]") {
+  MAKE_GENERATOR(generator);
+  // Avoid dividing by zero
+  UniformCustomDistribution<double> dist{1.0, 10.0};
+  const size_t size = 7;
+  const auto lhs = make_with_random_values<ComplexDataVector>(
+      make_not_null(&generator), make_not_null(&dist), size);
+  const auto rhs = make_with_random_values<ComplexDataVector>(
+      make_not_null(&generator), make_not_null(&dist), size);
+  test_storage(lhs);
+  test_arithmetic(lhs, rhs);
+}
@@ -9,6 +9,7 @@
 #include <random>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
@@ -638,6 +639,116 @@ void test_variables_serialization() noexcept {
   test_serialization(tuple_of_test_variables);
 }
 
+template <typename VectorType>
+void test_variables_non_owning() noexcept {
+  using value_type = typename VectorType::value_type;
+  using VariablesType =
+      Variables<tmpl::list<TestHelpers::Tags::Vector<VectorType>,
+                           TestHelpers::Tags::Scalar<VectorType>>>;
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<tt::get_fundamental_type_t<value_type>> dist{-100.0,
+                                                                         100.0};
+  UniformCustomDistribution<size_t> sdist{5, 20};
+  const size_t number_of_grid_points = sdist(gen);
+  const size_t size =
+      number_of_grid_points * VariablesType::number_of_independent_components;
+
+  std::vector<value_type> buffer(size);
+  fill_with_random_values(make_not_null(&buffer), make_not_null(&gen),
+                          make_not_null(&dist));
+  const std::vector<value_type> initial_buffer = buffer;
+
+  VariablesType view{buffer.data(), buffer.size()};
+  CHECK_FALSE(view.is_owning());
+  CHECK(view.data() == buffer.data());
+  CHECK(view.size() == size);
+  CHECK(view.number_of_grid_points() == number_of_grid_points);
+  // The tensors reference the buffer in the order of the tags
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK(get<TestHelpers::Tags::Vector<VectorType>>(view).get(i).data() ==
+          buffer.data() + i * number_of_grid_points);
+  }
+  CHECK(get(get<TestHelpers::Tags::Scalar<VectorType>>(view)).data() ==
+        buffer.data() + 3 * number_of_grid_points);
+
+  // Copying a view makes an owning copy of the data
+  const VariablesType owning_copy = view;
+  CHECK(owning_copy.is_owning());
+  CHECK(owning_copy.data() != buffer.data());
+  CHECK(owning_copy == view);
+  VariablesType copy_assigned{number_of_grid_points + 1};
+  copy_assigned = view;
+  CHECK(copy_assigned.is_owning());
+  CHECK(copy_assigned.data() != buffer.data());
+  CHECK(copy_assigned == view);
+  const Variables<db::wrap_tags_in<TestHelpers::Tags::Prefix0,
+                                   typename VariablesType::tags_list>>
+      prefixed_copy{view};
+  CHECK(prefixed_copy.is_owning());
+  CHECK(prefixed_copy.data() != buffer.data());
+  for (size_t i = 0; i < size; ++i) {
+    CHECK(prefixed_copy.data()[i] == buffer[i]);
+  }
+
+  // Assigning to a view writes through to the buffer
+  VariablesType other{number_of_grid_points};
+  fill_with_random_values(make_not_null(&other), make_not_null(&gen),
+                          make_not_null(&dist));
+  view = other;
+  CHECK_FALSE(view.is_owning());
+  CHECK(view.data() == buffer.data());
+  for (size_t i = 0; i < size; ++i) {
+    CHECK(buffer[i] == other.data()[i]);
+  }
+  view = owning_copy;
+  CHECK(view.data() == buffer.data());
+  CHECK(buffer == initial_buffer);
+  view.initialize(number_of_grid_points, value_type{2.0});
+  CHECK(view.data() == buffer.data());
+  CHECK(buffer == std::vector<value_type>(size, value_type{2.0}));
+
+  // Moving a view keeps referencing the buffer
+  VariablesType moved_view = std::move(view);
+  CHECK_FALSE(moved_view.is_owning());
+  CHECK(moved_view.data() == buffer.data());
+  VariablesType move_assigned_view{};
+  move_assigned_view = std::move(moved_view);
+  CHECK_FALSE(move_assigned_view.is_owning());
+  CHECK(move_assigned_view.data() == buffer.data());
+  CHECK(get(get<TestHelpers::Tags::Scalar<VectorType>>(move_assigned_view))
+            .data() == buffer.data() + 3 * number_of_grid_points);
+
+  // Serializing a view makes an owning copy
+  const auto deserialized = serialize_and_deserialize(move_assigned_view);
+  CHECK(deserialized.is_owning());
+  CHECK(deserialized.data() != buffer.data());
+  CHECK(deserialized == move_assigned_view);
+
+  // Unpacking into a view makes it own the unpacked data and leaves the
+  // viewed buffer untouched, even if the sizes differ
+  for (const size_t unpacked_grid_points :
+       {number_of_grid_points, number_of_grid_points + 2}) {
+    CAPTURE(unpacked_grid_points);
+    VariablesType unpacked_data{unpacked_grid_points};
+    fill_with_random_values(make_not_null(&unpacked_data), make_not_null(&gen),
+                            make_not_null(&dist));
+    const std::vector<value_type> buffer_before_unpacking = buffer;
+    VariablesType unpacked{buffer.data(), buffer.size()};
+    const std::vector<char> serialized = serialize(unpacked_data);
+    PUP::fromMem reader(serialized.data());
+    reader | unpacked;
+    CHECK(unpacked.is_owning());
+    CHECK(unpacked.data() != buffer.data());
+    CHECK(unpacked == unpacked_data);
+    CHECK(buffer == buffer_before_unpacking);
+  }
+
+  // Pointing an owning Variables elsewhere releases its allocation
+  other.set_data_ref(buffer.data(), buffer.size());
+  CHECK_FALSE(other.is_owning());
+  CHECK(other.data() == buffer.data());
+}
+
 template <typename VectorType>
 void test_variables_assign_subset() noexcept {
   using value_type = typename VectorType::value_type;
@@ -883,6 +994,14 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Variables", "[DataStructures][Unit]") {
     test_variables_serialization<ModalVector>();
   }
 
+  {
+    INFO("Test non-owning Variables");
+    test_variables_non_owning<ComplexDataVector>();
+    test_variables_non_owning<ComplexModalVector>();
+    test_variables_non_owning<DataVector>();
+    test_variables_non_owning<ModalVector>();
+  }
+
   {
     INFO("Test Variables assign subset");
     test_variables_assign_subset<ComplexDataVector>();
@@ -928,6 +1047,19 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Variables", "[DataStructures][Unit]") {
 #endif
 }
 
+// [[OutputRegex, Cannot resize a non-owning Variables]]
+[[noreturn]] SPECTRE_TEST_CASE("Unit.DataStructures.Variables.ResizeNonOwning",
+                               "[DataStructures][Unit]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  std::vector<double> buffer(4);
+  Variables<tmpl::list<TestHelpers::Tags::Scalar<DataVector>>> vars{
+      buffer.data(), buffer.size()};
+  vars.initialize(5);
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
+
 // clang-format off
 // [[OutputRegex, Must copy into same size]]
 [[noreturn]] SPECTRE_TEST_CASE(
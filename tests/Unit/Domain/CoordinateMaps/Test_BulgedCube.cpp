@@ -97,6 +97,7 @@ void test_bulged_cube(bool with_equiangular_map) {
   test_inverse_map(map, test_point2);
   test_inverse_map(map, test_point3);
   test_inverse_map(map, test_point4);
+  test_batched_inverse_map(map);
 }
 }  // namespace
 
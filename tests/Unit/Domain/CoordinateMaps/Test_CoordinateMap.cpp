@@ -143,8 +143,8 @@ void test_single_coordinate_map() {
     const auto coords_jacs_velocity =
         map_base->coords_frame_velocity_jacobians(local_source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == map(local_source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          map.inv_jacobian(local_source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          map.inv_jacobian(local_source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           map.jacobian(local_source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -335,7 +335,8 @@ void test_coordinate_map_with_affine_map() {
     const auto coords_jacs_velocity =
         map.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == map(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) == map.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          map.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) == map.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
           tnsr::I<double, 1, Frame::Grid>{0.0});
@@ -382,8 +383,8 @@ void test_coordinate_map_with_affine_map() {
     const auto coords_jacs_velocity =
         prod_map2d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == prod_map2d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          prod_map2d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          prod_map2d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           prod_map2d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -448,8 +449,8 @@ void test_coordinate_map_with_affine_map() {
     const auto coords_jacs_velocity =
         prod_map3d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == prod_map3d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          prod_map3d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          prod_map3d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           prod_map3d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -502,8 +503,8 @@ void test_coordinate_map_with_rotation_map() {
     const auto coords_jacs_velocity =
         double_rotated2d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated2d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated2d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated2d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated2d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -550,8 +551,8 @@ void test_coordinate_map_with_rotation_map() {
     const auto coords_jacs_velocity =
         double_rotated3d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated3d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated3d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated3d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated3d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -600,8 +601,8 @@ void test_coordinate_map_with_rotation_map_datavector() {
     const auto coords_jacs_velocity =
         double_rotated2d.coords_frame_velocity_jacobians(coords2d);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated2d(coords2d));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated2d.inv_jacobian(coords2d));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated2d.inv_jacobian(coords2d));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated2d.jacobian(coords2d));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -657,8 +658,8 @@ void test_coordinate_map_with_rotation_map_datavector() {
     const auto coords_jacs_velocity =
         double_rotated3d.coords_frame_velocity_jacobians(coords3d);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated3d(coords3d));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated3d.inv_jacobian(coords3d));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated3d.inv_jacobian(coords3d));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated3d.jacobian(coords3d));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -702,14 +703,98 @@ void test_coordinate_map_with_rotation_wedge() {
   const auto coords_jacs_velocity =
       composed_map.coords_frame_velocity_jacobians(test_point_vector);
   CHECK(std::get<0>(coords_jacs_velocity) == composed_map(test_point_vector));
-  CHECK(std::get<1>(coords_jacs_velocity) ==
-        composed_map.inv_jacobian(test_point_vector));
+  CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                        composed_map.inv_jacobian(test_point_vector));
   CHECK(std::get<2>(coords_jacs_velocity) ==
         composed_map.jacobian(test_point_vector));
   CHECK(std::get<3>(coords_jacs_velocity) ==
         tnsr::I<double, 2, Frame::Grid>{0.0});
 }
 
+void test_batched_inverse() {
+  INFO("Batched inverse");
+  // The wedge and equatorial compression invert all points together, and the
+  // rotation one point at a time.
+  const CoordinateMaps::Wedge3D wedge(1.0, 3.0, OrientationMap<3>{}, 0.2, 0.8,
+                                      true);
+  const CoordinateMaps::Rotation<3> rotation(0.3, 0.8, -0.5);
+  const CoordinateMaps::EquatorialCompression compression(1.5);
+  const auto composed_map =
+      make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+          wedge, rotation, compression);
+
+  const auto map_point =
+      [&wedge, &rotation, &compression](
+          const std::array<double, 3>& source_point) noexcept {
+        return compression(rotation(wedge(source_point)));
+      };
+  const std::array<std::array<double, 3>, 5> target_points{
+      {map_point({{0.1, -0.4, 0.7}}), map_point({{1.0, 1.0, -1.0}}),
+       // Below the wedge, so the wedge inverse is invalid
+       compression(rotation(std::array<double, 3>{{1.0, 0.5, -2.0}})),
+       map_point({{-0.9, 0.3, 0.0}}),
+       // Outside the wedge but invertible
+       map_point({{0.2, 0.5, 1.5}})}};
+  tnsr::I<DataVector, 3, Frame::Inertial> batched_target_points(
+      target_points.size());
+  for (size_t d = 0; d < 3; ++d) {
+    for (size_t s = 0; s < target_points.size(); ++s) {
+      batched_target_points.get(d)[s] = gsl::at(gsl::at(target_points, s), d);
+    }
+  }
+
+  tnsr::I<DataVector, 3, Frame::Logical> batched_source_points{};
+  std::vector<bool> is_valid{};
+  composed_map->inverse(make_not_null(&batched_source_points),
+                        make_not_null(&is_valid), batched_target_points);
+  CHECK(is_valid == std::vector<bool>{true, true, false, true, true});
+  for (size_t s = 0; s < target_points.size(); ++s) {
+    tnsr::I<double, 3, Frame::Inertial> target_point{};
+    for (size_t d = 0; d < 3; ++d) {
+      target_point.get(d) = gsl::at(gsl::at(target_points, s), d);
+    }
+    const auto source_point = composed_map->inverse(target_point);
+    REQUIRE(source_point.has_value() == is_valid[s]);
+    if (is_valid[s]) {
+      for (size_t d = 0; d < 3; ++d) {
+        CHECK(batched_source_points.get(d)[s] ==
+              approx(source_point->get(d)));
+      }
+    }
+  }
+
+  // Time-dependent maps invert one point at a time
+  const double initial_time = -1.;
+  const double final_time = 4.4;
+  const std::array<DataVector, 4> init_func{{{1.0}, {-2.0}, {2.0}, {0.0}}};
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  functions_of_time["Translation"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<3>>(
+          initial_time, init_func, final_time);
+  const auto time_dependent_map =
+      make_coordinate_map<Frame::Logical, Frame::Inertial>(
+          CoordinateMaps::TimeDependent::Translation{"Translation"},
+          CoordinateMaps::Affine{-1., 1., 4., 7.});
+  tnsr::I<DataVector, 1, Frame::Logical> time_dependent_source_points{};
+  time_dependent_map.inverse(
+      make_not_null(&time_dependent_source_points), make_not_null(&is_valid),
+      tnsr::I<DataVector, 1, Frame::Inertial>{DataVector{28.09, 49.69, 29.29}},
+      final_time, functions_of_time);
+  CHECK(is_valid == std::vector<bool>(3, true));
+  CHECK_ITERABLE_APPROX(
+      time_dependent_source_points,
+      (tnsr::I<DataVector, 1, Frame::Logical>{DataVector{-4.3, 10.1, -3.5}}));
+
+  // An empty batch
+  composed_map->inverse(make_not_null(&batched_source_points),
+                        make_not_null(&is_valid),
+                        tnsr::I<DataVector, 3, Frame::Inertial>(0_st));
+  CHECK(is_valid.empty());
+  CHECK(get<0>(batched_source_points).size() == 0);
+}
+
 void test_make_vector_coordinate_map_base() {
   INFO("Make vector coordinate map base");
   using Affine = CoordinateMaps::Affine;
@@ -1055,8 +1140,9 @@ void test_coordinate_maps_are_identity() {
             source_point);
     CHECK(std::get<0>(coords_jacs_velocity) ==
           wedge_composed_with_giant_identity(source_point));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          wedge_composed_with_giant_identity.inv_jacobian(source_point));
+    CHECK_ITERABLE_APPROX(
+        std::get<1>(coords_jacs_velocity),
+        wedge_composed_with_giant_identity.inv_jacobian(source_point));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           wedge_composed_with_giant_identity.jacobian(source_point));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -1192,9 +1278,10 @@ void test_time_dependent_map() {
             tnsr_double_logical, final_time, functions_of_time);
     CHECK(std::get<0>(coords_jacs_velocity) ==
           serialized_map(tnsr_double_logical, final_time, functions_of_time));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          serialized_map.inv_jacobian(tnsr_double_logical, final_time,
-                                      functions_of_time));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          serialized_map.inv_jacobian(tnsr_double_logical,
+                                                      final_time,
+                                                      functions_of_time));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           serialized_map.jacobian(tnsr_double_logical, final_time,
                                   functions_of_time));
@@ -1212,9 +1299,10 @@ void test_time_dependent_map() {
     CHECK(
         std::get<0>(coords_jacs_velocity) ==
         serialized_map(tnsr_datavector_logical, final_time, functions_of_time));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          serialized_map.inv_jacobian(tnsr_datavector_logical, final_time,
-                                      functions_of_time));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          serialized_map.inv_jacobian(tnsr_datavector_logical,
+                                                      final_time,
+                                                      functions_of_time));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           serialized_map.jacobian(tnsr_datavector_logical, final_time,
                                   functions_of_time));
@@ -1468,6 +1556,7 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
   test_coordinate_map_with_rotation_map();
   test_coordinate_map_with_rotation_map_datavector();
   test_coordinate_map_with_rotation_wedge();
+  test_batched_inverse();
   test_make_vector_coordinate_map_base();
   test_coordinate_maps_are_identity();
   test_time_dependent_map();
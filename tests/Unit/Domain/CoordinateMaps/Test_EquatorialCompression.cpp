@@ -29,6 +29,7 @@ void test_suite() {  // Set up random number generator
   const CoordinateMaps::EquatorialCompression angular_compression_map(
       aspect_ratio);
   test_suite_for_map_on_unit_cube(angular_compression_map);
+  test_batched_inverse_map(angular_compression_map);
 }
 
 void test_radius() {
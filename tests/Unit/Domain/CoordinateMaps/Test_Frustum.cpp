@@ -57,6 +57,7 @@ void test_suite_for_frustum(const bool with_equiangular_map) {
     const CoordinateMaps::Frustum frustum_map(face_vertices, -1.0, 2.0, map_i(),
                                               with_equiangular_map, 1.01);
     test_suite_for_map_on_unit_cube(frustum_map);
+    test_batched_inverse_map(frustum_map);
   }
 }
 
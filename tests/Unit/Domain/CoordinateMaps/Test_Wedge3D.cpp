@@ -5,14 +5,18 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <optional>
 #include <random>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "Domain/CoordinateMaps/Wedge3D.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/Domain/CoordinateMaps/TestMapHelpers.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 #include "Utilities/TypeTraits.hpp"
 
@@ -47,6 +51,7 @@ void test_wedge3d_all_directions() {
               with_logarithmic_map ? 1.0 : outer_sphericity,
               with_equiangular_map, halves, with_logarithmic_map);
           test_suite_for_map_on_unit_cube(wedge_map);
+          test_batched_inverse_map(wedge_map);
         }
       }
     }
@@ -302,6 +307,37 @@ void test_wedge3d_fail() noexcept {
     CHECK_ITERABLE_APPROX(map(map.inverse(test_mapped_point7).value()),
                           test_mapped_point7);
   }
+
+  // The batched inverse flags the same points as invalid, and still inverts
+  // the valid points in the same batch. test_mapped_point6 lies on the
+  // boundary of the valid region, so whether it is valid depends on roundoff.
+  const std::array<std::array<double, 3>, 7> test_mapped_points{
+      {test_mapped_point1, test_mapped_point2, test_mapped_point3,
+       test_mapped_point4, test_mapped_point5, test_mapped_point7,
+       map(std::array<double, 3>{{0.3, -0.2, 0.5}})}};
+  std::array<DataVector, 3> batched_points{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(batched_points, d) = DataVector{test_mapped_points.size()};
+    for (size_t s = 0; s < test_mapped_points.size(); ++s) {
+      gsl::at(batched_points, d)[s] =
+          gsl::at(gsl::at(test_mapped_points, s), d);
+    }
+  }
+  std::array<DataVector, 3> batched_inverse{};
+  std::vector<bool> is_valid{};
+  map.inverse(make_not_null(&batched_inverse), make_not_null(&is_valid),
+              batched_points);
+  REQUIRE(is_valid.size() == test_mapped_points.size());
+  for (size_t s = 0; s < test_mapped_points.size(); ++s) {
+    const auto point_inverse = map.inverse(gsl::at(test_mapped_points, s));
+    CHECK(is_valid[s] == point_inverse.has_value());
+    if (is_valid[s]) {
+      for (size_t d = 0; d < 3; ++d) {
+        CHECK(gsl::at(batched_inverse, d)[s] ==
+              approx(gsl::at(point_inverse.value(), d)));
+      }
+    }
+  }
 }
 }  // namespace
 
@@ -0,0 +1,79 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/CachedEvaluation.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Framework/TestHelpers.hpp"
+
+namespace domain::FunctionsOfTime {
+namespace {
+void test_cached_evaluation() noexcept {
+  using Polynomial = PiecewisePolynomial<2>;
+  std::unordered_map<std::string, std::unique_ptr<FunctionOfTime>>
+      functions_of_time{};
+  // f(t) = t^2 and g(t) = 2 t
+  functions_of_time["F"] = std::make_unique<Polynomial>(
+      0.0, std::array<DataVector, 3>{{{0.0}, {0.0}, {2.0}}}, 2.0);
+  functions_of_time["G"] = std::make_unique<Polynomial>(
+      0.0, std::array<DataVector, 3>{{{0.0}, {2.0}, {0.0}}}, 2.0);
+
+  const auto& f_at_half =
+      cached_func_and_derivs<2>(functions_of_time, "F", 0.5);
+  CHECK(f_at_half[0][0] == approx(0.25));
+  CHECK(f_at_half[1][0] == approx(1.0));
+  CHECK(f_at_half[2][0] == approx(2.0));
+  // Repeated calls return the cached value
+  CHECK(&cached_func_and_derivs<2>(functions_of_time, "F", 0.5) == &f_at_half);
+  // Each function of time is cached separately
+  CHECK(cached_func_and_derivs<2>(functions_of_time, "G", 0.5)[0][0] ==
+        approx(1.0));
+  CHECK(f_at_half[0][0] == approx(0.25));
+  // ...as is each number of derivatives
+  CHECK(cached_func_and_derivs<0>(functions_of_time, "F", 1.5)[0][0] ==
+        approx(2.25));
+  CHECK(cached_func_and_derivs<1>(functions_of_time, "F", 1.0)[1][0] ==
+        approx(2.0));
+  CHECK(f_at_half[0][0] == approx(0.25));
+
+  // A new time is evaluated in place
+  const auto& f_at_one =
+      cached_func_and_derivs<2>(functions_of_time, "F", 1.0);
+  CHECK(&f_at_one == &f_at_half);
+  CHECK(f_at_one[0][0] == approx(1.0));
+
+  // Updating the function of time invalidates the cache
+  dynamic_cast<Polynomial&>(*functions_of_time["F"]).update(1.0, {4.0}, 3.0);
+  CHECK(cached_func_and_derivs<2>(functions_of_time, "F", 1.0)[2][0] ==
+        approx(4.0));
+
+  // Replacing the function of time invalidates the cache
+  functions_of_time["F"] = std::make_unique<Polynomial>(
+      0.0, std::array<DataVector, 3>{{{1.0}, {0.0}, {0.0}}}, 2.0);
+  CHECK(cached_func_and_derivs<2>(functions_of_time, "F", 1.0)[0][0] ==
+        approx(1.0));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.CachedEvaluation",
+                  "[Domain][Unit]") {
+  test_cached_evaluation();
+}
+
+// [[OutputRegex, The function of time 'H' is not one of the known functions]]
+SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.CachedEvaluation.Missing",
+                  "[Domain][Unit]") {
+  ERROR_TEST();
+  const std::unordered_map<std::string, std::unique_ptr<FunctionOfTime>>
+      functions_of_time{};
+  cached_func_and_derivs<0>(functions_of_time, "H", 0.0);
+}
+}  // namespace domain::FunctionsOfTime
@@ -25,6 +25,9 @@ void test(const gsl::not_null<FunctionsOfTime::FunctionOfTime*> f_of_t,
   const FunctionsOfTime::PiecewisePolynomial<DerivOrder> f_of_t_derived_copy =
       *f_of_t_derived;
   CHECK(*f_of_t_derived == f_of_t_derived_copy);
+  std::array<DataVector, 3> buffer0{};
+  std::array<DataVector, 2> buffer1{};
+  std::array<DataVector, 1> buffer2{};
   while (t < final_time) {
     const auto lambdas0 = f_of_t->func_and_2_derivs(t);
     CHECK(approx(lambdas0[0][0]) == cube(t));
@@ -44,6 +47,18 @@ void test(const gsl::not_null<FunctionsOfTime::FunctionOfTime*> f_of_t,
     CHECK(approx(lambdas2[0][0]) == cube(t));
     CHECK(approx(lambdas2[0][1]) == square(t));
 
+    // The overloads writing into a buffer reuse its allocation
+    const double* const buffer0_data = buffer0[0].data();
+    f_of_t->func_and_2_derivs(make_not_null(&buffer0), t);
+    CHECK_ITERABLE_APPROX(buffer0, lambdas0);
+    if (buffer0_data != nullptr) {
+      CHECK(buffer0[0].data() == buffer0_data);
+    }
+    f_of_t->func_and_deriv(make_not_null(&buffer1), t);
+    CHECK_ITERABLE_APPROX(buffer1, lambdas1);
+    f_of_t->func(make_not_null(&buffer2), t);
+    CHECK_ITERABLE_APPROX(buffer2, lambdas2);
+
     t += dt;
     f_of_t_derived->update(t, {6.0, 0.0}, t + dt);
     CHECK(*f_of_t_derived != f_of_t_derived_copy);
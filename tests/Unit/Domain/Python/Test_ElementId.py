@@ -13,6 +13,11 @@ class TestElementId(unittest.TestCase):
         element_id = ElementId1D(block_id=1, segment_ids=[SegmentId(1, 0)])
         self.assertEqual(element_id.block_id, 1)
         self.assertEqual(element_id.segment_ids, [SegmentId(1, 0)])
+        self.assertEqual(element_id.grid_index, 0)
+        element_id = ElementId1D(block_id=1,
+                                 segment_ids=[SegmentId(1, 0)],
+                                 grid_index=2)
+        self.assertEqual(element_id.grid_index, 2)
 
     def test_repr(self):
         self.assertEqual(repr(ElementId1D(0)), "[B0,(L0I0)]")
@@ -25,12 +30,16 @@ class TestElementId(unittest.TestCase):
                     1, [SegmentId(1, 0),
                         SegmentId(0, 0),
                         SegmentId(1, 1)])), "[B1,(L1I0,L0I0,L1I1)]")
+        self.assertEqual(repr(ElementId1D(0, [SegmentId(1, 0)], 1)),
+                         "[B0,(L1I0),G1]")
 
     def test_equality(self):
         self.assertEqual(ElementId1D(0, [SegmentId(1, 0)]),
                          ElementId1D(0, [SegmentId(1, 0)]))
         self.assertNotEqual(ElementId1D(0, [SegmentId(1, 0)]),
                             ElementId1D(0, [SegmentId(1, 1)]))
+        self.assertNotEqual(ElementId1D(0, [SegmentId(1, 0)]),
+                            ElementId1D(0, [SegmentId(1, 0)], 1))
 
     def test_external_boundary_id(self):
         self.assertEqual(ElementId1D.external_boundary_id(),
@@ -25,11 +25,12 @@ namespace {
 template <size_t VolumeDim>
 void test_placement_new_and_hashing_impl(
     const size_t block1, const std::array<SegmentId, VolumeDim>& segments1,
-    const size_t block2, const std::array<SegmentId, VolumeDim>& segments2) {
+    const size_t block2, const std::array<SegmentId, VolumeDim>& segments2,
+    const size_t grid1 = 0, const size_t grid2 = 0) {
   using Hash = std::hash<ElementId<VolumeDim>>;
 
-  const ElementId<VolumeDim> id1(block1, segments1);
-  const ElementId<VolumeDim> id2(block2, segments2);
+  const ElementId<VolumeDim> id1(block1, segments1, grid1);
+  const ElementId<VolumeDim> id2(block2, segments2, grid2);
 
   ElementId<VolumeDim> test_id1{};
   ElementId<VolumeDim> test_id2{};
@@ -79,6 +80,17 @@ void test_placement_new_and_hashing() {
       }
     }
   }
+  for (const auto& segment : segments) {
+    for (size_t grid1 = 0; grid1 < 3; ++grid1) {
+      for (size_t grid2 = 0; grid2 < 3; ++grid2) {
+        test_placement_new_and_hashing_impl<1>(1, {{segment}}, 1, {{segment}},
+                                               grid1, grid2);
+        test_placement_new_and_hashing_impl<3>(
+            1, {{segment, segment, segment}}, 1, {{segment, segment, segment}},
+            grid1, grid2);
+      }
+    }
+  }
 }
 
 void test_element_id() {
@@ -88,6 +100,12 @@ void test_element_id() {
   ElementId<3> block_2_3d(2, segment_ids);
   CHECK(block_2_3d.block_id() == 2);
   CHECK(block_2_3d.segment_ids() == segment_ids);
+  CHECK(block_2_3d.grid_index() == 0);
+  ElementId<3> block_2_3d_on_grid_1(2, segment_ids, 1);
+  CHECK(block_2_3d_on_grid_1.block_id() == 2);
+  CHECK(block_2_3d_on_grid_1.segment_ids() == segment_ids);
+  CHECK(block_2_3d_on_grid_1.grid_index() == 1);
+  CHECK(ElementId<3>(2, 3).grid_index() == 3);
 
   // Test parent and child operations:
   ElementId<3> id = block_2_3d;
@@ -100,6 +118,11 @@ void test_element_id() {
       CHECK(id == id.id_of_parent(dim).id_of_child(dim, Side::Upper));
     }
   }
+  for (size_t dim = 0; dim < 3; dim++) {
+    CHECK(block_2_3d_on_grid_1.id_of_child(dim, Side::Lower).grid_index() ==
+          1);
+    CHECK(block_2_3d_on_grid_1.id_of_parent(dim).grid_index() == 1);
+  }
 
   // Test equality operator:
   ElementId<3> element_one(1);
@@ -110,12 +133,16 @@ void test_element_id() {
   CHECK(element_two != element_three);
   CHECK(element_two != element_four);
   CHECK(element_three != block_2_3d);
+  CHECK(block_2_3d != block_2_3d_on_grid_1);
+  CHECK(ElementId<3>(1, 1) != element_one);
 
   // Test pup operations:
   test_serialization(element_one);
+  test_serialization(block_2_3d_on_grid_1);
 
   // Test output operator:
   CHECK(get_output(block_2_3d) == "[B2,(L2I3,L1I0,L1I1)]");
+  CHECK(get_output(block_2_3d_on_grid_1) == "[B2,(L2I3,L1I0,L1I1),G1]");
 
   CHECK(ElementId<3>::external_boundary_id().block_id() ==
         two_to_the(SegmentId::block_id_bits) - 1);
@@ -56,4 +56,11 @@ SPECTRE_TEST_CASE("Unit.Domain.Structure.InitialElementIds", "[Domain][Unit]") {
       {{4, 2, 1}}, {{0, 3, 2}}};
   const auto element_ids_3d = initial_element_ids(initial_refinement_levels_3d);
   test_initial_element_ids(element_ids_3d, initial_refinement_levels_3d);
+
+  const auto element_ids_on_grid =
+      initial_element_ids(initial_refinement_levels_2d, 2);
+  test_initial_element_ids(element_ids_on_grid, initial_refinement_levels_2d);
+  for (const auto& element_id : element_ids_on_grid) {
+    CHECK(element_id.grid_index() == 2);
+  }
 }
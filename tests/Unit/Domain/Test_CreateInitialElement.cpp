@@ -485,5 +485,26 @@ SPECTRE_TEST_CASE("Unit.Domain.CreateInitialElement", "[Domain][Unit]") {
         Neighbors<2>{{ElementId<2>{0, {{SegmentId{2, 3}, SegmentId{3, 6}}}}},
                      aligned}}});
 
+  // element on a coarser grid of a multigrid hierarchy
+  test_create_initial_element(
+      ElementId<2>{0, {{SegmentId{2, 3}, SegmentId{3, 7}}}, 1}, test_block,
+      refinement,
+      {{Direction<2>::upper_xi(),
+        Neighbors<2>{
+            {ElementId<2>{1, {{SegmentId{2, 0}, SegmentId{3, 7}}}, 1}},
+            aligned}},
+       {Direction<2>::lower_xi(),
+        Neighbors<2>{
+            {ElementId<2>{0, {{SegmentId{2, 2}, SegmentId{3, 7}}}, 1}},
+            aligned}},
+       {Direction<2>::upper_eta(),
+        Neighbors<2>{
+            {ElementId<2>{2, {{SegmentId{3, 0}, SegmentId{2, 0}}}, 1}},
+            unaligned}},
+       {Direction<2>::lower_eta(),
+        Neighbors<2>{
+            {ElementId<2>{0, {{SegmentId{2, 3}, SegmentId{3, 6}}}, 1}},
+            aligned}}});
+
   test_h_refinement();
 }
@@ -9,6 +9,7 @@
 #include <memory>
 #include <pup.h>
 #include <string>
+#include <unordered_map>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -18,9 +19,12 @@
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/CoordinateMaps/Rotation.hpp"
+#include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
 #include "Domain/CoordinateMaps/Wedge2D.hpp"
 #include "Domain/CoordinateMaps/Wedge3D.hpp"
 #include "Domain/ElementMap.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -184,11 +188,67 @@ void test_element_map<3>() {
       CoordinateMaps::Wedge3D{3.0, 7.0, OrientationMap<3>{}, 0.8, 0.9, true},
       logical_point_double, logical_point_dv);
 }
+
+void test_time_dependent_element_map() {
+  using Affine = CoordinateMaps::Affine;
+  using Translation = CoordinateMaps::TimeDependent::Translation;
+
+  std::unordered_map<std::string,
+                     std::unique_ptr<FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  functions_of_time["Translation"] =
+      std::make_unique<FunctionsOfTime::PiecewisePolynomial<2>>(
+          0.0, std::array<DataVector, 3>{{{1.0}, {-2.0}, {3.0}}}, 10.0);
+  const double time = 1.5;
+
+  const ElementId<1> element_id(0, std::array<SegmentId, 1>{{SegmentId(2, 3)}});
+  const Affine affine_map{-1.0, 1.0, 0.5, 1.0};
+  const Affine block_affine_map{-1.0, 1.0, 2.0, 8.0};
+  const Translation translation{"Translation"};
+  const auto composed_map =
+      make_coordinate_map<Frame::Logical, Frame::Inertial>(
+          affine_map, block_affine_map, translation);
+  const ElementMap<1, Frame::Inertial> element_map{
+      element_id, make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+                      block_affine_map, translation)};
+
+  const tnsr::I<DV, 1, Frame::Logical> logical_point(
+      DV{-1.0, -0.5, 0.0, 0.5, 1.0});
+  CHECK_ITERABLE_APPROX(
+      element_map(logical_point, time, functions_of_time),
+      composed_map(logical_point, time, functions_of_time));
+  CHECK_ITERABLE_APPROX(
+      element_map.jacobian(logical_point, time, functions_of_time),
+      composed_map.jacobian(logical_point, time, functions_of_time));
+  CHECK_ITERABLE_APPROX(
+      element_map.inv_jacobian(logical_point, time, functions_of_time),
+      composed_map.inv_jacobian(logical_point, time, functions_of_time));
+  const tnsr::I<double, 1, Frame::Inertial> inertial_point{4.0};
+  CHECK_ITERABLE_APPROX(
+      element_map.inverse(inertial_point, time, functions_of_time),
+      composed_map.inverse(inertial_point, time, functions_of_time).value());
+
+  const auto coords_velocity_jacobians =
+      element_map.coords_frame_velocity_jacobians(logical_point, time,
+                                                  functions_of_time);
+  const auto expected_coords_velocity_jacobians =
+      composed_map.coords_frame_velocity_jacobians(logical_point, time,
+                                                   functions_of_time);
+  CHECK_ITERABLE_APPROX(std::get<0>(coords_velocity_jacobians),
+                        std::get<0>(expected_coords_velocity_jacobians));
+  CHECK_ITERABLE_APPROX(std::get<1>(coords_velocity_jacobians),
+                        std::get<1>(expected_coords_velocity_jacobians));
+  CHECK_ITERABLE_APPROX(std::get<2>(coords_velocity_jacobians),
+                        std::get<2>(expected_coords_velocity_jacobians));
+  CHECK_ITERABLE_APPROX(std::get<3>(coords_velocity_jacobians),
+                        std::get<3>(expected_coords_velocity_jacobians));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.ElementMap", "[Unit][Domain]") {
   test_element_map<1>();
   test_element_map<2>();
   test_element_map<3>();
+  test_time_dependent_element_map();
 }
 }  // namespace domain
@@ -0,0 +1,146 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "DataStructures/VariablesTag.hpp"
+#include "Elliptic/DiscontinuousGalerkin/DivFluxes.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <size_t Dim>
+struct ScalarFlux : db::SimpleTag {
+  using type = tnsr::I<DataVector, Dim>;
+};
+
+template <size_t Dim>
+struct VectorFlux : db::SimpleTag {
+  using type = tnsr::Ij<DataVector, Dim>;
+};
+
+template <size_t Dim>
+using flux_tags = tmpl::list<ScalarFlux<Dim>, VectorFlux<Dim>>;
+
+template <size_t Dim>
+void test_div_fluxes(const Spectral::Quadrature quadrature) noexcept {
+  CAPTURE(Dim);
+  CAPTURE(quadrature);
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1., 1.);
+  const Mesh<Dim> mesh{4, Spectral::Basis::Legendre, quadrature};
+  const size_t num_points = mesh.number_of_grid_points();
+  const DataVector used_for_size{num_points};
+  const auto fluxes = make_with_random_values<Variables<flux_tags<Dim>>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  using div_fluxes_type =
+      Variables<db::wrap_tags_in<Tags::div, flux_tags<Dim>>>;
+  using inv_jacobian_type =
+      InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>;
+
+  {
+    INFO("Constant inverse Jacobian");
+    const auto constant_values =
+        make_with_random_values<std::array<double, Dim * Dim>>(
+            make_not_null(&generator), make_not_null(&dist));
+    inv_jacobian_type inv_jacobian{num_points};
+    for (size_t j = 0; j < Dim; ++j) {
+      for (size_t i = 0; i < Dim; ++i) {
+        inv_jacobian.get(j, i) = gsl::at(constant_values, j * Dim + i);
+      }
+    }
+    const auto packed_inv_jacobian =
+        elliptic::dg::constant_inverse_jacobian(inv_jacobian);
+    REQUIRE(packed_inv_jacobian.has_value());
+    CHECK(*packed_inv_jacobian == constant_values);
+
+    div_fluxes_type div_of_fluxes{};
+    elliptic::dg::div_fluxes(make_not_null(&div_of_fluxes), fluxes, mesh,
+                             inv_jacobian, packed_inv_jacobian);
+    const auto expected_div_of_fluxes =
+        divergence(fluxes, mesh, inv_jacobian);
+    CHECK_VARIABLES_APPROX(div_of_fluxes, expected_div_of_fluxes);
+
+    // Reuse a buffer, which is resized on the first call
+    DataVector buffer{};
+    for (size_t i = 0; i < 2; ++i) {
+      div_fluxes_type div_of_fluxes_with_buffer{};
+      elliptic::dg::div_fluxes(make_not_null(&div_of_fluxes_with_buffer),
+                               make_not_null(&buffer), fluxes, mesh,
+                               inv_jacobian, packed_inv_jacobian);
+      CHECK(div_of_fluxes_with_buffer == div_of_fluxes);
+    }
+  }
+  {
+    INFO("Non-constant inverse Jacobian");
+    const auto inv_jacobian = make_with_random_values<inv_jacobian_type>(
+        make_not_null(&generator), make_not_null(&dist), used_for_size);
+    const auto packed_inv_jacobian =
+        elliptic::dg::constant_inverse_jacobian(inv_jacobian);
+    CHECK_FALSE(packed_inv_jacobian.has_value());
+
+    div_fluxes_type div_of_fluxes{};
+    elliptic::dg::div_fluxes(make_not_null(&div_of_fluxes), fluxes, mesh,
+                             inv_jacobian, packed_inv_jacobian);
+    CHECK(div_of_fluxes == divergence(fluxes, mesh, inv_jacobian));
+  }
+  {
+    INFO("Inverse Jacobian that varies by roundoff");
+    inv_jacobian_type inv_jacobian{num_points, 2.};
+    get<0, 0>(inv_jacobian)[num_points - 1] *=
+        1. + std::numeric_limits<double>::epsilon();
+    CHECK_FALSE(
+        elliptic::dg::constant_inverse_jacobian(inv_jacobian).has_value());
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Elliptic.DG.DivFluxes", "[Unit][Elliptic]") {
+  TestHelpers::db::test_simple_tag<
+      elliptic::dg::Tags::ConstantInverseJacobian<1>>(
+      "ConstantInverseJacobian");
+  TestHelpers::db::test_compute_tag<
+      elliptic::dg::Tags::ConstantInverseJacobianCompute<1>>(
+      "ConstantInverseJacobian");
+  TestHelpers::db::test_compute_tag<elliptic::dg::Tags::DivFluxesCompute<
+      1, ::Tags::Variables<flux_tags<1>>>>(
+      "Variables(div(ScalarFlux),div(VectorFlux))");
+
+  for (const auto quadrature :
+       {Spectral::Quadrature::GaussLobatto, Spectral::Quadrature::Gauss}) {
+    test_div_fluxes<1>(quadrature);
+    test_div_fluxes<2>(quadrature);
+    test_div_fluxes<3>(quadrature);
+  }
+}
+
+// [[OutputRegex, The inverse Jacobian has no grid points]]
+[[noreturn]] SPECTRE_TEST_CASE("Unit.Elliptic.DG.DivFluxes.EmptyInvJacobian",
+                               "[Unit][Elliptic]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  elliptic::dg::constant_inverse_jacobian(
+      InverseJacobian<DataVector, 1, Frame::Logical, Frame::Inertial>{});
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
@@ -4,10 +4,13 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <random>
 
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/SliceVariables.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -29,6 +32,7 @@
 #include "Time/Tags.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -601,10 +605,98 @@ void test() noexcept {
   }
 }
 
+void test_batching() noexcept {
+  namespace detail = evolution::dg::Actions::detail;
+  using vars_type = Variables<tmpl::list<Var1, Var2<2>>>;
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  const Index<3> extents{3, 4, 5};
+  const auto upper_eta_data = make_with_random_values<vars_type>(
+      make_not_null(&gen), make_not_null(&dist), DataVector{15});
+  const auto lower_zeta_data = make_with_random_values<vars_type>(
+      make_not_null(&gen), make_not_null(&dist), DataVector{12});
+
+  vars_type batch{27};
+  detail::copy_to_batch(make_not_null(&batch), upper_eta_data, 0);
+  detail::copy_to_batch(make_not_null(&batch), lower_zeta_data, 15);
+  vars_type unbatched{12};
+  detail::copy_from_batch(make_not_null(&unbatched), batch, 15);
+  CHECK(unbatched == lower_zeta_data);
+  unbatched.initialize(15);
+  detail::copy_from_batch(make_not_null(&unbatched), batch, 0);
+  CHECK(unbatched == upper_eta_data);
+
+  const auto volume_data = make_with_random_values<vars_type>(
+      make_not_null(&gen), make_not_null(&dist), DataVector{60});
+  auto expected = volume_data;
+  add_slice_to_data(make_not_null(&expected), upper_eta_data, extents, 1, 3);
+  add_slice_to_data(make_not_null(&expected), lower_zeta_data, extents, 2, 0);
+  auto batched_result = volume_data;
+  detail::add_batched_slice_to_data(make_not_null(&batched_result), batch, 0,
+                                    extents, 1, 3);
+  detail::add_batched_slice_to_data(make_not_null(&batched_result), batch, 15,
+                                    extents, 2, 0);
+  CHECK_VARIABLES_APPROX(batched_result, expected);
+}
+
+// An element without neighbors has no mortars, so the action must leave the
+// time derivative untouched without waiting for any data
+template <size_t Dim>
+void test_no_neighbors() noexcept {
+  CAPTURE(Dim);
+  Parallel::register_derived_classes_with_charm<BoundaryCorrection<Dim>>();
+  using metavars =
+      Metavariables<Dim, TestHelpers::SystemType::Conservative, false>;
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
+  MockRuntimeSystem runner{{std::vector<std::array<size_t, Dim>>{
+                                make_array<Dim>(2_st)},
+                            std::make_unique<BoundaryTerms<Dim>>(),
+                            ::dg::Formulation::StrongInertial}};
+
+  const ElementId<Dim> self_id{0};
+  const Element<Dim> element{self_id, DirectionMap<Dim, Neighbors<Dim>>{}};
+  const Mesh<Dim> mesh{5, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  ::InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial> inv_jac{
+      mesh.number_of_grid_points(), 0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    inv_jac.get(i, i) = 2.0;
+  }
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
+  for (size_t i = 0; i < logical_coords.size(); ++i) {
+    inertial_coords[i] = logical_coords[i];
+  }
+  using dt_variables_tag = db::add_tag_prefix<
+      ::Tags::dt, typename metavars::system::variables_tag>;
+  const typename dt_variables_tag::type dt_evolved_vars{
+      mesh.number_of_grid_points(), 1.0};
+  const TimeStepId time_step_id{true, 3, Time{Slab{0.2, 3.4}, {3, 100}}};
+  ActionTesting::emplace_component_and_initialize<component<metavars>>(
+      &runner, self_id,
+      {time_step_id, time_step_id, dt_evolved_vars, mesh, element,
+       inertial_coords, inv_jac, Spectral::Quadrature::GaussLobatto});
+  for (size_t i = 0; i < 3; ++i) {
+    ActionTesting::next_action<component<metavars>>(make_not_null(&runner),
+                                                    self_id);
+  }
+  ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
+  CHECK(get_tag<evolution::dg::Tags::MortarData<Dim>>(runner, self_id)
+            .empty());
+  REQUIRE(ActionTesting::is_ready<component<metavars>>(runner, self_id));
+  ActionTesting::next_action<component<metavars>>(make_not_null(&runner),
+                                                  self_id);
+  CHECK(get_tag<dt_variables_tag>(runner, self_id) == dt_evolved_vars);
+}
+
 SPECTRE_TEST_CASE("Unit.Evolution.DG.ApplyBoundaryCorrections",
                   "[Unit][Evolution][Actions]") {
   test<1>();
   test<2>();
   test<3>();
+  test_batching();
+  test_no_neighbors<1>();
+  test_no_neighbors<2>();
+  test_no_neighbors<3>();
 }
 }  // namespace
@@ -75,6 +75,17 @@ using MortarMap =
     std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>, MappedType,
                        boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>;
 
+// The mortar tags store a `evolution::dg::MortarMap`, so compare entry by
+// entry against the expected `std::unordered_map`.
+template <typename ActualMap, typename ExpectedMap>
+void check_mortar_map(const ActualMap& actual, const ExpectedMap& expected) {
+  CHECK(actual.size() == expected.size());
+  for (const auto& [mortar_id, expected_value] : expected) {
+    REQUIRE(actual.contains(mortar_id));
+    CHECK(actual.at(mortar_id) == expected_value);
+  }
+}
+
 template <size_t Dim>
 void test_impl(
     const std::vector<std::array<size_t, Dim>>& initial_extents,
@@ -113,10 +124,11 @@ void test_impl(
   };
 
   const auto& mortar_meshes = get_tag(Tags::MortarMesh<Dim>{});
-  CHECK(mortar_meshes == expected_mortar_meshes);
+  check_mortar_map(mortar_meshes, expected_mortar_meshes);
   const auto& mortar_sizes = get_tag(Tags::MortarSize<Dim>{});
-  CHECK(mortar_sizes == expected_mortar_sizes);
+  check_mortar_map(mortar_sizes, expected_mortar_sizes);
   const auto& mortar_data = get_tag(Tags::MortarData<Dim>{});
+  CHECK(mortar_data.size() == expected_mortar_meshes.size());
   for (const auto& mortar_id_and_mesh : expected_mortar_meshes) {
     // Just make sure this exists, it is not expected to hold any data
     CHECK(mortar_data.find(mortar_id_and_mesh.first) != mortar_data.end());
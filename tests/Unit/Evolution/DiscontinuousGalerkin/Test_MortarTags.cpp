@@ -4,9 +4,18 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <utility>
 
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace evolution::dg {
 namespace {
@@ -17,6 +26,34 @@ void test() {
   TestHelpers::db::test_simple_tag<Tags::MortarSize<Dim>>("MortarSize");
   TestHelpers::db::test_simple_tag<Tags::MortarNextTemporalId<Dim>>(
       "MortarNextTemporalId");
+
+  // An element with the maximum number of neighbors has one mortar per
+  // neighbor, and all of them fit into the fixed-size map.
+  MortarMap<Dim, TimeStepId> next_temporal_ids{};
+  const TimeStepId time_step_id{true, 0, Slab{0.0, 1.0}.start()};
+  for (size_t i = 0; i < maximum_number_of_neighbors(Dim); ++i) {
+    const auto direction =
+        gsl::at(Direction<Dim>::all_directions(), i % (2 * Dim));
+    next_temporal_ids.emplace(std::pair{direction, ElementId<Dim>{i}},
+                              time_step_id);
+  }
+  CHECK(next_temporal_ids.size() == maximum_number_of_neighbors(Dim));
+  for (const auto& [mortar_id, temporal_id] : next_temporal_ids) {
+    CHECK(temporal_id == time_step_id);
+    CHECK(next_temporal_ids.at(mortar_id) == time_step_id);
+  }
+  // The mortars of each direction fill that direction's row of the table.
+  size_t slot = 0;
+  for (const auto& mortar_id_and_temporal_id : next_temporal_ids) {
+    const auto& mortar_id = mortar_id_and_temporal_id.first;
+    CHECK(MortarIdHash<Dim>{}(mortar_id) ==
+          DirectionHash<Dim>{}(mortar_id.first) *
+              maximum_number_of_neighbors_per_direction(Dim));
+    CHECK(DirectionHash<Dim>{}(mortar_id.first) ==
+          slot / maximum_number_of_neighbors_per_direction(Dim));
+    ++slot;
+  }
+  test_serialization(next_temporal_ids);
 }
 }  // namespace
 
@@ -682,6 +682,98 @@ void test_constraint_energy_analytic(const Solution& solution,
       numerical_approx);
 }
 
+// Test that the fused kernel agrees with the individual constraint functions
+template <typename Frame, typename DataType>
+void test_all_constraints_random(const DataType& used_for_size) noexcept {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1., 1.);
+  const auto nn_generator = make_not_null(&generator);
+  const auto nn_dist = make_not_null(&dist);
+  const auto gauge_function =
+      make_with_random_values<tnsr::a<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto d_gauge_function =
+      make_with_random_values<tnsr::ia<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto spacetime_normal_one_form =
+      make_with_random_values<tnsr::a<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto spacetime_normal_vector =
+      make_with_random_values<tnsr::A<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto inverse_spatial_metric =
+      make_with_random_values<tnsr::II<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto inverse_spacetime_metric =
+      make_with_random_values<tnsr::AA<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto pi = make_with_random_values<tnsr::aa<DataType, 3, Frame>>(
+      nn_generator, nn_dist, used_for_size);
+  const auto phi = make_with_random_values<tnsr::iaa<DataType, 3, Frame>>(
+      nn_generator, nn_dist, used_for_size);
+  const auto d_pi = make_with_random_values<tnsr::iaa<DataType, 3, Frame>>(
+      nn_generator, nn_dist, used_for_size);
+  const auto d_phi = make_with_random_values<tnsr::ijaa<DataType, 3, Frame>>(
+      nn_generator, nn_dist, used_for_size);
+  const auto gamma2 = make_with_random_values<Scalar<DataType>>(
+      nn_generator, nn_dist, used_for_size);
+  const auto three_index_constraint =
+      make_with_random_values<tnsr::iaa<DataType, 3, Frame>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto spatial_metric_determinant =
+      make_with_random_values<Scalar<DataType>>(nn_generator, nn_dist,
+                                                used_for_size);
+
+  tnsr::a<DataType, 3, Frame> gauge_constraint{};
+  tnsr::a<DataType, 3, Frame> f_constraint{};
+  tnsr::ia<DataType, 3, Frame> two_index_constraint{};
+  tnsr::iaa<DataType, 3, Frame> four_index_constraint{};
+  Scalar<DataType> constraint_energy{};
+  GeneralizedHarmonic::all_constraints(
+      make_not_null(&gauge_constraint), make_not_null(&f_constraint),
+      make_not_null(&two_index_constraint),
+      make_not_null(&four_index_constraint), make_not_null(&constraint_energy),
+      gauge_function, d_gauge_function, spacetime_normal_one_form,
+      spacetime_normal_vector, inverse_spatial_metric, inverse_spacetime_metric,
+      pi, phi, d_pi, d_phi, gamma2, three_index_constraint,
+      spatial_metric_determinant);
+
+  const auto expected_gauge_constraint = GeneralizedHarmonic::gauge_constraint(
+      gauge_function, spacetime_normal_one_form, spacetime_normal_vector,
+      inverse_spatial_metric, inverse_spacetime_metric, pi, phi);
+  const auto expected_f_constraint = GeneralizedHarmonic::f_constraint(
+      gauge_function, d_gauge_function, spacetime_normal_one_form,
+      spacetime_normal_vector, inverse_spatial_metric, inverse_spacetime_metric,
+      pi, phi, d_pi, d_phi, gamma2, three_index_constraint);
+  const auto expected_two_index_constraint =
+      GeneralizedHarmonic::two_index_constraint(
+          d_gauge_function, spacetime_normal_one_form, spacetime_normal_vector,
+          inverse_spatial_metric, inverse_spacetime_metric, pi, phi, d_pi,
+          d_phi, gamma2, three_index_constraint);
+  const auto expected_four_index_constraint =
+      GeneralizedHarmonic::four_index_constraint(d_phi);
+  const auto expected_constraint_energy =
+      GeneralizedHarmonic::constraint_energy(
+          expected_gauge_constraint, expected_f_constraint,
+          expected_two_index_constraint, three_index_constraint,
+          expected_four_index_constraint, inverse_spatial_metric,
+          spatial_metric_determinant);
+
+  // The terms are summed in a different order than in the individual
+  // functions
+  Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(gauge_constraint, expected_gauge_constraint,
+                               custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(f_constraint, expected_f_constraint,
+                               custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(two_index_constraint,
+                               expected_two_index_constraint, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(four_index_constraint,
+                               expected_four_index_constraint, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(constraint_energy, expected_constraint_energy,
+                               custom_approx);
+}
+
 // Test compute items for various constraints via insertion and retrieval
 // in a databox
 template <typename Solution>
@@ -726,6 +818,10 @@ void test_constraint_compute_items(
   TestHelpers::db::test_compute_tag<
       GeneralizedHarmonic::Tags::ConstraintEnergyCompute<3, Frame::Inertial>>(
       "ConstraintEnergy");
+  TestHelpers::db::test_compute_tag<
+      GeneralizedHarmonic::Tags::AllConstraintsCompute<3, Frame::Inertial>>(
+      "Variables(GaugeConstraint,FConstraint,TwoIndexConstraint,"
+      "FourIndexConstraint,ConstraintEnergy)");
 
   // Check vs. time-independent analytic solution
   // Set up grid
@@ -1034,6 +1130,37 @@ void test_constraint_compute_items(
   CHECK(
       db::get<GeneralizedHarmonic::Tags::ConstraintEnergy<3, Frame::Inertial>>(
           box) == constraint_energy);
+
+  // Check that the fused compute item agrees with the individual ones
+  typename GeneralizedHarmonic::Tags::AllConstraintsCompute<
+      3, Frame::Inertial>::return_type all_constraints{};
+  GeneralizedHarmonic::Tags::AllConstraintsCompute<3, Frame::Inertial>::
+      function(make_not_null(&all_constraints), gauge_source,
+               deriv_gauge_source, spacetime_normal_one_form,
+               spacetime_normal_vector, inverse_spatial_metric,
+               inverse_spacetime_metric, pi, phi, deriv_pi, deriv_phi, gamma2,
+               three_index_constraint, det_spatial_metric);
+  Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get<GeneralizedHarmonic::Tags::GaugeConstraint<3, Frame::Inertial>>(
+          all_constraints),
+      gauge_constraint, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get<GeneralizedHarmonic::Tags::FConstraint<3, Frame::Inertial>>(
+          all_constraints),
+      f_constraint, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get<GeneralizedHarmonic::Tags::TwoIndexConstraint<3, Frame::Inertial>>(
+          all_constraints),
+      two_index_constraint, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get<GeneralizedHarmonic::Tags::FourIndexConstraint<3, Frame::Inertial>>(
+          all_constraints),
+      four_index_constraint, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get<GeneralizedHarmonic::Tags::ConstraintEnergy<3, Frame::Inertial>>(
+          all_constraints),
+      constraint_energy, custom_approx);
 }
 }  // namespace
 
@@ -1296,6 +1423,18 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.ConstraintEnergy",
       std::numeric_limits<double>::signaling_NaN());
 }
 
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.AllConstraints",
+                  "[Unit][Evolution]") {
+  test_all_constraints_random<Frame::Grid, DataVector>(
+      DataVector(4, std::numeric_limits<double>::signaling_NaN()));
+  test_all_constraints_random<Frame::Inertial, DataVector>(
+      DataVector(4, std::numeric_limits<double>::signaling_NaN()));
+  test_all_constraints_random<Frame::Grid, double>(
+      std::numeric_limits<double>::signaling_NaN());
+  test_all_constraints_random<Frame::Inertial, double>(
+      std::numeric_limits<double>::signaling_NaN());
+}
+
 SPECTRE_TEST_CASE(
     "Unit.Evolution.Systems.GeneralizedHarmonic.ConstraintComputeTags",
     "[Unit][Evolution]") {
@@ -0,0 +1,193 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/ImplicitM1HydroCoupling.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1HydroCoupling.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
+#include "Evolution/Systems/RadiationTransport/Tags.hpp"  // IWYU pragma: keep
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+using neutrino_species = tmpl::list<neutrinos::ElectronNeutrinos<1>>;
+using Species = neutrinos::ElectronNeutrinos<1>;
+using Implicit =
+    RadiationTransport::M1Grey::ImplicitM1HydroCoupling<neutrino_species>;
+using TildeE = RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial,
+                                                         Species>;
+using TildeS = RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial,
+                                                         Species>;
+
+struct Background {
+  Scalar<DataVector> emissivity;
+  Scalar<DataVector> absorption_opacity;
+  Scalar<DataVector> scattering_opacity;
+  tnsr::I<DataVector, 3> fluid_velocity;
+  Scalar<DataVector> lorentz_factor;
+  Scalar<DataVector> lapse;
+  tnsr::ii<DataVector, 3> spatial_metric;
+  tnsr::II<DataVector, 3> inv_spatial_metric;
+  Scalar<DataVector> sqrt_det_spatial_metric;
+};
+
+Background make_background(const std::array<double, 3>& velocity) noexcept {
+  const DataVector used_for_size{0.7, 1.2, 3.0};
+  Background background{};
+  get(background.emissivity) = DataVector{0.5, 2.0, 1.0};
+  get(background.absorption_opacity) = DataVector{1.0, 30.0, 200.0};
+  get(background.scattering_opacity) = DataVector{0.0, 5.0, 400.0};
+  get(background.lapse) = DataVector{1.0, 0.9, 0.8};
+  get(background.sqrt_det_spatial_metric) = DataVector(3, 1.0);
+  background.spatial_metric =
+      make_with_value<tnsr::ii<DataVector, 3>>(used_for_size, 0.0);
+  background.inv_spatial_metric =
+      make_with_value<tnsr::II<DataVector, 3>>(used_for_size, 0.0);
+  double v_sqr = 0.0;
+  for (size_t i = 0; i < 3; ++i) {
+    background.spatial_metric.get(i, i) = 1.0;
+    background.inv_spatial_metric.get(i, i) = 1.0;
+    background.fluid_velocity.get(i) = DataVector(3, gsl::at(velocity, i));
+    v_sqr += square(gsl::at(velocity, i));
+  }
+  get(background.lorentz_factor) = DataVector(3, 1.0 / sqrt(1.0 - v_sqr));
+  return background;
+}
+
+template <typename Vars, typename Sources>
+void solve(const gsl::not_null<Vars*> vars,
+           const gsl::not_null<Sources*> sources,
+           const double implicit_weight,
+           const Background& background) noexcept {
+  const Scalar<DataVector> closure_factor_guess(DataVector(3, 0.5));
+  Implicit::apply(
+      vars, sources, implicit_weight, 0.0, background.emissivity,
+      background.absorption_opacity, background.scattering_opacity,
+      closure_factor_guess, background.fluid_velocity,
+      background.lorentz_factor, background.lapse, background.spatial_metric,
+      background.inv_spatial_metric, background.sqrt_det_spatial_metric);
+}
+
+Implicit::variables_type initial_vars() noexcept {
+  Implicit::variables_type vars(3);
+  get(get<TildeE>(vars)) = DataVector{1.0, 2.0, 0.5};
+  get<0>(get<TildeS>(vars)) = DataVector{0.3, -0.5, 0.1};
+  get<1>(get<TildeS>(vars)) = DataVector{0.1, 0.2, 0.0};
+  get<2>(get<TildeS>(vars)) = DataVector{-0.2, 0.4, 0.2};
+  return vars;
+}
+
+void test_fluid_at_rest() noexcept {
+  const auto background = make_background({{0.0, 0.0, 0.0}});
+  const double weight = 0.3;
+  const auto explicit_vars = initial_vars();
+  auto vars = explicit_vars;
+  Implicit::sources_type sources(3);
+  solve(make_not_null(&vars), make_not_null(&sources), weight, background);
+
+  // The sources are linear in the rest frame of the fluid, so the solution
+  // is known in closed form.
+  const DataVector alpha_w = get(background.lapse) * weight;
+  CHECK_ITERABLE_APPROX(
+      get(get<TildeE>(vars)),
+      (get(get<TildeE>(explicit_vars)) +
+       alpha_w * get(background.sqrt_det_spatial_metric) *
+           get(background.emissivity)) /
+          (1.0 + alpha_w * get(background.absorption_opacity)));
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_APPROX(
+        get<TildeS>(vars).get(i),
+        get<TildeS>(explicit_vars).get(i) /
+            (1.0 + alpha_w * (get(background.absorption_opacity) +
+                              get(background.scattering_opacity))));
+  }
+  CHECK_ITERABLE_APPROX(
+      get(get<::Tags::Source<TildeE>>(sources)),
+      (get(get<TildeE>(vars)) - get(get<TildeE>(explicit_vars))) / weight);
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_APPROX(
+        get<::Tags::Source<TildeS>>(sources).get(i),
+        (get<TildeS>(vars).get(i) - get<TildeS>(explicit_vars).get(i)) /
+            weight);
+  }
+}
+
+void test_moving_fluid() noexcept {
+  const auto background = make_background({{0.1, 0.05, -0.08}});
+  const double weight = 0.2;
+  const auto explicit_vars = initial_vars();
+  auto vars = explicit_vars;
+  Implicit::sources_type sources(3);
+  solve(make_not_null(&vars), make_not_null(&sources), weight, background);
+
+  // Recompute the sources from the solution
+  Scalar<DataVector> closure_factor(DataVector(3, 0.5));
+  tnsr::II<DataVector, 3> pressure_tensor(3_st);
+  Scalar<DataVector> comoving_energy_density(3_st);
+  Scalar<DataVector> comoving_momentum_density_normal(3_st);
+  tnsr::i<DataVector, 3> comoving_momentum_density_spatial(3_st);
+  RadiationTransport::M1Grey::detail::compute_closure_impl(
+      make_not_null(&closure_factor), make_not_null(&pressure_tensor),
+      make_not_null(&comoving_energy_density),
+      make_not_null(&comoving_momentum_density_normal),
+      make_not_null(&comoving_momentum_density_spatial), get<TildeE>(vars),
+      get<TildeS>(vars), background.fluid_velocity,
+      background.lorentz_factor, background.spatial_metric,
+      background.inv_spatial_metric);
+  Scalar<DataVector> source_n(3_st);
+  tnsr::i<DataVector, 3> source_i(3_st);
+  RadiationTransport::M1Grey::detail::compute_m1_hydro_coupling_impl(
+      make_not_null(&source_n), make_not_null(&source_i),
+      background.emissivity, background.absorption_opacity,
+      background.scattering_opacity, comoving_energy_density,
+      comoving_momentum_density_normal, comoving_momentum_density_spatial,
+      background.fluid_velocity, background.lorentz_factor, background.lapse,
+      background.spatial_metric, background.sqrt_det_spatial_metric);
+
+  Approx custom_approx = Approx::custom().epsilon(1.e-8).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(get<::Tags::Source<TildeE>>(sources)),
+                               get(source_n), custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(get<TildeE>(vars)),
+      get(get<TildeE>(explicit_vars)) + weight * get(source_n), custom_approx);
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_CUSTOM_APPROX(get<::Tags::Source<TildeS>>(sources).get(i),
+                                 source_i.get(i), custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(
+        get<TildeS>(vars).get(i),
+        get<TildeS>(explicit_vars).get(i) + weight * source_i.get(i),
+        custom_approx);
+  }
+}
+
+void test_zero_coupling() noexcept {
+  Scalar<DataVector> source_n(DataVector{1.0, 2.0});
+  tnsr::i<DataVector, 3> source_i(DataVector{3.0, 4.0});
+  RadiationTransport::M1Grey::ZeroM1HydroCoupling<neutrino_species>::apply(
+      make_not_null(&source_n), make_not_null(&source_i));
+  CHECK(get(source_n) == DataVector(2, 0.0));
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK(source_i.get(i) == DataVector(2, 0.0));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.RadiationTransport.M1Grey.ImplicitM1HydroCoupling",
+                  "[Unit][M1Grey]") {
+  test_fluid_at_rest();
+  test_moving_fluid();
+  test_zero_coupling();
+}
@@ -406,7 +406,7 @@ using array_indices_for_each_component =
 
 /// Returns a vector of array_indices for each Component.  The vector
 /// is filled with only those array_indices for which there are queued
-/// actions.
+/// simple or threaded actions.
 template <typename ComponentList, typename MockRuntimeSystem>
 auto array_indices_with_queued_actions(
     const gsl::not_null<MockRuntimeSystem*> runner) noexcept
@@ -418,7 +418,8 @@ auto array_indices_with_queued_actions(
     auto& result_this_component = tuples::get<array_indices_tag>(result);
     for (auto& [index, mock_distributed_object] :
          runner->template mock_distributed_objects<Component>()) {
-      if (not mock_distributed_object.is_simple_action_queue_empty()) {
+      if (not mock_distributed_object.is_simple_action_queue_empty() or
+          not mock_distributed_object.is_threaded_action_queue_empty()) {
         result_this_component.push_back(index);
       }
     }
@@ -443,7 +444,9 @@ size_t number_of_queued_actions(
 
 /// Invokes the next queued action on a random Component on a random
 /// array_index of that component.  `array_indices` is the thing returned
-/// by `array_indices_with_queued_actions`
+/// by `array_indices_with_queued_actions`.  If both a simple and a threaded
+/// action are queued on the chosen array_index, one of the two is chosen at
+/// random.
 template <typename ComponentList, typename MockRuntimeSystem,
           typename Generator>
 void invoke_random_queued_action(
@@ -460,7 +463,7 @@ void invoke_random_queued_action(
 
   // Invoke the chosen queued action.
   size_t queued_action_count = 0;
-  tmpl::for_each<ComponentList>([&runner, &array_indices,
+  tmpl::for_each<ComponentList>([&runner, &generator, &array_indices,
                                  &index_of_action_to_invoke,
                                  &queued_action_count](
                                     auto component) noexcept {
@@ -471,9 +474,23 @@ void invoke_random_queued_action(
     if (index_of_action_to_invoke >= queued_action_count and
         index_of_action_to_invoke <
             queued_action_count + num_queued_actions_this_comp) {
-      runner->template invoke_queued_simple_action<Component>(
+      const auto& array_index =
           tuples::get<array_indices_tag>(array_indices)
-              .at(index_of_action_to_invoke - queued_action_count));
+              .at(index_of_action_to_invoke - queued_action_count);
+      const bool simple_queue_is_empty =
+          runner->template is_simple_action_queue_empty<Component>(
+              array_index);
+      const bool threaded_queue_is_empty =
+          runner->template is_threaded_action_queue_empty<Component>(
+              array_index);
+      if (threaded_queue_is_empty or
+          (not simple_queue_is_empty and
+           std::uniform_int_distribution<size_t>(0, 1)(*generator) == 0)) {
+        runner->template invoke_queued_simple_action<Component>(array_index);
+      } else {
+        runner->template invoke_queued_threaded_action<Component>(
+            array_index);
+      }
     }
     queued_action_count += num_queued_actions_this_comp;
   });
@@ -18,6 +18,7 @@
 #include <random>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -31,6 +32,7 @@
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/Domain/DomainTestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits.hpp"
 
 /*!
@@ -395,6 +397,52 @@ void test_inverse_map(const Map& map,
   CHECK_ITERABLE_APPROX(test_point, map.inverse(map(test_point)).value());
 }
 
+/*!
+ * \ingroup TestingFrameworkGroup
+ * \brief Given a Map `map` with an `inverse` overload for `DataVector`s,
+ * checks that the batched inverse of random points in the unit cube is valid
+ * at every point and agrees with the points and with the inverse of each
+ * point.
+ */
+template <typename Map>
+void test_batched_inverse_map(const Map& map) noexcept {
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> real_dis(-1.0, 1.0);
+  const size_t num_points = 20;
+  std::array<DataVector, Map::dim> test_points{};
+  for (size_t d = 0; d < Map::dim; ++d) {
+    gsl::at(test_points, d) = DataVector{num_points};
+    for (size_t s = 0; s < num_points; ++s) {
+      gsl::at(test_points, d)[s] = real_dis(gen);
+    }
+    // Include the origin
+    gsl::at(test_points, d)[0] = 0.0;
+  }
+
+  const auto mapped_points = map(test_points);
+  std::array<DataVector, Map::dim> batched_inverse{};
+  std::vector<bool> is_valid{};
+  map.inverse(make_not_null(&batched_inverse), make_not_null(&is_valid),
+              mapped_points);
+  REQUIRE(is_valid == std::vector<bool>(num_points, true));
+  for (size_t d = 0; d < Map::dim; ++d) {
+    CHECK_ITERABLE_APPROX(gsl::at(batched_inverse, d),
+                          gsl::at(test_points, d));
+  }
+  for (size_t s = 0; s < num_points; ++s) {
+    std::array<double, Map::dim> mapped_point{};
+    for (size_t d = 0; d < Map::dim; ++d) {
+      gsl::at(mapped_point, d) = gsl::at(mapped_points, d)[s];
+    }
+    const auto point_inverse = map.inverse(mapped_point);
+    REQUIRE(point_inverse.has_value());
+    for (size_t d = 0; d < Map::dim; ++d) {
+      CHECK(gsl::at(batched_inverse, d)[s] ==
+            approx(gsl::at(point_inverse.value(), d)));
+    }
+  }
+}
+
 /*!
  * \ingroup TestingFrameworkGroup
  * \brief Given a Map `map`, tests the map functions, including map inverse,
@@ -20,6 +20,7 @@
 #include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Time/Slab.hpp"
 #include "Time/Time.hpp"
@@ -93,6 +94,7 @@ struct MockReceivePoints {
       db::DataBox<DbTags>& box,
       Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
       const typename Metavariables::temporal_id::type& temporal_id,
       std::vector<std::optional<
           IdPair<domain::BlockId,
@@ -123,7 +125,7 @@ struct MockReceivePoints {
 template <typename Metavariables>
 struct mock_interpolator {
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockArrayChare;
+  using chare_type = ActionTesting::MockNodeGroupChare;
   using array_index = size_t;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
@@ -136,9 +138,10 @@ struct mock_interpolator {
                              Metavariables::Phase::Testing, tmpl::list<>>>;
 
   using component_being_mocked = intrp::Interpolator<Metavariables>;
-  using replace_these_simple_actions = tmpl::list<intrp::Actions::ReceivePoints<
-      typename Metavariables::InterpolationTargetA>>;
-  using with_these_simple_actions = tmpl::list<
+  using replace_these_threaded_actions =
+      tmpl::list<intrp::Actions::ReceivePoints<
+          typename Metavariables::InterpolationTargetA>>;
+  using with_these_threaded_actions = tmpl::list<
       MockReceivePoints<typename Metavariables::InterpolationTargetA>>;
 };
 
@@ -162,7 +165,7 @@ void test_interpolation_target(
   ActionTesting::MockRuntimeSystem<metavars> runner{std::move(tuple_of_opts)};
   ActionTesting::set_phase(make_not_null(&runner),
                            metavars::Phase::Initialization);
-  ActionTesting::emplace_component<interp_component>(&runner, 0);
+  ActionTesting::emplace_nodegroup_component<interp_component>(&runner);
   for (size_t i = 0; i < 2; ++i) {
     ActionTesting::next_action<interp_component>(make_not_null(&runner), 0);
   }
@@ -193,13 +196,12 @@ void test_interpolation_target(
 
   // But there should be one in mock_interpolator
 
-  ActionTesting::invoke_queued_simple_action<interp_component>(
+  ActionTesting::invoke_queued_threaded_action<interp_component>(
       make_not_null(&runner), 0);
 
   // Should be no more queued actions in mock_interpolator
-  CHECK(
-      ActionTesting::is_simple_action_queue_empty<mock_interpolator<metavars>>(
-          runner, 0));
+  CHECK(ActionTesting::is_threaded_action_queue_empty<
+        mock_interpolator<metavars>>(runner, 0));
 
   const auto& vars_holders = ActionTesting::get_databox_tag<
       interp_component, intrp::Tags::InterpolatedVarsHolders<metavars>>(runner,
@@ -230,7 +232,7 @@ void test_interpolation_target(
                                intrp::Actions::SendPointsToInterpolator<
                                    typename metavars::InterpolationTargetA>>(
       make_not_null(&runner), 0, new_temporal_id);
-  ActionTesting::invoke_queued_simple_action<interp_component>(
+  ActionTesting::invoke_queued_threaded_action<interp_component>(
       make_not_null(&runner), 0);
 
   // Should be two entries in the vars_infos
@@ -0,0 +1,116 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/Profiling.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Helpers/IO/Observers/ObserverHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/Actions/WriteDataBoxProfiling.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace helpers = TestObservers_detail;
+
+namespace {
+struct RecordedItem : db::SimpleTag {
+  using type = std::vector<double>;
+};
+
+struct Metavariables {
+  using component_list =
+      tmpl::list<helpers::observer_component<Metavariables>,
+                 helpers::observer_writer_component<Metavariables>>;
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<helpers::reduction_data_from_doubles>>;
+
+  enum class Phase { Initialization, Testing, Exit };
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.WriteDataBoxProfiling",
+                  "[Unit][Observers]") {
+  using obs_component = helpers::observer_component<Metavariables>;
+  using obs_writer = helpers::observer_writer_component<Metavariables>;
+
+  tuples::TaggedTuple<observers::Tags::ReductionFileName,
+                      observers::Tags::VolumeFileName>
+      cache_data{};
+  tuples::get<observers::Tags::VolumeFileName>(cache_data) =
+      "./Unit.IO.Observers.WriteDataBoxProfiling";
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{cache_data};
+  ActionTesting::emplace_component<obs_component>(&runner, 0);
+  ActionTesting::emplace_component<obs_writer>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<obs_component>(make_not_null(&runner), 0);
+    ActionTesting::next_action<obs_writer>(make_not_null(&runner), 0);
+  }
+  runner.set_phase(Metavariables::Phase::Testing);
+
+  const std::string h5_file_name =
+      tuples::get<observers::Tags::VolumeFileName>(cache_data) + "0.h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  // Record the statistics directly so the test doesn't depend on
+  // `DATABOX_PROFILING`
+  db::profiling::clear_compute_item_statistics();
+  const std::vector<double> value(4, 1.0);
+  for (size_t i = 0; i < 2; ++i) {
+    db::profiling::detail::record_evaluation<RecordedItem>(
+        std::chrono::steady_clock::now(), value);
+  }
+  db::profiling::detail::record_reset<RecordedItem>();
+  const auto& statistics =
+      db::profiling::compute_item_statistics().at(db::tag_name<RecordedItem>());
+
+  ActionTesting::simple_action<obs_component,
+                               observers::Actions::WriteDataBoxProfiling>(
+      make_not_null(&runner), 0, 1.5);
+  while (not ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner,
+                                                                        0)) {
+    ActionTesting::invoke_queued_threaded_action<obs_writer>(
+        make_not_null(&runner), 0);
+  }
+
+  // scoped to close the file
+  {
+    std::string subfile_name = db::tag_name<RecordedItem>();
+    std::replace(subfile_name.begin(), subfile_name.end(), '/', '_');
+    h5::H5File<h5::AccessType::ReadOnly> read_file{h5_file_name};
+    const auto& dataset =
+        read_file.get<h5::Dat>("/DataBoxProfiling/Pe0/" + subfile_name);
+    CHECK(dataset.get_legend() ==
+          std::vector<std::string>{"Time", "NumberOfEvaluations",
+                                   "NumberOfResets", "EvaluationTime",
+                                   "BytesProduced"});
+    const Matrix data = dataset.get_data();
+    REQUIRE(data.rows() == 1);
+    REQUIRE(data.columns() == 5);
+    CHECK(data(0, 0) == 1.5);
+    CHECK(data(0, 1) == 2.);
+    CHECK(data(0, 2) == 1.);
+    CHECK(data(0, 3) == approx(statistics.evaluation_time));
+    CHECK(data(0, 4) == static_cast<double>(2 * 4 * sizeof(double)));
+  }
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
@@ -0,0 +1,109 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/SerializedData.hpp"
+#include "Parallel/Serialize.hpp"
+#include "Utilities/FileSystem.hpp"
+
+SPECTRE_TEST_CASE("Unit.IO.H5.SerializedData", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.SerializedData.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  std::vector<double> smooth_data(1000);
+  for (size_t i = 0; i < smooth_data.size(); ++i) {
+    smooth_data[i] = 0.5 * static_cast<double>(i % 10);
+  }
+  const std::vector<std::string> strings{"Element0", "Element1"};
+  const std::vector<char> smooth_buffer = serialize(smooth_data);
+  const std::vector<char> strings_buffer = serialize(strings);
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+    auto& serialized_data =
+        h5_file.insert<h5::SerializedData>("/Checkpoint");
+    serialized_data.write_buffer("Smooth", smooth_buffer);
+    serialized_data.write_buffer("Strings", strings_buffer, 0);
+    serialized_data.write_buffer("MaxCompression", smooth_buffer, 9);
+    CHECK(serialized_data.get_buffer("Smooth") == smooth_buffer);
+  }
+  {
+    h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+    const auto& serialized_data =
+        h5_file.get<h5::SerializedData>("/Checkpoint");
+    CHECK(serialized_data.list_buffers() ==
+          std::vector<std::string>{"MaxCompression", "Smooth", "Strings"});
+    CHECK(deserialize<std::vector<double>>(
+              serialized_data.get_buffer("Smooth").data()) == smooth_data);
+    CHECK(deserialize<std::vector<double>>(
+              serialized_data.get_buffer("MaxCompression").data()) ==
+          smooth_data);
+    CHECK(deserialize<std::vector<std::string>>(
+              serialized_data.get_buffer("Strings").data()) == strings);
+  }
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.IO.H5.SerializedData.WriteAsync", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.SerializedData.WriteAsync.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  std::vector<double> data(100, 1.5);
+  std::vector<std::pair<std::string, std::vector<char>>> snapshot{};
+  snapshot.emplace_back("Element0", serialize(data));
+  data.assign(50, -2.0);
+  snapshot.emplace_back("Element1", serialize(data));
+  std::future<void> writing = h5::write_serialized_data_async(
+      h5_file_name, "/Checkpoint", std::move(snapshot));
+  // The data can change while the snapshot is written
+  data.assign(10, 3.0);
+  writing.get();
+  // Appending to an existing subfile
+  h5::write_serialized_data_async(h5_file_name, "/Checkpoint",
+                                  {{"Element2", serialize(data)}}, 0)
+      .get();
+
+  h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+  const auto& serialized_data = h5_file.get<h5::SerializedData>("/Checkpoint");
+  CHECK(serialized_data.list_buffers() ==
+        std::vector<std::string>{"Element0", "Element1", "Element2"});
+  CHECK(deserialize<std::vector<double>>(
+            serialized_data.get_buffer("Element0").data()) ==
+        std::vector<double>(100, 1.5));
+  CHECK(deserialize<std::vector<double>>(
+            serialized_data.get_buffer("Element1").data()) ==
+        std::vector<double>(50, -2.0));
+  CHECK(deserialize<std::vector<double>>(
+            serialized_data.get_buffer("Element2").data()) == data);
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+// [[OutputRegex, Cannot write the buffer 'Buffer' to 'Checkpoint.ser'
+// because it already exists]]
+SPECTRE_TEST_CASE("Unit.IO.H5.SerializedData.WriteTwice", "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name("Unit.IO.H5.SerializedData.WriteTwice.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+  auto& serialized_data = h5_file.insert<h5::SerializedData>("/Checkpoint");
+  serialized_data.write_buffer("Buffer", {'a', 'b'});
+  serialized_data.write_buffer("Buffer", {'c'});
+}
@@ -5,10 +5,12 @@
 
 #include <algorithm>
 #include <boost/iterator/transform_iterator.hpp>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -20,6 +22,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
 
@@ -249,6 +252,14 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
                   tensor_components_and_coords[grid_data_orders[j][i]]);
       }
     }
+    const auto bulk_read_components =
+        volume_file.get_tensor_components(observation_id, expected_components);
+    REQUIRE(bulk_read_components.size() == expected_components.size());
+    for (size_t i = 0; i < expected_components.size(); i++) {
+      CHECK(bulk_read_components[i] ==
+            volume_file.get_tensor_component(observation_id,
+                                             expected_components[i]));
+    }
   };
   for (size_t i = 0; i < observation_ids.size(); ++i) {
     check_time(observation_ids[i], observation_values[i]);
@@ -276,6 +287,70 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   }
 }
 
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.Compression", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.Compression.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  CHECK(get_output(h5::Compression::Method::None) == "None");
+  CHECK(get_output(h5::Compression::Method::Float32) == "Float32");
+  CHECK(get_output(h5::Compression::Method::Quantized) == "Quantized");
+
+  const size_t number_of_points = 1000;
+  DataVector data(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    data[i] = 100.0 * sin(0.01 * static_cast<double>(i)) + 0.3;
+  }
+  const size_t observation_id = 4444;
+  const double absolute_tolerance = 1.0e-4;
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+    auto& volume_file =
+        h5_file.insert<h5::VolumeData>("/element_data", version_number);
+    volume_file.write_volume_data(
+        observation_id, 1.0,
+        {{{number_of_points},
+          {TensorComponent{"A/U", data}, TensorComponent{"A/V", data},
+           TensorComponent{"A/W", data}},
+          {Spectral::Basis::Legendre},
+          {Spectral::Quadrature::Gauss}}},
+        {{"V", {h5::Compression::Method::Float32}},
+         {"W", {h5::Compression::Method::Quantized, absolute_tolerance}}});
+  }
+  h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+  const auto& volume_file =
+      h5_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.get_compression(observation_id, "U").method ==
+        h5::Compression::Method::None);
+  CHECK(volume_file.get_compression(observation_id, "V").method ==
+        h5::Compression::Method::Float32);
+  const auto quantized = volume_file.get_compression(observation_id, "W");
+  CHECK(quantized.method == h5::Compression::Method::Quantized);
+  CHECK(quantized.absolute_tolerance == absolute_tolerance);
+  auto components = volume_file.list_tensor_components(observation_id);
+  std::sort(components.begin(), components.end());
+  CHECK(components == std::vector<std::string>{"U", "V", "W"});
+
+  // Compressed tensor components are decompressed when they are read
+  CHECK(volume_file.get_tensor_component(observation_id, "U") == data);
+  const DataVector float32_data =
+      volume_file.get_tensor_component(observation_id, "V");
+  const DataVector quantized_data =
+      volume_file.get_tensor_component(observation_id, "W");
+  REQUIRE(float32_data.size() == number_of_points);
+  REQUIRE(quantized_data.size() == number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    CHECK(float32_data[i] == static_cast<double>(static_cast<float>(data[i])));
+    CHECK(std::abs(quantized_data[i] - data[i]) <= absolute_tolerance);
+  }
+  CHECK(quantized_data != data);
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
 // [[OutputRegex, The expected format of the tensor component names is
 // 'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in]]
 [[noreturn]] SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ComponentFormat0",
@@ -374,3 +449,26 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.FindNoObservationId",
         {Spectral::Quadrature::Gauss}}});
   volume_file.find_observation_id(11.0);
 }
+
+// [[OutputRegex, The absolute tolerance for compressing tensor component 'S'
+// must be positive]]
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.CompressionTolerance",
+                  "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.CompressionTolerance.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+  auto& volume_file =
+      h5_file.insert<h5::VolumeData>("/element_data", version_number);
+  volume_file.write_volume_data(
+      100, 10.0,
+      {{{2},
+        {TensorComponent{"A/S", {1.0, 2.0}}},
+        {Spectral::Basis::Legendre},
+        {Spectral::Quadrature::Gauss}}},
+      {{"S", {h5::Compression::Method::Quantized, 0.0}}});
+}
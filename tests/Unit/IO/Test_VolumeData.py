@@ -39,6 +39,39 @@ class TestVolumeDataWriting(unittest.TestCase):
         vol_file = self.h5_file.get_vol(path="/element_data")
         self.assertEqual(vol_file.get_header()[0:20], "#\n# File created on ")
 
+    # Test that compressed tensor components are decompressed when read
+    def test_write_compressed(self):
+        self.h5_file.insert_vol(path="/element_data", version=0)
+        vol_file = self.h5_file.get_vol(path="/element_data")
+        data = np.sin(np.linspace(0., 3., 8))
+        vol_file.write_volume_data(
+            0, 1.0, [
+                ds.ElementVolumeData([2, 2, 2], [
+                    ds.TensorComponent("grid/field_1", ds.DataVector(data)),
+                    ds.TensorComponent("grid/field_2", ds.DataVector(data))
+                ], [Basis.Legendre] * 3, [Quadrature.Gauss] * 3)
+            ],
+            compression={
+                "field_1":
+                spectre_h5.Compression(spectre_h5.Compression.Method.Float32),
+                "field_2":
+                spectre_h5.Compression(
+                    spectre_h5.Compression.Method.Quantized,
+                    absolute_tolerance=1.e-3)
+            })
+        self.assertEqual(
+            vol_file.get_compression(0, "field_2").method,
+            spectre_h5.Compression.Method.Quantized)
+        npt.assert_allclose(np.asarray(
+            vol_file.get_tensor_component(0, "field_1")),
+                            data,
+                            rtol=1.e-7)
+        npt.assert_allclose(np.asarray(
+            vol_file.get_tensor_component(0, "field_2")),
+                            data,
+                            rtol=0.,
+                            atol=1.e-3)
+
 
 class TestVolumeData(unittest.TestCase):
     # Test Fixtures
@@ -158,6 +191,22 @@ class TestVolumeData(unittest.TestCase):
                         observation_id=obs_id,
                         tensor_component=expected_tensor_component_names[i]))
                 [0:8], expected_tensor_component_data)
+        # Test reading all tensor components at once
+        all_components = self.vol_file.get_tensor_components(
+            observation_id=obs_id)
+        self.assertEqual(set(all_components.keys()),
+                         set(expected_tensor_component_names))
+        for i, expected_tensor_component_data in \
+                enumerate(self.tensor_component_data[:2]):
+            component = all_components[expected_tensor_component_names[i]]
+            self.assertIsInstance(component, np.ndarray)
+            npt.assert_almost_equal(component[0:8],
+                                    expected_tensor_component_data)
+        selected_components = self.vol_file.get_tensor_components(
+            observation_id=obs_id, tensor_components=['field_2'])
+        self.assertEqual(list(selected_components.keys()), ['field_2'])
+        npt.assert_almost_equal(selected_components['field_2'][0:8],
+                                self.tensor_component_data[1])
 
     # Test that the offset and length for certain grid is retrieved correctly
     def test_offset_and_length_for_grid(self):
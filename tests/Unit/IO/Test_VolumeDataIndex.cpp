@@ -0,0 +1,174 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataIndex.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+void write_observation(const std::string& file_name, const size_t grid_offset,
+                       const size_t observation_id,
+                       const double observation_value) {
+  h5::H5File<h5::AccessType::ReadWrite> file(file_name, true);
+  auto& volume_file = file.try_insert<h5::VolumeData>("/element_data");
+  const DataVector x{0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0};
+  const DataVector y{0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 1.0};
+  const DataVector z{0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0};
+  std::vector<ElementVolumeData> element_data{};
+  for (size_t i = 0; i < 2; ++i) {
+    const std::string grid_name =
+        "[[" + std::to_string(grid_offset + i) + "]]";
+    element_data.push_back(
+        {{2, 2, 2},
+         {TensorComponent{grid_name + "/InertialCoordinates_x", x},
+          TensorComponent{grid_name + "/InertialCoordinates_y", y},
+          TensorComponent{grid_name + "/InertialCoordinates_z", z},
+          TensorComponent{grid_name + "/S", observation_value * x},
+          TensorComponent{grid_name + "/T_x", observation_value * y},
+          TensorComponent{grid_name + "/T_y", observation_value * z},
+          TensorComponent{grid_name + "/T_z", observation_value * x}},
+         {3, Spectral::Basis::Legendre},
+         {3, Spectral::Quadrature::GaussLobatto}});
+  }
+  volume_file.write_volume_data(observation_id, observation_value,
+                                element_data);
+}
+
+h5::VolumeObservationMetadata expected_metadata(
+    const size_t observation_id, const double observation_value) noexcept {
+  return {observation_id,
+          observation_value,
+          3,
+          16,
+          2,
+          {"InertialCoordinates_x", "InertialCoordinates_y",
+           "InertialCoordinates_z", "S", "T_x", "T_y", "T_z"}};
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeDataIndex", "[Unit][IO][H5]") {
+  const std::vector<std::string> file_names{"Unit.IO.H5.VolumeDataIndex0.h5",
+                                            "Unit.IO.H5.VolumeDataIndex1.h5"};
+  const std::string index_file_name = "Unit.IO.H5.VolumeDataIndex.txt";
+  for (const auto& file_name : file_names) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+  if (file_system::check_if_file_exists(index_file_name)) {
+    file_system::rm(index_file_name, true);
+  }
+
+  for (size_t i = 0; i < file_names.size(); ++i) {
+    write_observation(file_names[i], 2 * i, 30, 2.5);
+    write_observation(file_names[i], 2 * i, 10, 0.5);
+  }
+
+  std::vector<h5::VolumeFileIndex> expected_index{};
+  for (const auto& file_name : file_names) {
+    expected_index.push_back(
+        {file_name, {expected_metadata(10, 0.5), expected_metadata(30, 2.5)}});
+  }
+  for (const size_t number_of_threads : {1_st, 2_st, 4_st}) {
+    CAPTURE(number_of_threads);
+    CHECK(h5::index_volume_files(file_names, "element_data",
+                                 "InertialCoordinates",
+                                 number_of_threads) == expected_index);
+  }
+  CHECK(h5::index_volume_files({}, "element_data", "InertialCoordinates", 4)
+            .empty());
+
+  {
+    INFO("Write and read the index");
+    h5::write_volume_file_index(index_file_name, expected_index);
+    CHECK(h5::read_volume_file_index(index_file_name) == expected_index);
+    file_system::rm(index_file_name, true);
+
+    // Names with whitespace and quotes survive the round trip
+    auto index_with_spaces = expected_index;
+    index_with_spaces[0].file_name = "Volume Data \"0\".h5";
+    index_with_spaces[0].observations[0].tensor_components[3] =
+        "Pressure (code units)";
+    h5::write_volume_file_index(index_file_name, index_with_spaces);
+    CHECK(h5::read_volume_file_index(index_file_name) == index_with_spaces);
+    file_system::rm(index_file_name, true);
+  }
+
+  {
+    INFO("Update an index");
+    auto previous_index = expected_index;
+    // Observations in the previous index are not read again, so this value
+    // survives the update
+    previous_index[0].observations[1].observation_value = 3.5;
+    // Observations that are no longer in the file are dropped
+    previous_index[1].observations.push_back(expected_metadata(40, 4.));
+    for (size_t i = 0; i < file_names.size(); ++i) {
+      write_observation(file_names[i], 2 * i, 20, 1.5);
+    }
+    const auto updated_index = h5::index_volume_files(
+        file_names, "element_data", "InertialCoordinates", 2, previous_index);
+    REQUIRE(updated_index.size() == 2);
+    CHECK(updated_index[0] ==
+          h5::VolumeFileIndex{file_names[0],
+                              {expected_metadata(10, 0.5),
+                               expected_metadata(20, 1.5),
+                               expected_metadata(30, 3.5)}});
+    CHECK(updated_index[1] ==
+          h5::VolumeFileIndex{file_names[1],
+                              {expected_metadata(10, 0.5),
+                               expected_metadata(20, 1.5),
+                               expected_metadata(30, 2.5)}});
+  }
+
+  {
+    INFO("Generate XDMF");
+    const auto xdmf = h5::volume_file_index_to_xdmf(
+        expected_index, "element_data", "InertialCoordinates", 1., 10., 1);
+    const std::string grid_path =
+        "Unit.IO.H5.VolumeDataIndex1.h5:/element_data.vol/ObservationId30";
+    const std::string expected_xdmf =
+        "<?xml version=\"1.0\" ?>\n"
+        "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\">\n"
+        "<Xdmf Version=\"2.0\">\n"
+        "<Domain>\n"
+        "<Grid Name=\"Evolution\" GridType=\"Collection\" "
+        "CollectionType=\"Temporal\">\n"
+        "  <Grid Name=\"Grids\" GridType=\"Collection\">\n"
+        "    <Time Value=\"2.50000000000000e+00\"/>\n";
+    CHECK(xdmf.substr(0, expected_xdmf.size()) == expected_xdmf);
+    // Only one observation is in the time interval
+    CHECK(xdmf.find("ObservationId10") == std::string::npos);
+    CHECK(xdmf.find("<Topology TopologyType=\"Hexahedron\" "
+                    "NumberOfElements=\"2\">") != std::string::npos);
+    CHECK(xdmf.find("          " + grid_path + "/connectivity\n") !=
+          std::string::npos);
+    CHECK(xdmf.find("          " + grid_path + "/InertialCoordinates_z\n") !=
+          std::string::npos);
+    CHECK(xdmf.find("<Attribute Name=\"S\" AttributeType=\"Scalar\" "
+                    "Center=\"Node\">") != std::string::npos);
+    CHECK(xdmf.find("<Attribute Name=\"T\" AttributeType=\"Vector\" "
+                    "Center=\"Node\">") != std::string::npos);
+    CHECK(xdmf.find("<Attribute Name=\"InertialCoordinates\"") ==
+          std::string::npos);
+    CHECK(xdmf.substr(xdmf.size() - 35) ==
+          "  </Grid>\n</Grid>\n</Domain>\n</Xdmf>");
+  }
+
+  for (const auto& file_name : file_names) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+}
@@ -129,7 +129,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.CleanUp", "[Unit]") {
           .temporal_ids_when_data_has_been_interpolated.empty());
 
   // Call the action on InterpolationTagA
-  runner.simple_action<
+  runner.threaded_action<
       mock_interpolator<metavars>,
       intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagA>>(
       0, temporal_id);
@@ -169,7 +169,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.CleanUp", "[Unit]") {
           .temporal_ids_when_data_has_been_interpolated.empty());
 
   // Call the action on InterpolationTagC
-  runner.simple_action<
+  runner.threaded_action<
       mock_interpolator<metavars>,
       intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagC>>(
       0, temporal_id);
@@ -217,7 +217,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.CleanUp", "[Unit]") {
 
   // Call the action on InterpolationTagB. This will clean up everything
   // since all the tags have now cleaned up.
-  runner.simple_action<
+  runner.threaded_action<
       mock_interpolator<metavars>,
       intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagB>>(
       0, temporal_id);
@@ -250,6 +250,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.CleanUp", "[Unit]") {
 
   // There should be no queued actions; verify this.
   CHECK(runner.is_simple_action_queue_empty<mock_interpolator<metavars>>(0));
+  CHECK(
+      runner.is_threaded_action_queue_empty<mock_interpolator<metavars>>(0));
 }
 
 }  // namespace
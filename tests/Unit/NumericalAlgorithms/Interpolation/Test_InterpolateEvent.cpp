@@ -23,11 +23,13 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "Time/Slab.hpp"
 #include "Time/Tags.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -74,8 +76,10 @@ struct MockInterpolatorReceiveVolumeData {
   static void apply(
       db::DataBox<DbTags>& /*box*/,
       Parallel::GlobalCache<Metavariables>& /*cache*/,
-      const ArrayIndex& /*array_index*/, const ::TimeStepId& temporal_id,
-      const ElementId<VolumeDim>& element_id, const ::Mesh<VolumeDim>& mesh,
+      const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+      const ::TimeStepId& temporal_id, const ElementId<VolumeDim>& element_id,
+      const ::Mesh<VolumeDim>& mesh,
       Variables<typename Metavariables::interpolator_source_vars>&&
           vars) noexcept {
     results.temporal_id = temporal_id;
@@ -107,13 +111,13 @@ struct MockAddTemporalIdsToInterpolationTarget {
 template <typename Metavariables>
 struct mock_interpolator {
   using component_being_mocked = intrp::Interpolator<Metavariables>;
-  using replace_these_simple_actions =
+  using replace_these_threaded_actions =
       tmpl::list<intrp::Actions::InterpolatorReceiveVolumeData>;
-  using with_these_simple_actions =
+  using with_these_threaded_actions =
       tmpl::list<MockInterpolatorReceiveVolumeData>;
 
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockGroupChare;
+  using chare_type = ActionTesting::MockNodeGroupChare;
   using array_index = size_t;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       typename Metavariables::Phase, Metavariables::Phase::Initialization,
@@ -190,7 +194,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.InterpolateEvent",
   ActionTesting::MockRuntimeSystem<metavars> runner{{}};
   ActionTesting::set_phase(make_not_null(&runner),
                            metavars::Phase::Initialization);
-  ActionTesting::emplace_group_component<interp_component>(&runner);
+  ActionTesting::emplace_nodegroup_component<interp_component>(&runner);
   ActionTesting::next_action<interp_component>(make_not_null(&runner), 0);
   ActionTesting::emplace_component<interp_target_component>(&runner, 0);
   ActionTesting::next_action<interp_target_component>(make_not_null(&runner),
@@ -221,10 +225,11 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.InterpolateEvent",
             array_index, std::add_pointer_t<elem_component>{});
 
   // Invoke all actions
-  runner.invoke_queued_simple_action<interp_component>(0);
+  runner.invoke_queued_threaded_action<interp_component>(0);
   runner.invoke_queued_simple_action<interp_target_component>(0);
 
-  // No more queued simple actions.
+  // No more queued actions.
+  CHECK(runner.is_threaded_action_queue_empty<interp_component>(0));
   CHECK(runner.is_simple_action_queue_empty<interp_component>(0));
   CHECK(runner.is_simple_action_queue_empty<interp_target_component>(0));
   CHECK(runner.is_simple_action_queue_empty<elem_component>(array_index));
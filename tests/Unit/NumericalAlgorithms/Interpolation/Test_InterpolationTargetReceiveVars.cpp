@@ -24,6 +24,7 @@
 #include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetReceiveVars.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Slab.hpp"
@@ -136,6 +137,7 @@ struct MockCleanUpInterpolator {
       db::DataBox<DbTags>& box,
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
       const typename Metavariables::temporal_id::type& temporal_id) noexcept {
     Slab slab(0.0, 1.0);
     CHECK(temporal_id == TimeStepId(true, 0, Time(slab, Rational(13, 15))));
@@ -240,7 +242,7 @@ struct MockPostInterpolationCallbackWithInvalidPoints {
 template <typename Metavariables>
 struct mock_interpolator {
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockArrayChare;
+  using chare_type = ActionTesting::MockNodeGroupChare;
   using array_index = size_t;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
@@ -253,10 +255,10 @@ struct mock_interpolator {
                              Metavariables::Phase::Testing, tmpl::list<>>>;
 
   using component_being_mocked = intrp::Interpolator<Metavariables>;
-  using replace_these_simple_actions =
+  using replace_these_threaded_actions =
       tmpl::list<intrp::Actions::CleanUpInterpolator<
           typename Metavariables::InterpolationTargetA>>;
-  using with_these_simple_actions = tmpl::list<
+  using with_these_threaded_actions = tmpl::list<
       MockCleanUpInterpolator<typename Metavariables::InterpolationTargetA>>;
 };
 
@@ -311,7 +313,7 @@ void test_interpolation_target_receive_vars() noexcept {
 
   ActionTesting::MockRuntimeSystem<metavars> runner{
       {domain_creator.create_domain()}};
-  ActionTesting::emplace_component<interp_component>(&runner, 0);
+  ActionTesting::emplace_nodegroup_component<interp_component>(&runner);
   for (size_t i = 0; i < 2; ++i) {
     ActionTesting::next_action<interp_component>(make_not_null(&runner), 0);
   }
@@ -371,8 +373,8 @@ void test_interpolation_target_receive_vars() noexcept {
   // Should be no queued simple action until we get num_points points.
   CHECK(
       ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
-  CHECK(
-      ActionTesting::is_simple_action_queue_empty<interp_component>(runner, 0));
+  CHECK(ActionTesting::is_threaded_action_queue_empty<interp_component>(runner,
+                                                                       0));
   CHECK(ActionTesting::get_databox_tag<
             target_component, intrp::Tags::TemporalIds<temporal_id_type>>(
             runner, 0)
@@ -401,9 +403,8 @@ void test_interpolation_target_receive_vars() noexcept {
   // Should be no queued simple action until we have added 10 points.
   CHECK(
       ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
-  CHECK(
-      ActionTesting::is_simple_action_queue_empty<mock_interpolator<metavars>>(
-          runner, 0));
+  CHECK(ActionTesting::is_threaded_action_queue_empty<
+        mock_interpolator<metavars>>(runner, 0));
 
   vars_src.clear();
   global_offsets.clear();
@@ -460,9 +461,9 @@ void test_interpolation_target_receive_vars() noexcept {
               runner, 0)
               .count(first_temporal_id) == 0);
 
-    // Now there should be a queued simple action, which is
+    // Now there should be a queued threaded action, which is
     // CleanUpInterpolator, which here we mock.
-    ActionTesting::invoke_queued_simple_action<interp_component>(
+    ActionTesting::invoke_queued_threaded_action<interp_component>(
         make_not_null(&runner), 0);
 
     // Check that MockCleanUpInterpolator was called.  It resets the
@@ -521,8 +522,8 @@ void test_interpolation_target_receive_vars() noexcept {
   // There should be no more queued actions; verify this.
   CHECK(
       ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
-  CHECK(
-      ActionTesting::is_simple_action_queue_empty<interp_component>(runner, 0));
+  CHECK(ActionTesting::is_threaded_action_queue_empty<interp_component>(runner,
+                                                                       0));
 }
 
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.InterpolationTarget.ReceiveVars",
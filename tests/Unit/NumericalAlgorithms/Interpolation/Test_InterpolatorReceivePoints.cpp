@@ -190,7 +190,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceivePoints",
   // Make sure that we have one Element registered,
   // or else ReceivePoints will (correctly) do nothing because it
   // thinks it will never have any Elements to interpolate onto.
-  runner.simple_action<interp_component, ::intrp::Actions::RegisterElement>(0);
+  runner.threaded_action<interp_component, ::intrp::Actions::RegisterElement>(
+      0);
 
   const auto domain = domain_creator.create_domain();
   const auto block_logical_coords = [&domain]() noexcept {
@@ -207,7 +208,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceivePoints",
   Slab slab(0.0, 1.0);
   TimeStepId temporal_id(true, 0, Time(slab, Rational(11, 15)));
 
-  runner.simple_action<
+  runner.threaded_action<
       mock_interpolator<metavars>,
       intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
       0, temporal_id, block_logical_coords);
@@ -235,6 +236,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceivePoints",
 
   // There should be no more queued actions; verify this.
   CHECK(runner.is_simple_action_queue_empty<mock_interpolator<metavars>>(0));
+  CHECK(
+      runner.is_threaded_action_queue_empty<mock_interpolator<metavars>>(0));
 
   // Make sure that the action was not called.
   CHECK(num_calls_of_target_receive_vars == 0);
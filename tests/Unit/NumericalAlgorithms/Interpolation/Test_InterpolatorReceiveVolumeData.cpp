@@ -285,7 +285,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
   // Tell the interpolator how many elements there are by registering
   // each one.
   for (size_t i = 0; i < element_ids.size(); ++i) {
-    runner.simple_action<interp_component, intrp::Actions::RegisterElement>(0);
+    runner.threaded_action<interp_component, intrp::Actions::RegisterElement>(
+        0);
   }
   ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
 
@@ -311,8 +312,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
                    5.0 * get<2>(inertial_coords);
 
     // Call the action on each element_id.
-    runner.simple_action<interp_component,
-                         ::intrp::Actions::InterpolatorReceiveVolumeData>(
+    runner.threaded_action<interp_component,
+                           ::intrp::Actions::InterpolatorReceiveVolumeData>(
         0, temporal_id, element_id, mesh, std::move(output_vars));
   }
 
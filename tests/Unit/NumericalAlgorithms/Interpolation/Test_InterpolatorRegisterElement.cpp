@@ -101,13 +101,15 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.RegisterElement",
                                        ::intrp::Tags::NumberOfElements>(
             runner, 0) == 0);
 
-  runner.simple_action<interp_component, ::intrp::Actions::RegisterElement>(0);
+  runner.threaded_action<interp_component, ::intrp::Actions::RegisterElement>(
+      0);
 
   CHECK(ActionTesting::get_databox_tag<interp_component,
                                        ::intrp::Tags::NumberOfElements>(
             runner, 0) == 1);
 
-  runner.simple_action<interp_component, ::intrp::Actions::RegisterElement>(0);
+  runner.threaded_action<interp_component, ::intrp::Actions::RegisterElement>(
+      0);
 
   CHECK(ActionTesting::get_databox_tag<interp_component,
                                        ::intrp::Tags::NumberOfElements>(
@@ -118,13 +120,14 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.RegisterElement",
   ActionTesting::next_action<elem_component>(make_not_null(&runner), 0);
   ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
 
-  runner.invoke_queued_simple_action<interp_component>(0);
+  runner.invoke_queued_threaded_action<interp_component>(0);
 
   CHECK(ActionTesting::get_databox_tag<interp_component,
                                        ::intrp::Tags::NumberOfElements>(
             runner, 0) == 3);
 
-  // No more queued simple actions.
+  // No more queued actions.
+  CHECK(runner.is_threaded_action_queue_empty<interp_component>(0));
   CHECK(runner.is_simple_action_queue_empty<interp_component>(0));
   CHECK(runner.is_simple_action_queue_empty<elem_component>(0));
 }
@@ -182,7 +182,7 @@ struct MockInterpolationTarget {
 template <typename Metavariables>
 struct MockInterpolator {
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockGroupChare;
+  using chare_type = ActionTesting::MockNodeGroupChare;
   using array_index = size_t;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
@@ -322,11 +322,11 @@ SPECTRE_TEST_CASE(
 
   ActionTesting::set_phase(make_not_null(&runner),
                            metavars::Phase::Initialization);
-  ActionTesting::emplace_group_component<interp_component>(&runner);
+  ActionTesting::emplace_nodegroup_component<interp_component>(&runner);
   for (size_t i = 0; i < 2; ++i) {
-    for (size_t core = 0; core < 6; ++core) {
+    for (size_t node = 0; node < 3; ++node) {
       ActionTesting::next_action<interp_component>(make_not_null(&runner),
-                                                   core);
+                                                   node);
     }
   }
   ActionTesting::emplace_singleton_component<target_a_component>(
@@ -370,19 +370,19 @@ SPECTRE_TEST_CASE(
   // each one. Normally intrp::Actions::RegisterElement is called by
   // RegisterElementWithInterpolator, and invoked on the ckLocalBranch
   // of the interpolator that is associated with each element
-  // (i.e. the local core on each element).
-  // Here we assign elements round-robin to the mock cores.
-  // And for group components, the array_index is the global core index.
-  const size_t num_cores = runner.num_global_cores();
-  std::unordered_map<ElementId<3>, size_t> mock_core_for_each_element;
-  size_t core_for_next_element = 0;
+  // (i.e. the local node of each element).
+  // Here we assign elements round-robin to the mock nodes.
+  // And for nodegroup components, the array_index is the node index.
+  const size_t num_nodes = runner.num_nodes();
+  std::unordered_map<ElementId<3>, size_t> mock_node_for_each_element;
+  size_t node_for_next_element = 0;
   for (const auto& element_id : element_ids) {
-    mock_core_for_each_element.insert({element_id, core_for_next_element});
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::RegisterElement>(
-        make_not_null(&runner), core_for_next_element);
-    if (++core_for_next_element >= num_cores) {
-      core_for_next_element = 0;
+    mock_node_for_each_element.insert({element_id, node_for_next_element});
+    ActionTesting::threaded_action<interp_component,
+                                   intrp::Actions::RegisterElement>(
+        make_not_null(&runner), node_for_next_element);
+    if (++node_for_next_element >= num_nodes) {
+      node_for_next_element = 0;
     }
   }
 
@@ -455,9 +455,9 @@ SPECTRE_TEST_CASE(
             tmpl::list<gr::Tags::SpatialMetric<3, Frame::Inertial>>{}));
 
     // Call the InterpolatorReceiveVolumeData action on each element_id.
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::InterpolatorReceiveVolumeData>(
-        make_not_null(&runner), mock_core_for_each_element.at(element_id),
+    ActionTesting::threaded_action<
+        interp_component, intrp::Actions::InterpolatorReceiveVolumeData>(
+        make_not_null(&runner), mock_node_for_each_element.at(element_id),
         temporal_id, element_id, mesh, std::move(output_vars));
   }
 
@@ -476,14 +476,9 @@ SPECTRE_TEST_CASE(
             metavars::component_list>(make_not_null(&runner));
   }
 
-  // There should be three more threaded actions, so invoke them and check
-  // that there are no more.  They should all be on node zero.
-  ActionTesting::invoke_queued_threaded_action<obs_writer>(
-      make_not_null(&runner), 0);
-  ActionTesting::invoke_queued_threaded_action<obs_writer>(
-      make_not_null(&runner), 0);
-  ActionTesting::invoke_queued_threaded_action<obs_writer>(
-      make_not_null(&runner), 0);
+  // The threaded actions of the observer writer (which write the reduction
+  // data) were invoked above along with the other queued actions, so there
+  // should be no more.
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 2));
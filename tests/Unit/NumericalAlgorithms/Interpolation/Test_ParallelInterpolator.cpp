@@ -198,7 +198,7 @@ struct mock_interpolation_target {
 template <typename Metavariables>
 struct mock_interpolator {
   using metavariables = Metavariables;
-  using chare_type = ActionTesting::MockGroupChare;
+  using chare_type = ActionTesting::MockNodeGroupChare;
   using array_index = size_t;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
@@ -296,12 +296,12 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.Integration",
       std::move(tuple_of_opts), {}, {2, 3, 1}};
   ActionTesting::set_phase(make_not_null(&runner),
                            metavars::Phase::Initialization);
-  ActionTesting::emplace_group_component<interp_component>(&runner);
+  ActionTesting::emplace_nodegroup_component<interp_component>(&runner);
   for (size_t i = 0; i < 2; ++i) {
-     for (size_t core = 0; core < 6; ++core) {
-       ActionTesting::next_action<interp_component>(make_not_null(&runner),
-                                                    core);
-     }
+    for (size_t node = 0; node < 3; ++node) {
+      ActionTesting::next_action<interp_component>(make_not_null(&runner),
+                                                   node);
+    }
   }
   ActionTesting::emplace_singleton_component<target_a_component>(
       &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{1});
@@ -339,19 +339,19 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.Integration",
   // Normally intrp::Actions::RegisterElement is called by
   // RegisterElementWithInterpolator, and invoked on the ckLocalBranch
   // of the interpolator that is associated with each element
-  // (i.e. the local core on each element).
-  // Here we assign elements round-robin to the mock cores.
-  // And for group components, the array_index is the global core index.
-  const size_t num_cores = runner.num_global_cores();
-  std::unordered_map<ElementId<3>, size_t> mock_core_for_each_element;
-  size_t core_for_next_element = 0;
+  // (i.e. the local node of each element).
+  // Here we assign elements round-robin to the mock nodes.
+  // And for nodegroup components, the array_index is the node index.
+  const size_t num_nodes = runner.num_nodes();
+  std::unordered_map<ElementId<3>, size_t> mock_node_for_each_element;
+  size_t node_for_next_element = 0;
   for (const auto& element_id : element_ids) {
-    mock_core_for_each_element.insert({element_id, core_for_next_element});
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::RegisterElement>(
-        make_not_null(&runner), core_for_next_element);
-    if (++core_for_next_element >= num_cores) {
-      core_for_next_element = 0;
+    mock_node_for_each_element.insert({element_id, node_for_next_element});
+    ActionTesting::threaded_action<interp_component,
+                                   intrp::Actions::RegisterElement>(
+        make_not_null(&runner), node_for_next_element);
+    if (++node_for_next_element >= num_nodes) {
+      node_for_next_element = 0;
     }
   }
 
@@ -392,9 +392,9 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.Integration",
                          5.0 * get<2>(inertial_coords);
 
     // Call the InterpolatorReceiveVolumeData action on each element_id.
-    ActionTesting::simple_action<interp_component,
-                                 intrp::Actions::InterpolatorReceiveVolumeData>(
-        make_not_null(&runner), mock_core_for_each_element.at(element_id),
+    ActionTesting::threaded_action<
+        interp_component, intrp::Actions::InterpolatorReceiveVolumeData>(
+        make_not_null(&runner), mock_node_for_each_element.at(element_id),
         temporal_id, element_id, mesh, std::move(output_vars));
   }
 
@@ -425,12 +425,14 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.Integration",
                               metavars::InterpolationTargetA>>(
       make_not_null(&runner), 0, std::vector<TimeStepId>{temporal_id});
   // ...so make sure it was ignored by checking that there isn't anything
-  // else in the simple_action queue of the target or the interpolator.
+  // else in the action queues of the target or the interpolator.
   CHECK(ActionTesting::is_simple_action_queue_empty<target_a_component>(runner,
                                                                         0));
-  for (size_t core = 0; core < 6; ++core) {
+  for (size_t node = 0; node < 3; ++node) {
     CHECK(ActionTesting::is_simple_action_queue_empty<interp_component>(runner,
-                                                                        core));
+                                                                        node));
+    CHECK(ActionTesting::is_threaded_action_queue_empty<interp_component>(
+        runner, node));
   }
 }
 }  // namespace
@@ -208,6 +208,68 @@ void test_linear_filter() {
                           Spectral::Quadrature::GaussLobatto>();
 }
 
+template <Spectral::Basis BasisType, Spectral::Quadrature QuadratureType>
+void test_modal_truncation_impl() {
+  CAPTURE(BasisType);
+  CAPTURE(QuadratureType);
+  constexpr size_t min_points =
+      Spectral::minimum_number_of_points<BasisType, QuadratureType>;
+  constexpr size_t max_points = Spectral::maximum_number_of_points<BasisType>;
+  for (size_t n = min_points; n <= max_points; ++n) {
+    CAPTURE(n);
+    const Mesh<1> source_mesh{n, BasisType, QuadratureType};
+    const auto& nodal_to_modal_matrix =
+        Spectral::nodal_to_modal_matrix<BasisType, QuadratureType>(n);
+    const DataVector u = exp(Spectral::collocation_points(source_mesh));
+    DataVector u_spectral(n);
+    dgemv_('N', n, n, 1.0, nodal_to_modal_matrix.data(),
+           nodal_to_modal_matrix.spacing(), u.data(), 1, 0.0,
+           u_spectral.data(), 1);
+    for (size_t m = min_points; m <= n; ++m) {
+      CAPTURE(m);
+      const Matrix truncation =
+          Spectral::modal_truncation_matrix(source_mesh, m);
+      CHECK(truncation.rows() == m);
+      CHECK(truncation.columns() == n);
+      DataVector u_truncated(m);
+      dgemv_('N', m, n, 1.0, truncation.data(), truncation.spacing(),
+             u.data(), 1, 0.0, u_truncated.data(), 1);
+      // The truncated data has the lowest `m` modes of the source data
+      const auto& target_nodal_to_modal_matrix =
+          Spectral::nodal_to_modal_matrix<BasisType, QuadratureType>(m);
+      DataVector u_truncated_spectral(m);
+      dgemv_('N', m, m, 1.0, target_nodal_to_modal_matrix.data(),
+             target_nodal_to_modal_matrix.spacing(), u_truncated.data(), 1,
+             0.0, u_truncated_spectral.data(), 1);
+      for (size_t s = 0; s < m; ++s) {
+        CHECK(u_truncated_spectral[s] == approx(u_spectral[s]));
+      }
+      // Polynomials that the target mesh represents are unchanged
+      const DataVector polynomial =
+          unit_polynomial(m - 1, Spectral::collocation_points(source_mesh));
+      DataVector polynomial_truncated(m);
+      dgemv_('N', m, n, 1.0, truncation.data(), truncation.spacing(),
+             polynomial.data(), 1, 0.0, polynomial_truncated.data(), 1);
+      CHECK_ITERABLE_APPROX(
+          polynomial_truncated,
+          unit_polynomial(
+              m - 1, Spectral::collocation_points<BasisType, QuadratureType>(
+                         m)));
+    }
+  }
+}
+
+void test_modal_truncation() {
+  test_modal_truncation_impl<Spectral::Basis::Legendre,
+                             Spectral::Quadrature::Gauss>();
+  test_modal_truncation_impl<Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto>();
+  test_modal_truncation_impl<Spectral::Basis::Chebyshev,
+                             Spectral::Quadrature::Gauss>();
+  test_modal_truncation_impl<Spectral::Basis::Chebyshev,
+                             Spectral::Quadrature::GaussLobatto>();
+}
+
 // By default, uses the default tolerance for floating-point comparisons. When
 // a non-zero eps is passed in as last argument, uses that tolerance instead.
 template <Spectral::Basis BasisType, Spectral::Quadrature QuadratureType,
@@ -530,6 +592,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.Spectral",
   test_creation();
   test_exact_differentiation_matrices();
   test_linear_filter();
+  test_modal_truncation();
   test_exact_extrapolation();
   test_exact_quadrature();
   test_quadrature_weights();
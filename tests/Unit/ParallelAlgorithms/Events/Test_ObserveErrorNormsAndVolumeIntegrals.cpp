@@ -0,0 +1,303 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/LinearOperators/DefiniteIntegral.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/Events/ObserveErrorNormsAndVolumeIntegrals.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Numeric.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+
+struct ObservationTimeTag : db::SimpleTag {
+  using type = double;
+};
+
+struct MockContributeReductionData {
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names{};
+    double time;
+    size_t number_of_grid_points;
+    double volume;
+    std::vector<double> errors{};
+    std::vector<double> volume_integrals{};
+  };
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static Results results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex, typename... Ts>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    observers::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    Parallel::ReductionData<Ts...>&& reduction_data) noexcept {
+    results.observation_id = observation_id;
+    results.subfile_name = subfile_name;
+    results.reduction_names = reduction_names;
+    results.time = std::get<0>(reduction_data.data());
+    results.number_of_grid_points = std::get<1>(reduction_data.data());
+    results.volume = std::get<2>(reduction_data.data());
+    results.errors.clear();
+    tmpl::for_each<tmpl::range<size_t, 3, sizeof...(Ts) - 1>>(
+        [&reduction_data](const auto index_v) noexcept {
+          constexpr size_t index = tmpl::type_from<decltype(index_v)>::value;
+          results.errors.push_back(std::get<index>(reduction_data.data()));
+        });
+    results.volume_integrals =
+        std::get<sizeof...(Ts) - 1>(reduction_data.data());
+  }
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+MockContributeReductionData::Results MockContributeReductionData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using array_index = int;
+  using chare_type = ActionTesting::MockArrayChare;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using array_index = int;
+  using chare_type = ActionTesting::MockGroupChare;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;  //  unused
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+struct ScalarVar : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+template <size_t SpatialDim>
+struct VectorVar : db::SimpleTag {
+  using type = tnsr::I<DataVector, SpatialDim>;
+};
+
+template <size_t SpatialDim>
+struct TensorVar : db::SimpleTag {
+  using type = tnsr::Ij<DataVector, SpatialDim>;
+};
+
+template <size_t SpatialDim>
+using error_norm_vars = tmpl::list<ScalarVar, VectorVar<SpatialDim>>;
+
+template <size_t SpatialDim>
+using volume_integral_vars =
+    tmpl::list<VectorVar<SpatialDim>, TensorVar<SpatialDim>>;
+
+template <size_t VolumeDim, bool HasAnalyticSolutions, typename ObserveEvent>
+void test_observe(const std::unique_ptr<ObserveEvent> observe,
+                  const bool has_analytic_solutions) noexcept {
+  using metavariables = Metavariables;
+  using element_component = ElementComponent<metavariables>;
+  using observer_component = MockObserverComponent<metavariables>;
+  using vars_tags = tmpl::list<ScalarVar, VectorVar<VolumeDim>,
+                               TensorVar<VolumeDim>>;
+  using solution_tags = error_norm_vars<VolumeDim>;
+
+  const typename element_component::array_index array_index(0);
+  const Mesh<VolumeDim> mesh{5, Spectral::Basis::Chebyshev,
+                             Spectral::Quadrature::GaussLobatto};
+  const size_t num_points = mesh.number_of_grid_points();
+
+  // Any data should be fine, we only check the received data
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> dist{1.0, 10.0};
+  Variables<vars_tags> vars(num_points);
+  fill_with_random_values(make_not_null(&vars), make_not_null(&gen),
+                          make_not_null(&dist));
+  Variables<db::wrap_tags_in<Tags::Analytic, solution_tags>> solutions(
+      num_points);
+  fill_with_random_values(make_not_null(&solutions), make_not_null(&gen),
+                          make_not_null(&dist));
+  const auto det_inv_jacobian = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&gen), make_not_null(&dist), num_points);
+
+  // Compute expected data for checks
+  const DataVector det_jacobian = 1.0 / get(det_inv_jacobian);
+  std::vector<double> expected_errors{};
+  tmpl::for_each<solution_tags>(
+      [&expected_errors, &vars, &solutions](auto tag_v) noexcept {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        double expected_error = 0.0;
+        for (size_t i = 0; i < get<tag>(vars).size(); ++i) {
+          const DataVector error =
+              get<tag>(vars)[i] - get<Tags::Analytic<tag>>(solutions)[i];
+          expected_error += alg::accumulate(square(error), 0.0);
+        }
+        expected_errors.push_back(expected_error);
+      });
+  std::vector<std::string> expected_reduction_names = {
+      "ObservationTimeTag", "NumberOfPoints", "Volume", "Error(ScalarVar)",
+      "Error(" + db::tag_name<VectorVar<VolumeDim>>() + ")"};
+  std::vector<double> expected_volume_integrals{};
+  tmpl::for_each<volume_integral_vars<VolumeDim>>(
+      [&expected_volume_integrals, &expected_reduction_names, &vars,
+       &det_jacobian, &mesh](auto tag_v) noexcept {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        const auto& tensor = get<tag>(vars);
+        for (size_t i = 0; i < tensor.size(); ++i) {
+          expected_reduction_names.push_back("VolumeIntegral(" +
+                                             db::tag_name<tag>() +
+                                             tensor.component_suffix(i) + ")");
+          expected_volume_integrals.push_back(
+              definite_integral(det_jacobian * tensor[i], mesh));
+        }
+      });
+
+  const double observation_time = 2.0;
+  const auto box = db::create<db::AddSimpleTags<
+      ObservationTimeTag, domain::Tags::Mesh<VolumeDim>,
+      domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>,
+      Tags::Variables<vars_tags>,
+      tmpl::conditional_t<HasAnalyticSolutions,
+                          ::Tags::AnalyticSolutions<solution_tags>,
+                          ::Tags::AnalyticSolutionsOptional<solution_tags>>>>(
+      observation_time, mesh, det_inv_jacobian, vars,
+      [&solutions, &has_analytic_solutions]() noexcept {
+        if constexpr (HasAnalyticSolutions) {
+          (void)has_analytic_solutions;
+          // NOLINTNEXTLINE(performance-no-automatic-move)
+          return solutions;
+        } else {
+          return has_analytic_solutions ? std::make_optional(solutions)
+                                        : std::nullopt;
+        }
+      }());
+
+  const auto ids_to_register =
+      observers::get_registration_observation_type_and_key(*observe, box);
+  CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+  CHECK(ids_to_register->second ==
+        observers::ObservationKey("/reductions.dat"));
+
+  ActionTesting::MockRuntimeSystem<metavariables> runner{{}};
+  ActionTesting::emplace_component<element_component>(make_not_null(&runner),
+                                                      0);
+  ActionTesting::emplace_group_component<observer_component>(&runner);
+
+  observe->run(box,
+               ActionTesting::cache<element_component>(runner, array_index),
+               array_index, std::add_pointer_t<element_component>{});
+
+  if (not HasAnalyticSolutions and not has_analytic_solutions) {
+    CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+    return;
+  }
+
+  // A single reduction carries all observed quantities
+  runner.template invoke_queued_simple_action<observer_component>(0);
+  CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+
+  const auto& results = MockContributeReductionData::results;
+  CHECK(results.observation_id.value() == observation_time);
+  CHECK(results.subfile_name == "/reductions");
+  CHECK(results.reduction_names == expected_reduction_names);
+  CHECK(results.time == observation_time);
+  CHECK(results.number_of_grid_points == num_points);
+  CHECK(results.volume == approx(definite_integral(det_jacobian, mesh)));
+  CHECK_ITERABLE_APPROX(results.errors, expected_errors);
+  CHECK_ITERABLE_APPROX(results.volume_integrals, expected_volume_integrals);
+}
+
+template <size_t VolumeDim, bool HasAnalyticSolutions>
+void test_observe_system(const bool has_analytic_solutions) noexcept {
+  INFO("Dim = " << VolumeDim);
+  test_observe<VolumeDim, HasAnalyticSolutions>(
+      std::make_unique<dg::Events::ObserveErrorNormsAndVolumeIntegrals<
+          VolumeDim, ObservationTimeTag, error_norm_vars<VolumeDim>,
+          volume_integral_vars<VolumeDim>>>("reductions"),
+      has_analytic_solutions);
+
+  INFO("create/serialize");
+  using EventType = Event<
+      tmpl::list<dg::Events::Registrars::ObserveErrorNormsAndVolumeIntegrals<
+          VolumeDim, ObservationTimeTag, error_norm_vars<VolumeDim>,
+          volume_integral_vars<VolumeDim>>>>;
+  Parallel::register_derived_classes_with_charm<EventType>();
+  const auto factory_event = TestHelpers::test_factory_creation<EventType>(
+      "ObserveErrorNormsAndVolumeIntegrals:\n"
+      "  SubfileName: reductions");
+  auto serialized_event = serialize_and_deserialize(factory_event);
+  test_observe<VolumeDim, HasAnalyticSolutions>(std::move(serialized_event),
+                                                has_analytic_solutions);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveErrorNormsAndVolumeIntegrals",
+                  "[Unit][Evolution]") {
+  INVOKE_TEST_FUNCTION(test_observe_system, (true), (1, 2, 3),
+                       (true, false));
+  INVOKE_TEST_FUNCTION(test_observe_system, (false), (1, 2, 3), (false));
+}
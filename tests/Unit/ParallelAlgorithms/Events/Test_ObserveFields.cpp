@@ -13,10 +13,12 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "DataStructures/Variables.hpp"
@@ -31,6 +33,7 @@
 #include "IO/Observer/ObserverComponent.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
@@ -191,8 +194,10 @@ struct ScalarSystem {
       "  SubfileName: element_data\n"
       "  VariablesToObserve: [Scalar]\n";
   static ObserveEvent make_test_object(
-      const std::optional<Mesh<volume_dim>>& interpolating_mesh) noexcept {
-    return ObserveEvent{"element_data", {"Scalar"}, interpolating_mesh};
+      const std::optional<Mesh<volume_dim>>& interpolating_mesh,
+      const std::optional<size_t>& number_of_modes = {}) noexcept {
+    return ObserveEvent{"element_data", {"Scalar"}, interpolating_mesh,
+                        number_of_modes};
   }
 };
 
@@ -289,10 +294,11 @@ struct ComplicatedSystem {
       "  VariablesToObserve: [Scalar, Vector, Tensor, Tensor2]\n";
 
   static ObserveEvent make_test_object(
-      const std::optional<Mesh<volume_dim>>& interpolating_mesh) noexcept {
+      const std::optional<Mesh<volume_dim>>& interpolating_mesh,
+      const std::optional<size_t>& number_of_modes = {}) noexcept {
     return ObserveEvent("element_data",
                         {"Scalar", "Vector", "Tensor", "Tensor2"},
-                        interpolating_mesh);
+                        interpolating_mesh, number_of_modes);
   }
 };
 
@@ -301,7 +307,8 @@ template <typename System, bool AlwaysHasAnalyticSolutions,
 void test_observe(
     const std::unique_ptr<ObserveEvent> observe,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh,
-    const bool has_analytic_solutions) noexcept {
+    const bool has_analytic_solutions,
+    const std::optional<size_t>& number_of_modes = {}) noexcept {
   using metavariables = Metavariables<System>;
   using element_component = ElementComponent<metavariables>;
   using observer_component = MockObserverComponent<metavariables>;
@@ -316,6 +323,19 @@ void test_observe(
                               Spectral::Quadrature::GaussLobatto);
 
   const intrp::RegularGrid interpolant(mesh, interpolating_mesh.value_or(mesh));
+  // The modes of the data are truncated in every dimension
+  const Mesh<volume_dim> output_mesh =
+      number_of_modes.has_value()
+          ? Mesh<volume_dim>(*number_of_modes, Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto)
+          : interpolating_mesh.value_or(mesh);
+  std::array<Matrix, volume_dim> truncation_matrices{};
+  if (number_of_modes.has_value()) {
+    for (size_t d = 0; d < volume_dim; ++d) {
+      gsl::at(truncation_matrices, d) = Spectral::modal_truncation_matrix(
+          mesh.slice_through(d), *number_of_modes);
+    }
+  }
   const double observation_time = 2.0;
   Variables<
       tmpl::push_back<typename System::all_vars_for_test, coordinates_tag>>
@@ -380,12 +400,12 @@ void test_observe(
   CHECK(results.received_extents.size() == volume_dim);
   CHECK(std::equal(results.received_extents.begin(),
                    results.received_extents.end(),
-                   interpolating_mesh.value_or(mesh).extents().begin()));
+                   output_mesh.extents().begin()));
   CHECK(std::equal(results.received_basis.begin(), results.received_basis.end(),
-                   interpolating_mesh.value_or(mesh).basis().begin()));
+                   output_mesh.basis().begin()));
   CHECK(std::equal(results.received_quadrature.begin(),
                    results.received_quadrature.end(),
-                   interpolating_mesh.value_or(mesh).quadrature().begin()));
+                   output_mesh.quadrature().begin()));
 
   size_t num_components_observed = 0;
   // gcc 6.4.0 gets confused if we try to capture tensor_data by
@@ -393,7 +413,8 @@ void test_observe(
   // non-const, so we capture a pointer instead.
   const auto check_component =
       [&element_name, &num_components_observed,
-       tensor_data = &results.in_received_tensor_data, &interpolant](
+       tensor_data = &results.in_received_tensor_data, &interpolant, &mesh,
+       &number_of_modes, &truncation_matrices](
           const std::string& component, const DataVector& expected) noexcept {
         CAPTURE(*tensor_data);
         CAPTURE(component);
@@ -404,7 +425,13 @@ void test_observe(
             });
         CHECK(it != tensor_data->end());
         if (it != tensor_data->end()) {
-          CHECK(it->data == interpolant.interpolate(expected));
+          if (number_of_modes.has_value()) {
+            CHECK_ITERABLE_APPROX(
+                it->data,
+                apply_matrices(truncation_matrices, expected, mesh.extents()));
+          } else {
+            CHECK(it->data == interpolant.interpolate(expected));
+          }
         }
         ++num_components_observed;
       };
@@ -432,15 +459,16 @@ template <typename System, bool AlwaysHasAnalyticSolutions = true>
 void test_system(
     const std::string& mesh_creation_string,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh = {},
-    const bool has_analytic_solutions = true) noexcept {
+    const bool has_analytic_solutions = true,
+    const std::optional<size_t>& number_of_modes = {}) noexcept {
   INFO(pretty_type::get_name<System>());
   CAPTURE(AlwaysHasAnalyticSolutions);
   CAPTURE(has_analytic_solutions);
   CAPTURE(mesh_creation_string);
   test_observe<System, AlwaysHasAnalyticSolutions>(
       std::make_unique<typename System::ObserveEvent>(
-          System::make_test_object(interpolating_mesh)),
-      interpolating_mesh, has_analytic_solutions);
+          System::make_test_object(interpolating_mesh, number_of_modes)),
+      interpolating_mesh, has_analytic_solutions, number_of_modes);
   INFO("create/serialize");
   using EventType = Event<tmpl::list<dg::Events::Registrars::ObserveFields<
       System::volume_dim, ObservationTimeTag,
@@ -448,12 +476,16 @@ void test_system(
       typename System::solution_for_test::vars_for_test>>>;
   Parallel::register_derived_classes_with_charm<EventType>();
   const std::string creation_string =
-      System::creation_string_for_test + mesh_creation_string;
+      System::creation_string_for_test + mesh_creation_string +
+      "\n  TruncateToNumberOfModes: " +
+      (number_of_modes.has_value() ? std::to_string(*number_of_modes)
+                                   : std::string{"None"});
   const auto factory_event =
       TestHelpers::test_factory_creation<EventType>(creation_string);
   auto serialized_event = serialize_and_deserialize(factory_event);
   test_observe<System, AlwaysHasAnalyticSolutions>(
-      std::move(serialized_event), interpolating_mesh, has_analytic_solutions);
+      std::move(serialized_event), interpolating_mesh, has_analytic_solutions,
+      number_of_modes);
 }
 }  // namespace
 
@@ -566,6 +598,17 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
             ComplicatedSystem::make_test_object(interpolating_mesh)),
         interpolating_mesh, true);
   }
+
+  {
+    INFO("Truncate modes")
+    const std::string interpolating_mesh_str = "  InterpolateToMesh: None";
+    test_system<ScalarSystem>(interpolating_mesh_str, std::nullopt, true, 3);
+    test_system<ComplicatedSystem>(interpolating_mesh_str, std::nullopt, true,
+                                   3);
+    // Truncating to the number of points of the mesh is the identity
+    test_system<ComplicatedSystem>(interpolating_mesh_str, std::nullopt, false,
+                                   5);
+  }
 }
 
 // [[OutputRegex, NotAVar is not an available variable.*Scalar]]
@@ -575,7 +618,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.bad_field",
   TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
       "SubfileName: VolumeData\n"
       "VariablesToObserve: [NotAVar]\n"
-      "InterpolateToMesh: None");
+      "InterpolateToMesh: None\n"
+      "TruncateToNumberOfModes: None");
 }
 
 // [[OutputRegex, Scalar specified multiple times]]
@@ -585,5 +629,31 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.repeated_field",
   TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
       "SubfileName: VolumeData\n"
       "VariablesToObserve: [Scalar, Scalar]\n"
-      "InterpolateToMesh: None");
+      "InterpolateToMesh: None\n"
+      "TruncateToNumberOfModes: None");
+}
+
+// [[OutputRegex, Specify either InterpolateToMesh or TruncateToNumberOfModes]]
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.interpolate_and_truncate",
+                  "[Unit][Evolution]") {
+  ERROR_TEST();
+  TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
+      "SubfileName: VolumeData\n"
+      "VariablesToObserve: [Scalar]\n"
+      "InterpolateToMesh:\n"
+      "  Extents: 3\n"
+      "  Basis: Legendre\n"
+      "  Quadrature: Gauss\n"
+      "TruncateToNumberOfModes: 3");
+}
+
+// [[OutputRegex, Cannot truncate to zero modes]]
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.zero_modes",
+                  "[Unit][Evolution]") {
+  ERROR_TEST();
+  TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
+      "SubfileName: VolumeData\n"
+      "VariablesToObserve: [Scalar]\n"
+      "InterpolateToMesh: None\n"
+      "TruncateToNumberOfModes: 0");
 }
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -34,6 +35,10 @@ struct VectorTag : db::SimpleTag {
   using type = DenseVector<double>;
 };
 
+struct SectionId : db::SimpleTag {
+  using type = size_t;
+};
+
 using fields_tag = VectorTag;
 using source_tag = ::Tags::FixedSource<fields_tag>;
 using operator_applied_to_fields_tag =
@@ -79,6 +84,16 @@ struct Metavariables {
 
 }  // namespace
 
+SPECTRE_TEST_CASE(
+    "Unit.ParallelLinearSolver.Asynchronous.SectionObservationKey",
+    "[Unit][ParallelAlgorithms][LinearSolver]") {
+  const auto box = db::create<db::AddSimpleTags<SectionId>>(size_t{2});
+  CHECK(LinearSolver::async_solvers::section_observation_key<void>(box)
+            .empty());
+  CHECK(LinearSolver::async_solvers::section_observation_key<SectionId>(box) ==
+        "SectionId2");
+}
+
 SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
                   "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
   using element_array = ElementArray<Metavariables>;
@@ -33,6 +33,10 @@ struct VectorTag : db::SimpleTag {
   using type = DenseVector<double>;
 };
 
+struct IsInSectionTag : db::SimpleTag {
+  using type = bool;
+};
+
 using fields_tag = VectorTag;
 using operator_applied_to_fields_tag =
     LinearSolver::Tags::OperatorAppliedTo<fields_tag>;
@@ -53,13 +57,18 @@ using preconditioned_basis_history_tag =
 
 template <typename Metavariables, bool Preconditioned>
 struct ElementArray {
+ private:
+  using section_tag = typename Metavariables::section_tag;
+
+ public:
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = int;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
           typename Metavariables::Phase, Metavariables::Phase::Initialization,
-          tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<VectorTag>>,
+          tmpl::list<ActionTesting::InitializeDataBox<
+                         tmpl::list<VectorTag, IsInSectionTag>>,
                      Actions::SetupDataBox,
                      LinearSolver::gmres::detail::InitializeElement<
                          fields_tag, DummyOptionsGroup, Preconditioned>>>,
@@ -68,34 +77,38 @@ struct ElementArray {
           tmpl::list<
               LinearSolver::gmres::detail::NormalizeInitialOperand<
                   fields_tag, DummyOptionsGroup, Preconditioned,
-                  DummyOptionsGroup>,
+                  DummyOptionsGroup, section_tag>,
               LinearSolver::gmres::detail::PrepareStep<
                   fields_tag, DummyOptionsGroup, Preconditioned,
                   DummyOptionsGroup>,
               LinearSolver::gmres::detail::NormalizeOperandAndUpdateField<
                   fields_tag, DummyOptionsGroup, Preconditioned,
-                  DummyOptionsGroup>,
+                  DummyOptionsGroup, section_tag>,
               Parallel::Actions::TerminatePhase>>>;
 };
 
-template <bool Preconditioned>
+template <bool Preconditioned, typename SectionTag>
 struct Metavariables {
+  using section_tag = SectionTag;
   using element_array = ElementArray<Metavariables, Preconditioned>;
   using component_list = tmpl::list<element_array>;
   enum class Phase { Initialization, Testing, Exit };
 };
 
-template <bool Preconditioned>
-void test_element_actions() {
+// Elements outside the array section of the solver keep their operand and
+// fields, but still follow the iterations of the solver
+template <bool Preconditioned, typename SectionTag = void>
+void test_element_actions(const bool in_section = true) {
   CAPTURE(Preconditioned);
-  using metavariables = Metavariables<Preconditioned>;
+  CAPTURE(in_section);
+  using metavariables = Metavariables<Preconditioned, SectionTag>;
   using element_array = typename metavariables::element_array;
 
   ActionTesting::MockRuntimeSystem<metavariables> runner{{}};
 
   // Setup mock element array
   ActionTesting::emplace_component_and_initialize<element_array>(
-      make_not_null(&runner), 0, {DenseVector<double>(3, 0.)});
+      make_not_null(&runner), 0, {DenseVector<double>(3, 0.), in_section});
   for (size_t i = 0; i < 2; ++i) {
     ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
   }
@@ -146,8 +159,8 @@ void test_element_actions() {
   }
 
   const auto test_normalize_initial_operand =
-      [&runner, &get_tag,
-       &set_tag](const Convergence::HasConverged& has_converged) {
+      [&runner, &get_tag, &set_tag,
+       &in_section](const Convergence::HasConverged& has_converged) {
         const size_t iteration_id = 0;
         set_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{},
                 iteration_id);
@@ -166,10 +179,15 @@ void test_element_actions() {
             std::make_tuple(residual_magnitude, has_converged);
         REQUIRE(ActionTesting::is_ready<element_array>(runner, 0));
         ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
-        CHECK_ITERABLE_APPROX(get_tag(operand_tag{}),
-                              DenseVector<double>(3, 0.5));
-        CHECK(get_tag(basis_history_tag{}).size() == 3);
-        CHECK(get_tag(basis_history_tag{})[2] == get_tag(operand_tag{}));
+        if (in_section) {
+          CHECK_ITERABLE_APPROX(get_tag(operand_tag{}),
+                                DenseVector<double>(3, 0.5));
+          CHECK(get_tag(basis_history_tag{}).size() == 3);
+          CHECK(get_tag(basis_history_tag{})[2] == get_tag(operand_tag{}));
+        } else {
+          CHECK(get_tag(operand_tag{}) == DenseVector<double>(3, 2.));
+          CHECK(get_tag(basis_history_tag{}).size() == 2);
+        }
         CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
               has_converged);
         CHECK(ActionTesting::get_next_action_index<element_array>(runner, 0) ==
@@ -183,8 +201,8 @@ void test_element_actions() {
   }
 
   const auto test_normalize_operand_and_update_field =
-      [&runner, &get_tag,
-       &set_tag](const Convergence::HasConverged& has_converged) {
+      [&runner, &get_tag, &set_tag,
+       &in_section](const Convergence::HasConverged& has_converged) {
         const size_t iteration_id = 2;
         set_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{},
                 iteration_id);
@@ -201,7 +219,7 @@ void test_element_actions() {
             element_array,
             LinearSolver::gmres::detail::NormalizeOperandAndUpdateField<
                 fields_tag, DummyOptionsGroup, Preconditioned,
-                DummyOptionsGroup>>(0);
+                DummyOptionsGroup, typename metavariables::section_tag>>(0);
         REQUIRE_FALSE(ActionTesting::is_ready<element_array>(runner, 0));
         auto& inbox = ActionTesting::get_inbox_tag<
             element_array, LinearSolver::gmres::detail::Tags::
@@ -214,12 +232,19 @@ void test_element_actions() {
             std::make_tuple(normalization, minres, has_converged);
         ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
         REQUIRE(ActionTesting::is_ready<element_array>(runner, 0));
-        CHECK_ITERABLE_APPROX(get_tag(operand_tag{}),
-                              DenseVector<double>(3, 0.5));
-        CHECK(get_tag(basis_history_tag{}).size() == 3);
-        CHECK(get_tag(basis_history_tag{})[2] == get_tag(operand_tag{}));
-        // minres * basis_history - initial = 2 * 0.5 + 4 * 1.5 - 1 = 6
-        CHECK_ITERABLE_APPROX(get_tag(VectorTag{}), DenseVector<double>(3, 6.));
+        if (in_section) {
+          CHECK_ITERABLE_APPROX(get_tag(operand_tag{}),
+                                DenseVector<double>(3, 0.5));
+          CHECK(get_tag(basis_history_tag{}).size() == 3);
+          CHECK(get_tag(basis_history_tag{})[2] == get_tag(operand_tag{}));
+          // minres * basis_history - initial = 2 * 0.5 + 4 * 1.5 - 1 = 6
+          CHECK_ITERABLE_APPROX(get_tag(VectorTag{}),
+                                DenseVector<double>(3, 6.));
+        } else {
+          CHECK(get_tag(operand_tag{}) == DenseVector<double>(3, 2.));
+          CHECK(get_tag(basis_history_tag{}).size() == 2);
+          CHECK(get_tag(VectorTag{}) == DenseVector<double>(3, 0.));
+        }
         CHECK(get_tag(Convergence::Tags::IterationId<DummyOptionsGroup>{}) ==
               3);
         CHECK(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}) ==
@@ -241,4 +266,7 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Gmres.ElementActions",
                   "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
   test_element_actions<true>();
   test_element_actions<false>();
+  test_element_actions<true, IsInSectionTag>(true);
+  test_element_actions<true, IsInSectionTag>(false);
+  test_element_actions<false, IsInSectionTag>(false);
 }
@@ -0,0 +1,262 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Informer/Tags.hpp"
+#include "Informer/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/Actions/TerminatePhase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Actions/SetData.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+
+struct TestSolver {};
+
+struct ScalarFieldTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+using fields_tag = ::Tags::Variables<tmpl::list<ScalarFieldTag>>;
+using source_tag = db::add_tag_prefix<::Tags::FixedSource, fields_tag>;
+using operator_applied_to_fields_tag =
+    db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, fields_tag>;
+
+template <typename Metavariables>
+struct ElementArray {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<
+              ActionTesting::InitializeDataBox<
+                  tmpl::list<
+                      domain::Tags::Mesh<1>,
+                      Convergence::Tags::IterationId<TestSolver>, fields_tag,
+                      source_tag, operator_applied_to_fields_tag,
+                      LinearSolver::multigrid::Tags::ChildrenRefinementLevels<
+                          1>,
+                      LinearSolver::multigrid::Tags::ParentRefinementLevels<
+                          1>>,
+                  tmpl::list<LinearSolver::Tags::ResidualCompute<
+                      fields_tag, source_tag>>>,
+              Actions::SetupDataBox,
+              LinearSolver::multigrid::detail::InitializeElement<1,
+                                                                 TestSolver>>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          tmpl::list<LinearSolver::multigrid::detail::
+                         ReceiveResidualFromFinerGrid<1, fields_tag, TestSolver,
+                                                      false, source_tag, true>,
+                     LinearSolver::multigrid::detail::
+                         ReceiveResidualFromFinerGrid<1, fields_tag, TestSolver,
+                                                      false, source_tag, false>,
+                     LinearSolver::multigrid::detail::SendResidualToCoarserGrid<
+                         1, fields_tag, TestSolver, source_tag>,
+                     LinearSolver::multigrid::detail::
+                         ReceiveCorrectionFromCoarserGrid<1, fields_tag,
+                                                          TestSolver,
+                                                          source_tag>,
+                     LinearSolver::multigrid::detail::SendCorrectionToFinerGrid<
+                         1, fields_tag, TestSolver, source_tag>,
+                     Parallel::Actions::TerminatePhase>>>;
+};
+
+struct Metavariables {
+  using element_array = ElementArray<Metavariables>;
+  using component_list = tmpl::list<element_array>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelMultigrid.ElementActions",
+                  "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
+  using element_array = typename Metavariables::element_array;
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{tuples::TaggedTuple<
+      LinearSolver::multigrid::Tags::MaxLevels<TestSolver>,
+      logging::Tags::Verbosity<TestSolver>>{2, Verbosity::Verbose}};
+
+  // Two elements on the finest grid and their parent on the coarser grid
+  const ElementId<1> lower_child_id{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> upper_child_id{0, {{SegmentId{1, 1}}}};
+  const ElementId<1> parent_id{0, {{SegmentId{0, 0}}}, 1};
+  const Mesh<1> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const std::vector<std::array<size_t, 1>> fine_levels{{{1}}};
+  const std::vector<std::array<size_t, 1>> coarse_levels{{{0}}};
+
+  const auto make_vars = [](DataVector values) {
+    typename fields_tag::type vars{values.size()};
+    get(get<ScalarFieldTag>(vars)) = std::move(values);
+    return vars;
+  };
+  const auto add_element = [&runner, &mesh, &make_vars](
+                               const ElementId<1>& element_id,
+                               DataVector fields, DataVector source,
+                               std::vector<std::array<size_t, 1>>
+                                   children_refinement_levels,
+                               std::vector<std::array<size_t, 1>>
+                                   parent_refinement_levels) {
+    ActionTesting::emplace_component_and_initialize<element_array>(
+        make_not_null(&runner), element_id,
+        {mesh, size_t{0}, make_vars(std::move(fields)),
+         make_vars(std::move(source)), make_vars(DataVector(3, 0.)),
+         std::move(children_refinement_levels),
+         std::move(parent_refinement_levels)});
+    for (size_t i = 0; i < 2; ++i) {
+      ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                                element_id);
+    }
+  };
+  // The residual is the linear function `x` of the block logical coordinate
+  add_element(lower_child_id, DataVector(3, 1.), DataVector{-1., -0.5, 0.},
+              {}, coarse_levels);
+  add_element(upper_child_id, DataVector(3, 1.), DataVector{0., 0.5, 1.}, {},
+              coarse_levels);
+  add_element(parent_id, DataVector(3, 4.), DataVector(3, 5.), fine_levels,
+              {});
+
+  const auto get_fields = [&runner](const ElementId<1>& element_id) {
+    return get(get<ScalarFieldTag>(
+        ActionTesting::get_databox_tag<element_array, fields_tag>(
+            runner, element_id)));
+  };
+
+  {
+    INFO("InitializeElement");
+    const auto get_tag = [&runner](auto tag_v,
+                                   const ElementId<1>& element_id) {
+      using tag = std::decay_t<decltype(tag_v)>;
+      return ActionTesting::get_databox_tag<element_array, tag>(runner,
+                                                                element_id);
+    };
+    using level_tag = LinearSolver::multigrid::Tags::MultigridLevel;
+    using parent_id_tag = LinearSolver::multigrid::Tags::ParentId<1>;
+    using child_ids_tag = LinearSolver::multigrid::Tags::ChildIds<1>;
+    CHECK(get_tag(level_tag{}, lower_child_id) == 0);
+    CHECK(get_tag(level_tag{}, parent_id) == 1);
+    using is_finest_grid_tag = LinearSolver::multigrid::Tags::IsFinestGrid;
+    CHECK(get_tag(is_finest_grid_tag{}, lower_child_id));
+    CHECK(get_tag(is_finest_grid_tag{}, upper_child_id));
+    CHECK_FALSE(get_tag(is_finest_grid_tag{}, parent_id));
+    CHECK(get_tag(parent_id_tag{}, lower_child_id) == parent_id);
+    CHECK(get_tag(parent_id_tag{}, upper_child_id) == parent_id);
+    CHECK_FALSE(get_tag(parent_id_tag{}, parent_id).has_value());
+    CHECK(get_tag(child_ids_tag{}, lower_child_id).empty());
+    CHECK(get_tag(child_ids_tag{}, parent_id) ==
+          std::unordered_set<ElementId<1>>{lower_child_id, upper_child_id});
+  }
+
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+
+  {
+    INFO("Restrict residual to coarser grid");
+    // Nothing to receive on the finest grid
+    for (const auto& child_id : {lower_child_id, upper_child_id}) {
+      for (size_t i = 0; i < 2; ++i) {
+        ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                                  child_id);
+      }
+      CHECK(get_fields(child_id) == DataVector(3, 1.));
+    }
+    CHECK_FALSE(ActionTesting::is_ready<element_array>(runner, parent_id));
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              lower_child_id);
+    CHECK_FALSE(ActionTesting::is_ready<element_array>(runner, parent_id));
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              upper_child_id);
+    REQUIRE(ActionTesting::is_ready<element_array>(runner, parent_id));
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              parent_id);
+    // The restricted residuals of the children are the source of the
+    // coarse-grid correction, which starts at zero
+    CHECK_ITERABLE_APPROX(
+        get(get<::Tags::FixedSource<ScalarFieldTag>>(
+            ActionTesting::get_databox_tag<element_array, source_tag>(
+                runner, parent_id))),
+        (DataVector{-1., 0., 1.}));
+    CHECK(get_fields(parent_id) == DataVector(3, 0.));
+    CHECK(get(get<LinearSolver::Tags::OperatorAppliedTo<ScalarFieldTag>>(
+              ActionTesting::get_databox_tag<element_array,
+                                             operator_applied_to_fields_tag>(
+                  runner, parent_id))) == DataVector(3, 0.));
+    // The residuals of the first iteration have already been received, so the
+    // receive at the beginning of every iteration does nothing
+    REQUIRE(ActionTesting::is_ready<element_array>(runner, parent_id));
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              parent_id);
+    CHECK_ITERABLE_APPROX(
+        get(get<::Tags::FixedSource<ScalarFieldTag>>(
+            ActionTesting::get_databox_tag<element_array, source_tag>(
+                runner, parent_id))),
+        (DataVector{-1., 0., 1.}));
+    // The children wait for the correction
+    for (const auto& child_id : {lower_child_id, upper_child_id}) {
+      CHECK_FALSE(ActionTesting::is_ready<element_array>(runner, child_id));
+    }
+  }
+  {
+    INFO("Prolongate correction to finer grid");
+    // Pretend the coarse grid has solved for a correction
+    ActionTesting::simple_action<element_array,
+                                 ::Actions::SetData<tmpl::list<fields_tag>>>(
+        make_not_null(&runner), parent_id, make_vars(DataVector{1., 2., 3.}));
+    // The coarsest grid skips ahead to sending the correction
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              parent_id);
+    CHECK(ActionTesting::get_next_action_index<element_array>(
+              runner, parent_id) == 4);
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              parent_id);
+    for (const auto& child_id : {lower_child_id, upper_child_id}) {
+      REQUIRE(ActionTesting::is_ready<element_array>(runner, child_id));
+      ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                                child_id);
+    }
+    CHECK_ITERABLE_APPROX(get_fields(lower_child_id),
+                          (DataVector{2., 2.5, 3.}));
+    CHECK_ITERABLE_APPROX(get_fields(upper_child_id),
+                          (DataVector{3., 3.5, 4.}));
+    // Nothing to send on the finest grid
+    for (const auto& child_id : {lower_child_id, upper_child_id}) {
+      ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                                child_id);
+      CHECK(ActionTesting::get_next_action_index<element_array>(
+                runner, child_id) == 5);
+    }
+  }
+}
@@ -0,0 +1,62 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+
+namespace LinearSolver::multigrid {
+
+SPECTRE_TEST_CASE("Unit.ParallelMultigrid.Hierarchy",
+                  "[Unit][ParallelAlgorithms][LinearSolver]") {
+  {
+    INFO("Coarsen refinement levels");
+    CHECK(coarsen(std::vector<std::array<size_t, 1>>{{{0}}, {{2}}}) ==
+          std::vector<std::array<size_t, 1>>{{{0}}, {{1}}});
+    CHECK(coarsen(std::vector<std::array<size_t, 2>>{{{2, 1}}, {{0, 3}}}) ==
+          std::vector<std::array<size_t, 2>>{{{1, 0}}, {{0, 2}}});
+    const std::vector<std::array<size_t, 3>> fully_coarsened{{{0, 0, 0}}};
+    CHECK(coarsen(fully_coarsened) == fully_coarsened);
+  }
+  {
+    INFO("Parent id");
+    CHECK(parent_id(ElementId<1>{0, {{{2, 3}}}}, {{1}}) ==
+          ElementId<1>{0, {{{1, 1}}}, 1});
+    CHECK(parent_id(ElementId<2>{1, {{{1, 0}, {0, 0}}}, 1}, {{0, 0}}) ==
+          ElementId<2>{1, {{{0, 0}, {0, 0}}}, 2});
+    CHECK(parent_id(ElementId<3>{2, {{{0, 0}, {2, 1}, {1, 1}}}}, {{0, 1, 0}}) ==
+          ElementId<3>{2, {{{0, 0}, {1, 0}, {0, 0}}}, 1});
+    INFO("Parent of an element in a block that is not coarsened");
+    CHECK(parent_id(ElementId<2>{0, {{{1, 1}, {2, 3}}}}, {{1, 2}}) ==
+          ElementId<2>{0, {{{1, 1}, {2, 3}}}, 1});
+    CHECK(parent_id(ElementId<2>{0, 3}, {{0, 0}}) == ElementId<2>{0, 4});
+  }
+  {
+    INFO("Child ids");
+    CHECK(child_ids(ElementId<1>{0, {{{1, 1}}}, 1}, {{2}}) ==
+          std::unordered_set<ElementId<1>>{ElementId<1>{0, {{{2, 2}}}},
+                                           ElementId<1>{0, {{{2, 3}}}}});
+    CHECK(child_ids(ElementId<1>{0, {{{1, 1}}}, 1}, {{1}}) ==
+          std::unordered_set<ElementId<1>>{ElementId<1>{0, {{{1, 1}}}}});
+    CHECK(child_ids(ElementId<2>{1, {{{0, 0}, {1, 1}}}, 2}, {{1, 1}}) ==
+          std::unordered_set<ElementId<2>>{
+              ElementId<2>{1, {{{1, 0}, {1, 1}}}, 1},
+              ElementId<2>{1, {{{1, 1}, {1, 1}}}, 1}});
+    const auto children_3d = child_ids(
+        ElementId<3>{0, {{{0, 0}, {0, 0}, {0, 0}}}, 1}, {{1, 1, 1}});
+    CHECK(children_3d.size() == 8);
+    for (const auto& child_id : children_3d) {
+      CHECK(child_id.grid_index() == 0);
+      CHECK(parent_id(child_id, {{0, 0, 0}}) == ElementId<3>{0, 1});
+    }
+  }
+}
+
+}  // namespace LinearSolver::multigrid
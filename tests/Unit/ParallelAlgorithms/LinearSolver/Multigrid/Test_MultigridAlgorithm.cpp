@@ -0,0 +1,404 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#define CATCH_CONFIG_RUNNER
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DenseMatrix.hpp"
+#include "DataStructures/DenseVector.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Elliptic/DiscontinuousGalerkin/DgElementArray.hpp"
+#include "Helpers/Domain/BoundaryConditions/BoundaryCondition.hpp"
+#include "Helpers/ParallelAlgorithms/LinearSolver/DistributedLinearSolverAlgorithmTestHelpers.hpp"
+#include "Helpers/ParallelAlgorithms/LinearSolver/LinearSolverAlgorithmTestHelpers.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/Actions/TerminatePhase.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Main.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeDomain.hpp"
+#include "ParallelAlgorithms/Initialization/Actions/RemoveOptionsAndTerminatePhase.hpp"
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/Actions/MakeIdentityIfSkipped.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/Gmres.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/ElementsAllocator.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Multigrid.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Richardson/Richardson.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace helpers = LinearSolverAlgorithmTestHelpers;
+namespace helpers_distributed = DistributedLinearSolverAlgorithmTestHelpers;
+
+namespace {
+
+struct ParallelGmres {
+  static constexpr Options::String help =
+      "Options for the iterative linear solver";
+};
+
+struct MultigridGroup {
+  static constexpr Options::String help =
+      "Options for the multigrid preconditioner";
+};
+
+struct PreSmoother {
+  static constexpr Options::String help = "Options for the pre-smoother";
+};
+
+struct PostSmoother {
+  static constexpr Options::String help = "Options for the post-smoother";
+};
+
+namespace OptionTags {
+// This option expects one list of matrix slices per grid of the multigrid
+// hierarchy, ordered from the finest to the coarsest grid. The matrix slices of
+// each grid have the layout described in
+// `DistributedLinearSolverAlgorithmTestHelpers::OptionTags::LinearOperator`.
+struct LinearOperator {
+  static constexpr Options::String help =
+      "The linear operator A to invert on every grid";
+  using type =
+      std::vector<std::vector<DenseMatrix<double, blaze::columnMajor>>>;
+};
+}  // namespace OptionTags
+
+struct LinearOperator : db::SimpleTag {
+  using type =
+      std::vector<std::vector<DenseMatrix<double, blaze::columnMajor>>>;
+  using option_tags = tmpl::list<OptionTags::LinearOperator>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& linear_operator) noexcept {
+    return linear_operator;
+  }
+};
+
+// Counts the applications of the linear operator on an element, so the
+// contributions from neighbors can be associated with the application they
+// belong to
+struct OperatorApplicationId : db::SimpleTag {
+  using type = size_t;
+};
+
+template <typename OperandTag>
+struct OperatorContributionsInboxTag
+    : Parallel::InboxInserters::Map<OperatorContributionsInboxTag<OperandTag>> {
+  using temporal_id = size_t;
+  using type = std::map<
+      temporal_id,
+      std::unordered_map<ElementId<1>,
+                         typename db::add_tag_prefix<
+                             LinearSolver::Tags::OperatorAppliedTo,
+                             OperandTag>::type>>;
+};
+
+// The `DistributedLinearSolverAlgorithmTestHelpers` apply the linear operator
+// in a global reduction over all elements. That doesn't work here, because the
+// grids of the multigrid hierarchy apply their operators independently of each
+// other. Instead, each element multiplies its slice of the operator matrix with
+// its operand and sends the rows that belong to its neighbors to them. This
+// works because the DG operator only couples nearest neighbors.
+template <typename OperandTag>
+struct SendOperatorContributions {
+ private:
+  using operator_applied_to_operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, OperandTag>;
+
+ public:
+  using const_global_cache_tags = tmpl::list<LinearOperator>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<1>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const auto& linear_operator =
+        gsl::at(gsl::at(get<LinearOperator>(box), element_id.grid_index()),
+                helpers_distributed::get_index(element_id));
+    const size_t num_points = linear_operator.columns();
+    const auto& operand = get<OperandTag>(box);
+    DenseVector<double> operator_applied_to_operand(linear_operator.rows());
+    dgemv_('N', linear_operator.rows(), linear_operator.columns(), 1,
+           linear_operator.data(), linear_operator.spacing(), operand.data(), 1,
+           0, operator_applied_to_operand.data(), 1);
+    const auto rows_of_element = [&operator_applied_to_operand, &num_points](
+                                     const ElementId<1>& id) noexcept {
+      typename operator_applied_to_operand_tag::type rows{num_points};
+      const auto rows_data = blaze::subvector(
+          operator_applied_to_operand,
+          helpers_distributed::get_index(id) * num_points, num_points);
+      std::copy(rows_data.begin(), rows_data.end(), rows.data());
+      return rows;
+    };
+
+    db::mutate<OperatorApplicationId, operator_applied_to_operand_tag>(
+        make_not_null(&box),
+        [&rows_of_element, &element_id](
+            const gsl::not_null<size_t*> application_id,
+            const auto operator_applied_to_operand_on_element) noexcept {
+          ++(*application_id);
+          *operator_applied_to_operand_on_element = rows_of_element(element_id);
+        });
+
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    const size_t application_id = get<OperatorApplicationId>(box);
+    for (const auto& direction_and_neighbors :
+         get<domain::Tags::Element<1>>(box).neighbors()) {
+      for (const auto& neighbor_id : direction_and_neighbors.second.ids()) {
+        Parallel::receive_data<OperatorContributionsInboxTag<OperandTag>>(
+            receiver_proxy[neighbor_id], application_id,
+            std::make_pair(element_id, rows_of_element(neighbor_id)));
+      }
+    }
+    return {std::move(box)};
+  }
+};
+
+template <typename OperandTag>
+struct ReceiveOperatorContributions {
+ private:
+  using operator_applied_to_operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, OperandTag>;
+  using inbox_tag = OperatorContributionsInboxTag<OperandTag>;
+
+ public:
+  using inbox_tags = tmpl::list<inbox_tag>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables>
+  static bool is_ready(const db::DataBox<DbTagsList>& box,
+                       const tuples::TaggedTuple<InboxTags...>& inboxes,
+                       const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                       const ElementId<1>& /*element_id*/) noexcept {
+    const size_t num_neighbors =
+        get<domain::Tags::Element<1>>(box).number_of_neighbors();
+    if (num_neighbors == 0) {
+      return true;
+    }
+    const auto& inbox = tuples::get<inbox_tag>(inboxes);
+    const auto received_contributions =
+        inbox.find(get<OperatorApplicationId>(box));
+    return received_contributions != inbox.end() and
+           received_contributions->second.size() == num_neighbors;
+  }
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<1>& /*element_id*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    if (get<domain::Tags::Element<1>>(box).number_of_neighbors() == 0) {
+      return {std::move(box)};
+    }
+    auto received_contributions =
+        std::move(tuples::get<inbox_tag>(inboxes)
+                      .extract(get<OperatorApplicationId>(box))
+                      .mapped());
+    db::mutate<operator_applied_to_operand_tag>(
+        make_not_null(&box),
+        [&received_contributions](
+            const auto operator_applied_to_operand) noexcept {
+          for (const auto& id_and_contribution : received_contributions) {
+            *operator_applied_to_operand += id_and_contribution.second;
+          }
+        });
+    return {std::move(box)};
+  }
+};
+
+template <typename OperandTag>
+using apply_operator = tmpl::list<SendOperatorContributions<OperandTag>,
+                                  ReceiveOperatorContributions<OperandTag>>;
+
+// Only the finest grid holds the solution. The coarser grids are assigned a
+// zero source, so the solver leaves their fields untouched.
+struct InitializeElement {
+  using const_global_cache_tags = tmpl::list<helpers_distributed::Source>;
+
+  using simple_tags =
+      tmpl::list<helpers_distributed::fields_tag,
+                 helpers_distributed::sources_tag, OperatorApplicationId>;
+  using compute_tags = tmpl::list<>;
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ElementId<1>& element_id, const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    const auto& source =
+        gsl::at(get<helpers_distributed::Source>(box),
+                helpers_distributed::get_index(element_id));
+    const size_t num_points = source.size();
+    typename helpers_distributed::sources_tag::type element_source{num_points,
+                                                                   0.};
+    if (element_id.grid_index() == 0) {
+      std::copy(source.begin(), source.end(), element_source.data());
+    }
+    ::Initialization::mutate_assign<simple_tags>(
+        make_not_null(&box),
+        typename helpers_distributed::fields_tag::type{num_points, 0.},
+        std::move(element_source), size_t{0});
+    return std::make_tuple(std::move(box));
+  }
+};
+
+template <typename OptionsGroup>
+struct TestResult {
+  using const_global_cache_tags = typename helpers_distributed::TestResult<
+      OptionsGroup>::const_global_cache_tags;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<1>& element_id, const ActionList meta,
+      const ParallelComponent* const component) noexcept {
+    if (element_id.grid_index() != 0) {
+      return {std::move(box), true};
+    }
+    return helpers_distributed::TestResult<OptionsGroup>::apply(
+        box, inboxes, cache, element_id, meta, component);
+  }
+};
+
+template <typename Metavariables>
+struct ElementArray {
+  using linear_solver = typename Metavariables::linear_solver;
+  using preconditioner = typename Metavariables::preconditioner;
+  using pre_smoother = typename Metavariables::pre_smoother;
+  using post_smoother = typename Metavariables::post_smoother;
+
+  using initialization_actions = tmpl::list<
+      Actions::SetupDataBox, dg::Actions::InitializeDomain<1>,
+      InitializeElement, typename linear_solver::initialize_element,
+      typename preconditioner::initialize_element,
+      typename pre_smoother::initialize_element,
+      typename post_smoother::initialize_element,
+      apply_operator<helpers_distributed::fields_tag>,
+      Initialization::Actions::RemoveOptionsAndTerminatePhase>;
+
+  using register_actions =
+      tmpl::list<typename linear_solver::register_element,
+                 typename preconditioner::register_element,
+                 typename pre_smoother::register_element,
+                 typename post_smoother::register_element,
+                 Parallel::Actions::TerminatePhase>;
+
+  using run_preconditioner = tmpl::list<
+      apply_operator<typename preconditioner::fields_tag>,
+      typename preconditioner::template solve<
+          apply_operator<typename preconditioner::fields_tag>,
+          typename pre_smoother::template solve<
+              apply_operator<typename pre_smoother::fields_tag>>,
+          typename post_smoother::template solve<
+              apply_operator<typename post_smoother::fields_tag>>>,
+      LinearSolver::Actions::MakeIdentityIfSkipped<preconditioner>>;
+
+  using solve_actions = tmpl::list<
+      typename linear_solver::template solve<tmpl::list<
+          run_preconditioner,
+          apply_operator<typename linear_solver::operand_tag>>>,
+      Parallel::Actions::TerminatePhase>;
+
+  using type = elliptic::DgElementArray<
+      Metavariables,
+      tmpl::list<
+          Parallel::PhaseActions<typename Metavariables::Phase,
+                                 Metavariables::Phase::Initialization,
+                                 initialization_actions>,
+          Parallel::PhaseActions<typename Metavariables::Phase,
+                                 Metavariables::Phase::RegisterWithObserver,
+                                 register_actions>,
+          Parallel::PhaseActions<typename Metavariables::Phase,
+                                 Metavariables::Phase::PerformLinearSolve,
+                                 solve_actions>,
+          Parallel::PhaseActions<
+              typename Metavariables::Phase, Metavariables::Phase::TestResult,
+              tmpl::list<TestResult<typename linear_solver::options_group>>>>,
+      LinearSolver::multigrid::ElementsAllocator<1, MultigridGroup>>;
+};
+
+struct Metavariables {
+  static constexpr const char* const help{
+      "Test the multigrid linear solver algorithm as preconditioner for GMRES"};
+  static constexpr size_t volume_dim = 1;
+  using system =
+      TestHelpers::domain::BoundaryConditions::SystemWithoutBoundaryConditions<
+          volume_dim>;
+
+  // GMRES operates only on the finest grid
+  using linear_solver =
+      LinearSolver::gmres::Gmres<Metavariables, helpers_distributed::fields_tag,
+                                 ParallelGmres, true,
+                                 helpers_distributed::sources_tag,
+                                 LinearSolver::multigrid::Tags::IsFinestGrid>;
+  // The operator includes the mass matrix, so the residual is massive
+  using preconditioner = LinearSolver::multigrid::Multigrid<
+      volume_dim, typename linear_solver::operand_tag, MultigridGroup, true,
+      typename linear_solver::preconditioner_source_tag>;
+  using pre_smoother = LinearSolver::Richardson::Richardson<
+      typename preconditioner::fields_tag, PreSmoother,
+      typename preconditioner::source_tag,
+      LinearSolver::multigrid::Tags::MultigridLevel>;
+  using post_smoother = LinearSolver::Richardson::Richardson<
+      typename preconditioner::fields_tag, PostSmoother,
+      typename preconditioner::source_tag,
+      LinearSolver::multigrid::Tags::MultigridLevel>;
+
+  using Phase = helpers::Phase;
+  using observed_reduction_data_tags = observers::collect_reduction_data_tags<
+      tmpl::list<linear_solver, preconditioner, pre_smoother, post_smoother>>;
+  using component_list = tmpl::push_back<
+      typename linear_solver::component_list,
+      typename ElementArray<Metavariables>::type,
+      observers::Observer<Metavariables>,
+      observers::ObserverWriter<Metavariables>,
+      helpers::OutputCleaner<Metavariables>>;
+  static constexpr bool ignore_unrecognized_command_line_options = false;
+  static constexpr auto determine_next_phase =
+      helpers::determine_next_phase<Metavariables>;
+};
+
+}  // namespace
+
+static const std::vector<void (*)()> charm_init_node_funcs{
+    &setup_error_handling, &domain::creators::register_derived_with_charm,
+    &TestHelpers::domain::BoundaryConditions::register_derived_with_charm};
+static const std::vector<void (*)()> charm_init_proc_funcs{
+    &enable_floating_point_exceptions};
+
+using charmxx_main_component = Parallel::Main<Metavariables>;
+
+#include "Parallel/CharmMain.tpp"  // IWYU pragma: keep
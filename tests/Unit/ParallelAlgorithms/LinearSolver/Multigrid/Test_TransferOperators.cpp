@@ -0,0 +1,175 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/TransferOperators.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::multigrid {
+
+namespace {
+struct ScalarField : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+DataVector polynomial(const DataVector& x) noexcept {
+  return 1. + x * (2. - x * (0.5 + 3. * x));
+}
+
+void test_transfer(const Spectral::Quadrature quadrature,
+                   const size_t num_points_child,
+                   const size_t num_points_parent,
+                   const Spectral::MortarSize size) {
+  CAPTURE(quadrature);
+  CAPTURE(num_points_child);
+  CAPTURE(num_points_parent);
+  CAPTURE(size);
+  const Mesh<1> child_mesh{num_points_child, Spectral::Basis::Legendre,
+                           quadrature};
+  const Mesh<1> parent_mesh{num_points_parent, Spectral::Basis::Legendre,
+                            quadrature};
+  const auto& parent_coords = Spectral::collocation_points(parent_mesh);
+  const auto& child_logical_coords = Spectral::collocation_points(child_mesh);
+  const double offset = size == Spectral::MortarSize::Full
+                            ? 0.
+                            : (size == Spectral::MortarSize::UpperHalf ? 0.5
+                                                                       : -0.5);
+  const double scale = size == Spectral::MortarSize::Full ? 1. : 0.5;
+  const DataVector child_coords = scale * child_logical_coords + offset;
+  using Vars = Variables<tmpl::list<ScalarField>>;
+  Vars parent_data{num_points_parent};
+  get(get<ScalarField>(parent_data)) = polynomial(parent_coords);
+  {
+    INFO("Prolongation is exact for polynomials on the parent");
+    const auto child_data =
+        prolongate(parent_data, parent_mesh, child_mesh, {{size}});
+    CHECK_ITERABLE_APPROX(get(get<ScalarField>(child_data)),
+                          polynomial(child_coords));
+  }
+  if (size == Spectral::MortarSize::Full) {
+    INFO("Restriction is exact for polynomials on the parent");
+    Vars child_data{num_points_child};
+    get(get<ScalarField>(child_data)) = polynomial(child_coords);
+    const auto restricted_data = restrict_to_parent(
+        child_data, child_mesh, parent_mesh, {{size}}, false);
+    CHECK_VARIABLES_APPROX(restricted_data, parent_data);
+  }
+}
+
+void test_restriction_from_both_children(
+    const Spectral::Quadrature quadrature, const size_t num_points_child,
+    const size_t num_points_parent) {
+  CAPTURE(quadrature);
+  CAPTURE(num_points_child);
+  CAPTURE(num_points_parent);
+  const Mesh<1> child_mesh{num_points_child, Spectral::Basis::Legendre,
+                           quadrature};
+  const Mesh<1> parent_mesh{num_points_parent, Spectral::Basis::Legendre,
+                            quadrature};
+  const auto& parent_coords = Spectral::collocation_points(parent_mesh);
+  const auto& child_logical_coords = Spectral::collocation_points(child_mesh);
+  using Vars = Variables<tmpl::list<ScalarField>>;
+  Vars parent_data{num_points_parent};
+  get(get<ScalarField>(parent_data)) = polynomial(parent_coords);
+  Vars restricted_data{num_points_parent, 0.};
+  Vars restricted_massive_data{num_points_parent, 0.};
+  for (const auto size :
+       {Spectral::MortarSize::LowerHalf, Spectral::MortarSize::UpperHalf}) {
+    CAPTURE(size);
+    const double offset = size == Spectral::MortarSize::UpperHalf ? 0.5 : -0.5;
+    Vars child_data{num_points_child};
+    get(get<ScalarField>(child_data)) =
+        polynomial(0.5 * child_logical_coords + offset);
+    restricted_data += restrict_to_parent(child_data, child_mesh, parent_mesh,
+                                          {{size}}, false);
+    // The child covers half the parent, so its Jacobian is 1/2
+    get(get<ScalarField>(child_data)) *=
+        0.5 * Spectral::quadrature_weights(child_mesh);
+    restricted_massive_data += restrict_to_parent(
+        child_data, child_mesh, parent_mesh, {{size}}, true);
+  }
+  {
+    INFO("Restriction of a smooth field reproduces the field on the parent");
+    CHECK_VARIABLES_APPROX(restricted_data, parent_data);
+  }
+  if (quadrature == Spectral::Quadrature::Gauss) {
+    // Gauss quadrature integrates the mass matrix exactly, so the Galerkin
+    // coarse-grid mass matrix is the mass matrix on the parent
+    INFO("Restriction of a massive field reproduces the massive field");
+    get(get<ScalarField>(parent_data)) *=
+        Spectral::quadrature_weights(parent_mesh);
+    CHECK_VARIABLES_APPROX(restricted_massive_data, parent_data);
+  }
+}
+
+template <size_t Dim>
+void test_child_size() {
+  CAPTURE(Dim);
+  std::array<SegmentId, Dim> parent_segment_ids{};
+  std::array<SegmentId, Dim> child_segment_ids{};
+  std::array<Spectral::MortarSize, Dim> expected_child_size{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(parent_segment_ids, d) = SegmentId{1, d % 2};
+    if (d == 0) {
+      gsl::at(child_segment_ids, d) = gsl::at(parent_segment_ids, d);
+      gsl::at(expected_child_size, d) = Spectral::MortarSize::Full;
+    } else if (d == 1) {
+      gsl::at(child_segment_ids, d) =
+          gsl::at(parent_segment_ids, d).id_of_child(Side::Lower);
+      gsl::at(expected_child_size, d) = Spectral::MortarSize::LowerHalf;
+    } else {
+      gsl::at(child_segment_ids, d) =
+          gsl::at(parent_segment_ids, d).id_of_child(Side::Upper);
+      gsl::at(expected_child_size, d) = Spectral::MortarSize::UpperHalf;
+    }
+  }
+  CHECK(child_size(child_segment_ids, parent_segment_ids) ==
+        expected_child_size);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelMultigrid.TransferOperators",
+                  "[Unit][ParallelAlgorithms][LinearSolver]") {
+  test_child_size<1>();
+  test_child_size<2>();
+  test_child_size<3>();
+  for (const auto quadrature :
+       {Spectral::Quadrature::Gauss, Spectral::Quadrature::GaussLobatto}) {
+    for (const auto size :
+         {Spectral::MortarSize::Full, Spectral::MortarSize::LowerHalf,
+          Spectral::MortarSize::UpperHalf}) {
+      test_transfer(quadrature, 4, 4, size);
+      test_transfer(quadrature, 6, 4, size);
+    }
+    test_restriction_from_both_children(quadrature, 4, 4);
+    test_restriction_from_both_children(quadrature, 6, 4);
+  }
+  {
+    INFO("Identity");
+    const Mesh<1> mesh{3, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+    CHECK(prolongation_matrix(mesh, mesh, Spectral::MortarSize::Full).rows() ==
+          0);
+    CHECK(restriction_matrix(mesh, mesh, Spectral::MortarSize::Full, false)
+              .rows() == 0);
+    CHECK(restriction_matrix(mesh, mesh, Spectral::MortarSize::Full, true)
+              .rows() == 0);
+  }
+}
+
+}  // namespace LinearSolver::multigrid
@@ -0,0 +1,191 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/MessageAggregation/Actions.hpp"
+#include "ParallelAlgorithms/MessageAggregation/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+
+struct TemporalIdTag : db::SimpleTag {
+  using type = size_t;
+};
+
+struct ReceiveTag : Parallel::InboxInserters::Pushback<ReceiveTag> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, std::vector<double>>;
+};
+
+template <typename Metavariables>
+struct MockAggregator;
+
+template <typename Metavariables>
+struct ElementArray {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<
+              ActionTesting::InitializeDataBox<tmpl::list<TemporalIdTag>>,
+              MessageAggregation::Actions::RegisterWithAggregator<
+                  MockAggregator<Metavariables>>>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          tmpl::list<MessageAggregation::Actions::SendAggregatedData<
+              MockAggregator<Metavariables>, TemporalIdTag>>>>;
+};
+
+template <typename Metavariables>
+struct MockAggregator {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = size_t;
+  using receive_tag = ReceiveTag;
+  using receive_data_type = double;
+  using element_component = ElementArray<Metavariables>;
+  using buffer_tag =
+      MessageAggregation::Tags::Buffer<ReceiveTag, size_t, double>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<Actions::SetupDataBox,
+                     MessageAggregation::Actions::InitializeAggregator<
+                         buffer_tag>>>,
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Testing, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementArray<Metavariables>,
+                                    MockAggregator<Metavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.MessageAggregation.Actions",
+                  "[Unit][ParallelAlgorithms][Actions]") {
+  using element_array = ElementArray<Metavariables>;
+  using aggregator = MockAggregator<Metavariables>;
+  using buffer_tag = typename aggregator::buffer_tag;
+
+  // Two mocked cores. Elements 0 and 1 live on core 0 and element 2 lives on
+  // core 1.
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}, {}, {2}};
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Initialization);
+  ActionTesting::emplace_group_component<aggregator>(&runner);
+  for (size_t proc = 0; proc < 2; ++proc) {
+    for (size_t i = 0; i < 2; ++i) {
+      ActionTesting::next_action<aggregator>(make_not_null(&runner), proc);
+    }
+  }
+  const std::vector<size_t> element_procs{0, 0, 1};
+  for (size_t element = 0; element < element_procs.size(); ++element) {
+    ActionTesting::emplace_array_component_and_initialize<element_array>(
+        &runner, ActionTesting::NodeId{0},
+        ActionTesting::LocalCoreId{element_procs[element]}, element,
+        {size_t{0}});
+    ActionTesting::next_action<element_array>(make_not_null(&runner), element);
+  }
+
+  const auto get_buffer = [&runner](const size_t proc) noexcept
+      -> const typename buffer_tag::type& {
+    return ActionTesting::get_databox_tag<aggregator, buffer_tag>(runner,
+                                                                  proc);
+  };
+  const auto invoke_all_queued_simple_actions =
+      [&runner](const size_t proc) noexcept {
+        size_t count = 0;
+        while (not ActionTesting::is_simple_action_queue_empty<aggregator>(
+            runner, proc)) {
+          ActionTesting::invoke_queued_simple_action<aggregator>(
+              make_not_null(&runner), proc);
+          ++count;
+        }
+        return count;
+      };
+  const auto get_inbox = [&runner](const size_t element) noexcept
+      -> const typename ReceiveTag::type& {
+    return ActionTesting::get_inbox_tag<element_array, ReceiveTag>(runner,
+                                                                   element);
+  };
+
+  {
+    INFO("RegisterWithAggregator and RegisterSender");
+    for (size_t element = 0; element < element_procs.size(); ++element) {
+      ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                                element);
+    }
+    CHECK(invoke_all_queued_simple_actions(0) == 2);
+    CHECK(invoke_all_queued_simple_actions(1) == 1);
+    CHECK(get_buffer(0).number_of_senders() == 2);
+    CHECK(get_buffer(1).number_of_senders() == 1);
+  }
+
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+
+  {
+    INFO("BufferData");
+    // Element 0 sends to elements 1 and 2, element 1 sends to element 0 and
+    // element 2 sends to element 0
+    using MessageAggregation::Actions::BufferData;
+    ActionTesting::simple_action<aggregator, BufferData>(
+        make_not_null(&runner), 0, 0, size_t{0}, size_t{1}, 1.);
+    ActionTesting::simple_action<aggregator, BufferData>(
+        make_not_null(&runner), 0, 1, size_t{0}, size_t{2}, 2.);
+    ActionTesting::simple_action<aggregator, BufferData>(
+        make_not_null(&runner), 0, 0, size_t{0}, size_t{0}, 3.);
+    ActionTesting::simple_action<aggregator, BufferData>(
+        make_not_null(&runner), 1, 0, size_t{0}, size_t{0}, 4.);
+    CHECK_FALSE(get_buffer(0).empty());
+    CHECK_FALSE(get_buffer(1).empty());
+  }
+  {
+    INFO("SendAggregatedData and SenderDone");
+    // Nothing is sent until both elements on core 0 are done
+    ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
+    CHECK(invoke_all_queued_simple_actions(0) == 1);
+    CHECK(ActionTesting::is_simple_action_queue_empty<aggregator>(runner, 0));
+    CHECK(ActionTesting::is_simple_action_queue_empty<aggregator>(runner, 1));
+    CHECK_FALSE(get_buffer(0).empty());
+    ActionTesting::next_action<element_array>(make_not_null(&runner), 1);
+    ActionTesting::invoke_queued_simple_action<aggregator>(
+        make_not_null(&runner), 0);
+    CHECK(get_buffer(0).empty());
+    // Core 0 sends one message to itself and one to core 1
+    CHECK_FALSE(
+        ActionTesting::is_simple_action_queue_empty<aggregator>(runner, 0));
+    CHECK_FALSE(
+        ActionTesting::is_simple_action_queue_empty<aggregator>(runner, 1));
+  }
+  {
+    INFO("ReceiveAggregatedData");
+    CHECK(invoke_all_queued_simple_actions(0) == 1);
+    CHECK(invoke_all_queued_simple_actions(1) == 1);
+    CHECK(get_inbox(0) == typename ReceiveTag::type{{0, {3.}}});
+    CHECK(get_inbox(1) == typename ReceiveTag::type{{0, {1.}}});
+    CHECK(get_inbox(2) == typename ReceiveTag::type{{0, {2.}}});
+    // The only element on core 1 is done, so its data is sent to core 0
+    ActionTesting::next_action<element_array>(make_not_null(&runner), 2);
+    CHECK(invoke_all_queued_simple_actions(1) == 1);
+    CHECK(get_buffer(1).empty());
+    CHECK(invoke_all_queued_simple_actions(0) == 1);
+    CHECK(get_inbox(0) == typename ReceiveTag::type{{0, {3., 4.}}});
+  }
+}
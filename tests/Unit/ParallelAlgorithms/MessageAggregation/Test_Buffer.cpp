@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "ParallelAlgorithms/MessageAggregation/Buffer.hpp"
+
+namespace MessageAggregation {
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.MessageAggregation.Buffer",
+                  "[Unit][ParallelAlgorithms]") {
+  using BufferType = Buffer<size_t, int, std::string>;
+  using Message = typename BufferType::message_type;
+  using Messages = std::unordered_map<int, Message>;
+  BufferType buffer{};
+  CHECK(buffer.empty());
+  buffer.register_sender(1);
+  buffer.register_sender(2);
+  CHECK(buffer.number_of_senders() == 2);
+  CHECK(buffer.extract_completed().empty());
+
+  // First sender sends to two PEs at temporal id 0, and already to one PE at
+  // temporal id 1
+  buffer.insert(0, 0, 1, "a");
+  buffer.insert(1, 0, 2, "b");
+  buffer.insert(0, 0, 3, "c");
+  buffer.insert(1, 1, 2, "d");
+  buffer.sender_done(1, 0);
+  CHECK(buffer.extract_completed().empty());
+  CHECK_FALSE(buffer.empty());
+
+  // Check serialization while data is pending
+  buffer = serialize_and_deserialize(buffer);
+  CHECK(buffer.number_of_senders() == 2);
+
+  // Second sender sends to one PE at temporal id 0
+  buffer.insert(1, 0, 4, "e");
+  buffer.sender_done(2, 0);
+  CHECK(buffer.extract_completed() ==
+        std::map<int, Messages>{
+            {0, Messages{{0, Message{{1, "a"}, {3, "c"}}},
+                         {1, Message{{2, "b"}, {4, "e"}}}}}});
+  CHECK(buffer.extract_completed().empty());
+  CHECK_FALSE(buffer.empty());
+
+  // Temporal id 1 is still pending
+  buffer.sender_done(1, 1);
+  CHECK(buffer.extract_completed().empty());
+  buffer.sender_done(2, 1);
+  CHECK(buffer.extract_completed() ==
+        std::map<int, Messages>{{1, Messages{{1, Message{{2, "d"}}}}}});
+  CHECK(buffer.empty());
+
+  // The second sender skips temporal id 2, which is complete once it is done
+  // at a later temporal id
+  buffer.insert(0, 2, 3, "f");
+  buffer.sender_done(1, 2);
+  CHECK(buffer.extract_completed().empty());
+  buffer.insert(1, 3, 1, "g");
+  buffer.sender_done(2, 3);
+  CHECK(buffer.extract_completed() ==
+        std::map<int, Messages>{{2, Messages{{0, Message{{3, "f"}}}}}});
+  buffer.sender_done(1, 3);
+  CHECK(buffer.extract_completed() ==
+        std::map<int, Messages>{{3, Messages{{1, Message{{1, "g"}}}}}});
+  CHECK(buffer.empty());
+}
+
+// [[OutputRegex, is not registered on this processing element]]
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.MessageAggregation.Buffer.Migrated",
+                  "[Unit][ParallelAlgorithms]") {
+  ERROR_TEST();
+  Buffer<size_t, int, std::string> buffer{};
+  buffer.register_sender(1);
+  buffer.sender_done(2, 0);
+}
+
+}  // namespace MessageAggregation
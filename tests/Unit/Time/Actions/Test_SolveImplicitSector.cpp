@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Time/Actions/SolveImplicitSector.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/Ars222.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+// IWYU pragma: no_forward_declare ActionTesting::InitializeDataBox
+
+namespace {
+struct Var : db::SimpleTag {
+  using type = double;
+};
+
+struct RelaxationRate : db::SimpleTag {
+  using type = double;
+};
+
+// The source S(t, u) = -kappa (u - t), solved exactly
+struct System {
+  using variables_tag = Var;
+
+  struct implicit_sector {
+    using argument_tags = tmpl::list<RelaxationRate>;
+    static void apply(const gsl::not_null<double*> u,
+                      const gsl::not_null<double*> source,
+                      const double implicit_weight, const double time,
+                      const double kappa) noexcept {
+      *u = (*u + implicit_weight * kappa * time) /
+           (1.0 + implicit_weight * kappa);
+      *source = -kappa * (*u - time);
+    }
+  };
+};
+
+using history_tag = Tags::ImplicitHistory<Var>;
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tags =
+      tmpl::list<Tags::TimeStepper<ImexTimeStepper>>;
+  using simple_tags =
+      db::AddSimpleTags<Tags::TimeStepId, Tags::Next<Tags::TimeStepId>,
+                        Tags::TimeStep, Var, history_tag, RelaxationRate>;
+
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Testing,
+                             tmpl::list<Actions::SolveImplicitSector<>>>>;
+};
+
+struct Metavariables {
+  using system = System;
+  using component_list = tmpl::list<Component<Metavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.Actions.SolveImplicitSector",
+                  "[Unit][Time][Actions]") {
+  Parallel::register_derived_classes_with_charm<TimeStepper>();
+
+  using component = Component<Metavariables>;
+  using simple_tags = typename component::simple_tags;
+  const TimeSteppers::Ars222 stepper{};
+  const double gamma = 1.0 - 1.0 / sqrt(2.0);
+  const double kappa = 4.0;
+
+  const Slab slab(1., 3.);
+  const TimeDelta time_step = slab.duration() / 2;
+  const double dt = time_step.value();
+  const TimeStepId substep_0(true, 0, slab.start());
+  const TimeStepId substep_1 = stepper.next_time_id(substep_0, time_step);
+  const TimeStepId next_step = stepper.next_time_id(substep_1, time_step);
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {std::make_unique<TimeSteppers::Ars222>()}};
+  ActionTesting::emplace_component_and_initialize<component>(
+      &runner, 0,
+      {substep_0, substep_1, time_step, 2.0, history_tag::type{}, kappa});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+
+  // First implicit stage, at the time of substep 1
+  const double time_1 = substep_1.substep_time().value();
+  const double expected_u_1 =
+      (2.0 + gamma * dt * kappa * time_1) / (1.0 + gamma * dt * kappa);
+  const double expected_source_1 = -kappa * (expected_u_1 - time_1);
+  runner.next_action<component>(0);
+  {
+    const auto& box = ActionTesting::get_databox<component, simple_tags>(
+        make_not_null(&runner), 0);
+    CHECK(db::get<Var>(box) == approx(expected_u_1));
+    REQUIRE(db::get<history_tag>(box).size() == 1);
+    CHECK(db::get<history_tag>(box)[0] == approx(expected_source_1));
+  }
+
+  // Second implicit stage, at the end of the step.  Set the variables to
+  // a new explicit update.
+  auto& box = ActionTesting::get_databox<component, simple_tags>(
+      make_not_null(&runner), 0);
+  db::mutate<Tags::TimeStepId, Tags::Next<Tags::TimeStepId>, Var>(
+      make_not_null(&box),
+      [&next_step, &substep_1](const gsl::not_null<TimeStepId*> time_step_id,
+                               const gsl::not_null<TimeStepId*> next_time_id,
+                               const gsl::not_null<double*> var) noexcept {
+        *time_step_id = substep_1;
+        *next_time_id = next_step;
+        *var = 3.0;
+      });
+  const double time_2 = next_step.substep_time().value();
+  const double inhomogeneous = 3.0 + (1.0 - gamma) * dt * expected_source_1;
+  runner.next_action<component>(0);
+  CHECK(db::get<Var>(box) ==
+        approx((inhomogeneous + gamma * dt * kappa * time_2) /
+               (1.0 + gamma * dt * kappa)));
+  CHECK(db::get<history_tag>(box).empty());
+}
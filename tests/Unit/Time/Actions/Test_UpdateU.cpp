@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -19,6 +20,7 @@
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
 #include "Time/Actions/UpdateU.hpp"  // IWYU pragma: keep
 #include "Time/Slab.hpp"
+#include "Time/StepperErrorTolerances.hpp"
 #include "Time/Tags.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
@@ -91,12 +93,34 @@ struct ComponentWithTemplateSpecifiedVariables {
                              tmpl::list<Actions::UpdateU<AlternativeVar>>>>;
 };
 
+template <typename Metavariables>
+struct ComponentWithErrorControl {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using simple_tags =
+      db::AddSimpleTags<Tags::TimeStep, variables_tag, history_tag,
+                        Tags::StepperError<variables_tag>,
+                        Tags::StepperErrorMeasure<variables_tag>,
+                        Tags::PreviousStepperError<variables_tag>,
+                        Tags::StepperErrorTolerances<variables_tag>,
+                        Tags::StepperErrorUpdated>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Testing,
+                             tmpl::list<Actions::UpdateU<>>>>;
+};
+
 struct Metavariables {
   using system = System;
   using time_stepper_tag = Tags::TimeStepper<TimeStepper>;
   using component_list =
       tmpl::list<Component<Metavariables>,
-                 ComponentWithTemplateSpecifiedVariables<Metavariables>>;
+                 ComponentWithTemplateSpecifiedVariables<Metavariables>,
+                 ComponentWithErrorControl<Metavariables>>;
   enum class Phase { Initialization, Testing, Exit };
 };
 }  // namespace
@@ -114,6 +138,8 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.UpdateU", "[Unit][Time][Actions]") {
   using component = Component<Metavariables>;
   using component_with_template_specified_variables =
       ComponentWithTemplateSpecifiedVariables<Metavariables>;
+  using component_with_error_control = ComponentWithErrorControl<Metavariables>;
+  using error_simple_tags = typename component_with_error_control::simple_tags;
   using simple_tags = typename component::simple_tags;
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
   MockRuntimeSystem runner{{std::make_unique<TimeSteppers::RungeKutta3>()}};
@@ -123,6 +149,10 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.UpdateU", "[Unit][Time][Actions]") {
   ActionTesting::emplace_component_and_initialize<
       component_with_template_specified_variables>(
       &runner, 0, {time_step, 1., alternative_history_tag::type{3}});
+  ActionTesting::emplace_component_and_initialize<component_with_error_control>(
+      &runner, 0,
+      {time_step, 1., history_tag::type{3}, 4., std::optional<double>{0.5},
+       std::optional<double>{}, StepperErrorTolerances{0.5, 0.25}, false});
   ActionTesting::set_phase(make_not_null(&runner),
                            Metavariables::Phase::Testing);
 
@@ -163,8 +193,24 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.UpdateU", "[Unit][Time][Actions]") {
         },
         db::get<alternative_variables_tag>(alternative_before_box));
 
+    auto& error_before_box =
+        ActionTesting::get_databox<component_with_error_control,
+                                   error_simple_tags>(make_not_null(&runner),
+                                                      0);
+    db::mutate<history_tag>(
+        make_not_null(&error_before_box),
+        [&rhs, &substep, &substep_times](
+            const gsl::not_null<typename history_tag::type*> history,
+            const double vars) noexcept {
+          const Time& time = gsl::at(substep_times, substep);
+          history->insert(TimeStepId(true, 0, substep_times[0], substep, time),
+                          vars, rhs(time.value(), vars));
+        },
+        db::get<variables_tag>(error_before_box));
+
     runner.next_action<component>(0);
     runner.next_action<component_with_template_specified_variables>(0);
+    runner.next_action<component_with_error_control>(0);
     const auto& box =
         ActionTesting::get_databox<component, simple_tags>(runner, 0);
     auto& alternative_box = ActionTesting::get_databox<
@@ -177,5 +223,34 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.UpdateU", "[Unit][Time][Actions]") {
 
     CHECK(db::get<alternative_variables_tag>(alternative_box) ==
           approx(gsl::at(expected_values, substep)));
+
+    // The RK3 error estimate is only available on the final substep, and
+    // compares against the second-order solution
+    // u^n + dt (RHS(u^n, t^n) + RHS(v^(1), t^n + dt)) / 2 = 1 + (2 + 6) / 2.
+    const auto& error_box =
+        ActionTesting::get_databox<component_with_error_control,
+                                   error_simple_tags>(runner, 0);
+    CHECK(db::get<variables_tag>(error_box) ==
+          approx(gsl::at(expected_values, substep)));
+    // The estimate is measured relative to the scale
+    // 0.5 + 0.25 * 10 / 3 = 4 / 3, and the previous measure is kept.
+    const auto& error_measure =
+        db::get<Tags::StepperErrorMeasure<variables_tag>>(error_box);
+    const auto& previous_error =
+        db::get<Tags::PreviousStepperError<variables_tag>>(error_box);
+    REQUIRE(error_measure.has_value());
+    if (substep < 2) {
+      CHECK_FALSE(db::get<Tags::StepperErrorUpdated>(error_box));
+      CHECK(db::get<Tags::StepperError<variables_tag>>(error_box) == 4.);
+      CHECK(*error_measure == 0.5);
+      CHECK_FALSE(previous_error.has_value());
+    } else {
+      CHECK(db::get<Tags::StepperErrorUpdated>(error_box));
+      CHECK(db::get<Tags::StepperError<variables_tag>>(error_box) ==
+            approx(10. / 3. - 5.));
+      CHECK(*error_measure == approx(1.25));
+      REQUIRE(previous_error.has_value());
+      CHECK(*previous_error == 0.5);
+    }
   }
 }
@@ -0,0 +1,217 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Time/Actions/ChangeStepSize.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/StepChoosers/ErrorControl.hpp"
+#include "Time/StepChoosers/StepChooser.hpp"
+#include "Time/StepControllers/BinaryFraction.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforthN.hpp"
+#include "Time/TimeSteppers/RungeKutta3.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeVector.hpp"
+#include "Utilities/TMPL.hpp"
+
+// IWYU pragma: no_include <pup.h>
+
+namespace {
+struct EvolvedVar : db::SimpleTag {
+  using type = DataVector;
+};
+
+using step_choosers =
+    tmpl::list<StepChoosers::Registrars::ErrorControl<EvolvedVar>>;
+using StepChooserType = StepChooser<step_choosers>;
+using ErrorControl = StepChoosers::ErrorControl<EvolvedVar>;
+using change_step_size = Actions::ChangeStepSize<step_choosers>;
+
+struct Metavariables {
+  using component_list = tmpl::list<>;
+};
+
+struct System {
+  using variables_tag = EvolvedVar;
+};
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tags = tmpl::list<Tags::TimeStepper<LtsTimeStepper>>;
+  using simple_tags =
+      tmpl::list<Tags::TimeStepId, Tags::Next<Tags::TimeStepId>,
+                 Tags::TimeStep, Tags::HistoryEvolvedVariables<EvolvedVar>,
+                 EvolvedVar, Tags::StepperErrorMeasure<EvolvedVar>,
+                 Tags::PreviousStepperError<EvolvedVar>,
+                 Tags::StepperErrorUpdated>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Testing,
+                             tmpl::list<change_step_size>>>;
+};
+
+struct LtsMetavariables {
+  using system = System;
+  static constexpr bool local_time_stepping = true;
+  using const_global_cache_tags = change_step_size::const_global_cache_tags;
+  using component_list = tmpl::list<Component<LtsMetavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+constexpr double max_factor = 5.0;
+constexpr double min_factor = 0.2;
+constexpr double safety_factor = 0.9;
+
+void check(const std::optional<double>& error,
+           const std::optional<double>& previous_error,
+           const bool error_updated, const double last_step,
+           const std::pair<double, bool>& expected) noexcept {
+  CAPTURE(error);
+  CAPTURE(previous_error);
+  CAPTURE(error_updated);
+  const Parallel::GlobalCache<Metavariables> cache{};
+  const ErrorControl error_control{max_factor, min_factor, safety_factor};
+  const std::unique_ptr<StepChooserType> error_control_base =
+      std::make_unique<ErrorControl>(error_control);
+
+  const TimeSteppers::RungeKutta3 time_stepper{};
+  const auto box = db::create<db::AddSimpleTags<
+      Tags::StepperErrorMeasure<EvolvedVar>,
+      Tags::PreviousStepperError<EvolvedVar>, Tags::StepperErrorUpdated,
+      Tags::TimeStepper<TimeStepper>>>(
+      error, previous_error, error_updated,
+      std::unique_ptr<TimeStepper>{
+          std::make_unique<TimeSteppers::RungeKutta3>()});
+
+  const auto check_result =
+      [&expected](const std::pair<double, bool>& result) noexcept {
+    CHECK(result.first == approx(expected.first));
+    CHECK(result.second == expected.second);
+  };
+  check_result(error_control(error, previous_error, error_updated,
+                             time_stepper, last_step, cache));
+  check_result(error_control_base->desired_step(last_step, box, cache));
+  check_result(serialize_and_deserialize(error_control)(
+      error, previous_error, error_updated, time_stepper, last_step, cache));
+  check_result(serialize_and_deserialize(error_control_base)
+                   ->desired_step(last_step, box, cache));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl", "[Unit][Time]") {
+  Parallel::register_derived_classes_with_charm<StepChooserType>();
+  Parallel::register_derived_classes_with_charm<TimeStepper>();
+
+  // RK3 has an order-2 error estimate.
+  const double order_plus_one = 3.0;
+  const double step = 0.5;
+
+  // No restriction until a new error estimate is available
+  check(0.01, std::nullopt, false, step,
+        {std::numeric_limits<double>::infinity(), true});
+  // Elementary controller without a previous estimate
+  check(0.01, std::nullopt, true, step,
+        {step * safety_factor * std::pow(0.01, -1.0 / order_plus_one), true});
+  // PI controller with a previous error measure of 0.1
+  check(0.01, 0.1, true, step,
+        {step * safety_factor * std::pow(0.01, -0.7 / order_plus_one) *
+             std::pow(0.1, 0.4 / order_plus_one),
+         true});
+  // PI controller computed by hand: with E_n = 1/8 and E_{n-1} = 1/64 the
+  // factor is 0.9 * 8^(0.7/3) * 64^(-0.4/3) = 0.9 * 2^0.7 * 2^(-0.8)
+  // = 0.9 * 2^(-0.1), so the step ratio is 0.83972969...
+  check(0.125, 0.015625, true, step, {step * 0.8397296923831267, true});
+  // After a previous error measure of 1 the step grows more cautiously than
+  // with the elementary controller, which would give 0.9 * 8^(1/3) = 1.8:
+  // with E_n = 1/8 the factor is 0.9 * 8^(0.7/3) = 0.9 * 2^0.7 = 1.46205...
+  check(0.125, 1.0, true, step, {step * 1.4620543134412238, true});
+  // Increase limited by the maximum factor
+  check(1.0e-12, std::nullopt, true, step, {step * max_factor, true});
+  // Steps that exceed the tolerance with an error measure of 2 are kept, but
+  // the next step shrinks
+  check(2.0, std::nullopt, true, step,
+        {step * safety_factor * std::pow(2.0, -1.0 / order_plus_one), true});
+  // Decrease limited by the minimum factor
+  check(100.0, std::nullopt, true, step, {step * min_factor, true});
+  // A vanishing error is limited by the maximum factor
+  check(0.0, 0.0, true, step, {step * max_factor, true});
+
+  TestHelpers::test_factory_creation<StepChooserType>(
+      "ErrorControl:\n"
+      "  MaxFactor: 5.0\n"
+      "  MinFactor: 0.2\n"
+      "  SafetyFactor: 0.9");
+}
+
+SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl.ChangeStepSize",
+                  "[Unit][Time]") {
+  Parallel::register_derived_classes_with_charm<StepChooserType>();
+  Parallel::register_derived_classes_with_charm<TimeStepper>();
+  Parallel::register_derived_classes_with_charm<StepController>();
+  using component = Component<LtsMetavariables>;
+
+  // AB2 has an order-1 error estimate
+  ActionTesting::MockRuntimeSystem<LtsMetavariables> runner{
+      {make_vector<std::unique_ptr<StepChooserType>>(
+           std::make_unique<ErrorControl>(max_factor, min_factor,
+                                          safety_factor)),
+       std::make_unique<StepControllers::BinaryFraction>(),
+       std::make_unique<TimeSteppers::AdamsBashforthN>(2)}};
+
+  // The last step went from the start of the slab to a quarter of the slab
+  const Slab slab(0.0, 1.0);
+  const Time time = slab.start() + slab.duration() / 4;
+  const TimeDelta step = slab.duration() / 4;
+  Tags::HistoryEvolvedVariables<EvolvedVar>::type history{2};
+  history.insert(TimeStepId(true, 0, slab.start()), DataVector{2.0},
+                 DataVector{-4.0});
+  // The error measure of the last step is 4, so it exceeded the tolerance
+  const DataVector values{1.0};
+  ActionTesting::emplace_component_and_initialize<component>(
+      &runner, 0,
+      {TimeStepId(true, 0, time), TimeStepId(true, 0, time + step), step,
+       std::move(history), values, std::optional<double>{4.0},
+       std::optional<double>{}, true});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           LtsMetavariables::Phase::Testing);
+  runner.next_action<component>(0);
+
+  // The step is kept, but the next step shrinks by the factor
+  // 0.9 * 4^(-1/2) = 0.45, which the controller quantizes to 1/16 of the slab
+  const auto get_tag = [&runner](auto tag_v) -> decltype(auto) {
+    using tag = std::decay_t<decltype(tag_v)>;
+    return ActionTesting::get_databox_tag<component, tag>(runner, 0);
+  };
+  CHECK(get_tag(Tags::TimeStepId{}) == TimeStepId(true, 0, time));
+  CHECK(get_tag(EvolvedVar{}) == values);
+  CHECK(get_tag(Tags::TimeStep{}) == slab.duration() / 16);
+  CHECK(get_tag(Tags::Next<Tags::TimeStepId>{}) ==
+        TimeStepId(true, 0, time + slab.duration() / 16));
+}
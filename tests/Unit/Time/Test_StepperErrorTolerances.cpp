@@ -0,0 +1,40 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "DataStructures/DataVector.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Time/StepperErrorTolerances.hpp"
+
+SPECTRE_TEST_CASE("Unit.Time.StepperErrorTolerances", "[Unit][Time]") {
+  const auto tolerances = TestHelpers::test_creation<StepperErrorTolerances>(
+      "AbsoluteTolerance: 0.5\n"
+      "RelativeTolerance: 0.25");
+  CHECK(tolerances.absolute_tolerance() == 0.5);
+  CHECK(tolerances.relative_tolerance() == 0.25);
+  CHECK(tolerances == StepperErrorTolerances{0.5, 0.25});
+  CHECK(tolerances != StepperErrorTolerances{0.5, 0.5});
+  CHECK(tolerances != StepperErrorTolerances{0.25, 0.25});
+  test_serialization(tolerances);
+
+  // The error scales are {0.75, 1.0}, so the measure is max(0.01, 0.008)
+  const DataVector values{1.0, -2.0};
+  CHECK(tolerances.error_measure(DataVector{0.0075, -0.008}, values) ==
+        approx(0.01));
+  CHECK(tolerances.error_measure(DataVector{0.0, -1.5}, values) ==
+        approx(1.5));
+  CHECK(tolerances.error_measure(DataVector{0.0, 0.0}, values) == 0.0);
+  CHECK(StepperErrorTolerances{1.0e-3, 0.0}.error_measure(
+            DataVector{4.0e-3}, DataVector{1.0}) == approx(4.0));
+}
+
+// [[OutputRegex, At least one of the tolerances must be positive]]
+SPECTRE_TEST_CASE("Unit.Time.StepperErrorTolerances.ZeroTolerances",
+                  "[Unit][Time]") {
+  ERROR_TEST();
+  TestHelpers::test_creation<StepperErrorTolerances>(
+      "AbsoluteTolerance: 0.0\n"
+      "RelativeTolerance: 0.0");
+}
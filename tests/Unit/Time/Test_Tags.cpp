@@ -43,4 +43,14 @@ SPECTRE_TEST_CASE("Unit.Time.Tags", "[Unit][Time]") {
   TestHelpers::db::test_simple_tag<Tags::StepChoosers<DummyType>>(
       "StepChoosers");
   TestHelpers::db::test_simple_tag<Tags::StepController>("StepController");
+  TestHelpers::db::test_prefix_tag<Tags::StepperError<DummyTag>>(
+      "StepperError(DummyTag)");
+  TestHelpers::db::test_prefix_tag<Tags::StepperErrorMeasure<DummyTag>>(
+      "StepperErrorMeasure(DummyTag)");
+  TestHelpers::db::test_prefix_tag<Tags::PreviousStepperError<DummyTag>>(
+      "PreviousStepperError(DummyTag)");
+  TestHelpers::db::test_prefix_tag<Tags::StepperErrorTolerances<DummyTag>>(
+      "StepperErrorTolerances(DummyTag)");
+  TestHelpers::db::test_simple_tag<Tags::StepperErrorUpdated>(
+      "StepperErrorUpdated");
 }
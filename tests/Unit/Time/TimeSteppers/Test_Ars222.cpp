@@ -0,0 +1,107 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/Time/TimeSteppers/TimeStepperTestUtils.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/Ars222.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+// Integrates dy/dt = cos(t) - kappa (y - sin(t)) from y(0) = 0 to t = 1,
+// treating the relaxation term implicitly, and returns the error with
+// respect to the solution y = sin(t).  This follows the sequence of
+// operations of Actions::UpdateU and Actions::SolveImplicitSector.
+double imex_error(const ImexTimeStepper& stepper, const double kappa,
+                  const int32_t num_steps) noexcept {
+  const Slab slab(0., 1.);
+  const TimeDelta step_size = slab.duration() / num_steps;
+  TimeStepId time_id(true, 0, slab.start());
+  double y = 0.0;
+  TimeSteppers::History<double, double> history{stepper.order()};
+  std::vector<double> implicit_history{};
+
+  while (time_id.substep_time() < slab.end()) {
+    const double t = time_id.substep_time().value();
+    history.insert(time_id, y, cos(t));
+    stepper.update_u(make_not_null(&y), make_not_null(&history), step_size);
+
+    const uint64_t substep = time_id.substep();
+    const TimeStepId next_time_id = stepper.next_time_id(time_id, step_size);
+    const double dt = step_size.value();
+    for (uint64_t i = 0; i < substep; ++i) {
+      y += stepper.implicit_coefficient(substep, i) * dt *
+           implicit_history[i];
+    }
+    // Exact solve of y = y* - w kappa (y - sin(t))
+    const double weight = stepper.implicit_weight(substep) * dt;
+    const double implicit_time = next_time_id.substep_time().value();
+    y = (y + weight * kappa * sin(implicit_time)) / (1.0 + weight * kappa);
+    if (substep + 1 == stepper.number_of_substeps()) {
+      implicit_history.clear();
+    } else {
+      implicit_history.push_back(-kappa * (y - sin(implicit_time)));
+    }
+    time_id = next_time_id;
+  }
+  return std::abs(y - sin(1.0));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.Ars222", "[Unit][Time]") {
+  const TimeSteppers::Ars222 stepper{};
+
+  // Without implicit terms the method is an explicit second-order
+  // Runge-Kutta method
+  TimeStepperTestUtils::check_substep_properties(stepper);
+  TimeStepperTestUtils::integrate_test(stepper, 2, 0, 1., 1e-6);
+  TimeStepperTestUtils::integrate_test(stepper, 2, 0, -1., 1e-6);
+  TimeStepperTestUtils::integrate_test_explicit_time_dependence(stepper, 2, 0,
+                                                                -1.0, 1.0e-6);
+  TimeStepperTestUtils::integrate_variable_test(stepper, 2, 0, 1e-6);
+  TimeStepperTestUtils::stability_test(stepper);
+  TimeStepperTestUtils::check_convergence_order(stepper);
+
+  // Second-order convergence of the IMEX scheme for a non-stiff source
+  {
+    const double rate =
+        std::log2(imex_error(stepper, 1.0, 20) / imex_error(stepper, 1.0, 40));
+    CHECK(rate == approx(2.0).margin(0.2));
+  }
+  // The stiff source is stable and accurate at steps far beyond the
+  // explicit stability limit 2 / kappa
+  CHECK(imex_error(stepper, 1.0e8, 10) < 1.0e-8);
+  CHECK(imex_error(stepper, 1.0e3, 10) < 1.0e-4);
+
+  CHECK(stepper.order() == 2_st);
+  CHECK(stepper.implicit_weight(0) == approx(1.0 - 1.0 / sqrt(2.0)));
+  CHECK(stepper.implicit_weight(1) == approx(1.0 - 1.0 / sqrt(2.0)));
+  CHECK(stepper.implicit_coefficient(1, 0) == approx(1.0 / sqrt(2.0)));
+
+  TestHelpers::test_factory_creation<TimeStepper>("Ars222");
+  test_serialization(stepper);
+  test_serialization_via_base<TimeStepper, TimeSteppers::Ars222>();
+  // test operator !=
+  CHECK_FALSE(stepper != stepper);
+}
+
+// [[OutputRegex, Ars222 does not provide an error estimate]]
+[[noreturn]] SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.Ars222.ErrorEstimate",
+                               "[Unit][Time]") {
+  ERROR_TEST();
+  TimeSteppers::Ars222{}.error_estimate_order();
+  ERROR("Failed to trigger ERROR in an error test");
+}
@@ -3,13 +3,78 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/Time/TimeSteppers/TimeStepperTestUtils.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/DormandPrince5.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 
+namespace {
+// Error in the dense output at the middle of a single step of the
+// equation dy/dt = y when the derivative at the end of the step has
+// been recorded in the history.
+double dense_error_with_final_derivative(const TimeDelta& step) noexcept {
+  const TimeSteppers::DormandPrince5 stepper{};
+  const bool time_runs_forward = step.is_positive();
+  const Time start =
+      time_runs_forward ? step.slab().start() : step.slab().end();
+  TimeStepId time_id(time_runs_forward, 0, start);
+  TimeSteppers::History<double, double> history{stepper.order()};
+  double y = exp(start.value());
+  for (size_t substep = 0; substep < stepper.number_of_substeps();
+       ++substep) {
+    history.insert(time_id, y, y);
+    const TimeStepId next_time_id = stepper.next_time_id(time_id, step);
+    if (substep + 1 < stepper.number_of_substeps()) {
+      stepper.update_u(make_not_null(&y), make_not_null(&history), step);
+    } else {
+      stepper.dense_update_u(make_not_null(&y), history,
+                             next_time_id.substep_time().value());
+      CHECK(y == approx(exp(next_time_id.substep_time().value())));
+      history.insert(next_time_id, y, y);
+    }
+    time_id = next_time_id;
+  }
+
+  // The endpoints are reproduced exactly.
+  double y_dense = 0.0;
+  stepper.dense_update_u(make_not_null(&y_dense), history, start.value());
+  CHECK(y_dense == approx(exp(start.value())));
+  stepper.dense_update_u(make_not_null(&y_dense), history,
+                         (start + step).value());
+  CHECK(y_dense == approx(y));
+
+  const double time = start.value() + 0.5 * step.value();
+  stepper.dense_update_u(make_not_null(&y_dense), history, time);
+  return abs(y_dense - exp(time));
+}
+
+void test_dense_output_with_final_derivative() noexcept {
+  // With the derivative at the end of the step the interpolant is
+  // fourth order, so the error over a single step scales as the fifth
+  // power of the step size.
+  for (const double sign : {1.0, -1.0}) {
+    CAPTURE(sign);
+    const Slab slab(0.0, 0.1);
+    const double coarse_error = dense_error_with_final_derivative(
+        sign > 0.0 ? slab.duration() : -slab.duration());
+    const double fine_error = dense_error_with_final_derivative(
+        sign > 0.0 ? slab.duration() / 2 : -slab.duration() / 2);
+    CHECK(log2(coarse_error / fine_error) > 4.5);
+  }
+}
+}  // namespace
+
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.DormandPrince5", "[Unit][Time]") {
   const TimeSteppers::DormandPrince5 stepper{};
   TimeStepperTestUtils::check_substep_properties(stepper);
@@ -27,6 +92,7 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.DormandPrince5", "[Unit][Time]") {
   // The dense output is currently broken and does not converge at the
   // correct rate.
   //TimeStepperTestUtils::check_dense_output(stepper);
+  test_dense_output_with_final_derivative();
 
   CHECK(stepper.order() == 5_st);
   CHECK(stepper.error_estimate_order() == 4_st);